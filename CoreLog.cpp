@@ -0,0 +1,340 @@
+// ============================================================================
+// File: CoreLog.cpp
+// Project: SkullStepperV4 - ESP32-S3 Modular Stepper Control System
+// Version: 4.2.0
+// Date: 2026-10-15
+// Author: Tim Rosener
+// Description: Lock-free deferred logging for the Core 0 real-time tasks
+// License: MIT
+// ============================================================================
+
+#include "CoreLog.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+#include <atomic>
+
+namespace CoreLog {
+
+static_assert((CORE_LOG_RING_SIZE & (CORE_LOG_RING_SIZE - 1)) == 0,
+              "CORE_LOG_RING_SIZE must be a power of two");
+
+// ----------------------------------------------------------------------------
+// Private Module Variables
+// ----------------------------------------------------------------------------
+
+/**
+ * One ring slot. The sequence number says who owns it: equal to the write
+ * position when free, position + 1 once the record is published.
+ */
+struct Slot {
+    std::atomic<uint32_t> sequence;
+    uint32_t timeMs;
+    const char* format;
+    uint8_t level;
+    uint8_t argCount;
+    PackedArg args[CORE_LOG_MAX_ARGS];
+};
+
+struct HistoryLine {
+    uint32_t timeMs;
+    uint8_t level;
+    char text[CORE_LOG_LINE_LENGTH];
+};
+
+static Slot g_ring[CORE_LOG_RING_SIZE];
+static std::atomic<uint32_t> g_head(0);   // Next write position (producers)
+static std::atomic<uint32_t> g_tail(0);   // Next read position (drain task only)
+static std::atomic<bool> g_ready(false);
+
+static std::atomic<uint32_t> g_written(0);
+static std::atomic<uint32_t> g_dropped(0);
+static std::atomic<uint32_t> g_highWater(0);
+static uint32_t g_drained = 0;
+
+static HistoryLine g_history[CORE_LOG_HISTORY_LINES];
+static uint8_t g_historyNext = 0;
+static uint8_t g_historyCount = 0;
+static SemaphoreHandle_t g_historyMutex = NULL;
+
+static TaskHandle_t g_drainTaskHandle = NULL;
+
+// ----------------------------------------------------------------------------
+// Producer Side (any core)
+// ----------------------------------------------------------------------------
+
+bool push(uint8_t level, const char* format, const PackedArg* args, uint8_t argCount) {
+    if (!g_ready.load(std::memory_order_acquire)) {
+        g_dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    // Claim a slot (bounded MPMC ring - a CAS on the head, no locks)
+    Slot* slot;
+    uint32_t pos = g_head.load(std::memory_order_relaxed);
+    for (;;) {
+        slot = &g_ring[pos & (CORE_LOG_RING_SIZE - 1)];
+        uint32_t seq = slot->sequence.load(std::memory_order_acquire);
+        int32_t diff = (int32_t)(seq - pos);
+        if (diff == 0) {
+            if (g_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            // Slot still holds a record from the previous lap - ring full
+            g_dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        } else {
+            pos = g_head.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->timeMs = millis();
+    slot->format = format;
+    slot->level = level;
+    slot->argCount = min(argCount, (uint8_t)CORE_LOG_MAX_ARGS);
+    memcpy(slot->args, args, slot->argCount * sizeof(PackedArg));
+    slot->sequence.store(pos + 1, std::memory_order_release);
+
+    g_written.fetch_add(1, std::memory_order_relaxed);
+
+    // Depth after this write; a racing update only loses a transient peak
+    uint32_t depth = pos + 1 - g_tail.load(std::memory_order_relaxed);
+    if (depth > g_highWater.load(std::memory_order_relaxed)) {
+        g_highWater.store(depth, std::memory_order_relaxed);
+    }
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+// Consumer Side (drain task on Core 1)
+// ----------------------------------------------------------------------------
+
+/**
+ * Take the oldest published record
+ * @return false if the ring is empty (or the oldest record is still being written)
+ */
+static bool pop(Slot& record) {
+    uint32_t pos = g_tail.load(std::memory_order_relaxed);
+    Slot& slot = g_ring[pos & (CORE_LOG_RING_SIZE - 1)];
+    uint32_t seq = slot.sequence.load(std::memory_order_acquire);
+    if ((int32_t)(seq - (pos + 1)) < 0) {
+        return false;
+    }
+
+    record.timeMs = slot.timeMs;
+    record.format = slot.format;
+    record.level = slot.level;
+    record.argCount = slot.argCount;
+    memcpy(record.args, slot.args, record.argCount * sizeof(PackedArg));
+
+    // Hand the slot back to producers for the next lap
+    slot.sequence.store(pos + CORE_LOG_RING_SIZE, std::memory_order_release);
+    g_tail.store(pos + 1, std::memory_order_relaxed);
+    return true;
+}
+
+/**
+ * Expand a record into text, one conversion at a time
+ * Length modifiers are ignored - every argument is 32 bits wide
+ */
+static void formatRecord(const Slot& record, char* out, size_t size) {
+    const char* p = record.format ? record.format : "";
+    size_t len = 0;
+    uint8_t argIndex = 0;
+
+    while (*p && len < size - 1) {
+        if (*p != '%') {
+            out[len++] = *p++;
+            continue;
+        }
+        if (p[1] == '%') {
+            out[len++] = '%';
+            p += 2;
+            continue;
+        }
+
+        // Copy flags, width and precision; drop length modifiers
+        char spec[16];
+        uint8_t specLen = 0;
+        const char* start = p;
+        spec[specLen++] = *p++;
+        while (*p && strchr("-+ #0123456789.", *p) && specLen < sizeof(spec) - 2) {
+            spec[specLen++] = *p++;
+        }
+        while (*p && strchr("hlLqjzt", *p)) {
+            p++;
+        }
+        char conversion = *p;
+        if (conversion == '\0' || argIndex >= record.argCount) {
+            // Malformed spec or missing argument - print it verbatim
+            size_t n = min((size_t)(p - start), size - 1 - len);
+            memcpy(out + len, start, n);
+            len += n;
+            if (conversion == '\0') break;
+            continue;
+        }
+        p++;
+        spec[specLen++] = conversion;
+        spec[specLen] = '\0';
+
+        PackedArg arg = record.args[argIndex++];
+        int written = 0;
+        switch (conversion) {
+            case 'd': case 'i':
+                written = snprintf(out + len, size - len, spec, (int)(int32_t)arg);
+                break;
+            case 'u': case 'x': case 'X': case 'o': case 'c':
+                written = snprintf(out + len, size - len, spec, (unsigned int)arg);
+                break;
+            case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': {
+                uint32_t bits = (uint32_t)arg;
+                float value;
+                memcpy(&value, &bits, sizeof(value));
+                written = snprintf(out + len, size - len, spec, (double)value);
+                break;
+            }
+            case 's': {
+                const char* text = (const char*)(uintptr_t)arg;
+                written = snprintf(out + len, size - len, spec, text ? text : "(null)");
+                break;
+            }
+            case 'p':
+                written = snprintf(out + len, size - len, spec, (void*)(uintptr_t)arg);
+                break;
+            default:
+                written = snprintf(out + len, size - len, "%s", spec);
+                break;
+        }
+        if (written > 0) {
+            len = min(len + (size_t)written, size - 1);
+        }
+    }
+
+    // Records keep the printf-style trailing newline - println adds its own
+    while (len > 0 && (out[len - 1] == '\n' || out[len - 1] == '\r')) {
+        len--;
+    }
+    out[len] = '\0';
+}
+
+static void addHistory(uint32_t timeMs, uint8_t level, const char* text) {
+    if (xSemaphoreTake(g_historyMutex, pdMS_TO_TICKS(5)) != pdTRUE) {
+        return;
+    }
+    HistoryLine& line = g_history[g_historyNext];
+    line.timeMs = timeMs;
+    line.level = level;
+    strncpy(line.text, text, sizeof(line.text) - 1);
+    line.text[sizeof(line.text) - 1] = '\0';
+    g_historyNext = (g_historyNext + 1) % CORE_LOG_HISTORY_LINES;
+    if (g_historyCount < CORE_LOG_HISTORY_LINES) g_historyCount++;
+    xSemaphoreGive(g_historyMutex);
+}
+
+static void drainTask(void* parameter) {
+    static Slot record;
+    static char line[CORE_LOG_LINE_LENGTH];
+    uint32_t reportedDrops = 0;
+
+    for (;;) {
+        while (pop(record)) {
+            formatRecord(record, line, sizeof(line));
+            Serial.println(line);
+            addHistory(record.timeMs, record.level, line);
+            g_drained++;
+        }
+
+        uint32_t dropped = g_dropped.load(std::memory_order_relaxed);
+        if (dropped != reportedDrops) {
+            Serial.printf("CoreLog: %lu records dropped (ring full)\n",
+                          (unsigned long)(dropped - reportedDrops));
+            reportedDrops = dropped;
+        }
+
+        vTaskDelay(pdMS_TO_TICKS(CORE_LOG_DRAIN_PERIOD_MS));
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Public Interface Functions
+// ----------------------------------------------------------------------------
+
+bool initialize() {
+    if (g_ready.load()) {
+        return true;
+    }
+
+    g_historyMutex = xSemaphoreCreateMutex();
+    if (g_historyMutex == NULL) {
+        Serial.println("CoreLog: ERROR - Failed to create history mutex");
+        return false;
+    }
+
+    for (uint32_t i = 0; i < CORE_LOG_RING_SIZE; i++) {
+        g_ring[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    BaseType_t result = xTaskCreatePinnedToCore(
+        drainTask,
+        "CoreLog",
+        CORE_LOG_TASK_STACK_SIZE,
+        NULL,
+        CORE_LOG_TASK_PRIORITY,
+        &g_drainTaskHandle,
+        1  // Core 1 - formatting and UART writes stay off the real-time core
+    );
+    if (result != pdPASS) {
+        Serial.println("CoreLog: ERROR - Failed to create drain task");
+        return false;
+    }
+
+    g_ready.store(true, std::memory_order_release);
+    return true;
+}
+
+void getStats(Stats& stats) {
+    stats.written = g_written.load(std::memory_order_relaxed);
+    stats.dropped = g_dropped.load(std::memory_order_relaxed);
+    stats.drained = g_drained;
+    stats.highWater = g_highWater.load(std::memory_order_relaxed);
+    stats.capacity = CORE_LOG_RING_SIZE;
+}
+
+const char* levelName(uint8_t level) {
+    switch (level) {
+        case CORE_LOG_LEVEL_ERROR: return "error";
+        case CORE_LOG_LEVEL_WARN:  return "warn";
+        case CORE_LOG_LEVEL_INFO:  return "info";
+        case CORE_LOG_LEVEL_DEBUG: return "debug";
+        default:                   return "none";
+    }
+}
+
+void exportJson(JsonObject out) {
+    Stats stats;
+    getStats(stats);
+    out["level"] = levelName(CORE_LOG_LEVEL);
+    out["written"] = stats.written;
+    out["dropped"] = stats.dropped;
+    out["drained"] = stats.drained;
+    out["highWater"] = stats.highWater;
+    out["capacity"] = stats.capacity;
+
+    JsonArray lines = out.createNestedArray("lines");
+    if (g_historyMutex == NULL ||
+        xSemaphoreTake(g_historyMutex, pdMS_TO_TICKS(10)) != pdTRUE) {
+        return;
+    }
+    uint8_t first = (g_historyNext + CORE_LOG_HISTORY_LINES - g_historyCount) % CORE_LOG_HISTORY_LINES;
+    for (uint8_t i = 0; i < g_historyCount; i++) {
+        HistoryLine& line = g_history[(first + i) % CORE_LOG_HISTORY_LINES];
+        JsonObject entry = lines.createNestedObject();
+        entry["t"] = line.timeMs;
+        entry["level"] = levelName(line.level);
+        entry["msg"] = line.text;  // char* - copied into the document
+    }
+    xSemaphoreGive(g_historyMutex);
+}
+
+} // namespace CoreLog
@@ -0,0 +1,193 @@
+// ============================================================================
+// File: CoreLog.h
+// Project: SkullStepperV4 - ESP32-S3 Modular Stepper Control System
+// Version: 4.2.0
+// Date: 2026-10-15
+// Author: Tim Rosener
+// Description: Lock-free deferred logging for the Core 0 real-time tasks
+// License: MIT
+//
+// Core 0 tasks must never block on the UART. CORE_LOG_* macros store a
+// binary record (format string pointer, level, timestamp and up to
+// CORE_LOG_MAX_ARGS 32-bit arguments) in a bounded lock-free ring and
+// return immediately. A Core 1 drain task formats the records, prints them
+// to Serial and keeps the most recent lines for the web interface. When
+// the ring is full the record is dropped and counted - producers never wait.
+//
+// Format strings and %s arguments must be string literals (or other static
+// storage): only their pointers are stored, the text is read on Core 1.
+// Levels above CORE_LOG_LEVEL (ProjectConfig.h) compile to nothing.
+// ============================================================================
+
+#ifndef CORELOG_H
+#define CORELOG_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <type_traits>
+#include "ProjectConfig.h"
+
+// ----------------------------------------------------------------------------
+// Log Levels
+// ----------------------------------------------------------------------------
+#define CORE_LOG_LEVEL_NONE   0
+#define CORE_LOG_LEVEL_ERROR  1
+#define CORE_LOG_LEVEL_WARN   2
+#define CORE_LOG_LEVEL_INFO   3
+#define CORE_LOG_LEVEL_DEBUG  4
+
+#ifndef CORE_LOG_LEVEL
+#define CORE_LOG_LEVEL CORE_LOG_LEVEL_INFO
+#endif
+
+// ----------------------------------------------------------------------------
+// Ring and Drain Configuration
+// ----------------------------------------------------------------------------
+#define CORE_LOG_RING_SIZE        128   // Records (power of two)
+#define CORE_LOG_MAX_ARGS         10    // Arguments per record
+#define CORE_LOG_LINE_LENGTH      160   // Formatted line, including terminator
+#define CORE_LOG_HISTORY_LINES    32    // Recent lines kept for /api/log
+#define CORE_LOG_DRAIN_PERIOD_MS  10    // Drain task poll period
+#define CORE_LOG_TASK_STACK_SIZE  4096
+#define CORE_LOG_TASK_PRIORITY    1
+
+// ============================================================================
+// CoreLog Namespace - Deferred Logging
+// ============================================================================
+
+namespace CoreLog {
+
+    // ------------------------------------------------------------------------
+    // Types
+    // ------------------------------------------------------------------------
+
+    /**
+     * Ring statistics (since boot)
+     */
+    struct Stats {
+        uint32_t written;    // Records accepted into the ring
+        uint32_t dropped;    // Records lost because the ring was full (or before initialize)
+        uint32_t drained;    // Records formatted and printed by the drain task
+        uint32_t highWater;  // Most records waiting in the ring at once
+        uint16_t capacity;   // Ring size in records
+    };
+
+    // ------------------------------------------------------------------------
+    // Argument Packing
+    // ------------------------------------------------------------------------
+
+    /**
+     * One packed argument - 32 bits on the ESP32, pointer-wide elsewhere
+     * so %s literals survive the 64-bit host build (extras/host)
+     */
+    typedef uintptr_t PackedArg;
+
+    /**
+     * Integers, bools and enums travel as their 32-bit value
+     */
+    template<typename T>
+    inline PackedArg packArg(T value) {
+        static_assert(std::is_integral<T>::value || std::is_enum<T>::value,
+                      "CoreLog arguments must be integers, floats or string literals");
+        return (PackedArg)(uint32_t)value;
+    }
+
+    /**
+     * Floating point travels as float bits (the drain task widens it again)
+     */
+    inline PackedArg packArg(float value) {
+        uint32_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+
+    inline PackedArg packArg(double value) {
+        return packArg((float)value);
+    }
+
+    /**
+     * Strings travel as a pointer - literals only
+     */
+    inline PackedArg packArg(const char* value) {
+        return (PackedArg)value;
+    }
+
+    // ------------------------------------------------------------------------
+    // Public Interface Functions
+    // ------------------------------------------------------------------------
+
+    /**
+     * Prepare the ring and start the Core 1 drain task
+     * Records written before this are dropped (and counted)
+     * @return true if the drain task is running
+     */
+    bool initialize();
+
+    /**
+     * Store one packed record (use the CORE_LOG_* macros instead)
+     * Lock-free and non-blocking, safe from any task on either core
+     * @param level CORE_LOG_LEVEL_* of the record
+     * @param format printf-style format string with static storage
+     * @param args Packed arguments
+     * @param argCount Number of packed arguments
+     * @return false if the record was dropped
+     */
+    bool push(uint8_t level, const char* format, const PackedArg* args, uint8_t argCount);
+
+    /**
+     * Pack the arguments and store a record
+     */
+    template<typename... Args>
+    inline bool write(uint8_t level, const char* format, Args... args) {
+        static_assert(sizeof...(Args) <= CORE_LOG_MAX_ARGS, "Too many CoreLog arguments");
+        const PackedArg packed[sizeof...(Args) + 1] = { packArg(args)..., 0 };
+        return push(level, format, packed, sizeof...(Args));
+    }
+
+    /**
+     * Get ring statistics
+     * @param stats Receives the counters
+     */
+    void getStats(Stats& stats);
+
+    /**
+     * Short level name for reports ("error", "warn", "info", "debug")
+     */
+    const char* levelName(uint8_t level);
+
+    /**
+     * Write the statistics and the recent lines (oldest first) as JSON
+     * @param out Object receiving the counters and a "lines" array
+     */
+    void exportJson(JsonObject out);
+
+} // namespace CoreLog
+
+// ----------------------------------------------------------------------------
+// Logging Macros
+// ----------------------------------------------------------------------------
+#if CORE_LOG_LEVEL >= CORE_LOG_LEVEL_ERROR
+#define CORE_LOG_ERROR(...) CoreLog::write(CORE_LOG_LEVEL_ERROR, __VA_ARGS__)
+#else
+#define CORE_LOG_ERROR(...) ((void)0)
+#endif
+
+#if CORE_LOG_LEVEL >= CORE_LOG_LEVEL_WARN
+#define CORE_LOG_WARN(...) CoreLog::write(CORE_LOG_LEVEL_WARN, __VA_ARGS__)
+#else
+#define CORE_LOG_WARN(...) ((void)0)
+#endif
+
+#if CORE_LOG_LEVEL >= CORE_LOG_LEVEL_INFO
+#define CORE_LOG_INFO(...) CoreLog::write(CORE_LOG_LEVEL_INFO, __VA_ARGS__)
+#else
+#define CORE_LOG_INFO(...) ((void)0)
+#endif
+
+#if CORE_LOG_LEVEL >= CORE_LOG_LEVEL_DEBUG
+#define CORE_LOG_DEBUG(...) CoreLog::write(CORE_LOG_LEVEL_DEBUG, __VA_ARGS__)
+#else
+#define CORE_LOG_DEBUG(...) ((void)0)
+#endif
+
+#endif // CORELOG_H
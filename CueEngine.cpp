@@ -0,0 +1,265 @@
+// ============================================================================
+// File: CueEngine.cpp
+// Project: SkullStepperV4 - ESP32-S3 Modular Stepper Control System
+// Version: 4.2.0
+// Date: 2026-10-15
+// Author: Tim Rosener
+// Description: PVT keyframe cue storage and interpolation implementation
+// License: MIT
+// ============================================================================
+
+#include "CueEngine.h"
+#include "InputValidation.h"
+#include <Preferences.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+namespace CueEngine {
+
+// Separate flash namespace so a config factory reset keeps show cues
+static const char* CUE_NAMESPACE = "skullcues";
+
+static CueTrack g_cues[MAX_CUES];
+static SemaphoreHandle_t g_cueMutex = NULL;
+static Preferences g_cuePreferences;
+
+/**
+ * Flash keys for a cue slot ("cue0" keyframes, "loop0" flag)
+ */
+static void cueKeys(uint8_t id, char* keyName, char* loopName) {
+    snprintf(keyName, 8, "cue%u", id);
+    snprintf(loopName, 8, "loop%u", id);
+}
+
+/**
+ * Write one cue slot to flash (removes the entry for an empty slot)
+ */
+static void saveTrack(uint8_t id, const CueTrack& track) {
+    char keyName[8], loopName[8];
+    cueKeys(id, keyName, loopName);
+
+    if (!g_cuePreferences.begin(CUE_NAMESPACE, false)) {
+        Serial.println("CueEngine: Failed to open flash storage");
+        return;
+    }
+    if (track.count == 0) {
+        g_cuePreferences.remove(keyName);
+        g_cuePreferences.remove(loopName);
+    } else {
+        g_cuePreferences.putBytes(keyName, track.keys, track.count * sizeof(Keyframe));
+        g_cuePreferences.putBool(loopName, track.loop);
+    }
+    g_cuePreferences.end();
+}
+
+bool initialize() {
+    if (g_cueMutex == NULL) {
+        g_cueMutex = xSemaphoreCreateMutex();
+        if (g_cueMutex == NULL) {
+            Serial.println("CueEngine: Failed to create mutex");
+            return false;
+        }
+    }
+
+    memset(g_cues, 0, sizeof(g_cues));
+
+    if (!g_cuePreferences.begin(CUE_NAMESPACE, true)) {
+        return true;  // Nothing stored yet
+    }
+    uint8_t loaded = 0;
+    for (uint8_t id = 0; id < MAX_CUES; id++) {
+        char keyName[8], loopName[8];
+        cueKeys(id, keyName, loopName);
+        size_t length = g_cuePreferences.getBytesLength(keyName);
+        if (length == 0 || length % sizeof(Keyframe) != 0 ||
+            length > sizeof(g_cues[id].keys)) {
+            continue;
+        }
+        g_cuePreferences.getBytes(keyName, g_cues[id].keys, length);
+        g_cues[id].count = length / sizeof(Keyframe);
+        g_cues[id].loop = g_cuePreferences.getBool(loopName, false);
+        loaded++;
+    }
+    g_cuePreferences.end();
+
+    Serial.printf("CueEngine: %d cue(s) loaded from flash\n", loaded);
+    return true;
+}
+
+bool uploadTrackJson(JsonObjectConst cmd, bool append, const char*& error) {
+    if (!cmd.containsKey("id")) {
+        error = "Missing cue id";
+        return false;
+    }
+    int id = cmd["id"];
+    if (id < 0 || id >= MAX_CUES) {
+        error = "Cue id out of range (0-7)";
+        return false;
+    }
+    JsonArrayConst keyframes = cmd["keyframes"].as<JsonArrayConst>();
+    if (keyframes.isNull() || keyframes.size() == 0) {
+        error = "Missing keyframes array";
+        return false;
+    }
+
+    // Build the new track privately, then swap it in under the mutex
+    CueTrack track;
+    if (append) {
+        if (xSemaphoreTake(g_cueMutex, pdMS_TO_TICKS(50)) != pdTRUE) {
+            error = "Cue store busy";
+            return false;
+        }
+        track = g_cues[id];
+        xSemaphoreGive(g_cueMutex);
+        if (track.count == 0) {
+            error = "Cue is empty - upload before append";
+            return false;
+        }
+    } else {
+        memset(&track, 0, sizeof(track));
+    }
+    if (cmd.containsKey("loop")) {
+        track.loop = cmd["loop"];
+    }
+
+    for (JsonArrayConst key : keyframes) {
+        if (track.count >= MAX_KEYFRAMES) {
+            error = "Too many keyframes (max 64)";
+            return false;
+        }
+        if (key.size() < 2) {
+            error = "Keyframe must be [timeMs, position, velocity]";
+            return false;
+        }
+        Keyframe k;
+        k.time = key[0];
+        k.position = key[1];
+        k.velocity = key[2] | 0.0f;
+
+        if (k.position < ParamLimits::MIN_POSITION || k.position > ParamLimits::MAX_POSITION) {
+            error = "Keyframe position out of range";
+            return false;
+        }
+        if (fabsf(k.velocity) > ParamLimits::MAX_SPEED) {
+            error = "Keyframe velocity exceeds maximum speed";
+            return false;
+        }
+        if (track.count == 0) {
+            if (k.time != 0 || k.velocity != 0.0f) {
+                error = "First keyframe must be at time 0 and at rest";
+                return false;
+            }
+        } else {
+            const Keyframe& prev = track.keys[track.count - 1];
+            if (k.time <= prev.time) {
+                error = "Keyframe times must increase";
+                return false;
+            }
+            float average = abs(k.position - prev.position) * 1000.0f / (k.time - prev.time);
+            if (average > ParamLimits::MAX_SPEED) {
+                error = "Keyframe segment exceeds maximum speed";
+                return false;
+            }
+        }
+        track.keys[track.count++] = k;
+    }
+
+    if (xSemaphoreTake(g_cueMutex, pdMS_TO_TICKS(50)) != pdTRUE) {
+        error = "Cue store busy";
+        return false;
+    }
+    g_cues[id] = track;
+    xSemaphoreGive(g_cueMutex);
+
+    saveTrack(id, track);
+    Serial.printf("CueEngine: Cue %d stored - %d keyframes, %.3fs%s\n", id, track.count,
+                  track.keys[track.count - 1].time / 1000.0f, track.loop ? ", loop" : "");
+    return true;
+}
+
+bool getTrack(uint8_t id, CueTrack& out) {
+    if (id >= MAX_CUES || g_cueMutex == NULL) {
+        return false;
+    }
+    // Short wait - called from the Core 0 task when a cue starts
+    if (xSemaphoreTake(g_cueMutex, pdMS_TO_TICKS(5)) != pdTRUE) {
+        return false;
+    }
+    out = g_cues[id];
+    xSemaphoreGive(g_cueMutex);
+
+    if (out.count < 2) {
+        return false;
+    }
+    // Playable only if it ends at rest, and a loop must close on itself
+    const Keyframe& first = out.keys[0];
+    const Keyframe& last = out.keys[out.count - 1];
+    if (last.velocity != 0.0f || (out.loop && last.position != first.position)) {
+        return false;
+    }
+    return true;
+}
+
+bool deleteTrack(uint8_t id) {
+    if (id >= MAX_CUES || g_cueMutex == NULL) {
+        return false;
+    }
+    if (xSemaphoreTake(g_cueMutex, pdMS_TO_TICKS(50)) != pdTRUE) {
+        return false;
+    }
+    memset(&g_cues[id], 0, sizeof(CueTrack));
+    xSemaphoreGive(g_cueMutex);
+
+    saveTrack(id, g_cues[id]);
+    return true;
+}
+
+void listTracks(JsonDocument& doc) {
+    JsonArray cues = doc.createNestedArray("cues");
+    if (g_cueMutex == NULL || xSemaphoreTake(g_cueMutex, pdMS_TO_TICKS(50)) != pdTRUE) {
+        return;
+    }
+    for (uint8_t id = 0; id < MAX_CUES; id++) {
+        const CueTrack& track = g_cues[id];
+        if (track.count == 0) {
+            continue;
+        }
+        JsonObject cue = cues.createNestedObject();
+        cue["id"] = id;
+        cue["keyframes"] = track.count;
+        cue["duration"] = track.keys[track.count - 1].time / 1000.0f;
+        cue["loop"] = track.loop;
+    }
+    xSemaphoreGive(g_cueMutex);
+}
+
+float hermitePosition(const Keyframe& a, const Keyframe& b, float t) {
+    const float h = (b.time - a.time) * 0.001f;
+    float s = t / h;
+    if (s < 0.0f) s = 0.0f;
+    if (s > 1.0f) s = 1.0f;
+
+    const float s2 = s * s;
+    const float s3 = s2 * s;
+    const float h10 = s3 - 2.0f * s2 + s;
+    const float h01 = -2.0f * s3 + 3.0f * s2;
+    const float h11 = s3 - s2;
+    // h00 = 1 - h01: work relative to a so large positions keep float precision
+    return a.position + h01 * (float)(b.position - a.position) +
+           h * (h10 * a.velocity + h11 * b.velocity);
+}
+
+float hermiteVelocity(const Keyframe& a, const Keyframe& b, float t) {
+    const float h = (b.time - a.time) * 0.001f;
+    float s = t / h;
+    if (s < 0.0f) s = 0.0f;
+    if (s > 1.0f) s = 1.0f;
+
+    const float s2 = s * s;
+    const float d10 = 3.0f * s2 - 4.0f * s + 1.0f;
+    const float d01 = -6.0f * s2 + 6.0f * s;
+    const float d11 = 3.0f * s2 - 2.0f * s;
+    return d01 * (float)(b.position - a.position) / h + d10 * a.velocity + d11 * b.velocity;
+}
+
+} // namespace CueEngine
@@ -0,0 +1,120 @@
+// ============================================================================
+// File: CueEngine.h
+// Project: SkullStepperV4 - ESP32-S3 Modular Stepper Control System
+// Version: 4.2.0
+// Date: 2026-10-15
+// Author: Tim Rosener
+// Description: PVT (position-velocity-time) keyframe cue storage and
+//              cubic Hermite interpolation for on-device cue playback
+// License: MIT
+//
+// Tracks are uploaded from Core 1 (serial JSON, web API) and persisted to
+// flash. StepperController copies a track when a cue starts and plays it
+// back from the Core 0 task, so playback never touches the shared store.
+// ============================================================================
+
+#ifndef CUEENGINE_H
+#define CUEENGINE_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+// ============================================================================
+// CueEngine Namespace - Keyframe Cue Tracks
+// ============================================================================
+
+namespace CueEngine {
+
+    // ------------------------------------------------------------------------
+    // Constants
+    // ------------------------------------------------------------------------
+
+    const uint8_t MAX_CUES = 8;             // Cue slots (DMX cue band selects 1-8)
+    const uint8_t MAX_KEYFRAMES = 64;       // Keyframes per cue
+
+    // ------------------------------------------------------------------------
+    // Cue Structures
+    // ------------------------------------------------------------------------
+
+    /**
+     * One PVT keyframe - the motor passes position at time with velocity
+     */
+    struct Keyframe {
+        uint32_t time;        // Time since cue start (ms)
+        int32_t position;     // Absolute position (steps)
+        float velocity;       // Velocity at this keyframe (steps/sec, signed)
+    };
+
+    /**
+     * A complete cue track
+     * First keyframe is at time 0 and at rest; a looping track must end
+     * where it starts so playback can wrap without a jump
+     */
+    struct CueTrack {
+        Keyframe keys[MAX_KEYFRAMES];
+        uint8_t count;        // Keyframes in use (0 = empty slot)
+        bool loop;            // Restart from the first keyframe at the end
+    };
+
+    // ------------------------------------------------------------------------
+    // Public Interface Functions
+    // ------------------------------------------------------------------------
+
+    /**
+     * Create the cue store mutex and load stored cues from flash
+     * @return true if initialization successful
+     */
+    bool initialize();
+
+    /**
+     * Replace or extend a cue from a JSON command
+     * {"id":0,"loop":false,"keyframes":[[timeMs,position,velocity],...]}
+     * Long cues are sent in several lines with append = true
+     * @param cmd Parsed JSON command object
+     * @param append true to add keyframes to the end of the existing cue
+     * @param error Returns a message on failure
+     * @return true if the cue was stored
+     */
+    bool uploadTrackJson(JsonObjectConst cmd, bool append, const char*& error);
+
+    /**
+     * Copy a cue for playback
+     * @param id Cue slot (0 to MAX_CUES-1)
+     * @param out Returns the track
+     * @return false if the slot is empty or the store is busy
+     */
+    bool getTrack(uint8_t id, CueTrack& out);
+
+    /**
+     * Erase a cue slot (RAM and flash)
+     * @return true if the slot was valid
+     */
+    bool deleteTrack(uint8_t id);
+
+    /**
+     * Describe stored cues
+     * @param doc Receives a "cues" array of {id, keyframes, duration, loop}
+     */
+    void listTracks(JsonDocument& doc);
+
+    /**
+     * Interpolated position between two keyframes (cubic Hermite)
+     * @param a Segment start keyframe
+     * @param b Segment end keyframe
+     * @param t Time since a (s), clamped to the segment
+     * @return absolute position in steps (fractional)
+     */
+    float hermitePosition(const Keyframe& a, const Keyframe& b, float t);
+
+    /**
+     * Interpolated velocity between two keyframes (cubic Hermite derivative)
+     * @param a Segment start keyframe
+     * @param b Segment end keyframe
+     * @param t Time since a (s), clamped to the segment
+     * @return velocity in steps/sec (signed)
+     */
+    float hermiteVelocity(const Keyframe& a, const Keyframe& b, float t);
+
+} // namespace CueEngine
+
+#endif // CUEENGINE_H
@@ -0,0 +1,420 @@
+// ============================================================================
+// File: DMXPersonality.cpp
+// Project: SkullStepperV4 - ESP32-S3 Modular Stepper Control System
+// Version: 4.2.0
+// Date: 2026-10-15
+// Author: Tim Rosener
+// Description: DMX personality storage, compilation and decoding
+// License: MIT
+// ============================================================================
+
+#include "DMXPersonality.h"
+#include "FixedPoint.h"
+#include <Preferences.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+namespace DMXPersonality {
+
+// Separate flash namespace so a config factory reset keeps venue layouts
+static const char* PERSONALITY_NAMESPACE = "skulldmx";
+
+// Built-in layouts (slot 0 is the original 5-channel layout in 8-bit mode)
+static const Personality BUILTIN[BUILTIN_COUNT] = {
+    { "standard8", 4, {
+        { Role::POSITION,     0, NO_FINE, Curve::LINEAR, 0, 100 },
+        { Role::ACCELERATION, 2, NO_FINE, Curve::LINEAR, 0, 100 },
+        { Role::SPEED,        3, NO_FINE, Curve::LINEAR, 0, 100 },
+        { Role::MODE,         4, NO_FINE, Curve::LINEAR, 0, 100 } } },
+    { "standard16", 4, {
+        { Role::POSITION,     0, 1,       Curve::LINEAR, 0, 100 },
+        { Role::ACCELERATION, 2, NO_FINE, Curve::LINEAR, 0, 100 },
+        { Role::SPEED,        3, NO_FINE, Curve::LINEAR, 0, 100 },
+        { Role::MODE,         4, NO_FINE, Curve::LINEAR, 0, 100 } } },
+    { "compact16", 2, {
+        { Role::POSITION,     0, 1,       Curve::LINEAR, 0, 100 },
+        { Role::MODE,         2, NO_FINE, Curve::LINEAR, 0, 100 } } },
+};
+
+static Personality g_personalities[MAX_PERSONALITIES];
+static SemaphoreHandle_t g_personalityMutex = NULL;
+static Preferences g_personalityPreferences;
+
+static const char* const ROLE_NAMES[ROLE_COUNT] = {"position", "speed", "acceleration", "mode"};
+static const char* const CURVE_NAMES[] = {"linear", "square", "root"};
+static const uint8_t CURVE_COUNT = sizeof(CURVE_NAMES) / sizeof(CURVE_NAMES[0]);
+
+/**
+ * Flash key for a personality slot ("pers3")
+ */
+static void personalityKey(uint8_t slot, char* keyName) {
+    snprintf(keyName, 8, "pers%u", slot);
+}
+
+/**
+ * Write one user slot to flash (removes the entry for an empty slot)
+ */
+static void savePersonality(uint8_t slot, const Personality& personality) {
+    char keyName[8];
+    personalityKey(slot, keyName);
+
+    if (!g_personalityPreferences.begin(PERSONALITY_NAMESPACE, false)) {
+        Serial.println("DMXPersonality: Failed to open flash storage");
+        return;
+    }
+    if (personality.count == 0) {
+        g_personalityPreferences.remove(keyName);
+    } else {
+        g_personalityPreferences.putBytes(keyName, &personality, sizeof(Personality));
+    }
+    g_personalityPreferences.end();
+}
+
+/**
+ * Match a name against a table (case-sensitive, as sent by the tools)
+ * @return index, or -1 if not found
+ */
+static int8_t parseName(const char* text, const char* const* names, uint8_t count) {
+    if (!text) {
+        return -1;
+    }
+    for (uint8_t i = 0; i < count; i++) {
+        if (strcmp(text, names[i]) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/**
+ * Integer square root (largest r with r * r <= value)
+ */
+static uint32_t isqrt(uint32_t value) {
+    uint32_t root = 0;
+    uint32_t bit = 1UL << 30;
+    while (bit > value) {
+        bit >>= 2;
+    }
+    while (bit != 0) {
+        if (value >= root + bit) {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return root;
+}
+
+/**
+ * Percentage of full scale as a Q0.16 fraction
+ */
+static uint16_t fractionFromRange(uint8_t percent) {
+    return (uint16_t)(((uint32_t)percent * FixedPoint::FRACTION_ONE + 50) / 100);
+}
+
+// ============================================================================
+// Store
+// ============================================================================
+
+bool initialize() {
+    if (g_personalityMutex == NULL) {
+        g_personalityMutex = xSemaphoreCreateMutex();
+        if (g_personalityMutex == NULL) {
+            Serial.println("DMXPersonality: Failed to create mutex");
+            return false;
+        }
+    }
+
+    memset(g_personalities, 0, sizeof(g_personalities));
+    memcpy(g_personalities, BUILTIN, sizeof(BUILTIN));
+
+    if (!g_personalityPreferences.begin(PERSONALITY_NAMESPACE, true)) {
+        return true;  // Nothing stored yet
+    }
+    uint8_t loaded = 0;
+    for (uint8_t slot = BUILTIN_COUNT; slot < MAX_PERSONALITIES; slot++) {
+        char keyName[8];
+        personalityKey(slot, keyName);
+        if (g_personalityPreferences.getBytesLength(keyName) != sizeof(Personality)) {
+            continue;
+        }
+        Personality stored;
+        g_personalityPreferences.getBytes(keyName, &stored, sizeof(Personality));
+        stored.name[NAME_LENGTH - 1] = '\0';
+        const char* error;
+        if (!validate(stored, error)) {
+            Serial.printf("DMXPersonality: Slot %d ignored - %s\n", slot, error);
+            continue;
+        }
+        g_personalities[slot] = stored;
+        loaded++;
+    }
+    g_personalityPreferences.end();
+
+    Serial.printf("DMXPersonality: %d built-in, %d stored personality(s) loaded\n", BUILTIN_COUNT, loaded);
+    return true;
+}
+
+bool getPersonality(uint8_t slot, Personality& out) {
+    if (slot >= MAX_PERSONALITIES || g_personalityMutex == NULL) {
+        return false;
+    }
+    if (xSemaphoreTake(g_personalityMutex, pdMS_TO_TICKS(50)) != pdTRUE) {
+        return false;
+    }
+    out = g_personalities[slot];
+    xSemaphoreGive(g_personalityMutex);
+    return out.count > 0;
+}
+
+bool uploadJson(JsonObjectConst cmd, const char*& error) {
+    if (!cmd.containsKey("id")) {
+        error = "Missing personality id";
+        return false;
+    }
+    int id = cmd["id"];
+    if (id < BUILTIN_COUNT || id >= MAX_PERSONALITIES) {
+        error = "Personality id out of range (3-7, 0-2 are built in)";
+        return false;
+    }
+    JsonArrayConst channels = cmd["channels"].as<JsonArrayConst>();
+    if (channels.isNull() || channels.size() == 0) {
+        error = "Missing channels array";
+        return false;
+    }
+    if (channels.size() > MAX_ROLE_CHANNELS) {
+        error = "Too many channels (max 8 entries)";
+        return false;
+    }
+
+    Personality personality;
+    memset(&personality, 0, sizeof(personality));
+    strncpy(personality.name, cmd["name"] | "custom", NAME_LENGTH - 1);  // memset above terminates it
+
+    for (JsonObjectConst entry : channels) {
+        int8_t role = parseName(entry["role"], ROLE_NAMES, ROLE_COUNT);
+        if (role < 0) {
+            error = "Channel role must be position, speed, acceleration or mode";
+            return false;
+        }
+        int8_t curve = parseName(entry["curve"] | "linear", CURVE_NAMES, CURVE_COUNT);
+        if (curve < 0) {
+            error = "Channel curve must be linear, square or root";
+            return false;
+        }
+        int coarse = entry["coarse"] | -1;
+        int fine = entry["fine"] | -1;
+        int low = entry["range"][0] | 0;
+        int high = entry["range"][1] | 100;
+        if (coarse < 0 || coarse >= MAX_FOOTPRINT || fine >= MAX_FOOTPRINT) {
+            error = "Channel offset out of range (0-31)";
+            return false;
+        }
+        if (low < 0 || low > 100 || high < 0 || high > 100) {
+            error = "Channel range must be 0-100 %";
+            return false;
+        }
+
+        ChannelDef& def = personality.channels[personality.count++];
+        def.role = (Role)role;
+        def.coarse = (uint8_t)coarse;
+        def.fine = (fine < 0) ? NO_FINE : (uint8_t)fine;
+        def.curve = (Curve)curve;
+        def.rangeLow = (uint8_t)low;
+        def.rangeHigh = (uint8_t)high;
+    }
+
+    if (!validate(personality, error)) {
+        return false;
+    }
+
+    if (xSemaphoreTake(g_personalityMutex, pdMS_TO_TICKS(50)) != pdTRUE) {
+        error = "Personality store busy";
+        return false;
+    }
+    g_personalities[id] = personality;
+    xSemaphoreGive(g_personalityMutex);
+
+    savePersonality(id, personality);
+    Decoder decoder;
+    compile(personality, id, decoder);
+    Serial.printf("DMXPersonality: Slot %d stored - \"%s\", %d channels\n", id, personality.name,
+                  decoder.footprint);
+    return true;
+}
+
+bool deletePersonality(uint8_t slot) {
+    if (slot < BUILTIN_COUNT || slot >= MAX_PERSONALITIES) {
+        return false;
+    }
+    if (xSemaphoreTake(g_personalityMutex, pdMS_TO_TICKS(50)) != pdTRUE) {
+        return false;
+    }
+    memset(&g_personalities[slot], 0, sizeof(Personality));
+    xSemaphoreGive(g_personalityMutex);
+
+    savePersonality(slot, g_personalities[slot]);
+    return true;
+}
+
+void listPersonalities(JsonDocument& doc) {
+    JsonArray list = doc.createNestedArray("personalities");
+    for (uint8_t slot = 0; slot < MAX_PERSONALITIES; slot++) {
+        Personality personality;
+        Decoder decoder;
+        if (!getPersonality(slot, personality) || !compile(personality, slot, decoder)) {
+            continue;
+        }
+        JsonObject entry = list.createNestedObject();
+        entry["id"] = slot;
+        entry["name"] = (const char*)g_personalities[slot].name;  // Static storage - no copy
+        entry["footprint"] = decoder.footprint;
+        entry["builtin"] = slot < BUILTIN_COUNT;
+    }
+}
+
+// ============================================================================
+// Compilation and Decoding
+// ============================================================================
+
+bool validate(const Personality& personality, const char*& error) {
+    if (personality.count == 0 || personality.count > MAX_ROLE_CHANNELS) {
+        error = "Personality needs 1-8 channel entries";
+        return false;
+    }
+
+    uint8_t roles = 0;
+    uint32_t used = 0;  // One bit per channel offset
+    for (uint8_t i = 0; i < personality.count; i++) {
+        const ChannelDef& def = personality.channels[i];
+        if ((uint8_t)def.role >= ROLE_COUNT || (uint8_t)def.curve >= CURVE_COUNT) {
+            error = "Unknown role or curve";
+            return false;
+        }
+        if (def.coarse >= MAX_FOOTPRINT || (def.fine != NO_FINE && def.fine >= MAX_FOOTPRINT)) {
+            error = "Channel offset out of range (0-31)";
+            return false;
+        }
+        if (def.rangeLow > 100 || def.rangeHigh > 100) {
+            error = "Channel range must be 0-100 %";
+            return false;
+        }
+        if (def.role == Role::MODE && def.fine != NO_FINE) {
+            error = "Mode channel is 8-bit (no fine channel)";
+            return false;
+        }
+        if (roles & (1 << (uint8_t)def.role)) {
+            error = "Role used twice";
+            return false;
+        }
+        roles |= 1 << (uint8_t)def.role;
+
+        uint32_t channels = 1UL << def.coarse;
+        if (def.fine != NO_FINE) {
+            channels |= 1UL << def.fine;
+            if (def.fine == def.coarse) {
+                error = "Fine channel must differ from coarse";
+                return false;
+            }
+        }
+        if (used & channels) {
+            error = "Channel used twice";
+            return false;
+        }
+        used |= channels;
+    }
+
+    if (!(roles & (1 << (uint8_t)Role::POSITION)) || !(roles & (1 << (uint8_t)Role::MODE))) {
+        error = "Position and mode channels are required";
+        return false;
+    }
+    return true;
+}
+
+bool compile(const Personality& personality, uint8_t slot, Decoder& out) {
+    const char* error;
+    if (!validate(personality, error)) {
+        return false;
+    }
+
+    memset(&out, 0, sizeof(out));
+    out.slot = slot;
+    strncpy(out.name, personality.name, NAME_LENGTH - 1);  // memset above terminates it
+    for (uint8_t i = 0; i < personality.count; i++) {
+        const ChannelDef& def = personality.channels[i];
+        DecodeOp& op = out.ops[out.count++];
+        op.coarse = def.coarse;
+        op.fine = def.fine;
+        op.role = def.role;
+        op.curve = def.curve;
+        op.low = fractionFromRange(def.rangeLow);
+        op.high = fractionFromRange(def.rangeHigh);
+
+        uint8_t last = (def.fine != NO_FINE && def.fine > def.coarse) ? def.fine : def.coarse;
+        if (last + 1 > out.footprint) {
+            out.footprint = last + 1;
+        }
+        if (def.role == Role::MODE) {
+            out.modeChannel = def.coarse;
+        }
+    }
+    return true;
+}
+
+uint16_t shape(const DecodeOp& op, uint16_t raw) {
+    uint32_t x = raw;
+    switch (op.curve) {
+        case Curve::SQUARE:
+            x = (x * x + FixedPoint::FRACTION_ONE / 2) / FixedPoint::FRACTION_ONE;
+            break;
+        case Curve::ROOT:
+            x = isqrt(x * FixedPoint::FRACTION_ONE);
+            break;
+        case Curve::LINEAR:
+            break;
+    }
+    return (uint16_t)FixedPoint::lerp(op.low, op.high, (uint16_t)x);
+}
+
+void decode(const Decoder& decoder, const uint8_t* channels, Values& out) {
+    // Roles without a channel run at full scale
+    for (uint8_t role = 0; role < ROLE_COUNT; role++) {
+        out.value[role] = FixedPoint::FRACTION_ONE;
+        out.raw[role] = FixedPoint::FRACTION_ONE;
+    }
+    out.mode = 0;
+
+    for (uint8_t i = 0; i < decoder.count; i++) {
+        const DecodeOp& op = decoder.ops[i];
+        uint16_t raw = (op.fine == NO_FINE) ? FixedPoint::fractionFrom8(channels[op.coarse])
+                                            : FixedPoint::fractionFrom16(channels[op.coarse], channels[op.fine]);
+        out.raw[(uint8_t)op.role] = raw;
+        if (op.role == Role::MODE) {
+            out.mode = channels[op.coarse];  // Mode bands work on the raw value
+            out.value[(uint8_t)op.role] = raw;
+        } else {
+            out.value[(uint8_t)op.role] = shape(op, raw);
+        }
+    }
+}
+
+const DecodeOp* findOp(const Decoder& decoder, Role role) {
+    for (uint8_t i = 0; i < decoder.count; i++) {
+        if (decoder.ops[i].role == role) {
+            return &decoder.ops[i];
+        }
+    }
+    return nullptr;
+}
+
+const char* roleName(Role role) {
+    return ((uint8_t)role < ROLE_COUNT) ? ROLE_NAMES[(uint8_t)role] : "unknown";
+}
+
+const char* curveName(Curve curve) {
+    return ((uint8_t)curve < CURVE_COUNT) ? CURVE_NAMES[(uint8_t)curve] : "unknown";
+}
+
+} // namespace DMXPersonality
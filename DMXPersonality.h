@@ -0,0 +1,201 @@
+// ============================================================================
+// File: DMXPersonality.h
+// Project: SkullStepperV4 - ESP32-S3 Modular Stepper Control System
+// Version: 4.2.0
+// Date: 2026-10-15
+// Author: Tim Rosener
+// Description: Table-driven DMX personalities (channel layouts) and the
+//              flat decoder compiled from them
+// License: MIT
+//
+// A personality lists the channels the fixture uses, relative to the base
+// channel: each entry has a role (position, speed, acceleration, mode), a
+// coarse channel, an optional fine channel for 16-bit control, a response
+// curve and an output range. Slots 0-2 are built in; slots 3-7 are uploaded
+// from Core 1 (serial JSON, web API) and persisted to flash.
+//
+// DMXReceiver compiles the selected personality into a Decoder - a flat
+// list of operations - and runs it once per frame over the validated
+// channels, so a frame is decoded in a single pass with no table lookups.
+// ============================================================================
+
+#ifndef DMXPERSONALITY_H
+#define DMXPERSONALITY_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include "HardwareConfig.h"
+
+// ============================================================================
+// DMXPersonality Namespace - Channel Layouts and Decoding
+// ============================================================================
+
+namespace DMXPersonality {
+
+    // ------------------------------------------------------------------------
+    // Constants
+    // ------------------------------------------------------------------------
+
+    const uint8_t MAX_PERSONALITIES = DMX_PERSONALITY_SLOTS;  // Personality slots
+    const uint8_t BUILTIN_COUNT = 3;        // Slots 0-2 are built in (read-only)
+    const uint8_t MAX_ROLE_CHANNELS = 8;    // Channel entries per personality
+    const uint8_t MAX_FOOTPRINT = 32;       // Channels from the base channel
+    const uint8_t NAME_LENGTH = 16;         // Including terminator
+    const uint8_t NO_FINE = 0xFF;           // Entry has no fine channel (8-bit)
+    const uint8_t ROLE_COUNT = 4;
+
+    // ------------------------------------------------------------------------
+    // Personality Structures
+    // ------------------------------------------------------------------------
+
+    enum class Role : uint8_t {
+        POSITION,      // Target as a fraction of the position limits
+        SPEED,         // Speed limit as a fraction of the configured maximum
+        ACCELERATION,  // Acceleration limit as a fraction of the configured maximum
+        MODE           // Mode control (STOP / CONTROL / CUE / HOME bands, raw value)
+    };
+
+    enum class Curve : uint8_t {
+        LINEAR,
+        SQUARE,        // Fine control at the low end
+        ROOT           // Fine control at the high end
+    };
+
+    /**
+     * One channel (or coarse/fine pair) of a personality
+     * Roles without an entry run at full scale (speed, acceleration);
+     * position and mode are required
+     */
+    struct ChannelDef {
+        Role role;
+        uint8_t coarse;       // Offset from the base channel (0 = base)
+        uint8_t fine;         // Offset of the fine channel, NO_FINE for 8-bit
+        Curve curve;          // Ignored for MODE
+        uint8_t rangeLow;     // Output at DMX 0 (% of full scale)
+        uint8_t rangeHigh;    // Output at DMX full; below rangeLow reverses the channel
+    };
+
+    /**
+     * A complete channel layout
+     */
+    struct Personality {
+        char name[NAME_LENGTH];
+        uint8_t count;        // Entries in use (0 = empty slot)
+        ChannelDef channels[MAX_ROLE_CHANNELS];
+    };
+
+    // ------------------------------------------------------------------------
+    // Decoder Structures
+    // ------------------------------------------------------------------------
+
+    /**
+     * One compiled decode step
+     */
+    struct DecodeOp {
+        uint8_t coarse;
+        uint8_t fine;         // NO_FINE for 8-bit
+        Role role;
+        Curve curve;
+        uint16_t low;         // Q0.16 output at DMX 0
+        uint16_t high;        // Q0.16 output at DMX full
+    };
+
+    /**
+     * Flat decoder compiled from a personality
+     */
+    struct Decoder {
+        DecodeOp ops[MAX_ROLE_CHANNELS];
+        uint8_t count;
+        uint8_t footprint;    // Channels used from the base channel
+        uint8_t modeChannel;  // Offset of the mode channel
+        uint8_t slot;         // Personality slot compiled from
+        char name[NAME_LENGTH];
+    };
+
+    /**
+     * Decoded values of one frame, indexed by Role
+     */
+    struct Values {
+        uint16_t value[ROLE_COUNT];   // Q0.16 after curve and range
+        uint16_t raw[ROLE_COUNT];     // Channel value before the curve (8-bit channels scaled to 16 bits)
+        uint8_t mode;                 // Mode channel value (0-255)
+    };
+
+    // ------------------------------------------------------------------------
+    // Public Interface Functions
+    // ------------------------------------------------------------------------
+
+    /**
+     * Create the store mutex and load stored personalities from flash
+     * @return true if initialization successful
+     */
+    bool initialize();
+
+    /**
+     * Copy a personality
+     * @param slot Personality slot (0 to MAX_PERSONALITIES-1)
+     * @param out Returns the personality
+     * @return false if the slot is empty or the store is busy
+     */
+    bool getPersonality(uint8_t slot, Personality& out);
+
+    /**
+     * Store a personality from a JSON command
+     * {"id":3,"name":"venue","channels":[{"role":"position","coarse":0,"fine":1,
+     *  "curve":"linear","range":[0,100]},{"role":"mode","coarse":2},...]}
+     * @param cmd Parsed JSON command object
+     * @param error Returns a message on failure
+     * @return true if the personality was stored
+     */
+    bool uploadJson(JsonObjectConst cmd, const char*& error);
+
+    /**
+     * Erase a stored personality (RAM and flash)
+     * @return false for a built-in slot or when the store is busy
+     */
+    bool deletePersonality(uint8_t slot);
+
+    /**
+     * Describe the personalities
+     * @param doc Receives a "personalities" array of {id, name, footprint, builtin}
+     */
+    void listPersonalities(JsonDocument& doc);
+
+    /**
+     * Check a personality for missing or duplicate roles and overlapping channels
+     * @param error Returns a message on failure
+     */
+    bool validate(const Personality& personality, const char*& error);
+
+    /**
+     * Compile a personality into a decoder
+     * @return false if the personality is invalid
+     */
+    bool compile(const Personality& personality, uint8_t slot, Decoder& out);
+
+    /**
+     * Decode one frame
+     * @param decoder Compiled personality
+     * @param channels Channels from the base channel (decoder.footprint bytes)
+     * @param out Receives the values
+     */
+    void decode(const Decoder& decoder, const uint8_t* channels, Values& out);
+
+    /**
+     * Apply an operation's curve and range to a raw 16-bit value
+     * @return Q0.16 output
+     */
+    uint16_t shape(const DecodeOp& op, uint16_t raw);
+
+    /**
+     * Find the operation for a role
+     * @return nullptr if the personality has no channel for the role
+     */
+    const DecodeOp* findOp(const Decoder& decoder, Role role);
+
+    const char* roleName(Role role);
+    const char* curveName(Curve curve);
+
+} // namespace DMXPersonality
+
+#endif // DMXPERSONALITY_H
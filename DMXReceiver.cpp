@@ -12,9 +12,13 @@
 #include "DMXReceiver.h"
 #include "StepperController.h"
 #include "SystemConfig.h"
+#include "FixedPoint.h"
+#include "CoreLog.h"
+#include "MotionTrace.h"
 #include <ESP32S3DMX.h>
 #include <Arduino.h>
 #include <esp_task_wdt.h>  // For watchdog timer
+#include <esp_timer.h>     // Frame watcher
 #include <driver/gpio.h>    // For GPIO pull resistor configuration
 
 // ============================================================================
@@ -25,6 +29,7 @@ namespace DMXReceiver {
   
   // ----------------------------------------------------------------------------
   // Debug control - set to false to disable debug output
+  // Task output goes through CoreLog; debug records also need CORE_LOG_LEVEL 4
   // ----------------------------------------------------------------------------
   static const bool DMX_DEBUG_ENABLED = true;  // Set to true only when debugging
   
@@ -41,8 +46,31 @@ namespace DMXReceiver {
   
   // Channel configuration
   static uint16_t baseChannel = 1;  // Default base channel
-  static const uint8_t NUM_CHANNELS = 5;  // We use 5 consecutive channels
-  static uint8_t channelCache[NUM_CHANNELS] = {0};  // Cache for our channels
+  
+  // Personality: Core 1 compiles a decoder and hands it over through a
+  // one-entry queue; the DMX task takes it at the start of the next frame
+  static DMXPersonality::Decoder decoder = {};  // DMX task only (after initialize)
+  static QueueHandle_t decoderQueue = NULL;
+  static volatile uint8_t personalitySlot = 0;
+  static volatile uint8_t personalityFootprint = 0;
+  
+  // Network input: the NetworkDMX task copies the newest universe into a
+  // one-entry queue and wakes the DMX task, which takes it like a UART frame
+  struct NetworkFrame {
+    uint32_t timestamp;                 // micros() when the packet was received
+    uint16_t slots;
+    uint8_t data[DMX_UNIVERSE_SIZE];
+  };
+  static QueueHandle_t networkQueue = NULL;
+  static NetworkFrame networkStaging;   // NetworkDMX task only
+  static NetworkFrame networkFrame;     // DMX task only
+  static volatile DMXInput inputSource = DMXInput::UART;
+  static uint32_t networkPackets = 0;   // Network frames taken by the DMX task
+  
+  // Universe snapshots: the task writes the unpublished buffer, then publishes it
+  static UniverseFrame frames[2];
+  static std::atomic<const UniverseFrame*> publishedFrame(nullptr);
+  static uint32_t universeSequence = 0;  // Last sequence handed out (DMX task only)
   
   // Signal tracking
   static bool dmxConnected = false;
@@ -57,17 +85,32 @@ namespace DMXReceiver {
   // Task handle for Core 0 execution
   static TaskHandle_t dmxTaskHandle = NULL;
   
+  // Frame watcher: notifies the task when the library's packet counter moves
+  static esp_timer_handle_t frameWatchTimer = NULL;
+  static volatile uint32_t watchedPacketCount = 0;
+  static volatile uint32_t frameSeenUs = 0;  // micros() when the watcher saw the newest frame
+  
+  // Frame timing (written by the DMX task only, read without locking)
+  static FrameStats frameStats = {};
+  static uint64_t intervalSumUs = 0;
+  static uint64_t jitterSumUs = 0;
+  static uint64_t latencySumUs = 0;
+  static uint32_t lastFrameUs = 0;
+  static uint32_t rateWindowStartMs = 0;
+  static uint32_t rateWindowFrames = 0;
+  static uint32_t currentFrameUs = 0;        // Frame being processed
+  static bool frameCommandRecorded = false;  // Latency already taken for this frame
+  static volatile bool frameStatsResetRequested = true;
+  
   // Task health monitoring
   static uint32_t g_lastTaskUpdate = 0;
   static const uint32_t TASK_HEALTH_TIMEOUT_MS = 5000;  // Task is unhealthy if no update for 5 seconds
   
-  // Mutex for channel cache protection
-  static SemaphoreHandle_t channelCacheMutex = NULL;
-  
   // Data validation
   static uint8_t consecutiveHomeReads = 0;  // Count consecutive 255 values on mode channel
   static const uint8_t HOME_TRIGGER_COUNT = 3;  // Require 3 consecutive reads of 255 to trigger homing
-  static uint8_t lastValidChannels[NUM_CHANNELS] = {0};  // Last known good values
+  static uint8_t lastValidChannels[MAX_CHANNELS] = {0};  // Last known good values
+  static uint8_t previousCache[MAX_CHANNELS] = {0};  // Raw values of the previous frame
   
   // DMX control state
   static DMXMode currentMode = DMXMode::STOP;
@@ -76,31 +119,37 @@ namespace DMXReceiver {
   static bool homingInProgress = false;  // Track if homing is active
   static bool homingTriggeredByDMX = false;  // Track if DMX initiated the homing
   static uint32_t lastChannelUpdateTime = 0;  // Track when channels were last updated
+  static int8_t triggeredCue = -1;  // Cue last triggered in CUE mode (-1 = none yet)
+  static int8_t candidateCue = -1;  // Cue selection waiting to settle
+  static uint8_t consecutiveCueReads = 0;  // Reads of the same cue selection
+  static const uint8_t CUE_TRIGGER_COUNT = 3;  // Selection must hold for 3 reads before it plays
+  static const int32_t DMX_MIN_RATE_MILLI = 10 * FixedPoint::MILLI_PER_UNIT;  // Speed/accel floor (10 steps/sec, steps/sec²)
   
   // DMX configuration
   static bool dmxEnabled = true;  // DMX control enabled by default
-  static bool use16BitPosition = false;  // Default to 8-bit mode
   static uint32_t lastMotionCommandTime = 0;
   static int32_t lastTargetPosition = -1;  // Track last commanded position
-  static uint8_t lastSpeedValue = 0;  // Track last speed DMX value
-  static uint8_t lastAccelValue = 0;  // Track last acceleration DMX value
+  static uint8_t lastSpeedValue = 0;  // Track last speed value (decoded, 8-bit resolution)
+  static uint8_t lastAccelValue = 0;  // Track last acceleration value (decoded, 8-bit resolution)
   
   // ----------------------------------------------------------------------------
   // DMX Mode Detection with Hysteresis
   // ----------------------------------------------------------------------------
   
+  static const char* modeName(DMXMode mode) {
+    switch (mode) {
+      case DMXMode::STOP:    return "STOP";
+      case DMXMode::CONTROL: return "CONTROL";
+      case DMXMode::CUE:     return "CUE";
+      case DMXMode::HOME:    return "HOME";
+    }
+    return "UNKNOWN";
+  }
+  
   static DMXMode detectModeWithHysteresis(uint8_t modeValue) {
-    DMXMode detectedMode;
-    
     // Determine raw mode from value
-    // 1-100: STOP, 101-254: CONTROL, 255: HOME
-    if (modeValue <= MODE_STOP_MAX) {
-      detectedMode = DMXMode::STOP;
-    } else if (modeValue <= MODE_CONTROL_MAX) {
-      detectedMode = DMXMode::CONTROL;
-    } else {
-      detectedMode = DMXMode::HOME;  // Only at 255
-    }
+    // 1-100: STOP, 101-200: CONTROL, 201-254: CUE, 255: HOME
+    DMXMode detectedMode = detectMode(modeValue);
     
     // Apply hysteresis if mode is different from current
     if (detectedMode != currentMode) {
@@ -118,9 +167,20 @@ namespace DMXReceiver {
           if (detectedMode == DMXMode::STOP && modeValue > (MODE_STOP_MAX - MODE_HYSTERESIS)) {
             return currentMode;  // Stay in CONTROL mode
           }
+          // Need to get above 200+hysteresis to switch to CUE
+          if (detectedMode == DMXMode::CUE && modeValue < (MODE_CONTROL_MAX + MODE_HYSTERESIS)) {
+            return currentMode;  // Stay in CONTROL mode
+          }
           // HOME is only at 255, no hysteresis needed
           break;
           
+        case DMXMode::CUE:
+          // Need to drop below 200-hysteresis to switch back to CONTROL
+          if (detectedMode == DMXMode::CONTROL && modeValue > (MODE_CONTROL_MAX - MODE_HYSTERESIS)) {
+            return currentMode;  // Stay in CUE mode
+          }
+          break;
+          
         case DMXMode::HOME:
           // Once in HOME mode, need to drop below 255 to exit
           // No hysteresis since HOME is only at exactly 255
@@ -131,6 +191,98 @@ namespace DMXReceiver {
     return detectedMode;
   }
   
+  // ----------------------------------------------------------------------------
+  // Frame Timing
+  // ----------------------------------------------------------------------------
+  
+  /**
+   * Frame watcher (esp_timer task) - wakes the DMX task once per new frame
+   */
+  static void frameWatchCallback(void* arg) {
+    uint32_t count = dmx.getPacketCount();
+    if (count != watchedPacketCount) {
+      watchedPacketCount = count;
+      frameSeenUs = micros();
+      if (dmxTaskHandle) {
+        xTaskNotifyGive(dmxTaskHandle);
+      }
+    }
+  }
+  
+  static void clearFrameStats() {
+    frameStats = {};
+    frameStats.intervalMinUs = UINT32_MAX;
+    intervalSumUs = 0;
+    jitterSumUs = 0;
+    latencySumUs = 0;
+    lastFrameUs = 0;
+    rateWindowStartMs = millis();
+    rateWindowFrames = 0;
+  }
+  
+  /**
+   * Record a frame about to be processed
+   * @param frameUs micros() when the frame was seen
+   * @param skipped Frames that completed unseen since the previous one
+   */
+  static void recordFrame(uint32_t frameUs, uint32_t skipped) {
+    if (frameStatsResetRequested) {
+      frameStatsResetRequested = false;
+      clearFrameStats();
+    }
+    
+    frameStats.frames++;
+    frameStats.skippedFrames += skipped;
+    if (frameStats.frames > 1) {
+      uint32_t interval = frameUs - lastFrameUs;
+      uint32_t intervals = frameStats.frames - 1;
+      intervalSumUs += interval;
+      frameStats.intervalAvgUs = (uint32_t)(intervalSumUs / intervals);
+      if (interval < frameStats.intervalMinUs) frameStats.intervalMinUs = interval;
+      if (interval > frameStats.intervalMaxUs) frameStats.intervalMaxUs = interval;
+      uint32_t jitter = (interval > frameStats.intervalAvgUs) ? interval - frameStats.intervalAvgUs
+                                                               : frameStats.intervalAvgUs - interval;
+      jitterSumUs += jitter;
+      frameStats.jitterAvgUs = (uint32_t)(jitterSumUs / intervals);
+      if (jitter > frameStats.jitterMaxUs) frameStats.jitterMaxUs = jitter;
+    }
+    lastFrameUs = frameUs;
+    
+    rateWindowFrames++;
+    uint32_t windowMs = millis() - rateWindowStartMs;
+    if (windowMs >= 1000) {
+      frameStats.rateHz = rateWindowFrames * 1000.0f / windowMs;
+      rateWindowStartMs += windowMs;
+      rateWindowFrames = 0;
+    }
+    
+    currentFrameUs = frameUs;
+    frameCommandRecorded = false;
+  }
+  
+  /**
+   * Queue a motion command for the current frame and record its latency
+   * (first command of each frame only)
+   */
+  static BaseType_t queueFrameCommand(const MotionCommand& cmd) {
+    BaseType_t result = StepperController::queueMotionCommand(cmd);
+    if (result == pdTRUE && !frameCommandRecorded) {
+      frameCommandRecorded = true;
+      uint32_t latency = micros() - currentFrameUs;
+      frameStats.commandFrames++;
+      latencySumUs += latency;
+      frameStats.latencyAvgUs = (uint32_t)(latencySumUs / frameStats.commandFrames);
+      if (latency > frameStats.latencyMaxUs) frameStats.latencyMaxUs = latency;
+      for (uint8_t i = 0; i < LATENCY_BUCKETS; i++) {
+        if (latency <= LATENCY_BUCKET_US[i]) {
+          frameStats.latencyBuckets[i]++;
+          break;
+        }
+      }
+    }
+    return result;
+  }
+  
   // ----------------------------------------------------------------------------
   // Process DMX Channels and Generate Motion Commands
   // ----------------------------------------------------------------------------
@@ -145,7 +297,7 @@ namespace DMXReceiver {
       static uint32_t lastDisconnectWarning = 0;
       if (millis() - lastDisconnectWarning > 5000) {
         lastDisconnectWarning = millis();
-        Serial.printf("[DMX] Warning: DMX not connected - waiting for signal (timeout=%lums)\n", signalTimeout);
+        CORE_LOG_WARN("[DMX] Warning: DMX not connected - waiting for signal (timeout=%lums)", signalTimeout);
       }
       return;
     }
@@ -156,14 +308,14 @@ namespace DMXReceiver {
     // If homing just started, set our flag
     if (currentlyHoming && !homingInProgress) {
       homingInProgress = true;
-      Serial.println("[DMX] Homing in progress - ignoring all DMX input");
+      CORE_LOG_INFO("[DMX] Homing in progress - ignoring all DMX input");
     }
     
     // If homing just completed, clear our flag and resume DMX processing
     if (!currentlyHoming && homingInProgress) {
       homingInProgress = false;
       homingTriggeredByDMX = false;
-      Serial.println("[DMX] Homing complete - resuming DMX processing");
+      CORE_LOG_INFO("[DMX] Homing complete - resuming DMX processing");
       // Reset mode to STOP to prevent immediate re-triggering
       currentMode = DMXMode::STOP;
     }
@@ -173,27 +325,24 @@ namespace DMXReceiver {
       return;  // Don't process any DMX channels during homing
     }
     
-    // Get current channel values with mutex protection
-    uint8_t channels[5] = {0};
-    if (xSemaphoreTake(channelCacheMutex, pdMS_TO_TICKS(10)) == pdTRUE) {
-      memcpy(channels, channelCache, NUM_CHANNELS);
-      xSemaphoreGive(channelCacheMutex);
-    } else {
-      // Failed to get mutex, use last known values
+    // Channels of the newest frame (published by this task - no lock needed)
+    const UniverseFrame* frame = publishedFrame.load(std::memory_order_relaxed);
+    if (!frame) {
       return;
     }
+    const uint8_t* channels = frame->channels;
+    const DMXPersonality::Values& values = frame->values;
     
     // Detect mode with hysteresis
-    DMXMode newMode = detectModeWithHysteresis(channels[CH_MODE]);
+    DMXMode newMode = detectModeWithHysteresis(values.mode);
     
     // Check if system needs homing
     bool homingRequired = !StepperController::isHomed() || StepperController::isLimitFaultActive();
     
     // Handle mode transitions
     if (newMode != currentMode) {
-      Serial.printf("[DMX] Mode change: %s -> %s\n",
-        currentMode == DMXMode::STOP ? "STOP" : (currentMode == DMXMode::CONTROL ? "CONTROL" : "HOME"),
-        newMode == DMXMode::STOP ? "STOP" : (newMode == DMXMode::CONTROL ? "CONTROL" : "HOME"));
+      CORE_LOG_INFO("[DMX] Mode change: %s -> %s", modeName(currentMode), modeName(newMode));
+      MotionTrace::record(MotionTrace::Event::DMX_MODE, (uint8_t)newMode, 0, (int32_t)currentMode);
       
       lastMode = currentMode;
       currentMode = newMode;
@@ -207,7 +356,7 @@ namespace DMXReceiver {
             stopCmd.type = CommandType::STOP;
             stopCmd.timestamp = millis();
             stopCmd.commandId = 0;
-            xQueueSend(g_motionCommandQueue, &stopCmd, 0);
+            queueFrameCommand(stopCmd);
           }
           break;
           
@@ -219,23 +368,29 @@ namespace DMXReceiver {
             homeCmd.type = CommandType::HOME;
             homeCmd.timestamp = millis();
             homeCmd.commandId = 0;
-            if (xQueueSend(g_motionCommandQueue, &homeCmd, 0) == pdTRUE) {
+            if (queueFrameCommand(homeCmd) == pdTRUE) {
               homingTriggeredByDMX = true;
-              Serial.println("[DMX] Homing command sent - DMX input will be ignored until complete");
+              CORE_LOG_INFO("[DMX] Homing command sent - DMX input will be ignored until complete");
             }
           }
           break;
           
+        case DMXMode::CUE:
+          // Entering CUE mode always plays the selected cue, even if it played last time
+          triggeredCue = -1;
+          candidateCue = -1;
+          consecutiveCueReads = 0;
+          // Fall through - same homing check as CONTROL
         case DMXMode::CONTROL:
           // Check if system allows movement
           if (homingRequired) {
-            Serial.println("[DMX] CONTROL mode blocked - homing required");
+            CORE_LOG_WARN("[DMX] %s mode blocked - homing required", modeName(newMode));
             // Optionally send a stop command to ensure no movement
             MotionCommand stopCmd;
             stopCmd.type = CommandType::STOP;
             stopCmd.timestamp = millis();
             stopCmd.commandId = 0;
-            xQueueSend(g_motionCommandQueue, &stopCmd, 0);
+            queueFrameCommand(stopCmd);
           }
           break;
       }
@@ -244,47 +399,50 @@ namespace DMXReceiver {
     // Process position control in CONTROL mode only if system is homed
     if (currentMode == DMXMode::CONTROL && !homingRequired) {
       
-      // Calculate position from DMX values
-      float positionPercent;
-      if (use16BitPosition) {
-        // 16-bit mode: combine MSB and LSB
-        // Check for stuck LSB (DMX signal issue)
+      // Position as a Q0.16 fraction of the range, as decoded by the personality
+      uint16_t positionFraction = values.value[(uint8_t)DMXPersonality::Role::POSITION];
+      const DMXPersonality::DecodeOp* positionOp = DMXPersonality::findOp(decoder, DMXPersonality::Role::POSITION);
+      bool lsbStuckAtZero = false;
+      if (positionOp && positionOp->fine != DMXPersonality::NO_FINE) {
+        // 16-bit position: check for stuck fine channel (DMX signal issue)
         static uint8_t lastLSB = 0;
         static uint32_t lsbStuckCount = 0;
+        uint8_t msb = channels[positionOp->coarse];
+        uint8_t lsb = channels[positionOp->fine];
+        lsbStuckAtZero = (msb > 0 && lsb == 0);
         
-        if (channels[CH_POSITION_MSB] > 0 && channels[CH_POSITION_LSB] == 0 && lastLSB > 0) {
+        if (lsbStuckAtZero && lastLSB > 0) {
           // LSB might be stuck at 0
           lsbStuckCount++;
           if (lsbStuckCount > 3) {
-            // Silently switch to 8-bit mode temporarily
-            positionPercent = (channels[CH_POSITION_MSB] / 255.0f) * 100.0f;
+            // Silently fall back to 8-bit resolution temporarily
+            positionFraction = DMXPersonality::shape(*positionOp, FixedPoint::fractionFrom8(msb));
           } else {
             // Use last known good LSB value
-            uint16_t pos16 = (static_cast<uint16_t>(channels[CH_POSITION_MSB]) << 8) | lastLSB;
-            positionPercent = (pos16 / 65535.0f) * 100.0f;
+            positionFraction = DMXPersonality::shape(*positionOp, FixedPoint::fractionFrom16(msb, lastLSB));
           }
         } else {
           lsbStuckCount = 0;
-          if (channels[CH_POSITION_LSB] > 0) {
-            lastLSB = channels[CH_POSITION_LSB];
+          if (lsb > 0) {
+            lastLSB = lsb;
           }
-          uint16_t pos16 = (static_cast<uint16_t>(channels[CH_POSITION_MSB]) << 8) | channels[CH_POSITION_LSB];
-          positionPercent = (pos16 / 65535.0f) * 100.0f;
         }
-      } else {
-        // 8-bit mode: use MSB only
-        positionPercent = (channels[CH_POSITION_MSB] / 255.0f) * 100.0f;
       }
       
+      // Speed and acceleration at 8-bit resolution for change detection
+      uint16_t speedFraction = values.value[(uint8_t)DMXPersonality::Role::SPEED];
+      uint16_t accelFraction = values.value[(uint8_t)DMXPersonality::Role::ACCELERATION];
+      uint8_t speedValue = speedFraction >> 8;
+      uint8_t accelValue = accelFraction >> 8;
+      
       // Get position limits from StepperController
       int32_t minPos, maxPos;
       if (!StepperController::getPositionLimits(minPos, maxPos)) {
         return;  // Can't get limits
       }
       
-      // Calculate actual target position
-      int32_t range = maxPos - minPos;
-      int32_t targetPosition = minPos + (int32_t)((range * positionPercent) / 100.0f);
+      // Calculate actual target position (integer math, rounded to nearest step)
+      int32_t targetPosition = FixedPoint::lerp(minPos, maxPos, positionFraction);
       
       // Get current position to check if we need to send a command
       int32_t currentPos = StepperController::getCurrentPosition();
@@ -292,8 +450,8 @@ namespace DMXReceiver {
       
       // Check if position, speed, or acceleration changed significantly
       bool positionChanged = (lastTargetPosition == -1 || abs(targetPosition - lastTargetPosition) > 2);
-      bool speedChanged = (abs(channels[CH_SPEED] - lastSpeedValue) > 2);  // Small threshold to prevent jitter
-      bool accelChanged = (abs(channels[CH_ACCELERATION] - lastAccelValue) > 2);
+      bool speedChanged = (abs(speedValue - lastSpeedValue) > 2);  // Small threshold to prevent jitter
+      bool accelChanged = (abs(accelValue - lastAccelValue) > 2);
       
       // Check if we've been idle for too long (position tracking timeout)
       static uint32_t lastPositionUpdateTime = 0;
@@ -303,17 +461,24 @@ namespace DMXReceiver {
       // This ensures we detect changes even after idle periods
       bool atTargetPosition = (abs(currentPos - targetPosition) < 3);  // Within 3 steps of target
       
+      // Once follow mode has seen the setpoint held, a move still inside its
+      // ETA is already heading there - resending it every frame is redundant
+      static bool setpointHoldSent = false;
+      bool enRoute = !positionChanged && setpointHoldSent && isMoving &&
+                     StepperController::getTimeToArrival() > 0;
+      bool setpointMoved = positionChanged;
+      
       // Force update if position changed OR if we've been idle too long OR DMX position differs from actual
-      if (positionChanged || positionTimeout || !atTargetPosition) {
+      if (positionChanged || positionTimeout || (!atTargetPosition && !enRoute)) {
         lastPositionUpdateTime = millis();
         positionChanged = true;  // Force position update
         
         // Debug output when forcing update
         if (positionTimeout) {
-          Serial.println("[DMX] Position timeout - forcing update");
+          CORE_LOG_INFO("[DMX] Position timeout - forcing update");
         }
         if (!atTargetPosition && !positionChanged) {
-          Serial.printf("[DMX] Position mismatch - Current: %d, DMX Target: %d\n", currentPos, targetPosition);
+          CORE_LOG_INFO("[DMX] Position mismatch - Current: %d, DMX Target: %d", currentPos, targetPosition);
         }
       }
       
@@ -324,24 +489,27 @@ namespace DMXReceiver {
       SystemConfig* config = SystemConfigMgr::getConfig();
       if (!config) return;
       
-      // Calculate actual speed and acceleration from DMX values
-      float actualSpeed, actualAccel;
+      // Calculate actual speed and acceleration from DMX values (milli-units)
+      // Converted to steps/sec only when a command is built
       
-      // Scale DMX values to actual speed (0 = minimum, 255 = maximum)
+      // Scale decoded values to actual speed (0 = minimum, full scale = maximum;
+      // full scale when the personality has no speed channel)
       // Use a minimum speed of 10 steps/sec to prevent stalling
-      float speedPercent = (channels[CH_SPEED] / 255.0f) * 100.0f;
-      actualSpeed = 10.0f + ((config->defaultProfile.maxSpeed - 10.0f) * speedPercent) / 100.0f;
+      int32_t speedMilli = FixedPoint::lerp(DMX_MIN_RATE_MILLI,
+                                            FixedPoint::toMilli(config->defaultProfile.maxSpeed),
+                                            speedFraction);
       
-      // Scale DMX values to actual acceleration (0 = minimum, 255 = maximum)
+      // Scale decoded values to actual acceleration (0 = minimum, full scale = maximum)
       // Use a minimum acceleration of 10 steps/sec² 
-      float accelPercent = (channels[CH_ACCELERATION] / 255.0f) * 100.0f;
-      actualAccel = 10.0f + ((config->defaultProfile.acceleration - 10.0f) * accelPercent) / 100.0f;
+      int32_t accelMilli = FixedPoint::lerp(DMX_MIN_RATE_MILLI,
+                                            FixedPoint::toMilli(config->defaultProfile.acceleration),
+                                            accelFraction);
       
       // Debug output every 1 second showing all values
       static uint32_t lastDebugPrintTime = 0;
       static int32_t lastDebugPosition = -1;
-      static float lastDebugSpeed = -1;
-      static float lastDebugAccel = -1;
+      static int32_t lastDebugSpeed = -1;
+      static int32_t lastDebugAccel = -1;
       static uint32_t lastTaskAliveTime = 0;
       
       if (DMX_DEBUG_ENABLED && millis() - lastDebugPrintTime >= 1000) {  // Every 1 second
@@ -349,66 +517,58 @@ namespace DMXReceiver {
         
         // Check what changed since last print
         bool posChanged = (lastDebugPosition != targetPosition);
-        bool spdChanged = (lastDebugSpeed != actualSpeed);
-        bool accChanged = (lastDebugAccel != actualAccel);
+        bool spdChanged = (lastDebugSpeed != speedMilli);
+        bool accChanged = (lastDebugAccel != accelMilli);
         
-        // Check for anomalies
-        bool lsbStuckAtZero = (channels[CH_POSITION_MSB] > 0 && channels[CH_POSITION_LSB] == 0);
+        // Change indicators, indexed by pos | spd << 1 | acc << 2 (one record per line)
+        static const char* const CHANGE_TAGS[8] = {
+          "", " [Changed: POS]", " [Changed: SPD]", " [Changed: POS SPD]",
+          " [Changed: ACC]", " [Changed: POS ACC]", " [Changed: SPD ACC]", " [Changed: POS SPD ACC]"
+        };
+        uint8_t changeIndex = (posChanged ? 1 : 0) | (spdChanged ? 2 : 0) | (accChanged ? 4 : 0);
         
         // Always print current values
-        Serial.printf("[DMX] Pos: %d (%.1f%%) Spd: %.0f Acc: %.0f | Current: %d | Moving: %s",
-                      targetPosition, positionPercent, actualSpeed, actualAccel,
-                      currentPos, isMoving ? "YES" : "NO");
-        
-        // Add change indicators
-        if (posChanged || spdChanged || accChanged) {
-          Serial.print(" [Changed:");
-          if (posChanged) Serial.print(" POS");
-          if (spdChanged) Serial.print(" SPD");
-          if (accChanged) Serial.print(" ACC");
-          Serial.print("]");
-        }
-        
-        // Add DMX channel raw values for reference
-        Serial.printf(" | DMX[%d,%d,%d,%d,%d]", 
-                      channels[CH_POSITION_MSB], channels[CH_POSITION_LSB],
-                      channels[CH_SPEED], channels[CH_ACCELERATION],
-                      channels[CH_MODE]);
+        CORE_LOG_DEBUG("[DMX] Pos: %d (%.1f%%) Spd: %.0f Acc: %.0f | Current: %d | Moving: %s%s",
+                       targetPosition, FixedPoint::fractionToPercent(positionFraction),
+                       FixedPoint::fromMilli(speedMilli), FixedPoint::fromMilli(accelMilli),
+                       currentPos, isMoving ? "YES" : "NO", CHANGE_TAGS[changeIndex]);
         
-        // Warn about anomalies
-        if (lsbStuckAtZero) {
-          Serial.print(" [LSB STUCK!]");
-        }
-        
-        Serial.println();
+        // Raw channel values for reference (before curve and range), with the anomaly warning
+        CORE_LOG_DEBUG("[DMX]   P%d raw pos %u spd %u acc %u mode %d%s", decoder.slot,
+                       values.raw[(uint8_t)DMXPersonality::Role::POSITION],
+                       values.raw[(uint8_t)DMXPersonality::Role::SPEED],
+                       values.raw[(uint8_t)DMXPersonality::Role::ACCELERATION],
+                       values.mode, lsbStuckAtZero ? " [LSB STUCK!]" : "");
         
         // Task alive status removed to clean up serial output
         
         // Update last values
         lastDebugPosition = targetPosition;
-        lastDebugSpeed = actualSpeed;
-        lastDebugAccel = actualAccel;
+        lastDebugSpeed = speedMilli;
+        lastDebugAccel = accelMilli;
       }
       
       // Send command if any parameter changed and update is needed
       if (needsUpdate) {
         
-        // Create motion command
+        // Stream the setpoint in follow mode - StepperController carries the
+        // current velocity into each new target instead of stopping at every frame
         MotionCommand cmd;
-        cmd.type = CommandType::MOVE_ABSOLUTE;
+        cmd.type = CommandType::FOLLOW_TARGET;
         cmd.profile = config->defaultProfile;  // Start with current profile
         cmd.profile.targetPosition = targetPosition;
-        cmd.profile.maxSpeed = actualSpeed;
-        cmd.profile.acceleration = actualAccel;
-        cmd.profile.deceleration = actualAccel;  // Same as acceleration
+        cmd.profile.maxSpeed = FixedPoint::fromMilli(speedMilli);
+        cmd.profile.acceleration = FixedPoint::fromMilli(accelMilli);
+        cmd.profile.deceleration = cmd.profile.acceleration;  // Same as acceleration
         cmd.timestamp = millis();
         cmd.commandId = 0;
         
         // Send command to StepperController (non-blocking)
-        if (xQueueSend(g_motionCommandQueue, &cmd, 0) == pdTRUE) {
+        if (queueFrameCommand(cmd) == pdTRUE) {
+          setpointHoldSent = !setpointMoved;
           lastTargetPosition = targetPosition;
-          lastSpeedValue = channels[CH_SPEED];
-          lastAccelValue = channels[CH_ACCELERATION];
+          lastSpeedValue = speedValue;
+          lastAccelValue = accelValue;
           
           // Command sent - no need for additional logging here as debug output handles it
         }
@@ -418,8 +578,26 @@ namespace DMXReceiver {
       static uint32_t lastHomingWarning = 0;
       if (millis() - lastHomingWarning > 5000) {
         lastHomingWarning = millis();
-        Serial.println("[DMX] Position control blocked - system requires homing");
-        Serial.println("[DMX] Set mode channel to 255 to initiate homing");
+        CORE_LOG_WARN("[DMX] Position control blocked - system requires homing");
+        CORE_LOG_INFO("[DMX] Set mode channel to 255 to initiate homing");
+      }
+    } else if (currentMode == DMXMode::CUE && !homingRequired) {
+      // Play a cue once its selection has settled; holding the value does not retrigger
+      int8_t selectedCue = cueForModeValue(values.mode);
+      if (selectedCue != candidateCue) {
+        candidateCue = selectedCue;
+        consecutiveCueReads = 0;
+      }
+      if (selectedCue != triggeredCue && ++consecutiveCueReads >= CUE_TRIGGER_COUNT) {
+        MotionCommand cueCmd = {};
+        cueCmd.type = CommandType::CUE_PLAY;
+        cueCmd.cueId = selectedCue;
+        cueCmd.timestamp = millis();
+        cueCmd.commandId = 0;
+        if (queueFrameCommand(cueCmd)) {
+          triggeredCue = selectedCue;
+          CORE_LOG_INFO("[DMX] Cue %d triggered", selectedCue);
+        }
       }
     } else if (currentMode != DMXMode::CONTROL) {
       // Debug output for non-CONTROL modes
@@ -428,11 +606,9 @@ namespace DMXReceiver {
       
       if (millis() - lastModeDebugTime >= 5000) {  // Every 5 seconds when not in control
         lastModeDebugTime = millis();
-        Serial.printf("[DMX] Mode: %s | DMX Channels[%d,%d,%d,%d,%d] | Homing Required: %s\n",
-                      currentMode == DMXMode::STOP ? "STOP" : 
-                      (currentMode == DMXMode::HOME ? "HOME" : "UNKNOWN"),
-                      channels[0], channels[1], channels[2], channels[3], channels[4],
-                      homingRequired ? "YES" : "NO");
+        CORE_LOG_DEBUG("[DMX] Mode: %s | Mode channel %d (P%d) | Homing Required: %s",
+                       modeName(currentMode), values.mode, decoder.slot,
+                       homingRequired ? "YES" : "NO");
         
         // Task alive status removed to clean up serial output
       }
@@ -443,7 +619,7 @@ namespace DMXReceiver {
     if (millis() - lastConnectionDebugTime >= 10000) {  // Every 10 seconds
       lastConnectionDebugTime = millis();
       if (!dmxConnected) {
-        Serial.println("[DMX] WARNING: No DMX signal detected");
+        CORE_LOG_WARN("[DMX] WARNING: No DMX signal detected");
       }
     }
   }
@@ -453,35 +629,50 @@ namespace DMXReceiver {
   // ----------------------------------------------------------------------------
   
   /**
-   * Update channel cache from DMX data
+   * Fill a frame's validated and decoded channels from its universe data
+   * @param frame Frame being written (not yet published)
    */
-  static void updateChannelCache() {
+  static void updateChannelCache(UniverseFrame& frame) {
+    const uint8_t footprint = decoder.footprint;
+    const uint8_t modeChannel = decoder.modeChannel;
+    
+    // Validated channels of the previous frame (zeros before the first)
+    static const uint8_t NO_CHANNELS[MAX_CHANNELS] = {0};
+    const UniverseFrame* previousFrame = publishedFrame.load(std::memory_order_relaxed);
+    const uint8_t* channelCache = previousFrame ? previousFrame->channels : NO_CHANNELS;
+    
+    frame.channelCount = footprint;
+    memset(frame.channels, 0, MAX_CHANNELS);
+    
     // Ensure base channel + our channels don't exceed 512
-    if (baseChannel + NUM_CHANNELS - 1 > 512) {
+    if (baseChannel + footprint - 1 > 512) {
+      memcpy(frame.channels, channelCache, footprint);
+      DMXPersonality::decode(decoder, frame.channels, frame.values);
       return;
     }
     
-    // Save previous values for comparison
-    static uint8_t previousCache[NUM_CHANNELS] = {0};
+    // Previous raw values for comparison
     bool hadNonZeroValues = false;
-    for (int i = 0; i < NUM_CHANNELS; i++) {
+    for (int i = 0; i < footprint; i++) {
       if (previousCache[i] > 0) {
         hadNonZeroValues = true;
         break;
       }
     }
     
-    // Create temporary buffer for reading
-    uint8_t tempBuffer[NUM_CHANNELS];
-    
-    // Use the efficient readChannels method to read our 5 channels at once
-    uint16_t channelsRead = dmx.readChannels(tempBuffer, baseChannel, NUM_CHANNELS);
+    // Our channels from the snapshot
+    uint8_t tempBuffer[MAX_CHANNELS];
+    uint16_t channelsRead = (frame.slots >= baseChannel) ? frame.slots - baseChannel + 1 : 0;
+    if (channelsRead > footprint) {
+      channelsRead = footprint;
+    }
+    memcpy(tempBuffer, &frame.data[baseChannel - 1], channelsRead);
     
     // Check if we got all channels
-    if (channelsRead != NUM_CHANNELS) {
+    if (channelsRead != footprint) {
       // Partial read - might indicate a short DMX universe
-      Serial.printf("[DMX] Warning: Only read %d of %d channels\n", channelsRead, NUM_CHANNELS);
-      for (uint16_t i = channelsRead; i < NUM_CHANNELS; i++) {
+      CORE_LOG_WARN("[DMX] Warning: Only read %d of %d channels", channelsRead, footprint);
+      for (uint16_t i = channelsRead; i < footprint; i++) {
         tempBuffer[i] = 0;  // Clear unread channels
       }
     }
@@ -492,72 +683,77 @@ namespace DMXReceiver {
     // Check for suspicious patterns (all 255s, all 0s except one channel)
     int zeroCount = 0;
     int ffCount = 0;
-    for (int i = 0; i < NUM_CHANNELS; i++) {
+    for (int i = 0; i < footprint; i++) {
       if (tempBuffer[i] == 0) zeroCount++;
       if (tempBuffer[i] == 255) ffCount++;
     }
     
-    // Suspicious if all channels are 255, or 4 channels are 0 and one is 255
-    if (ffCount == NUM_CHANNELS || (zeroCount == NUM_CHANNELS - 1 && ffCount == 1)) {
+    // Suspicious if all channels are 255, or all but one are 0 and that one is 255
+    // (too common in a legitimate frame to judge layouts under 4 channels)
+    if (footprint >= 4 && (ffCount == footprint || (zeroCount == footprint - 1 && ffCount == 1))) {
       dataValid = false;
-      Serial.printf("[DMX] Suspicious data pattern detected: zeros=%d, 255s=%d\n", zeroCount, ffCount);
+      CORE_LOG_INFO("[DMX] Suspicious data pattern detected: zeros=%d, 255s=%d", zeroCount, ffCount);
     }
     
     // Special validation for mode channel (255 = homing)
-    if (tempBuffer[CH_MODE] == 255) {
+    if (tempBuffer[modeChannel] == 255) {
       // Check if this is a sudden spike
-      if (previousCache[CH_MODE] < 250) {
+      if (previousCache[modeChannel] < 250) {
         consecutiveHomeReads++;
         if (consecutiveHomeReads < HOME_TRIGGER_COUNT) {
           // Not enough consecutive reads, use previous value
-          tempBuffer[CH_MODE] = previousCache[CH_MODE];
-          Serial.printf("[DMX] Mode=255 detected, count=%d/%d, filtering...\n", 
-                       consecutiveHomeReads, HOME_TRIGGER_COUNT);
+          tempBuffer[modeChannel] = previousCache[modeChannel];
+          CORE_LOG_DEBUG("[DMX] Mode=255 detected, count=%d/%d, filtering...", 
+                        consecutiveHomeReads, HOME_TRIGGER_COUNT);
         } else {
-          Serial.println("[DMX] Mode=255 confirmed after multiple reads, allowing HOME trigger");
+          CORE_LOG_INFO("[DMX] Mode=255 confirmed after multiple reads, allowing HOME trigger");
         }
       }
     } else {
       consecutiveHomeReads = 0;  // Reset counter
     }
     
-    // Update cache with mutex protection
-    if (xSemaphoreTake(channelCacheMutex, pdMS_TO_TICKS(10)) == pdTRUE) {
+    // Store the validated channels with the frame
+    {
       if (dataValid) {
         // Check for significant changes before updating
         bool significantChange = false;
-        for (int i = 0; i < NUM_CHANNELS; i++) {
+        for (int i = 0; i < footprint; i++) {
           int diff = abs(tempBuffer[i] - channelCache[i]);
-          if (diff > 5 && i != CH_MODE) {  // Allow small changes, except mode
+          if (diff > 5 && i != modeChannel) {  // Allow small changes, except mode
             significantChange = true;
           }
-          if (i == CH_MODE && tempBuffer[i] != channelCache[i]) {
+          if (i == modeChannel && tempBuffer[i] != channelCache[i]) {
             // Mode change is always significant
             significantChange = true;
-            Serial.printf("[DMX] Mode channel changing: %d -> %d\n", channelCache[i], tempBuffer[i]);
+            CORE_LOG_DEBUG("[DMX] Mode channel changing: %d -> %d", channelCache[i], tempBuffer[i]);
           }
         }
         
+        memcpy(frame.channels, tempBuffer, footprint);
+        memcpy(lastValidChannels, tempBuffer, footprint);
+        DMXPersonality::decode(decoder, frame.channels, frame.values);
+        
         if (significantChange) {
-          Serial.printf("[DMX] Channel update: [%d,%d,%d,%d,%d] -> [%d,%d,%d,%d,%d]\n",
-                       channelCache[0], channelCache[1], channelCache[2], channelCache[3], channelCache[4],
-                       tempBuffer[0], tempBuffer[1], tempBuffer[2], tempBuffer[3], tempBuffer[4]);
+          const DMXPersonality::Values& values = frame.values;
+          CORE_LOG_DEBUG("[DMX] Channel update: pos %.1f%% spd %.1f%% acc %.1f%% mode %d",
+                        FixedPoint::fractionToPercent(values.value[(uint8_t)DMXPersonality::Role::POSITION]),
+                        FixedPoint::fractionToPercent(values.value[(uint8_t)DMXPersonality::Role::SPEED]),
+                        FixedPoint::fractionToPercent(values.value[(uint8_t)DMXPersonality::Role::ACCELERATION]),
+                        values.mode);
         }
-        
-        memcpy(channelCache, tempBuffer, NUM_CHANNELS);
-        memcpy(lastValidChannels, tempBuffer, NUM_CHANNELS);
       } else {
         // Use last known good values
-        Serial.println("[DMX] Invalid data detected, using last known good values");
-        memcpy(channelCache, lastValidChannels, NUM_CHANNELS);
+        CORE_LOG_INFO("[DMX] Invalid data detected, using last known good values");
+        memcpy(frame.channels, lastValidChannels, footprint);
+        DMXPersonality::decode(decoder, frame.channels, frame.values);
       }
-      xSemaphoreGive(channelCacheMutex);
     }
     
     // Check if all values went to zero
     bool allZeros = true;
-    for (int i = 0; i < NUM_CHANNELS; i++) {
-      if (channelCache[i] != 0) {
+    for (int i = 0; i < footprint; i++) {
+      if (frame.channels[i] != 0) {
         allZeros = false;
         break;
       }
@@ -565,14 +761,12 @@ namespace DMXReceiver {
     
     // Debug if values suddenly went to all zeros
     if (allZeros && hadNonZeroValues) {
-      Serial.println("[DMX] WARNING: All channel values suddenly went to 0!");
-      Serial.printf("[DMX] Previous values were: [%d,%d,%d,%d,%d]\n",
-                    previousCache[0], previousCache[1], previousCache[2], 
-                    previousCache[3], previousCache[4]);
+      CORE_LOG_WARN("[DMX] WARNING: All channel values suddenly went to 0!");
+      CORE_LOG_INFO("[DMX] Previous mode channel value was %d", previousCache[modeChannel]);
     }
     
     // Save current values for next comparison
-    memcpy(previousCache, tempBuffer, NUM_CHANNELS);  // Use tempBuffer, not channelCache
+    memcpy(previousCache, tempBuffer, footprint);  // Use tempBuffer, not the validated channels
   }
   
   /**
@@ -582,23 +776,90 @@ namespace DMXReceiver {
     if (dmxConnected && (millis() - lastPacketTime > signalTimeout)) {
       dmxConnected = false;
       currentState = DMXState::TIMEOUT;
-      Serial.printf("[DMX] Signal timeout - no packets for %lums (timeout=%lums)\n", 
+      CORE_LOG_INFO("[DMX] Signal timeout - no packets for %lums (timeout=%lums)", 
                     millis() - lastPacketTime, signalTimeout);
     }
   }
   
+  /**
+   * Start a frame: take a pending personality switch and pick the buffer
+   * readers are not using (marked torn until publishFrame)
+   */
+  static UniverseFrame& beginFrame() {
+    // Switch personality between frames, never inside one
+    if (decoderQueue && xQueueReceive(decoderQueue, &decoder, 0) == pdTRUE) {
+      memset(lastValidChannels, 0, sizeof(lastValidChannels));
+      memset(previousCache, 0, sizeof(previousCache));
+      consecutiveHomeReads = 0;
+      lastTargetPosition = -1;  // Resend the position decoded with the new layout
+      // Slot only - CoreLog keeps %s arguments as pointers and decoder is
+      // overwritten by the next switch before the drain task formats it
+      CORE_LOG_INFO("[DMX] Personality %d active - %d channels",
+                    decoder.slot, decoder.footprint);
+    }
+    
+    const UniverseFrame* previousFrame = publishedFrame.load(std::memory_order_relaxed);
+    UniverseFrame& frame = (previousFrame == &frames[0]) ? frames[1] : frames[0];
+    frame.sequence.store(0, std::memory_order_relaxed);  // Mark torn for late readers
+    std::atomic_thread_fence(std::memory_order_release);
+    return frame;
+  }
+  
+  /**
+   * Validate, decode and publish a frame whose universe data is filled in
+   * @param frame Frame from beginFrame()
+   * @param frameUs micros() when the frame was seen
+   */
+  static void publishFrame(UniverseFrame& frame, uint32_t frameUs) {
+    dmxConnected = true;
+    currentState = DMXState::SIGNAL_PRESENT;
+    lastPacketTime = millis();
+    
+    frame.timestamp = frameUs;
+    updateChannelCache(frame);
+    
+    // Publish it (universeSequence skips 0, which marks a frame being written)
+    if (++universeSequence == 0) {
+      universeSequence = 1;
+    }
+    frame.sequence.store(universeSequence, std::memory_order_release);
+    publishedFrame.store(&frame, std::memory_order_release);
+    lastChannelUpdateTime = millis();
+    
+    // Check if all channels went to 0 (force position update when values return)
+    static bool allChannelsWereZero = false;
+    bool allChannelsZero = true;
+    for (int i = 0; i < frame.channelCount; i++) {
+      if (frame.channels[i] != 0) {
+        allChannelsZero = false;
+        break;
+      }
+    }
+    
+    // Force position update when channels return from all-zero state
+    if (!allChannelsZero && allChannelsWereZero) {
+      lastTargetPosition = -1;  // Force position sync
+    }
+    allChannelsWereZero = allChannelsZero;
+    
+    // Update system status
+    SAFE_WRITE_STATUS(dmxState, DMXState::SIGNAL_PRESENT);
+    SAFE_WRITE_STATUS(lastDMXUpdate, lastPacketTime);
+  }
+  
   /**
    * DMX task running on Core 0
+   * Sleeps until the frame watcher (UART) or NetworkDMX (network input)
+   * reports a new frame and processes each frame once; wakes every
+   * HOUSEKEEPING_MS without frames for the signal timeout, watchdog and
+   * health stamp
    */
   static void dmxTask(void* parameter) {
-    TickType_t xLastWakeTime = xTaskGetTickCount();
-    const TickType_t xFrequency = pdMS_TO_TICKS(10);  // 10ms update rate
-    
     // Add this task to watchdog
     esp_task_wdt_add(NULL);
     
-    Serial.println("[DMX] Task started on Core 0");
-    Serial.println("[DMX] Watchdog timer active (10s timeout)");
+    CORE_LOG_INFO("[DMX] Task started on Core 0");
+    CORE_LOG_INFO("[DMX] Watchdog timer active (10s timeout)");
     uint32_t loopCount = 0;
     uint32_t lastWdtFeed = 0;
     
@@ -607,59 +868,67 @@ namespace DMXReceiver {
       g_lastTaskUpdate = millis();
       loopCount++;
       
+      // Wait for the next frame (or the housekeeping period)
+      bool newFrame = ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(HOUSEKEEPING_MS)) > 0;
+      uint32_t frameUs = frameSeenUs;
+      
+      if (inputSource == DMXInput::NETWORK) {
+        // Network input - the newest universe handed over by NetworkDMX
+        lastPacketCount = dmx.getPacketCount();  // Keep the UART counter in step for a switch back
+        newFrame = networkQueue && xQueueReceive(networkQueue, &networkFrame, 0) == pdTRUE;
+        if (newFrame) {
+          recordFrame(networkFrame.timestamp, 0);  // Superseded packets are counted by NetworkDMX
+          networkPackets++;
+          totalPackets = networkPackets;
+          UniverseFrame& frame = beginFrame();
+          frame.slots = networkFrame.slots;
+          memcpy(frame.data, networkFrame.data, networkFrame.slots);
+          if (frame.slots < DMX_UNIVERSE_SIZE) {
+            memset(frame.data + frame.slots, 0, DMX_UNIVERSE_SIZE - frame.slots);
+          }
+          publishFrame(frame, networkFrame.timestamp);
+        }
+      }
       // Check if DMX is connected
-      if (dmx.isConnected()) {
+      else if (dmx.isConnected()) {
         // Check if we have new packets
         uint32_t currentPacketCount = dmx.getPacketCount();
         if (currentPacketCount > lastPacketCount) {
           // New packet(s) received
-          dmxConnected = true;
-          currentState = DMXState::SIGNAL_PRESENT;
-          lastPacketTime = millis();
+          if (!newFrame) {
+            frameUs = micros();  // Watcher has not fired yet - count the frame from now
+          }
+          recordFrame(frameUs, (lastPacketCount > 0) ? currentPacketCount - lastPacketCount - 1 : 0);
+          newFrame = true;
           totalPackets = currentPacketCount;
           errorPackets = dmx.getErrorCount();
           lastPacketCount = currentPacketCount;
           
-          // Update our channel cache
-          updateChannelCache();
-          lastChannelUpdateTime = millis();
-          
-          // Check if all channels went to 0 (force position update when values return)
-          static bool allChannelsWereZero = false;
-          bool allChannelsZero = true;
-          for (int i = 0; i < NUM_CHANNELS; i++) {
-            if (channelCache[i] != 0) {
-              allChannelsZero = false;
-              break;
-            }
-          }
-          
-          // Force position update when channels return from all-zero state
-          if (!allChannelsZero && allChannelsWereZero) {
-            lastTargetPosition = -1;  // Force position sync
+          // Snapshot the universe into the buffer readers are not using
+          UniverseFrame& frame = beginFrame();
+          frame.slots = dmx.readChannels(frame.data, 1, DMX_UNIVERSE_SIZE);
+          if (frame.slots < DMX_UNIVERSE_SIZE) {
+            memset(frame.data + frame.slots, 0, DMX_UNIVERSE_SIZE - frame.slots);
           }
-          allChannelsWereZero = allChannelsZero;
-          
-          // Update system status
-          SAFE_WRITE_STATUS(dmxState, DMXState::SIGNAL_PRESENT);
-          SAFE_WRITE_STATUS(lastDMXUpdate, lastPacketTime);
+          publishFrame(frame, frameUs);
+        } else {
+          newFrame = false;  // Counter already taken on an earlier wake
         }
       } else {
         // No DMX signal
+        newFrame = false;
         if (dmxConnected) {
           dmxConnected = false;
           currentState = DMXState::NO_SIGNAL;
-          Serial.println("[DMX] Signal lost");
+          CORE_LOG_INFO("[DMX] Signal lost");
         }
       }
       
       // Check for timeout (redundant with library's isConnected, but allows custom timeout)
       checkSignalTimeout();
       
-      // Always process DMX channels if we have a valid signal
-      // Use the cached values from the last valid packet
-      if (dmxConnected) {
-        // Don't update cache here - only use what was cached from valid packets
+      // Process each new frame once, from the cache it just filled
+      if (dmxConnected && newFrame) {
         processDMXChannels();
       }
       
@@ -668,9 +937,6 @@ namespace DMXReceiver {
         esp_task_wdt_reset();
         lastWdtFeed = millis();
       }
-      
-      // Wait for next cycle
-      vTaskDelayUntil(&xLastWakeTime, xFrequency);
     }
   }
   
@@ -685,13 +951,6 @@ namespace DMXReceiver {
     
     Serial.println("[DMX] Initializing DMXReceiver with ESP32S3DMX...");
     
-    // Create mutex for channel cache protection
-    channelCacheMutex = xSemaphoreCreateMutex();
-    if (channelCacheMutex == NULL) {
-      Serial.println("[DMX] ERROR: Failed to create channel cache mutex");
-      return false;
-    }
-    
     // Initialize DMX on UART2 with RX pin from HardwareConfig
     // Note: ESP32S3DMX begin() parameters are: uart_num, rx_pin, tx_pin, enable_pin
     // For receive-only, we need to properly configure the pins
@@ -721,10 +980,29 @@ namespace DMXReceiver {
     
     // Load base channel from config
     SAFE_READ_CONFIG(dmxStartChannel, baseChannel);
-    if (baseChannel < 1 || baseChannel > 508) {  // 508 because we need 5 channels
+    if (baseChannel < 1 || baseChannel > 512) {
       baseChannel = 1;  // Default to channel 1
     }
     
+    // Input source (RS-485 or Art-Net/sACN through NetworkDMX)
+    networkQueue = xQueueCreate(1, sizeof(NetworkFrame));
+    uint8_t input = 0;
+    SAFE_READ_CONFIG(dmxInput, input);
+    inputSource = (input == (uint8_t)DMXInput::NETWORK) ? DMXInput::NETWORK : DMXInput::UART;
+    
+    // Compile the selected personality (taken by the task with the first frame)
+    decoderQueue = xQueueCreate(1, sizeof(DMXPersonality::Decoder));
+    uint8_t slot = 0;
+    SAFE_READ_CONFIG(dmxPersonality, slot);
+    if (!selectPersonality(slot, false)) {
+      Serial.printf("[DMX] WARNING: Personality %d unavailable at base channel %d - using personality 0\n",
+                    slot, baseChannel);
+      if (!selectPersonality(0, false)) {
+        baseChannel = 1;  // Layout does not fit after the base channel
+        selectPersonality(0, false);
+      }
+    }
+    
     // Load timeout from config
     SAFE_READ_CONFIG(dmxTimeout, signalTimeout);
     
@@ -739,11 +1017,22 @@ namespace DMXReceiver {
       0                   // Core 0 - Real-time operations
     );
     
+    // Start the frame watcher (the library has no frame-complete callback)
+    esp_timer_create_args_t watchArgs = {};
+    watchArgs.callback = frameWatchCallback;
+    watchArgs.name = "dmxFrameWatch";
+    if (esp_timer_create(&watchArgs, &frameWatchTimer) != ESP_OK ||
+        esp_timer_start_periodic(frameWatchTimer, FRAME_POLL_US) != ESP_OK) {
+      Serial.println("[DMX] WARNING: Frame watcher not started - processing on housekeeping wakes only");
+    }
+    
     // Update system status
     SAFE_WRITE_STATUS(dmxState, DMXState::NO_SIGNAL);
     
     moduleInitialized = true;
     Serial.println("[DMX] DMXReceiver initialized successfully");
+    Serial.print("[DMX] Input: ");
+    Serial.println((inputSource == DMXInput::NETWORK) ? "network (Art-Net/sACN)" : "RS-485");
     Serial.print("[DMX] Base channel: ");
     Serial.println(baseChannel);
     Serial.print("[DMX] Timeout: ");
@@ -770,8 +1059,9 @@ namespace DMXReceiver {
       return 0;
     }
     
-    // Use the library's read method for individual channel access
-    return dmx.read(channel);
+    // Latest snapshot (the library buffer changes while a frame arrives)
+    const UniverseFrame* frame = getUniverseFrame();
+    return frame ? frame->data[channel - 1] : 0;
   }
   
   uint32_t getLastUpdateTime() {
@@ -787,17 +1077,31 @@ namespace DMXReceiver {
       return false;
     }
     
-    // Get direct access to DMX buffer and copy it
-    const uint8_t* dmxBuffer = dmx.getBuffer();
-    if (dmxBuffer) {
-      // Copy channels 1-512 (skip start code at index 0)
-      memcpy(buffer, dmxBuffer + 1, 512);
-      return true;
+    // Copy the latest snapshot, retrying if the DMX task reused it meanwhile
+    for (uint8_t attempt = 0; attempt < SNAPSHOT_RETRIES; attempt++) {
+      const UniverseFrame* frame = getUniverseFrame();
+      if (!frame) {
+        return false;
+      }
+      uint32_t sequence = frame->sequence.load(std::memory_order_acquire);
+      memcpy(buffer, frame->data, DMX_UNIVERSE_SIZE);
+      if (frameIntact(frame, sequence)) {
+        return true;
+      }
     }
     
     return false;
   }
   
+  const UniverseFrame* getUniverseFrame() {
+    return publishedFrame.load(std::memory_order_acquire);
+  }
+  
+  uint32_t getUniverseSequence() {
+    const UniverseFrame* frame = getUniverseFrame();
+    return frame ? frame->sequence.load(std::memory_order_acquire) : 0;
+  }
+  
   bool setTimeout(uint32_t timeoutMs) {
     if (timeoutMs < 100 || timeoutMs > 60000) {
       return false;  // Invalid timeout
@@ -821,37 +1125,119 @@ namespace DMXReceiver {
     // We can't reset the library's internal counters, but we can track our own
     totalPackets = dmx.getPacketCount();
     errorPackets = dmx.getErrorCount();
-    lastPacketCount = totalPackets;
+    frameStatsResetRequested = true;  // Applied by the DMX task with the next frame
     return true;
   }
   
+  bool getFrameStats(FrameStats& stats) {
+    if (frameStatsResetRequested) {
+      stats = {};
+      return false;
+    }
+    stats = frameStats;
+    if (stats.frames < 2) {
+      stats.intervalMinUs = 0;
+    }
+    return stats.frames > 0;
+  }
+  
   // ----------------------------------------------------------------------------
-  // Additional Public Functions for 5-Channel Implementation
+  // Personality and Channel Functions
   // ----------------------------------------------------------------------------
   
   /**
-   * Get cached values for our 5 channels
-   * @param cache Array of 5 bytes to receive channel values
-   * @return true if values retrieved successfully
+   * Get validated values for our channels from the newest frame
+   * @param cache Buffer to receive channel values
+   * @param maxChannels Size of cache
+   * @return number of channels copied, 0 if the frame kept changing
+   */
+  uint8_t getChannelCache(uint8_t* cache, uint8_t maxChannels) {
+    for (uint8_t attempt = 0; attempt < SNAPSHOT_RETRIES; attempt++) {
+      const UniverseFrame* frame = getUniverseFrame();
+      if (!frame) {
+        // No frame yet - channels read as zero
+        uint8_t count = (personalityFootprint < maxChannels) ? personalityFootprint : maxChannels;
+        memset(cache, 0, count);
+        return count;
+      }
+      uint32_t sequence = frame->sequence.load(std::memory_order_acquire);
+      uint8_t count = (frame->channelCount < maxChannels) ? frame->channelCount : maxChannels;
+      memcpy(cache, frame->channels, count);
+      if (frameIntact(frame, sequence)) {
+        return count;
+      }
+    }
+    return 0;
+  }
+  
+  /**
+   * Get the decoded values of the newest frame
+   * @param values Receives the values
+   * @return false if the frame kept changing while it was copied
+   */
+  bool getDecodedValues(DMXPersonality::Values& values) {
+    for (uint8_t attempt = 0; attempt < SNAPSHOT_RETRIES; attempt++) {
+      const UniverseFrame* frame = getUniverseFrame();
+      if (!frame) {
+        values = {};
+        return true;  // No frame yet - STOP mode, zero position
+      }
+      uint32_t sequence = frame->sequence.load(std::memory_order_acquire);
+      values = frame->values;
+      if (frameIntact(frame, sequence)) {
+        return true;
+      }
+    }
+    return false;
+  }
+  
+  /**
+   * Select the personality the DMX task decodes with
+   * @param slot Personality slot
+   * @param persist Store the selection in the configuration
+   * @return false if the slot is empty or does not fit after the base channel
    */
-  bool getChannelCache(uint8_t cache[5]) {
-    bool success = false;
-    if (xSemaphoreTake(channelCacheMutex, pdMS_TO_TICKS(10)) == pdTRUE) {
-      memcpy(cache, channelCache, NUM_CHANNELS);
-      xSemaphoreGive(channelCacheMutex);
-      success = true;
+  bool selectPersonality(uint8_t slot, bool persist) {
+    DMXPersonality::Personality personality;
+    DMXPersonality::Decoder compiled;
+    if (!decoderQueue || !DMXPersonality::getPersonality(slot, personality) ||
+        !DMXPersonality::compile(personality, slot, compiled)) {
+      return false;
+    }
+    if (baseChannel + compiled.footprint - 1 > 512) {
+      return false;
+    }
+    
+    // Hand the decoder to the DMX task (replaces one it has not taken yet)
+    xQueueOverwrite(decoderQueue, &compiled);
+    personalitySlot = slot;
+    personalityFootprint = compiled.footprint;
+    
+    if (persist) {
+      SAFE_WRITE_CONFIG(dmxPersonality, slot);
     }
-    return success;
+    
+    Serial.printf("[DMX] Personality %d (%s): channels %d-%d\n", slot, compiled.name,
+                  baseChannel, baseChannel + compiled.footprint - 1);
+    return true;
+  }
+  
+  uint8_t getPersonalitySlot() {
+    return personalitySlot;
+  }
+  
+  uint8_t getFootprint() {
+    return personalityFootprint;
   }
   
   /**
-   * Set base channel for 5-channel operation
-   * @param channel Base channel (1-508)
+   * Set base channel
+   * @param channel Base channel (1 to 513 - footprint)
    * @return true if channel set successfully
    */
   bool setBaseChannel(uint16_t channel) {
-    // Validate that base + 4 doesn't exceed 512
-    if (channel < 1 || channel > 508) {
+    // Validate that the personality's channels don't run past 512
+    if (channel < 1 || channel + personalityFootprint - 1 > 512) {
       return false;
     }
     
@@ -868,7 +1254,7 @@ namespace DMXReceiver {
   
   /**
    * Get current base channel
-   * @return Current base channel (1-508)
+   * @return Current base channel
    */
   uint16_t getBaseChannel() {
     return baseChannel;
@@ -881,17 +1267,20 @@ namespace DMXReceiver {
    * @return Number of characters written
    */
   size_t getFormattedChannelValues(char* buffer, size_t bufferSize) {
-    uint8_t safeCache[NUM_CHANNELS] = {0};
-    if (xSemaphoreTake(channelCacheMutex, pdMS_TO_TICKS(10)) == pdTRUE) {
-      memcpy(safeCache, channelCache, NUM_CHANNELS);
-      xSemaphoreGive(channelCacheMutex);
-    }
-    return snprintf(buffer, bufferSize, 
-      "Ch%d-Ch%d: [%3d,%3d,%3d,%3d,%3d]",
-      baseChannel, baseChannel + 4,
-      safeCache[0], safeCache[1], safeCache[2], 
-      safeCache[3], safeCache[4]
-    );
+    uint8_t safeCache[MAX_CHANNELS] = {0};
+    uint8_t count = getChannelCache(safeCache, MAX_CHANNELS);
+    if (count == 0) {
+      count = personalityFootprint;
+    }
+    
+    size_t written = snprintf(buffer, bufferSize, "Ch%d-Ch%d: [", baseChannel, baseChannel + count - 1);
+    for (uint8_t i = 0; i < count && written < bufferSize; i++) {
+      written += snprintf(buffer + written, bufferSize - written, i ? ",%3d" : "%3d", safeCache[i]);
+    }
+    if (written < bufferSize) {
+      written += snprintf(buffer + written, bufferSize - written, "]");
+    }
+    return (written < bufferSize) ? written : bufferSize - 1;
   }
   
   /**
@@ -902,13 +1291,13 @@ namespace DMXReceiver {
     dmxEnabled = enable;
     Serial.printf("[DMX] Control %s\n", enable ? "enabled" : "disabled");
     
-    if (!enable && currentMode == DMXMode::CONTROL) {
-      // Stop motion if disabling while in control mode
+    if (!enable && (currentMode == DMXMode::CONTROL || currentMode == DMXMode::CUE)) {
+      // Stop motion if disabling while in control or cue mode
       MotionCommand stopCmd;
       stopCmd.type = CommandType::STOP;
       stopCmd.timestamp = millis();
       stopCmd.commandId = 0;
-      xQueueSend(g_motionCommandQueue, &stopCmd, 0);
+      StepperController::queueMotionCommand(stopCmd);
       currentMode = DMXMode::STOP;
     }
     
@@ -924,26 +1313,53 @@ namespace DMXReceiver {
   }
   
   /**
-   * Set 16-bit position mode
-   * @param enable true for 16-bit mode, false for 8-bit mode
+   * Select the DMX input
+   * @param input UART (RS-485) or NETWORK (Art-Net/sACN)
+   * @param persist Store the selection in the configuration
    */
-  bool set16BitMode(bool enable) {
-    use16BitPosition = enable;
-    Serial.printf("[DMX] Position mode: %s\n", enable ? "16-bit" : "8-bit");
+  bool setInput(DMXInput input, bool persist) {
+    if (input != inputSource) {
+      if (networkQueue) {
+        xQueueReset(networkQueue);  // No stale universe from before the switch
+      }
+      inputSource = input;
+      frameStatsResetRequested = true;  // Timing of the other input does not carry over
+      Serial.printf("[DMX] Input: %s\n", (input == DMXInput::NETWORK) ? "network (Art-Net/sACN)" : "RS-485");
+    }
+    if (persist) {
+      SAFE_WRITE_CONFIG(dmxInput, (uint8_t)input);
+    }
     return true;
   }
   
+  DMXInput getInput() {
+    return inputSource;
+  }
+  
   /**
-   * Get current 16-bit mode setting
-   * @return true if 16-bit mode is enabled
+   * Hand a network universe to the DMX task (NetworkDMX task only)
+   * @param data Channel 1 onwards
+   * @param slots Channels in data (1-512)
+   * @param receivedUs micros() when the packet was received
+   * @return false if the network is not the selected input
    */
-  bool is16BitMode() {
-    return use16BitPosition;
+  bool submitNetworkFrame(const uint8_t* data, uint16_t slots, uint32_t receivedUs) {
+    if (inputSource != DMXInput::NETWORK || !networkQueue || slots == 0 || slots > DMX_UNIVERSE_SIZE) {
+      return false;
+    }
+    networkStaging.timestamp = receivedUs;
+    networkStaging.slots = slots;
+    memcpy(networkStaging.data, data, slots);
+    xQueueOverwrite(networkQueue, &networkStaging);  // Newest universe wins
+    if (dmxTaskHandle) {
+      xTaskNotifyGive(dmxTaskHandle);
+    }
+    return true;
   }
   
   /**
    * Get current DMX mode
-   * @return Current mode (STOP, CONTROL, HOME)
+   * @return Current mode (STOP, CONTROL, CUE, HOME)
    */
   DMXMode getCurrentMode() {
     return currentMode;
@@ -14,8 +14,10 @@
 
 #include "GlobalInterface.h"
 #include "HardwareConfig.h"
+#include "DMXPersonality.h"
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
+#include <atomic>
 
 // ============================================================================
 // DMXReceiver Module - Core 0 Real-Time DMX Reception
@@ -27,28 +29,80 @@ namespace DMXReceiver {
   // Module Constants
   // ----------------------------------------------------------------------------
   
-  // DMX channel layout (base + offset)
-  const uint8_t CH_POSITION_MSB = 0;  // Position coarse (8-bit mode)
-  const uint8_t CH_POSITION_LSB = 1;  // Position fine (16-bit mode)
-  const uint8_t CH_ACCELERATION = 2;  // Acceleration limit (% of max)
-  const uint8_t CH_SPEED = 3;         // Speed limit (% of max)
-  const uint8_t CH_MODE = 4;          // Mode control
+  // Channel layout comes from the selected personality (DMXPersonality.h)
+  const uint8_t MAX_CHANNELS = DMXPersonality::MAX_FOOTPRINT;  // Channels from the base channel
   
   // Mode thresholds
   const uint8_t MODE_STOP_MAX = 100;      // 1-100: STOP mode
-  const uint8_t MODE_CONTROL_MAX = 254;   // 101-254: DMX CONTROL mode
+  const uint8_t MODE_CONTROL_MAX = 200;   // 101-200: DMX CONTROL mode
+  const uint8_t MODE_CUE_MAX = 254;       // 201-254: CUE mode (play stored cue)
+  const uint8_t MODE_CUE_BAND = 6;        // Mode values per cue: 201-206 = cue 0, 207-212 = cue 1...
   // 255: FORCE HOME mode
   
+  // Frame-synchronous processing
+  const uint32_t FRAME_POLL_US = 500;         // Packet counter check by the frame watcher (esp_timer)
+  const uint32_t HOUSEKEEPING_MS = 100;       // Task wake without frames (timeout, watchdog, health)
+  const uint8_t LATENCY_BUCKETS = 6;          // Frame-to-command latency histogram
+  const uint32_t LATENCY_BUCKET_US[LATENCY_BUCKETS] = {250, 500, 1000, 2000, 5000, UINT32_MAX};
+  const uint8_t SNAPSHOT_RETRIES = 4;         // Copy attempts when a snapshot is rewritten mid-copy
+  
   // ----------------------------------------------------------------------------
   // Module Enums
   // ----------------------------------------------------------------------------
   
+  enum class DMXInput : uint8_t {
+    UART,      // RS-485 transceiver (ESP32S3DMX)
+    NETWORK    // Art-Net / sACN over the WiFi AP (NetworkDMX)
+  };
+  
   enum class DMXMode {
     STOP,      // Motor holds position, ignores position channel
     CONTROL,   // Follows position channel  
+    CUE,       // Plays the stored cue selected by the mode value
     HOME       // Initiates homing sequence
   };
   
+  // ----------------------------------------------------------------------------
+  // Module Structures
+  // ----------------------------------------------------------------------------
+  
+  /**
+   * Frame timing statistics (since the last resetStats)
+   * Frame times are when the frame watcher saw the packet counter move,
+   * so intervals and latency carry up to FRAME_POLL_US of detection delay
+   */
+  struct FrameStats {
+    uint32_t frames;            // Frames processed
+    uint32_t skippedFrames;     // Frames completed between two watcher checks (not processed)
+    float rateHz;               // Frame rate over the last full second
+    uint32_t intervalAvgUs;     // Inter-frame interval
+    uint32_t intervalMinUs;
+    uint32_t intervalMaxUs;
+    uint32_t jitterAvgUs;       // |interval - average interval|
+    uint32_t jitterMaxUs;
+    uint32_t commandFrames;     // Frames that queued a motion command
+    uint32_t latencyAvgUs;      // Frame seen -> motion command queued
+    uint32_t latencyMaxUs;
+    uint32_t latencyBuckets[LATENCY_BUCKETS];  // Counts up to each LATENCY_BUCKET_US edge
+  };
+  
+  /**
+   * One received DMX frame (universe snapshot)
+   * Written by the DMX task into one of two buffers and then published;
+   * a published frame is not touched until two newer frames have arrived.
+   * sequence is 0 while the buffer is being rewritten, so a reader that
+   * keeps a frame across frames checks frameIntact() after reading.
+   */
+  struct UniverseFrame {
+    std::atomic<uint32_t> sequence;       // Frame number (1, 2, ...), 0 while being written
+    uint32_t timestamp;                   // micros() when the frame was seen
+    uint16_t slots;                       // Channels received (a short universe has fewer than 512)
+    uint8_t data[DMX_UNIVERSE_SIZE];      // Channel n at data[n - 1]
+    uint8_t channelCount;                 // Footprint of the personality that decoded the frame
+    uint8_t channels[MAX_CHANNELS];       // Our channels after validation (base channel onwards)
+    DMXPersonality::Values values;        // channels decoded by the personality
+  };
+  
   // ----------------------------------------------------------------------------
   // Module Interface Functions
   // ----------------------------------------------------------------------------
@@ -99,6 +153,30 @@ namespace DMXReceiver {
    */
   bool getUniverseData(uint8_t* buffer);
   
+  /**
+   * Get the newest complete frame without copying or locking
+   * @return frame, or nullptr before the first frame
+   */
+  const UniverseFrame* getUniverseFrame();
+  
+  /**
+   * Get the sequence number of the newest frame (0 before the first frame)
+   * Cheap change check for readers that poll
+   */
+  uint32_t getUniverseSequence();
+  
+  /**
+   * Check that a frame still holds the data it had when sequence was read
+   * Read sequence (acquire) first, then the data, then call this
+   * @param frame Frame from getUniverseFrame()
+   * @param sequence frame->sequence read before the data
+   * @return true if the data read in between belongs to that frame
+   */
+  inline bool frameIntact(const UniverseFrame* frame, uint32_t sequence) {
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return sequence != 0 && frame->sequence.load(std::memory_order_relaxed) == sequence;
+  }
+  
   /**
    * Set DMX timeout value
    * @param timeoutMs timeout in milliseconds (100-60000)
@@ -115,32 +193,66 @@ namespace DMXReceiver {
   bool getPacketStats(uint32_t& totalPackets, uint32_t& errorPackets);
   
   /**
-   * Reset packet statistics
+   * Reset packet statistics and frame timing statistics
    * @return true if statistics reset
    */
   bool resetStats();
   
+  /**
+   * Get frame rate, jitter and frame-to-command latency
+   * @param stats Receives the statistics
+   * @return true if at least one frame has been processed
+   */
+  bool getFrameStats(FrameStats& stats);
+  
   // ----------------------------------------------------------------------------
-  // 5-Channel Specific Functions
+  // Personality and Channel Functions
   // ----------------------------------------------------------------------------
   
   /**
-   * Get cached values for our 5 channels
-   * @param cache Array of 5 bytes to receive channel values
-   * @return true if values retrieved successfully
+   * Get validated values for our channels from the newest frame
+   * @param cache Buffer to receive channel values (zeros before the first frame)
+   * @param maxChannels Size of cache (MAX_CHANNELS holds any personality)
+   * @return number of channels copied, 0 if the frame kept changing
+   */
+  uint8_t getChannelCache(uint8_t* cache, uint8_t maxChannels);
+  
+  /**
+   * Get the decoded values of the newest frame
+   * @param values Receives the values (STOP mode, zero position before the first frame)
+   * @return false if the frame kept changing while it was copied
+   */
+  bool getDecodedValues(DMXPersonality::Values& values);
+  
+  /**
+   * Select the personality the DMX task decodes with
+   * The compiled decoder is handed to the task, which switches at the next frame
+   * @param slot Personality slot (0 to DMXPersonality::MAX_PERSONALITIES-1)
+   * @param persist Store the selection in the configuration
+   * @return false if the slot is empty or the footprint does not fit after the base channel
    */
-  bool getChannelCache(uint8_t cache[5]);
+  bool selectPersonality(uint8_t slot, bool persist = true);
   
   /**
-   * Set base channel for 5-channel operation
-   * @param channel Base channel (1-508, since we need 5 consecutive channels)
+   * Get the selected personality slot
+   */
+  uint8_t getPersonalitySlot();
+  
+  /**
+   * Get the number of channels the selected personality uses
+   */
+  uint8_t getFootprint();
+  
+  /**
+   * Set base channel
+   * @param channel Base channel (1 to 513 - footprint, so the personality fits in the universe)
    * @return true if channel set successfully
    */
   bool setBaseChannel(uint16_t channel);
   
   /**
    * Get current base channel
-   * @return Current base channel (1-508)
+   * @return Current base channel
    */
   uint16_t getBaseChannel();
   
@@ -164,32 +276,18 @@ namespace DMXReceiver {
   inline DMXMode detectMode(uint8_t modeValue) {
     if (modeValue <= MODE_STOP_MAX) return DMXMode::STOP;
     if (modeValue <= MODE_CONTROL_MAX) return DMXMode::CONTROL;
+    if (modeValue <= MODE_CUE_MAX) return DMXMode::CUE;
     return DMXMode::HOME;
   }
   
   /**
-   * Calculate position percentage from channel values
-   * @param msb Position MSB channel value
-   * @param lsb Position LSB channel value (for 16-bit mode)
-   * @param use16Bit Whether to use 16-bit precision
-   * @return Position as percentage (0.0 - 100.0)
+   * Cue slot selected by a CUE mode value
+   * @param modeValue Raw channel value (201-254)
+   * @return Cue slot 0-7 (the last band runs up to 254)
    */
-  inline float calculatePosition(uint8_t msb, uint8_t lsb, bool use16Bit) {
-    if (use16Bit) {
-      uint16_t pos16 = (static_cast<uint16_t>(msb) << 8) | lsb;
-      return (pos16 / 65535.0f) * 100.0f;
-    } else {
-      return (msb / 255.0f) * 100.0f;
-    }
-  }
-  
-  /**
-   * Scale DMX value to percentage
-   * @param value DMX channel value (0-255)
-   * @return Percentage (0.0 - 100.0)
-   */
-  inline float dmxToPercent(uint8_t value) {
-    return (value / 255.0f) * 100.0f;
+  inline uint8_t cueForModeValue(uint8_t modeValue) {
+    uint8_t cue = (modeValue - MODE_CONTROL_MAX - 1) / MODE_CUE_BAND;
+    return (cue > 7) ? 7 : cue;
   }
   
   // ----------------------------------------------------------------------------
@@ -209,16 +307,28 @@ namespace DMXReceiver {
   bool isDMXEnabled();
   
   /**
-   * Set 16-bit position mode
-   * @param enable true for 16-bit mode, false for 8-bit mode
+   * Select the DMX input; frames of the other input are ignored
+   * @param input UART (RS-485) or NETWORK (Art-Net/sACN)
+   * @param persist Store the selection in the configuration
+   * @return true if input selected
+   */
+  bool setInput(DMXInput input, bool persist = true);
+  
+  /**
+   * Get the selected DMX input
    */
-  bool set16BitMode(bool enable);
+  DMXInput getInput();
   
   /**
-   * Get current 16-bit mode setting
-   * @return true if 16-bit mode is enabled
+   * Hand a network universe to the DMX task (called by the NetworkDMX task only)
+   * Copied into a one-entry queue (a newer universe replaces one not yet
+   * taken) and processed like a UART frame
+   * @param data Channel 1 onwards
+   * @param slots Channels in data (1-512)
+   * @param receivedUs micros() when the packet was received
+   * @return false if the network is not the selected input
    */
-  bool is16BitMode();
+  bool submitNetworkFrame(const uint8_t* data, uint16_t slots, uint32_t receivedUs);
   
   /**
    * Get current DMX mode
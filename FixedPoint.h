@@ -0,0 +1,115 @@
+// ============================================================================
+// File: FixedPoint.h
+// Project: SkullStepperV4 - ESP32-S3 Modular Stepper Control System
+// Version: 4.2.0
+// Date: 2026-10-15
+// Author: Tim Rosener
+// Description: Integer motion units for the Core 0 control path
+// License: MIT
+//
+// Control-path representations:
+//   position      int32_t steps
+//   speed         int32_t milliHz (milli-steps/sec, FastAccelStepper's native unit)
+//   acceleration  int32_t milli-steps/sec²
+//   fraction      uint16_t Q0.16 of full scale (0 = 0%, 65535 = 100%)
+//   stream time   uint32_t microseconds
+// Floats are converted at the API edges only (config, serial, web, status),
+// so control decisions are bit-identical on any target or host build.
+// ============================================================================
+
+#ifndef FIXED_POINT_H
+#define FIXED_POINT_H
+
+#include <Arduino.h>
+
+// ============================================================================
+// FixedPoint Namespace - Integer Unit Conversions
+// ============================================================================
+
+namespace FixedPoint {
+
+    const uint16_t FRACTION_ONE = 65535;   // 100% in Q0.16
+    const int32_t MILLI_PER_UNIT = 1000;   // milliHz per Hz, milli-steps/sec² per step/sec²
+
+    // ------------------------------------------------------------------------
+    // Fractions of a range (Q0.16)
+    // ------------------------------------------------------------------------
+
+    /**
+     * 8-bit DMX value as a fraction (255 maps exactly to FRACTION_ONE)
+     */
+    inline uint16_t fractionFrom8(uint8_t value) {
+        return (uint16_t)value * 257;
+    }
+
+    /**
+     * 16-bit DMX value (coarse + fine) as a fraction
+     */
+    inline uint16_t fractionFrom16(uint8_t msb, uint8_t lsb) {
+        return ((uint16_t)msb << 8) | lsb;
+    }
+
+    /**
+     * Percentage (API edge) as a fraction, clamped to 0-100%
+     */
+    inline uint16_t fractionFromPercent(float percent) {
+        if (percent <= 0.0f) return 0;
+        if (percent >= 100.0f) return FRACTION_ONE;
+        return (uint16_t)lroundf(percent * (FRACTION_ONE / 100.0f));
+    }
+
+    /**
+     * Fraction as a percentage, for display only
+     */
+    inline float fractionToPercent(uint16_t fraction) {
+        return fraction * (100.0f / FRACTION_ONE);
+    }
+
+    /**
+     * Point at a fraction of the way from lo to hi (rounded to nearest)
+     * 64-bit intermediate - exact for any int32 span
+     */
+    inline int32_t lerp(int32_t lo, int32_t hi, uint16_t fraction) {
+        int64_t span = (int64_t)hi - lo;
+        return lo + (int32_t)((span * fraction + FRACTION_ONE / 2) / FRACTION_ONE);
+    }
+
+    // ------------------------------------------------------------------------
+    // Speeds and accelerations (milli-units)
+    // ------------------------------------------------------------------------
+
+    /**
+     * steps/sec or steps/sec² (API edge) to milli-units (milliHz for speed)
+     */
+    inline int32_t toMilli(float value) {
+        return (int32_t)lroundf(value * MILLI_PER_UNIT);
+    }
+
+    /**
+     * Milli-units to steps/sec or steps/sec², for profiles, status and display
+     */
+    inline float fromMilli(int32_t milli) {
+        return milli / (float)MILLI_PER_UNIT;
+    }
+
+    // ------------------------------------------------------------------------
+    // Stream time (microseconds)
+    // ------------------------------------------------------------------------
+
+    /**
+     * Planner duration (s) to microseconds, rounded once when a piece starts
+     */
+    inline uint32_t secondsToMicros(float seconds) {
+        return (seconds > 0.0f) ? (uint32_t)lroundf(seconds * 1e6f) : 0;
+    }
+
+    /**
+     * Microseconds to seconds, only where a planner function is sampled
+     */
+    inline float microsToSeconds(int32_t micros) {
+        return micros * 1e-6f;
+    }
+
+} // namespace FixedPoint
+
+#endif // FIXED_POINT_H
@@ -21,14 +21,18 @@
 // Global Variable Definitions (Thread-Safe)
 // ============================================================================
 
-// System status and configuration (protected by mutexes)
+// System status (seqlock published) and configuration (mutex protected)
 SystemStatus g_systemStatus = {};
 SystemConfig g_systemConfig = {};
 
 // FreeRTOS synchronization primitives
-SemaphoreHandle_t g_statusMutex = nullptr;
 SemaphoreHandle_t g_configMutex = nullptr;
 
+// Status seqlock: odd sequence = write in progress
+static std::atomic<uint32_t> g_statusSequence(0);
+static portMUX_TYPE g_statusWriteLock = portMUX_INITIALIZER_UNLOCKED;
+static const uint8_t STATUS_READ_RETRIES = 8;  // Optimistic attempts before locking
+
 // Inter-module communication queues
 QueueHandle_t g_motionCommandQueue = nullptr;
 QueueHandle_t g_statusUpdateQueue = nullptr;
@@ -66,23 +70,15 @@ bool initializeGlobalInfrastructure() {
     // Create FreeRTOS Mutexes for Thread Safety
     // ========================================================================
     
-    g_statusMutex = xSemaphoreCreateMutex();
-    if (g_statusMutex == nullptr) {
-        Serial.println("GlobalInfrastructure: FATAL - Failed to create status mutex");
-        return false;
-    }
-    
     g_configMutex = xSemaphoreCreateMutex();
     if (g_configMutex == nullptr) {
         Serial.println("GlobalInfrastructure: FATAL - Failed to create config mutex");
-        vSemaphoreDelete(g_statusMutex);
         return false;
     }
     
     g_systemStateMutex = xSemaphoreCreateMutex();
     if (g_systemStateMutex == nullptr) {
         Serial.println("GlobalInfrastructure: FATAL - Failed to create system state mutex");
-        vSemaphoreDelete(g_statusMutex);
         vSemaphoreDelete(g_configMutex);
         return false;
     }
@@ -94,11 +90,10 @@ bool initializeGlobalInfrastructure() {
     // ========================================================================
     
     // Motion command queue (SerialInterface -> StepperController)
-    g_motionCommandQueue = xQueueCreate(10, sizeof(MotionCommand));
+    g_motionCommandQueue = xQueueCreate(MOTION_COMMAND_QUEUE_SIZE, sizeof(MotionCommand));
     if (g_motionCommandQueue == nullptr) {
         Serial.println("GlobalInfrastructure: FATAL - Failed to create motion command queue");
         // Clean up mutexes
-        vSemaphoreDelete(g_statusMutex);
         vSemaphoreDelete(g_configMutex);
         vSemaphoreDelete(g_systemStateMutex);
         return false;
@@ -110,7 +105,6 @@ bool initializeGlobalInfrastructure() {
         Serial.println("GlobalInfrastructure: FATAL - Failed to create status update queue");
         // Clean up
         vQueueDelete(g_motionCommandQueue);
-        vSemaphoreDelete(g_statusMutex);
         vSemaphoreDelete(g_configMutex);
         vSemaphoreDelete(g_systemStateMutex);
         return false;
@@ -123,14 +117,13 @@ bool initializeGlobalInfrastructure() {
         // Clean up
         vQueueDelete(g_motionCommandQueue);
         vQueueDelete(g_statusUpdateQueue);
-        vSemaphoreDelete(g_statusMutex);
         vSemaphoreDelete(g_configMutex);
         vSemaphoreDelete(g_systemStateMutex);
         return false;
     }
     
     Serial.println("GlobalInfrastructure: Inter-module communication queues created");
-    Serial.printf("  Motion Command Queue: %d slots\n", 10);
+    Serial.printf("  Motion Command Queue: %d slots\n", MOTION_COMMAND_QUEUE_SIZE);
     Serial.printf("  Status Update Queue: %d slots\n", 20);
     Serial.printf("  DMX Data Queue: %d slots\n", 5);
     
@@ -139,7 +132,8 @@ bool initializeGlobalInfrastructure() {
     // ========================================================================
     
     // Initialize system status with safe defaults
-    if (xSemaphoreTake(g_statusMutex, pdMS_TO_TICKS(1000)) == pdTRUE) {
+    beginStatusWrite();
+    {
         g_systemStatus.systemState = SystemState::INITIALIZING;
         g_systemStatus.motionState = MotionState::IDLE;
         g_systemStatus.safetyState = SafetyState::NORMAL;
@@ -148,6 +142,7 @@ bool initializeGlobalInfrastructure() {
         g_systemStatus.currentPosition = 0;
         g_systemStatus.targetPosition = 0;
         g_systemStatus.currentSpeed = 0.0f;
+        g_systemStatus.timeToArrival = 0;
         
         g_systemStatus.stepperEnabled = false;
         g_systemStatus.limitsActive[0] = false; // Left limit
@@ -160,13 +155,9 @@ bool initializeGlobalInfrastructure() {
         
         g_systemStatus.uptime = 0;
         g_systemStatus.errorCode = 0;
-        
-        xSemaphoreGive(g_statusMutex);
-        Serial.println("GlobalInfrastructure: System status initialized with thread-safe defaults");
-    } else {
-        Serial.println("GlobalInfrastructure: ERROR - Failed to acquire status mutex for initialization");
-        return false;
     }
+    endStatusWrite();
+    Serial.println("GlobalInfrastructure: System status initialized with thread-safe defaults");
     
     // Initialize system configuration with safe defaults
     if (xSemaphoreTake(g_configMutex, pdMS_TO_TICKS(1000)) == pdTRUE) {
@@ -177,6 +168,7 @@ bool initializeGlobalInfrastructure() {
         g_systemConfig.defaultProfile.jerk = 1000.0f;
         g_systemConfig.defaultProfile.targetPosition = 0;
         g_systemConfig.defaultProfile.enableLimits = true;
+        g_systemConfig.defaultProfile.shape = ProfileShape::TRAPEZOIDAL;
         
         // Position limits
         g_systemConfig.homePositionPercent = 50.0f;
@@ -188,6 +180,11 @@ bool initializeGlobalInfrastructure() {
         g_systemConfig.dmxScale = 1.0f;
         g_systemConfig.dmxOffset = 0;
         g_systemConfig.dmxTimeout = 5000;
+        g_systemConfig.dmxInterpolation = true;
+        g_systemConfig.dmxInterpDelayMs = DMX_INTERP_DELAY_MS;
+        g_systemConfig.dmxPersonality = DMX_PERSONALITY;
+        g_systemConfig.dmxInput = DMX_INPUT;
+        g_systemConfig.dmxUniverse = DMX_NET_UNIVERSE;
         
         // Safety settings
         g_systemConfig.enableLimitSwitches = true;
@@ -250,11 +247,6 @@ void shutdownGlobalInfrastructure() {
     }
     
     // Delete mutexes
-    if (g_statusMutex) {
-        vSemaphoreDelete(g_statusMutex);
-        g_statusMutex = nullptr;
-    }
-    
     if (g_configMutex) {
         vSemaphoreDelete(g_configMutex);
         g_configMutex = nullptr;
@@ -360,6 +352,57 @@ uint16_t calculateChecksum(const void* data, size_t length) {
     return static_cast<uint16_t>(~sum); // One's complement
 }
 
+// ============================================================================
+// Status Snapshot Functions (Seqlock)
+// ============================================================================
+
+/**
+ * Begin a status write section (enters a short critical section)
+ * Must be paired with endStatusWrite() on the same task
+ */
+void beginStatusWrite() {
+    portENTER_CRITICAL(&g_statusWriteLock);
+    g_statusSequence.fetch_add(1, std::memory_order_relaxed);  // Odd: write in progress
+    std::atomic_thread_fence(std::memory_order_release);
+}
+
+/**
+ * End a status write section and publish the updated snapshot
+ */
+void endStatusWrite() {
+    g_statusSequence.fetch_add(1, std::memory_order_release);  // Even: snapshot stable
+    portEXIT_CRITICAL(&g_statusWriteLock);
+}
+
+/**
+ * Copy a consistent snapshot of g_systemStatus without blocking writers
+ * @param snapshot returns the status copy
+ * @return sequence number of the snapshot (even, increases on every publish)
+ */
+uint32_t readSystemStatus(SystemStatus& snapshot) {
+    for (uint8_t attempt = 0; attempt < STATUS_READ_RETRIES; attempt++) {
+        uint32_t before = g_statusSequence.load(std::memory_order_acquire);
+        if (before & 1) {
+            continue;  // Writer active on the other core
+        }
+        
+        snapshot = g_systemStatus;
+        
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (g_statusSequence.load(std::memory_order_relaxed) == before) {
+            return before;
+        }
+    }
+    
+    // Writers hold the lock for a handful of stores, so a locked copy is
+    // cheap and guarantees progress under heavy publish rates
+    portENTER_CRITICAL(&g_statusWriteLock);
+    snapshot = g_systemStatus;
+    uint32_t sequence = g_statusSequence.load(std::memory_order_relaxed);
+    portEXIT_CRITICAL(&g_statusWriteLock);
+    return sequence;
+}
+
 // ============================================================================
 // Thread-Safe Status Update Functions
 // ============================================================================
@@ -383,13 +426,8 @@ bool broadcastStatusUpdate() {
     
     SystemStatus statusCopy;
     
-    // Make a thread-safe copy of current status
-    if (xSemaphoreTake(g_statusMutex, pdMS_TO_TICKS(10)) == pdTRUE) {
-        statusCopy = g_systemStatus;
-        xSemaphoreGive(g_statusMutex);
-    } else {
-        return false;
-    }
+    // Take a consistent snapshot of current status (never blocks)
+    readSystemStatus(statusCopy);
     
     // Update uptime before broadcasting
     statusCopy.uptime = getSystemUptime();
@@ -418,7 +456,7 @@ bool validateSystemIntegrity() {
     }
     
     // Check mutexes
-    if (g_statusMutex == nullptr || g_configMutex == nullptr || g_systemStateMutex == nullptr) {
+    if (g_configMutex == nullptr || g_systemStateMutex == nullptr) {
         Serial.println("GlobalInfrastructure: FAIL - One or more mutexes are null");
         return false;
     }
@@ -429,14 +467,14 @@ bool validateSystemIntegrity() {
         return false;
     }
     
-    // Test mutex acquisition (with timeout)
-    if (xSemaphoreTake(g_statusMutex, pdMS_TO_TICKS(100)) == pdTRUE) {
-        xSemaphoreGive(g_statusMutex);
-    } else {
-        Serial.println("GlobalInfrastructure: FAIL - Status mutex appears to be deadlocked");
+    // Status seqlock must not be stuck mid-write
+    SystemStatus statusCheck;
+    if (readSystemStatus(statusCheck) & 1) {
+        Serial.println("GlobalInfrastructure: FAIL - Status sequence stuck in write");
         return false;
     }
     
+    // Test mutex acquisition (with timeout)
     if (xSemaphoreTake(g_configMutex, pdMS_TO_TICKS(100)) == pdTRUE) {
         xSemaphoreGive(g_configMutex);
     } else {
@@ -450,7 +488,7 @@ bool validateSystemIntegrity() {
     UBaseType_t dmxQueueSpaces = uxQueueSpacesAvailable(g_dmxDataQueue);
     
     Serial.printf("GlobalInfrastructure: Queue status - Motion: %d/%d, Status: %d/%d, DMX: %d/%d\n",
-                  (10 - motionQueueSpaces), 10,
+                  (MOTION_COMMAND_QUEUE_SIZE - motionQueueSpaces), MOTION_COMMAND_QUEUE_SIZE,
                   (20 - statusQueueSpaces), 20, 
                   (5 - dmxQueueSpaces), 5);
     
@@ -494,7 +532,8 @@ void printInfrastructureStatus() {
     // FreeRTOS object status
     if (g_globalInfrastructureInitialized) {
         Serial.println("FreeRTOS Objects:");
-        Serial.printf("  Status Mutex: %s\n", g_statusMutex ? "OK" : "NULL");
+        SystemStatus statusSnapshot;
+        Serial.printf("  Status Sequence: %u\n", readSystemStatus(statusSnapshot));
         Serial.printf("  Config Mutex: %s\n", g_configMutex ? "OK" : "NULL");
         Serial.printf("  System State Mutex: %s\n", g_systemStateMutex ? "OK" : "NULL");
         Serial.printf("  Motion Command Queue: %s\n", g_motionCommandQueue ? "OK" : "NULL");
@@ -503,8 +542,8 @@ void printInfrastructureStatus() {
         
         // Queue usage
         if (g_motionCommandQueue) {
-            UBaseType_t motionUsed = 10 - uxQueueSpacesAvailable(g_motionCommandQueue);
-            Serial.printf("  Motion Queue Usage: %d/10\n", motionUsed);
+            UBaseType_t motionUsed = MOTION_COMMAND_QUEUE_SIZE - uxQueueSpacesAvailable(g_motionCommandQueue);
+            Serial.printf("  Motion Queue Usage: %d/%d\n", motionUsed, MOTION_COMMAND_QUEUE_SIZE);
         }
         
         if (g_statusUpdateQueue) {
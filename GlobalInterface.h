@@ -15,6 +15,7 @@
 #include <freertos/queue.h>
 #include <freertos/semphr.h>
 #include <atomic>
+#include "HardwareConfig.h"
 
 // ============================================================================
 // Global Data Structures and Interfaces for SkullStepperV4
@@ -69,7 +70,19 @@ enum class CommandType {
   STOP,
   EMERGENCY_STOP,
   ENABLE,
-  DISABLE
+  DISABLE,
+  FOLLOW_TARGET,    // Streaming setpoint (DMX) - retarget with velocity feed-forward
+  PATH_APPEND,      // Queue a waypoint (profile.targetPosition / maxSpeed / acceleration)
+  PATH_START,       // Run the queued waypoints with look-ahead blending
+  PATH_CLEAR,       // Drop queued waypoints, decelerating if a path is running
+  CUE_PLAY,         // Play a stored keyframe cue (cueId)
+  MOVE_COORDINATED  // Move the axes in axisMask to axisTargets, starting and arriving together
+};
+
+enum class ProfileShape : uint8_t {
+  CONFIGURED,   // Use the shape from the configured default profile
+  TRAPEZOIDAL,  // Constant acceleration ramps (FastAccelStepper ramp generator)
+  SCURVE        // Jerk-limited S-curve (MotionPlanner segment table)
 };
 
 // ----------------------------------------------------------------------------
@@ -79,9 +92,10 @@ struct MotionProfile {
   float maxSpeed;           // Maximum speed (steps/sec)
   float acceleration;       // Acceleration (steps/sec²)
   float deceleration;       // Deceleration (steps/sec²)
-  float jerk;              // Jerk limitation (steps/sec³)
+  float jerk;              // Jerk limitation (steps/sec³) - used by S-curve moves
   int32_t targetPosition;   // Target position (steps)
   bool enableLimits;        // Respect limit switches
+  ProfileShape shape;       // Ramp shape for moves (per move, or global in defaultProfile)
 };
 
 // ----------------------------------------------------------------------------
@@ -92,6 +106,10 @@ struct MotionCommand {
   MotionProfile profile;
   uint32_t timestamp;
   uint16_t commandId;
+  uint8_t cueId;            // CUE_PLAY: cue slot to play
+  uint8_t axis = 0;         // Axis the command drives (0 = primary)
+  uint8_t axisMask;         // MOVE_COORDINATED: bit n set = axis n takes part
+  int32_t axisTargets[STEPPER_AXIS_COUNT];  // MOVE_COORDINATED: absolute target per axis
 };
 
 // ----------------------------------------------------------------------------
@@ -106,6 +124,7 @@ struct SystemStatus {
   int32_t currentPosition;
   int32_t targetPosition;
   float currentSpeed;
+  uint32_t timeToArrival;   // ms until the current move is expected to finish (0 = at rest)
   
   bool stepperEnabled;
   bool limitsActive[2];     // [LEFT, RIGHT]
@@ -128,21 +147,29 @@ struct SystemConfig {
   float homePositionPercent;  // Home position as percentage of range (0-100%)
   int32_t minPosition;
   int32_t maxPosition;
-  float homingSpeed;        // Speed for homing sequence (steps/sec)
+  float homingSpeed;        // Speed for homing sequence (steps/sec) - slow re-approach when fast homing is on
+  float homingFastSpeed;    // Fast approach speed for two-speed homing (steps/sec, 0 = single speed)
   float limitSafetyMargin;  // Steps to stay away from limit switches (default: 400)
   bool autoHomeOnBoot;      // Automatically home on system startup
   bool autoHomeOnEstop;     // Automatically home after emergency stop/limit fault
+  bool verifyHoming;        // Home on one switch against the stored calibrated range when possible
   
   // DMX Settings
   uint16_t dmxStartChannel;
   float dmxScale;           // DMX to position scaling
   int32_t dmxOffset;        // DMX position offset
   uint32_t dmxTimeout;      // DMX timeout (ms)
+  bool dmxInterpolation;    // Upsample DMX setpoints between frames (follow mode)
+  uint8_t dmxInterpDelayMs; // Interpolation delay: 0 = predict a frame ahead, >= frame interval = interpolate only
+  uint8_t dmxPersonality;   // Channel layout slot (see DMXPersonality.h)
+  uint8_t dmxInput;         // 0 = RS-485, 1 = network (Art-Net/sACN, see NetworkDMX.h)
+  uint16_t dmxUniverse;     // Network universe (Art-Net port address 0-32767, sACN 1-63999)
   
   // Safety Settings
   bool enableLimitSwitches;
   bool enableStepperAlarm;
   float emergencyDeceleration;
+  uint8_t limitFilterSamples;  // Limit switch glitch filter samples (50 us apart)
   
   // System Settings
   uint32_t statusUpdateInterval;
@@ -155,11 +182,12 @@ struct SystemConfig {
 };
 
 // ----------------------------------------------------------------------------
-// Global Shared Data (Protected by Mutexes) - DEFINED IN GlobalInfrastructure.cpp
+// Global Shared Data - DEFINED IN GlobalInfrastructure.cpp
 // ----------------------------------------------------------------------------
+// g_systemStatus is published through a sequence lock (see Status Snapshot
+// Functions below). g_systemConfig is protected by g_configMutex.
 extern SystemStatus g_systemStatus;
 extern SystemConfig g_systemConfig;
-extern SemaphoreHandle_t g_statusMutex;
 extern SemaphoreHandle_t g_configMutex;
 
 // ----------------------------------------------------------------------------
@@ -172,20 +200,21 @@ extern QueueHandle_t g_dmxDataQueue;
 // ----------------------------------------------------------------------------
 // Thread-Safe Access Macros
 // ----------------------------------------------------------------------------
+// Status access never blocks: reads copy a consistent snapshot and retry if a
+// writer was active, writes are a short critical section that cannot be lost.
 #define SAFE_READ_STATUS(field, dest) \
   do { \
-    if (xSemaphoreTake(g_statusMutex, pdMS_TO_TICKS(10)) == pdTRUE) { \
-      dest = g_systemStatus.field; \
-      xSemaphoreGive(g_statusMutex); \
-    } \
+    SystemStatus _statusSnapshot; \
+    readSystemStatus(_statusSnapshot); \
+    dest = _statusSnapshot.field; \
   } while(0)
 
 #define SAFE_WRITE_STATUS(field, value) \
   do { \
-    if (xSemaphoreTake(g_statusMutex, pdMS_TO_TICKS(10)) == pdTRUE) { \
-      g_systemStatus.field = value; \
-      xSemaphoreGive(g_statusMutex); \
-    } \
+    auto _statusValue = (value); \
+    beginStatusWrite(); \
+    g_systemStatus.field = _statusValue; \
+    endStatusWrite(); \
   } while(0)
 
 #define SAFE_READ_CONFIG(field, dest) \
@@ -251,6 +280,32 @@ bool broadcastStatusUpdate();
  */
 bool getMemoryStats(uint32_t& freeHeap, uint32_t& minFreeHeap);
 
+// ----------------------------------------------------------------------------
+// Status Snapshot Functions (Seqlock) - IMPLEMENTED IN GlobalInfrastructure.cpp
+// ----------------------------------------------------------------------------
+// Writers bracket their updates with beginStatusWrite()/endStatusWrite(), which
+// moves the sequence counter to an odd value and back. Readers never take a
+// lock; they copy the structure and retry if the sequence changed meanwhile.
+// Keep write sections to plain field assignments - no logging or blocking calls.
+
+/**
+ * Begin a status write section (enters a short critical section)
+ * Must be paired with endStatusWrite() on the same task
+ */
+void beginStatusWrite();
+
+/**
+ * End a status write section and publish the updated snapshot
+ */
+void endStatusWrite();
+
+/**
+ * Copy a consistent snapshot of g_systemStatus without blocking writers
+ * @param snapshot returns the status copy
+ * @return sequence number of the snapshot (even, increases on every publish)
+ */
+uint32_t readSystemStatus(SystemStatus& snapshot);
+
 // ----------------------------------------------------------------------------
 // Thread-Safe Utility Functions - IMPLEMENTED IN GlobalInfrastructure.cpp
 // ----------------------------------------------------------------------------
@@ -290,6 +345,7 @@ namespace StepperController {
   bool initialize();
   bool update();
   bool processMotionCommand(const MotionCommand& cmd);
+  bool queueMotionCommand(const MotionCommand& cmd, TickType_t timeout);
   bool emergencyStop();
   bool enable(bool state);
   int32_t getCurrentPosition();
@@ -303,19 +359,20 @@ namespace StepperController {
   bool getTimingDiagnostics(uint32_t& stepInterval, float& dutyCycle);
   
   // Homing and limit functions
-  bool startHoming();
+  bool startHoming(bool fullSweep = false, uint8_t axis = 0);
   bool isHoming();
   uint8_t getHomingProgress();
-  bool isHomed();
-  bool getPositionLimits(int32_t& minPos, int32_t& maxPos);
+  bool isHomed(uint8_t axis = 0);
+  bool getPositionLimits(int32_t& minPos, int32_t& maxPos, uint8_t axis = 0);
+  bool getDetectedLimits(int32_t& leftLimit, int32_t& rightLimit, uint8_t axis = 0);
   void getLimitStates(bool& leftLimit, bool& rightLimit);
   
   // Advanced motion functions
-  bool moveTo(int32_t position);
-  bool move(int32_t steps);
-  bool stop();
-  bool setMaxSpeed(float speed);
-  bool setAcceleration(float accel);
+  bool moveTo(int32_t position, uint8_t axis = 0);
+  bool move(int32_t steps, uint8_t axis = 0);
+  bool stop(uint8_t axis = 0);
+  bool setMaxSpeed(float speed, uint8_t axis = 0);
+  bool setAcceleration(float accel, uint8_t axis = 0);
   int32_t distanceToGo();
   bool isAlarmActive();
 }
@@ -11,6 +11,8 @@
 #ifndef HARDWARECONFIG_H
 #define HARDWARECONFIG_H
 
+#include "ProjectConfig.h"
+
 // ============================================================================
 // ESP32-S3 Hardware Configuration for SkullStepperV4
 // ============================================================================
@@ -36,6 +38,21 @@
 #define LEFT_LIMIT_PIN          17   // GPIO 17 (Active low with pull-up) ✓ CONFIRMED
 #define RIGHT_LIMIT_PIN         18   // GPIO 18 (Active low with pull-up) ✓ CONFIRMED
 
+// ----------------------------------------------------------------------------
+// Stepper Axes
+// ----------------------------------------------------------------------------
+// Every axis is a CL57Y + stepper with its own pair of limit switches, driven
+// from the one ODStepper engine (ESP32-S3: up to 4 MCPWM/PCNT + 4 RMT steppers).
+// Axis 0 uses the pins above; add one row per extra axis and raise the count.
+// Row: step, dir, enable, alarm, left limit, right limit
+// Both can be predefined together (the host harness builds a 2-axis variant).
+#ifndef STEPPER_AXIS_COUNT
+#define STEPPER_AXIS_COUNT      1
+#define STEPPER_AXIS_PINS { \
+    { STEPPER_STEP_PIN, STEPPER_DIR_PIN, STEPPER_ENABLE_PIN, STEPPER_ALARM_PIN, LEFT_LIMIT_PIN, RIGHT_LIMIT_PIN } \
+}
+#endif
+
 // ----------------------------------------------------------------------------
 // Limit Switch Noise Filtering Recommendations
 // ----------------------------------------------------------------------------
@@ -66,19 +83,37 @@
 #define DMX_BAUD_RATE           250000
 #define DMX_UNIVERSE_SIZE       512
 #define DMX_START_CHANNEL       1    // DMX channel for position control
-
-// RMT Configuration for Hardware Pulse Generation
-#define STEPPER_RMT_CHANNEL     RMT_CHANNEL_0    // RMT channel for step pulses
+#define DMX_INTERP_DELAY_MS     10   // Default setpoint interpolation delay (see SetpointInterpolator.h)
+#define DMX_INTERP_MAX_DELAY_MS 100  // Upper bound for the dmxInterpDelayMs parameter
+#define DMX_PERSONALITY         0    // Default channel layout (0 = standard8, see DMXPersonality.h)
+#define DMX_PERSONALITY_SLOTS   8    // Personality slots (0-2 built in, 3-7 uploaded)
+#define DMX_INPUT               0    // Default input: 0 = RS-485, 1 = network (Art-Net/sACN)
+#define DMX_NET_UNIVERSE        1    // Default network universe
+#define DMX_NET_MAX_UNIVERSE    63999  // Highest sACN universe (Art-Net stops at 32767)
+
+// RMT Configuration for Hardware Pulse Generation (STEPPER_BACKEND_RMT)
+// One TX channel per axis is allocated by the driver (ESP32-S3: 4 TX channels)
 #define RMT_CLK_DIV             80               // 80MHz / 80 = 1MHz (1μs resolution)
-#define RMT_MEM_BLOCK_NUM       1                // Memory blocks for RMT
-#define RMT_IDLE_LEVEL          RMT_IDLE_LEVEL_LOW // Idle level for step pin
+#define RMT_MEM_BLOCK_NUM       1                // 48-symbol memory blocks per channel
+#define RMT_IDLE_LEVEL          0                // Idle level for step pin (low)
+#define RMT_BLOCK_SYMBOLS       64               // Symbols (steps) per pulse block
+#define RMT_BLOCK_MAX_US        2000             // Longest pulse block (bounds stop latency)
+#define RMT_DIR_SETUP_US        20               // DIR setup before the first step after a reversal
 
 // Timing Constants for 25% Duty Cycle Step Pulses
 #define MIN_STEP_PULSE_WIDTH    2    // Minimum step pulse width (microseconds) - CL57Y requirement
 #define STEP_PULSE_DUTY_CYCLE   0.25 // 25% duty cycle for step pulses
+#ifdef STEPPER_BACKEND_RMT
+#define MIN_STEP_PERIOD         25   // Minimum step period (40kHz max frequency)
+#define MAX_STEP_FREQUENCY      40000 // Maximum step frequency (Hz)
+#else
 #define MIN_STEP_PERIOD         100  // Minimum step period (10kHz max frequency)
 #define MAX_STEP_FREQUENCY      10000 // Maximum step frequency (Hz)
-#define LIMIT_SWITCH_DEBOUNCE   100  // Limit switch debounce time (ms) - Increased for noise immunity
+#endif
+#define LIMIT_FILTER_SAMPLES    8    // Default limit glitch filter samples (window = (samples - 1) x spacing)
+#define LIMIT_FILTER_MAX_SAMPLES 32  // Upper bound for the limitFilterSamples parameter
+#define LIMIT_FILTER_SAMPLE_US  50   // Glitch filter window per sample (microseconds)
+#define LIMIT_EDGE_RING_SIZE    16   // ISR edge timestamp ring (power of two)
 
 // Calculate pulse timing from frequency for RMT
 #define RMT_PERIOD_FROM_FREQ(freq)      (1000000.0f / (freq))              // Period in microseconds
@@ -106,5 +141,10 @@
 // System Timing
 #define MAIN_LOOP_INTERVAL_MS   10   // Main loop cycle time
 #define STATUS_UPDATE_INTERVAL_MS 100 // Status reporting interval
+#define STEPPER_TASK_ACTIVE_MS  2    // Stepper housekeeping period while moving/homing
+#define STEPPER_TASK_IDLE_MS    20   // Stepper housekeeping period when idle (events wake immediately)
+
+// Inter-Module Queues
+#define MOTION_COMMAND_QUEUE_SIZE 32 // Motion commands (drained and coalesced every stepper wake)
 
 #endif // HARDWARECONFIG_H
\ No newline at end of file
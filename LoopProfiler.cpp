@@ -0,0 +1,195 @@
+// ============================================================================
+// File: LoopProfiler.cpp
+// Project: SkullStepperV4 - ESP32-S3 Modular Stepper Control System
+// Version: 4.2.0
+// Date: 2026-10-15
+// Author: Tim Rosener
+// Description: Cycle-counter profiler for the Core 0 stepper control loop
+// License: MIT
+// ============================================================================
+
+#include "LoopProfiler.h"
+
+namespace LoopProfiler {
+
+static const char* const ZONE_NAMES[ZONE_COUNT] = {
+    "limits", "commands", "stream", "homing", "status",
+    "alarm", "autoHome", "publish", "cycle"
+};
+
+#ifdef ENABLE_LOOP_PROFILER
+
+// Log-linear buckets: 4 per power of two, covering 2^2 to 2^26
+// (2^26 cycles is 280 ms at 240 MHz - anything longer lands in the last bucket)
+static const uint8_t MIN_OCTAVE = 2;
+static const uint8_t OCTAVES = 24;
+static const uint8_t SUB_BUCKETS = 4;
+static const uint8_t BUCKET_COUNT = OCTAVES * SUB_BUCKETS;
+
+struct Histogram {
+    uint32_t buckets[BUCKET_COUNT];
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t sum;
+};
+
+static Histogram g_zones[ZONE_COUNT];
+static Histogram g_jitter;
+static volatile bool g_resetRequested = true;  // First record starts from a clean slate
+
+/**
+ * Bucket index for a value (top two bits below the leading one pick the sub-bucket)
+ */
+static uint8_t bucketFor(uint32_t value) {
+    if (value < (1UL << MIN_OCTAVE)) return 0;
+    uint8_t msb = 31 - __builtin_clz(value);
+    if (msb >= MIN_OCTAVE + OCTAVES) return BUCKET_COUNT - 1;
+    uint8_t sub = (value >> (msb - 2)) & (SUB_BUCKETS - 1);
+    return (msb - MIN_OCTAVE) * SUB_BUCKETS + sub;
+}
+
+/**
+ * Largest value that falls into a bucket
+ */
+static uint32_t bucketUpperEdge(uint8_t bucket) {
+    uint8_t msb = bucket / SUB_BUCKETS + MIN_OCTAVE;
+    uint32_t step = 1UL << (msb - 2);
+    return (1UL << msb) + (bucket % SUB_BUCKETS + 1) * step - 1;
+}
+
+static void clearHistogram(Histogram& histogram) {
+    memset(&histogram, 0, sizeof(histogram));
+    histogram.min = UINT32_MAX;
+}
+
+static void addSample(Histogram& histogram, uint32_t value) {
+    histogram.buckets[bucketFor(value)]++;
+    histogram.count++;
+    histogram.sum += value;
+    if (value < histogram.min) histogram.min = value;
+    if (value > histogram.max) histogram.max = value;
+}
+
+/**
+ * Apply a reset requested from another core (writer side only)
+ */
+static void applyPendingReset() {
+    if (!g_resetRequested) return;
+    for (uint8_t i = 0; i < ZONE_COUNT; i++) {
+        clearHistogram(g_zones[i]);
+    }
+    clearHistogram(g_jitter);
+    g_resetRequested = false;
+}
+
+static bool summarize(const Histogram& histogram, Stats& stats) {
+    stats.count = histogram.count;
+    if (stats.count == 0) {
+        stats.min = stats.avg = stats.max = stats.p99 = 0;
+        return false;
+    }
+    stats.min = histogram.min;
+    stats.max = histogram.max;
+    stats.avg = (uint32_t)(histogram.sum / stats.count);
+
+    // First bucket where the running count reaches 99% of the samples
+    uint32_t target = stats.count - stats.count / 100;
+    uint32_t seen = 0;
+    stats.p99 = stats.max;
+    for (uint8_t i = 0; i < BUCKET_COUNT; i++) {
+        seen += histogram.buckets[i];
+        if (seen >= target) {
+            stats.p99 = min(bucketUpperEdge(i), stats.max);
+            break;
+        }
+    }
+    return true;
+}
+
+uint32_t record(Zone zone, uint32_t startCycles) {
+    applyPendingReset();
+    uint32_t nowCycles = now();
+    addSample(g_zones[(uint8_t)zone], nowCycles - startCycles);
+    return nowCycles;
+}
+
+void recordWake(uint32_t sleptUs, uint32_t periodUs) {
+    applyPendingReset();
+    addSample(g_jitter, sleptUs > periodUs ? sleptUs - periodUs : periodUs - sleptUs);
+}
+
+bool getZoneStats(Zone zone, Stats& stats) {
+    if (zone >= Zone::COUNT || g_resetRequested) {
+        memset(&stats, 0, sizeof(stats));
+        return false;
+    }
+    return summarize(g_zones[(uint8_t)zone], stats);
+}
+
+bool getJitterStats(Stats& stats) {
+    if (g_resetRequested) {
+        memset(&stats, 0, sizeof(stats));
+        return false;
+    }
+    return summarize(g_jitter, stats);
+}
+
+void reset() {
+    g_resetRequested = true;
+}
+
+#else // ENABLE_LOOP_PROFILER not defined
+
+bool getZoneStats(Zone zone, Stats& stats) {
+    memset(&stats, 0, sizeof(stats));
+    return false;
+}
+
+bool getJitterStats(Stats& stats) {
+    memset(&stats, 0, sizeof(stats));
+    return false;
+}
+
+void reset() {}
+
+#endif // ENABLE_LOOP_PROFILER
+
+const char* zoneName(Zone zone) {
+    return (zone < Zone::COUNT) ? ZONE_NAMES[(uint8_t)zone] : "unknown";
+}
+
+uint32_t cyclesPerMicrosecond() {
+    return ESP.getCpuFreqMHz();
+}
+
+static void statsToJson(JsonObject out, const Stats& stats) {
+    out["count"] = stats.count;
+    out["min"] = stats.min;
+    out["avg"] = stats.avg;
+    out["max"] = stats.max;
+    out["p99"] = stats.p99;
+}
+
+void exportJson(JsonObject out) {
+#ifdef ENABLE_LOOP_PROFILER
+    out["enabled"] = true;
+#else
+    out["enabled"] = false;
+#endif
+    out["cpuMHz"] = cyclesPerMicrosecond();
+
+    // Cycle counts per zone
+    JsonObject zones = out.createNestedObject("zones");
+    for (uint8_t i = 0; i < ZONE_COUNT; i++) {
+        Stats stats;
+        getZoneStats((Zone)i, stats);
+        statsToJson(zones.createNestedObject(zoneName((Zone)i)), stats);
+    }
+
+    Stats jitter;
+    getJitterStats(jitter);
+    statsToJson(out.createNestedObject("jitterUs"), jitter);
+}
+
+} // namespace LoopProfiler
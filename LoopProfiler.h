@@ -0,0 +1,133 @@
+// ============================================================================
+// File: LoopProfiler.h
+// Project: SkullStepperV4 - ESP32-S3 Modular Stepper Control System
+// Version: 4.2.0
+// Date: 2026-10-15
+// Author: Tim Rosener
+// Description: Cycle-counter profiler for the Core 0 stepper control loop
+// License: MIT
+//
+// Each zone of stepperControllerTask records its CPU cycle count into a
+// fixed-size log-linear histogram (4 buckets per power of two, so p99 is
+// within 25%). Wake-up jitter against the active housekeeping period is
+// kept the same way in microseconds. Only the Core 0 task writes; readers
+// on Core 1 copy the counters without locking (diagnostics only).
+// Disable with ENABLE_LOOP_PROFILER in ProjectConfig.h.
+// ============================================================================
+
+#ifndef LOOPPROFILER_H
+#define LOOPPROFILER_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include "ProjectConfig.h"
+
+// ============================================================================
+// LoopProfiler Namespace - Control Loop Instrumentation
+// ============================================================================
+
+namespace LoopProfiler {
+
+    // ------------------------------------------------------------------------
+    // Types
+    // ------------------------------------------------------------------------
+
+    /**
+     * Instrumented zones of stepperControllerTask, in loop order
+     */
+    enum class Zone : uint8_t {
+        LIMITS,      // checkLimitSwitches()
+        COMMANDS,    // Queue receive, coalescing and processMotionCommand()
+        STREAM,      // Cue approach, S-curve/path/cue streaming and follow mode
+        HOMING,      // updateHomingSequence()
+        STATUS,      // updateMotionStatus()
+        ALARM,       // checkAlarmStatus()
+        AUTO_HOME,   // Auto-home after E-stop block
+        PUBLISH,     // publishMotionStatus()
+        CYCLE,       // Whole loop pass, wake to sleep
+        COUNT
+    };
+
+    const uint8_t ZONE_COUNT = (uint8_t)Zone::COUNT;
+
+    /**
+     * Summary of one histogram (cycles for zones, microseconds for jitter)
+     */
+    struct Stats {
+        uint32_t count;   // Samples since the last reset
+        uint32_t min;
+        uint32_t avg;
+        uint32_t max;
+        uint32_t p99;     // Upper edge of the bucket holding the 99th percentile
+    };
+
+    // ------------------------------------------------------------------------
+    // Recording (Core 0 task only)
+    // ------------------------------------------------------------------------
+
+#ifdef ENABLE_LOOP_PROFILER
+    /**
+     * Current CPU cycle count, the start stamp for a zone
+     */
+    inline uint32_t now() {
+        return ESP.getCycleCount();
+    }
+
+    /**
+     * Record a zone that started at startCycles
+     * @return cycle count now, so consecutive zones can chain their stamps
+     */
+    uint32_t record(Zone zone, uint32_t startCycles);
+
+    /**
+     * Record a timed wake-up (no event) against the period that was requested
+     * @param sleptUs Time actually spent waiting
+     * @param periodUs Requested housekeeping period
+     */
+    void recordWake(uint32_t sleptUs, uint32_t periodUs);
+#else
+    inline uint32_t now() { return 0; }
+    inline uint32_t record(Zone, uint32_t) { return 0; }
+    inline void recordWake(uint32_t, uint32_t) {}
+#endif
+
+    // ------------------------------------------------------------------------
+    // Reporting (any core)
+    // ------------------------------------------------------------------------
+
+    /**
+     * Get the summary for one zone
+     * @return false if the zone has no samples
+     */
+    bool getZoneStats(Zone zone, Stats& stats);
+
+    /**
+     * Get the wake-up jitter summary (|actual - period|, microseconds)
+     * @return false if no timed wake-ups have been recorded
+     */
+    bool getJitterStats(Stats& stats);
+
+    /**
+     * Short zone name for reports ("limits", "commands", ...)
+     */
+    const char* zoneName(Zone zone);
+
+    /**
+     * Clear all histograms (applied by the Core 0 task on its next wake)
+     */
+    void reset();
+
+    /**
+     * CPU cycles per microsecond, for converting reported cycle counts
+     */
+    uint32_t cyclesPerMicrosecond();
+    
+    /**
+     * Write all zones and the jitter summary as JSON (serial and web API)
+     * @param out Object receiving "enabled", "cpuMHz", "zones" and "jitterUs"
+     */
+    void exportJson(JsonObject out);
+
+} // namespace LoopProfiler
+
+#endif // LOOPPROFILER_H
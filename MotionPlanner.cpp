@@ -0,0 +1,349 @@
+// ============================================================================
+// File: MotionPlanner.cpp
+// Project: SkullStepperV4 - ESP32-S3 Modular Stepper Control System
+// Version: 4.2.0
+// Date: 2026-10-15
+// Author: Tim Rosener
+// Description: S-curve and waypoint look-ahead planning implementation
+// License: MIT
+// ============================================================================
+
+#include "MotionPlanner.h"
+#include <math.h>
+
+namespace MotionPlanner {
+
+// Bisection steps when shortening the cruise velocity for short moves
+// (20 halvings resolve vMax to better than 1 ppm)
+static const uint8_t VELOCITY_SEARCH_ITERATIONS = 20;
+
+/**
+ * Ramp timing for reaching velocity v from rest
+ * @param tj Returns jerk segment duration
+ * @param tc Returns constant-acceleration segment duration
+ * @return distance covered by the ramp
+ */
+static float rampForVelocity(float v, float aMax, float jerk, float& tj, float& tc) {
+    if (v * jerk >= aMax * aMax) {
+        // Acceleration limit reached - trapezoidal acceleration
+        tj = aMax / jerk;
+        tc = v / aMax - tj;
+    } else {
+        // Acceleration limit not reached - triangular acceleration
+        tj = sqrtf(v / jerk);
+        tc = 0.0f;
+    }
+    return v * (2.0f * tj + tc) * 0.5f;
+}
+
+bool planSCurve(int32_t start, int32_t target, float vMax, float aMax, float jerk,
+                SCurveProfile& out) {
+    memset(&out, 0, sizeof(out));
+    out.startPosition = start;
+    out.direction = (target >= start) ? 1 : -1;
+    out.distance = abs(target - start);
+
+    if (out.distance == 0 || vMax <= 0.0f || aMax <= 0.0f || jerk <= 0.0f) {
+        return false;
+    }
+
+    const float distance = (float)out.distance;
+    float tj = 0.0f, tc = 0.0f;
+    float v = vMax;
+    float rampDistance = rampForVelocity(v, aMax, jerk, tj, tc);
+
+    // Too short to reach vMax: find the highest cruise velocity that fits
+    if (2.0f * rampDistance > distance) {
+        float lo = 0.0f, hi = vMax;
+        for (uint8_t i = 0; i < VELOCITY_SEARCH_ITERATIONS; i++) {
+            float mid = 0.5f * (lo + hi);
+            if (2.0f * rampForVelocity(mid, aMax, jerk, tj, tc) > distance) {
+                hi = mid;
+            } else {
+                lo = mid;
+            }
+        }
+        v = lo;
+        rampDistance = rampForVelocity(v, aMax, jerk, tj, tc);
+    }
+
+    float tv = (distance - 2.0f * rampDistance) / v;
+    if (tv < 0.0f) tv = 0.0f;
+
+    const float durations[SCURVE_SEGMENTS] = { tj, tc, tj, tv, tj, tc, tj };
+    const float jerks[SCURVE_SEGMENTS] = { jerk, 0.0f, -jerk, 0.0f, -jerk, 0.0f, jerk };
+
+    // Integrate the start state of each segment
+    float a = 0.0f, vel = 0.0f, p = 0.0f;
+    for (uint8_t i = 0; i < SCURVE_SEGMENTS; i++) {
+        SCurveSegment& seg = out.segments[i];
+        const float t = durations[i];
+        seg.duration = t;
+        seg.jerk = jerks[i];
+        seg.a0 = a;
+        seg.v0 = vel;
+        seg.p0 = p;
+
+        p += vel * t + a * t * t * 0.5f + seg.jerk * t * t * t / 6.0f;
+        vel += a * t + seg.jerk * t * t * 0.5f;
+        a += seg.jerk * t;
+        out.totalTime += t;
+    }
+
+    out.peakVelocity = v;
+    out.peakAccel = jerk * tj;
+    return true;
+}
+
+uint8_t segmentAt(const SCurveProfile& profile, float t) {
+    float segmentEnd = 0.0f;
+    for (uint8_t i = 0; i < SCURVE_SEGMENTS - 1; i++) {
+        segmentEnd += profile.segments[i].duration;
+        if (t < segmentEnd) {
+            return i;
+        }
+    }
+    return SCURVE_SEGMENTS - 1;
+}
+
+/**
+ * Locate the segment for t and return the time offset into it
+ */
+static const SCurveSegment& locate(const SCurveProfile& profile, float t, float& tau) {
+    if (t < 0.0f) t = 0.0f;
+    if (t > profile.totalTime) t = profile.totalTime;
+
+    float segmentStart = 0.0f;
+    uint8_t i = 0;
+    for (; i < SCURVE_SEGMENTS - 1; i++) {
+        if (t < segmentStart + profile.segments[i].duration) {
+            break;
+        }
+        segmentStart += profile.segments[i].duration;
+    }
+    tau = t - segmentStart;
+    return profile.segments[i];
+}
+
+float positionAt(const SCurveProfile& profile, float t) {
+    float tau;
+    const SCurveSegment& seg = locate(profile, t, tau);
+    return seg.p0 + seg.v0 * tau + seg.a0 * tau * tau * 0.5f +
+           seg.jerk * tau * tau * tau / 6.0f;
+}
+
+float velocityAt(const SCurveProfile& profile, float t) {
+    float tau;
+    const SCurveSegment& seg = locate(profile, t, tau);
+    return seg.v0 + seg.a0 * tau + seg.jerk * tau * tau * 0.5f;
+}
+
+float trapezoidDuration(int32_t distance, float vMax, float aMax) {
+    if (distance <= 0 || vMax <= 0.0f || aMax <= 0.0f) {
+        return 0.0f;
+    }
+
+    const float d = (float)distance;
+    const float rampDistance = vMax * vMax / aMax;  // Accel + decel together
+    if (rampDistance >= d) {
+        // Triangular profile - never reaches vMax
+        return 2.0f * sqrtf(d / aMax);
+    }
+    return 2.0f * vMax / aMax + (d - rampDistance) / vMax;
+}
+
+float moveDuration(int32_t distance, float v0, float vMax, float aMax) {
+    if (vMax <= 0.0f || aMax <= 0.0f) {
+        return 0.0f;
+    }
+
+    // Work in the direction of the target
+    float d = (float)distance;
+    if (d < 0.0f) {
+        d = -d;
+        v0 = -v0;
+    }
+
+    float t = 0.0f;
+    if (v0 < 0.0f) {
+        // Moving away - stop, then cover the extra distance from rest
+        t = -v0 / aMax;
+        d += v0 * v0 / (2.0f * aMax);
+        v0 = 0.0f;
+    }
+    v0 = fminf(v0, vMax);
+
+    const float stoppingDistance = v0 * v0 / (2.0f * aMax);
+    if (stoppingDistance > d) {
+        // Too fast to stop in time - stop past the target and come back
+        return t + v0 / aMax + trapezoidDuration((int32_t)(stoppingDistance - d + 0.5f), vMax, aMax);
+    }
+
+    const float peak = sqrtf(aMax * d + 0.5f * v0 * v0);
+    if (peak <= vMax) {
+        // Triangular profile - never reaches vMax
+        return t + (2.0f * peak - v0) / aMax;
+    }
+    const float rampDistance = (2.0f * vMax * vMax - v0 * v0) / (2.0f * aMax);
+    return t + (2.0f * vMax - v0) / aMax + (d - rampDistance) / vMax;
+}
+
+// ============================================================================
+// Waypoint Path Buffer
+// ============================================================================
+
+void pathClear(PathBuffer& path) {
+    path.head = 0;
+    path.count = 0;
+}
+
+PathSegment* pathAt(PathBuffer& path, uint8_t n) {
+    if (n >= path.count) {
+        return nullptr;
+    }
+    return &path.segments[(path.head + n) % PATH_BUFFER_SIZE];
+}
+
+bool pathAppend(PathBuffer& path, int32_t start, int32_t target, float maxSpeed, float accel) {
+    if (path.count >= PATH_BUFFER_SIZE || maxSpeed <= 0.0f || accel <= 0.0f) {
+        return false;
+    }
+
+    PathSegment* last = pathAt(path, path.count - 1);
+    if (last != nullptr) {
+        start = last->target;
+    }
+    if (target == start) {
+        return true;  // Already there - nothing to plan
+    }
+
+    PathSegment& seg = path.segments[(path.head + path.count) % PATH_BUFFER_SIZE];
+    memset(&seg, 0, sizeof(seg));
+    seg.start = start;
+    seg.target = target;
+    seg.maxSpeed = maxSpeed;
+    seg.accel = accel;
+    path.count++;
+    return true;
+}
+
+void pathPop(PathBuffer& path) {
+    if (path.count > 0) {
+        path.head = (path.head + 1) % PATH_BUFFER_SIZE;
+        path.count--;
+    }
+}
+
+/**
+ * Fit a trapezoid between fixed entry and exit speeds
+ */
+static void planSegmentTiming(PathSegment& seg) {
+    const float distance = (float)abs(seg.target - seg.start);
+    const float a = seg.accel;
+    const float v0 = seg.entrySpeed;
+    const float v1 = seg.exitSpeed;
+
+    // Highest speed reachable while still able to slow to v1 by the waypoint
+    float peak = sqrtf((2.0f * a * distance + v0 * v0 + v1 * v1) * 0.5f);
+    float vc = (peak < seg.maxSpeed) ? peak : seg.maxSpeed;
+    if (vc < v0) vc = v0;
+    if (vc < v1) vc = v1;
+
+    const float accelDistance = (vc * vc - v0 * v0) / (2.0f * a);
+    const float decelDistance = (vc * vc - v1 * v1) / (2.0f * a);
+    float cruiseDistance = distance - accelDistance - decelDistance;
+    if (cruiseDistance < 0.0f) cruiseDistance = 0.0f;
+
+    seg.cruiseSpeed = vc;
+    seg.accelTime = (vc - v0) / a;
+    seg.decelTime = (vc - v1) / a;
+    seg.cruiseTime = (vc > 0.0f) ? cruiseDistance / vc : 0.0f;
+}
+
+void pathReplan(PathBuffer& path, uint8_t frozen, float entrySpeed) {
+    if (frozen >= path.count) {
+        return;
+    }
+
+    // Reverse pass: the path ends at rest; each entry speed is capped by the
+    // junction limit and by what the segment can shed before its exit
+    float nextEntry = 0.0f;
+    for (int i = path.count - 1; i >= frozen; i--) {
+        PathSegment& seg = *pathAt(path, i);
+        PathSegment* prev = (i > 0) ? pathAt(path, i - 1) : nullptr;
+        const float distance = (float)abs(seg.target - seg.start);
+
+        seg.exitSpeed = nextEntry;
+        float junction = 0.0f;
+        if (prev != nullptr &&
+            ((seg.target > seg.start) == (prev->target > prev->start))) {
+            junction = (seg.maxSpeed < prev->maxSpeed) ? seg.maxSpeed : prev->maxSpeed;
+        }
+        float reachable = sqrtf(seg.exitSpeed * seg.exitSpeed + 2.0f * seg.accel * distance);
+        seg.entrySpeed = (junction < reachable) ? junction : reachable;
+        nextEntry = seg.entrySpeed;
+    }
+
+    // Forward pass: entry speeds are fixed by what precedes them, exits are
+    // capped by what the segment can gain
+    float entry = (frozen > 0) ? pathAt(path, frozen - 1)->exitSpeed : entrySpeed;
+    for (uint8_t i = frozen; i < path.count; i++) {
+        PathSegment& seg = *pathAt(path, i);
+        const float distance = (float)abs(seg.target - seg.start);
+
+        seg.entrySpeed = entry;
+        float reachable = sqrtf(entry * entry + 2.0f * seg.accel * distance);
+        if (seg.exitSpeed > reachable) {
+            seg.exitSpeed = reachable;
+        }
+        planSegmentTiming(seg);
+        entry = seg.exitSpeed;
+    }
+}
+
+float segmentDuration(const PathSegment& segment) {
+    return segment.accelTime + segment.cruiseTime + segment.decelTime;
+}
+
+float segmentPositionAt(const PathSegment& segment, float t) {
+    const float a = segment.accel;
+    if (t <= 0.0f) {
+        return 0.0f;
+    }
+    if (t < segment.accelTime) {
+        return segment.entrySpeed * t + 0.5f * a * t * t;
+    }
+
+    float p = (segment.entrySpeed + segment.cruiseSpeed) * 0.5f * segment.accelTime;
+    t -= segment.accelTime;
+    if (t < segment.cruiseTime) {
+        return p + segment.cruiseSpeed * t;
+    }
+
+    p += segment.cruiseSpeed * segment.cruiseTime;
+    t -= segment.cruiseTime;
+    if (t > segment.decelTime) {
+        t = segment.decelTime;
+    }
+    return p + segment.cruiseSpeed * t - 0.5f * a * t * t;
+}
+
+float segmentVelocityAt(const PathSegment& segment, float t) {
+    if (t <= 0.0f) {
+        return segment.entrySpeed;
+    }
+    if (t < segment.accelTime) {
+        return segment.entrySpeed + segment.accel * t;
+    }
+    t -= segment.accelTime;
+    if (t < segment.cruiseTime) {
+        return segment.cruiseSpeed;
+    }
+    t -= segment.cruiseTime;
+    if (t > segment.decelTime) {
+        t = segment.decelTime;
+    }
+    return segment.cruiseSpeed - segment.accel * t;
+}
+
+} // namespace MotionPlanner
@@ -0,0 +1,220 @@
+// ============================================================================
+// File: MotionPlanner.h
+// Project: SkullStepperV4 - ESP32-S3 Modular Stepper Control System
+// Version: 4.2.0
+// Date: 2026-10-15
+// Author: Tim Rosener
+// Description: Trajectory planning - jerk-limited (S-curve) point-to-point moves
+//              and a look-ahead planner for chained waypoint segments
+// License: MIT
+//
+// Pure math, no hardware access. StepperController samples the profiles
+// produced here and feeds the result to the step generator on Core 0.
+// Path buffers are owned and modified by the Core 0 task only.
+// ============================================================================
+
+#ifndef MOTIONPLANNER_H
+#define MOTIONPLANNER_H
+
+#include <Arduino.h>
+
+// ============================================================================
+// MotionPlanner Namespace - S-Curves and Waypoint Look-Ahead
+// ============================================================================
+
+namespace MotionPlanner {
+
+    // ------------------------------------------------------------------------
+    // Constants
+    // ------------------------------------------------------------------------
+
+    // Classic 7-segment S-curve:
+    //   0 jerk+  1 const accel  2 jerk-  3 cruise  4 jerk-  5 const decel  6 jerk+
+    const uint8_t SCURVE_SEGMENTS = 7;
+    
+    // Waypoint segments held by a path buffer (show cues are 5-20 waypoints)
+    const uint8_t PATH_BUFFER_SIZE = 32;
+
+    // ------------------------------------------------------------------------
+    // Planner Structures
+    // ------------------------------------------------------------------------
+
+    /**
+     * One constant-jerk segment, with the kinematic state at its start
+     * Distances are measured from the move start along the direction of travel
+     */
+    struct SCurveSegment {
+        float duration;   // Segment length (s), may be 0
+        float jerk;       // Constant jerk during segment (steps/sec³)
+        float a0;         // Acceleration at segment start (steps/sec²)
+        float v0;         // Velocity at segment start (steps/sec)
+        float p0;         // Distance travelled at segment start (steps)
+    };
+
+    /**
+     * Precomputed S-curve for a single move
+     */
+    struct SCurveProfile {
+        SCurveSegment segments[SCURVE_SEGMENTS];
+        float totalTime;        // Move duration (s)
+        int32_t distance;       // Unsigned move length (steps)
+        float peakVelocity;     // Cruise velocity actually reached (steps/sec)
+        float peakAccel;        // Acceleration actually reached (steps/sec²)
+        int8_t direction;       // +1 or -1
+        int32_t startPosition;  // Absolute start position (steps)
+    };
+
+    /**
+     * One waypoint segment: trapezoid from entry speed to exit speed
+     * Speeds and times are filled in by pathReplan()
+     */
+    struct PathSegment {
+        int32_t start;        // Absolute start position (steps)
+        int32_t target;       // Absolute waypoint position (steps)
+        float maxSpeed;       // Cruise speed limit (steps/sec)
+        float accel;          // Acceleration/deceleration (steps/sec²)
+        float entrySpeed;     // Speed at start (steps/sec)
+        float cruiseSpeed;    // Peak speed reached (steps/sec)
+        float exitSpeed;      // Speed passing through the waypoint (steps/sec)
+        float accelTime;      // Time from entry to cruise speed (s)
+        float cruiseTime;     // Time at cruise speed (s)
+        float decelTime;      // Time from cruise to exit speed (s)
+    };
+    
+    /**
+     * Ring buffer of waypoint segments, oldest first
+     */
+    struct PathBuffer {
+        PathSegment segments[PATH_BUFFER_SIZE];
+        uint8_t head;         // Index of the oldest segment
+        uint8_t count;        // Segments in the buffer
+    };
+    
+    // ------------------------------------------------------------------------
+    // Planning Functions
+    // ------------------------------------------------------------------------
+
+    /**
+     * Plan a rest-to-rest jerk-limited move
+     * Reduces the cruise velocity when the move is too short to reach vMax
+     * @param start Absolute start position (steps)
+     * @param target Absolute target position (steps)
+     * @param vMax Maximum velocity (steps/sec)
+     * @param aMax Maximum acceleration (steps/sec²)
+     * @param jerk Jerk limit (steps/sec³)
+     * @param out Returns the segment table
+     * @return true if a profile was planned (false for zero-length or invalid limits)
+     */
+    bool planSCurve(int32_t start, int32_t target, float vMax, float aMax, float jerk,
+                    SCurveProfile& out);
+
+    /**
+     * Find the segment active at time t
+     * @param profile Planned profile
+     * @param t Time since move start (s)
+     * @return segment index 0-6 (6 once t passes the end)
+     */
+    uint8_t segmentAt(const SCurveProfile& profile, float t);
+
+    /**
+     * Distance travelled at time t (unsigned, along the direction of travel)
+     * @param profile Planned profile
+     * @param t Time since move start (s), clamped to [0, totalTime]
+     * @return distance in steps (fractional)
+     */
+    float positionAt(const SCurveProfile& profile, float t);
+
+    /**
+     * Speed at time t (unsigned)
+     * @param profile Planned profile
+     * @param t Time since move start (s), clamped to [0, totalTime]
+     * @return speed in steps/sec
+     */
+    float velocityAt(const SCurveProfile& profile, float t);
+
+    /**
+     * Duration of the equivalent trapezoidal move, for comparison
+     * @param distance Unsigned move length (steps)
+     * @param vMax Maximum velocity (steps/sec)
+     * @param aMax Maximum acceleration (steps/sec²)
+     * @return move time in seconds
+     */
+    float trapezoidDuration(int32_t distance, float vMax, float aMax);
+
+    /**
+     * Expected duration of a ramp-generator move that starts in motion
+     * Covers stopping first when moving away from the target and the
+     * overshoot-and-return when already too fast to stop in time
+     * @param distance Signed distance to the target (steps)
+     * @param v0 Signed current velocity (steps/sec)
+     * @param vMax Maximum velocity (steps/sec)
+     * @param aMax Acceleration, also used for deceleration (steps/sec²)
+     * @return move time in seconds (0 if limits are invalid)
+     */
+    float moveDuration(int32_t distance, float v0, float vMax, float aMax);
+    
+    // ------------------------------------------------------------------------
+    // Path Buffer Functions
+    // ------------------------------------------------------------------------
+    
+    /**
+     * Empty a path buffer
+     */
+    void pathClear(PathBuffer& path);
+    
+    /**
+     * Append a waypoint; the segment starts where the previous one ends
+     * Zero-length segments are ignored (reported as accepted)
+     * @param path Path buffer
+     * @param start Start position, used only when the buffer is empty
+     * @param target Waypoint position (steps)
+     * @param maxSpeed Cruise speed limit (steps/sec)
+     * @param accel Acceleration (steps/sec²)
+     * @return false if the buffer is full or limits are invalid
+     */
+    bool pathAppend(PathBuffer& path, int32_t start, int32_t target, float maxSpeed, float accel);
+    
+    /**
+     * Access the segment n places after the oldest
+     * @return segment pointer, nullptr if n >= count
+     */
+    PathSegment* pathAt(PathBuffer& path, uint8_t n);
+    
+    /**
+     * Remove the oldest segment
+     */
+    void pathPop(PathBuffer& path);
+    
+    /**
+     * Look-ahead: recompute junction speeds and segment timing
+     * The path always ends at rest; a junction keeps its speed only when
+     * travel continues in the same direction
+     * @param path Path buffer
+     * @param frozen Leading segments already executing (left untouched)
+     * @param entrySpeed Entry speed of the first unfrozen segment when frozen == 0
+     */
+    void pathReplan(PathBuffer& path, uint8_t frozen, float entrySpeed);
+    
+    /**
+     * Duration of a planned segment
+     * @return seconds
+     */
+    float segmentDuration(const PathSegment& segment);
+    
+    /**
+     * Distance travelled into a planned segment at time t (unsigned)
+     * @param t Time since segment start (s), clamped to the segment
+     * @return distance in steps (fractional)
+     */
+    float segmentPositionAt(const PathSegment& segment, float t);
+    
+    /**
+     * Speed within a planned segment at time t (unsigned)
+     * @param t Time since segment start (s), clamped to the segment
+     * @return speed in steps/sec
+     */
+    float segmentVelocityAt(const PathSegment& segment, float t);
+
+} // namespace MotionPlanner
+
+#endif // MOTIONPLANNER_H
@@ -0,0 +1,142 @@
+// ============================================================================
+// File: MotionTrace.cpp
+// Project: SkullStepperV4 - ESP32-S3 Modular Stepper Control System
+// Version: 4.2.0
+// Date: 2026-10-15
+// Author: Tim Rosener
+// Description: Binary flight recorder for motion events
+// License: MIT
+// ============================================================================
+
+#include "MotionTrace.h"
+#include <atomic>
+
+namespace MotionTrace {
+
+static_assert(sizeof(Record) == 12, "Trace record layout is part of the dump format");
+static_assert((TRACE_BUFFER_EVENTS & (TRACE_BUFFER_EVENTS - 1)) == 0,
+              "TRACE_BUFFER_EVENTS must be a power of two");
+
+static const char* const EVENT_NAMES[(uint8_t)Event::COUNT] = {
+    "command", "moveStart", "rampPhase", "limitEdge",
+    "forceStop", "homingPhase", "dmxMode", "queueOverflow"
+};
+
+// ----------------------------------------------------------------------------
+// Private Module Variables
+// ----------------------------------------------------------------------------
+
+/**
+ * One buffer slot. The sequence is 0 while a writer fills the slot and
+ * index + 1 once it holds event number index - readers check it before
+ * and after copying the record (seqlock, no writer ever waits).
+ */
+struct Slot {
+    std::atomic<uint32_t> sequence;
+    Record record;
+};
+
+static Slot g_slots[TRACE_BUFFER_EVENTS];
+static std::atomic<uint32_t> g_head(0);       // Next event number
+static std::atomic<uint32_t> g_clearedAt(0);  // First event number after the last clear
+
+#ifdef ENABLE_MOTION_TRACE
+
+void recordAt(uint32_t timeUs, Event event, uint8_t arg, uint16_t id, int32_t value) {
+    uint32_t index = g_head.fetch_add(1, std::memory_order_relaxed);
+    Slot& slot = g_slots[index & (TRACE_BUFFER_EVENTS - 1)];
+
+    slot.sequence.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.record.timeUs = timeUs;
+    slot.record.event = (uint8_t)event;
+    slot.record.arg = arg;
+    slot.record.id = id;
+    slot.record.value = value;
+    slot.sequence.store(index + 1, std::memory_order_release);
+}
+
+#endif // ENABLE_MOTION_TRACE
+
+/**
+ * Oldest event number still in the buffer (and not cleared)
+ */
+static uint32_t firstHeld(uint32_t head) {
+    uint32_t cleared = g_clearedAt.load(std::memory_order_relaxed);
+    uint32_t recorded = head - cleared;
+    return (recorded > TRACE_BUFFER_EVENTS) ? head - TRACE_BUFFER_EVENTS : cleared;
+}
+
+void getSummary(Summary& summary) {
+    uint32_t head = g_head.load(std::memory_order_acquire);
+    uint32_t first = firstHeld(head);
+    summary.recorded = head - g_clearedAt.load(std::memory_order_relaxed);
+    summary.overwritten = summary.recorded - (head - first);
+    summary.held = head - first;
+    summary.capacity = TRACE_BUFFER_EVENTS;
+}
+
+size_t maxDumpSize() {
+    return TRACE_HEADER_SIZE + TRACE_BUFFER_EVENTS * sizeof(Record);
+}
+
+static void putU16(uint8_t* out, uint16_t value) {
+    out[0] = value & 0xFF;
+    out[1] = value >> 8;
+}
+
+static void putU32(uint8_t* out, uint32_t value) {
+    for (uint8_t i = 0; i < 4; i++) {
+        out[i] = (value >> (8 * i)) & 0xFF;
+    }
+}
+
+size_t dump(uint8_t* buffer, size_t size) {
+    if (buffer == nullptr || size < TRACE_HEADER_SIZE) {
+        return 0;
+    }
+
+    uint32_t head = g_head.load(std::memory_order_acquire);
+    uint32_t first = firstHeld(head);
+    uint32_t cleared = g_clearedAt.load(std::memory_order_relaxed);
+    uint16_t count = 0;
+    size_t offset = TRACE_HEADER_SIZE;
+
+    for (uint32_t index = first; index != head; index++) {
+        if (offset + sizeof(Record) > size) break;
+        Slot& slot = g_slots[index & (TRACE_BUFFER_EVENTS - 1)];
+
+        uint32_t before = slot.sequence.load(std::memory_order_acquire);
+        if (before != index + 1) continue;  // Still being written or already replaced
+        Record record = slot.record;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_relaxed) != before) continue;
+
+        uint8_t* out = buffer + offset;
+        putU32(out, record.timeUs);
+        out[4] = record.event;
+        out[5] = record.arg;
+        putU16(out + 6, record.id);
+        putU32(out + 8, (uint32_t)record.value);
+        offset += sizeof(Record);
+        count++;
+    }
+
+    memcpy(buffer, "SKTR", 4);
+    buffer[4] = TRACE_FORMAT_VERSION;
+    buffer[5] = sizeof(Record);
+    putU16(buffer + 6, count);
+    putU32(buffer + 8, micros());
+    putU32(buffer + 12, first - cleared);
+    return offset;
+}
+
+void clear() {
+    g_clearedAt.store(g_head.load(std::memory_order_acquire), std::memory_order_relaxed);
+}
+
+const char* eventName(Event event) {
+    return (event < Event::COUNT) ? EVENT_NAMES[(uint8_t)event] : "unknown";
+}
+
+} // namespace MotionTrace
@@ -0,0 +1,149 @@
+// ============================================================================
+// File: MotionTrace.h
+// Project: SkullStepperV4 - ESP32-S3 Modular Stepper Control System
+// Version: 4.2.0
+// Date: 2026-10-15
+// Author: Tim Rosener
+// Description: Binary flight recorder for motion events
+// License: MIT
+//
+// StepperController and DMXReceiver record timestamped motion events
+// (commands, move starts, ramp phases, limit edges, stops, homing phases,
+// DMX mode changes, queue overflows) into a fixed-size circular buffer that
+// keeps the newest TRACE_BUFFER_EVENTS. Recording is lock-free from any task
+// on either core (not from ISRs). The buffer is dumped as a binary blob with
+// TRACE DUMP (hex over serial) or GET /api/trace (raw bytes);
+// scripts/utils/trace_to_chrome.py converts either to Chrome trace JSON.
+//
+// Dump format (little-endian):
+//   Header, 16 bytes:
+//     char[4]  magic "SKTR"
+//     uint8    format version (TRACE_FORMAT_VERSION)
+//     uint8    event size in bytes (12)
+//     uint16   event count that follows
+//     uint32   micros() at dump time (reference for the event timestamps)
+//     uint32   events overwritten since the last clear
+//   Events, oldest first, 12 bytes each:
+//     uint32   micros() timestamp (wraps every 71 minutes)
+//     uint8    event type (MotionTrace::Event)
+//     uint8    argument (per event, see Event)
+//     uint16   command id (COMMAND, MOVE_START, QUEUE_OVERFLOW) else 0
+//     int32    value (per event, see Event)
+//
+// Disable with ENABLE_MOTION_TRACE in ProjectConfig.h.
+// ============================================================================
+
+#ifndef MOTIONTRACE_H
+#define MOTIONTRACE_H
+
+#include <Arduino.h>
+#include "ProjectConfig.h"
+
+#define TRACE_BUFFER_EVENTS   512   // Events kept (power of two)
+#define TRACE_FORMAT_VERSION  1
+#define TRACE_HEADER_SIZE     16
+
+// ============================================================================
+// MotionTrace Namespace - Motion Event Recorder
+// ============================================================================
+
+namespace MotionTrace {
+
+    // ------------------------------------------------------------------------
+    // Types
+    // ------------------------------------------------------------------------
+
+    /**
+     * Event types - values are part of the dump format, append only
+     */
+    enum class Event : uint8_t {
+        COMMAND,         // Command taken from the queue: arg CommandType, value target position
+        MOVE_START,      // Move, path or cue issued to the motor: arg CommandType, value target position
+        RAMP_PHASE,      // Motion state change: arg MotionState, value position
+        LIMIT_EDGE,      // Confirmed switch change at the ISR edge time: arg bit0 right, bit1 active, value latched position
+        FORCE_STOP,      // Motor force-stopped: value position
+        HOMING_PHASE,    // Homing state change: arg HomingState, value position
+        DMX_MODE,        // DMX mode change: arg new DMXMode, value previous DMXMode
+        QUEUE_OVERFLOW,  // Motion command rejected by a full queue: arg CommandType, value target position
+        COUNT
+    };
+
+    /**
+     * One recorded event (also the on-wire layout)
+     */
+    struct Record {
+        uint32_t timeUs;
+        uint8_t event;
+        uint8_t arg;
+        uint16_t id;
+        int32_t value;
+    };
+
+    /**
+     * Buffer summary
+     */
+    struct Summary {
+        uint32_t recorded;     // Events recorded since the last clear
+        uint32_t overwritten;  // Of those, events pushed out by newer ones
+        uint16_t held;         // Events currently in the buffer
+        uint16_t capacity;     // Buffer size in events
+    };
+
+    // ------------------------------------------------------------------------
+    // Recording (any task, either core)
+    // ------------------------------------------------------------------------
+
+#ifdef ENABLE_MOTION_TRACE
+    /**
+     * Record an event stamped with an earlier micros() time (e.g. an ISR edge)
+     */
+    void recordAt(uint32_t timeUs, Event event, uint8_t arg, uint16_t id, int32_t value);
+
+    /**
+     * Record an event stamped now
+     */
+    inline void record(Event event, uint8_t arg = 0, uint16_t id = 0, int32_t value = 0) {
+        recordAt(micros(), event, arg, id, value);
+    }
+#else
+    inline void recordAt(uint32_t, Event, uint8_t, uint16_t, int32_t) {}
+    inline void record(Event, uint8_t = 0, uint16_t = 0, int32_t = 0) {}
+#endif
+
+    // ------------------------------------------------------------------------
+    // Reporting (any core)
+    // ------------------------------------------------------------------------
+
+    /**
+     * Get the buffer summary
+     * @param summary Receives the counters
+     */
+    void getSummary(Summary& summary);
+
+    /**
+     * Largest dump in bytes (header plus a full buffer)
+     */
+    size_t maxDumpSize();
+
+    /**
+     * Write the header and the buffered events (oldest first)
+     * Events being overwritten while the dump runs are skipped
+     * @param buffer Destination, maxDumpSize() bytes to be sure everything fits
+     * @param size Size of buffer
+     * @return bytes written (0 if the buffer cannot hold the header)
+     */
+    size_t dump(uint8_t* buffer, size_t size);
+
+    /**
+     * Forget all recorded events
+     */
+    void clear();
+
+    /**
+     * Short event name for reports ("command", "moveStart", ...)
+     */
+    const char* eventName(Event event);
+
+} // namespace MotionTrace
+
+#endif // MOTIONTRACE_H
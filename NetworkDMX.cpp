@@ -0,0 +1,471 @@
+// ============================================================================
+// File: NetworkDMX.cpp
+// Project: SkullStepperV4 - ESP32-S3 Modular Stepper Control System
+// Version: 4.2.0
+// Date: 2026-10-15
+// Author: Tim Rosener
+// Description: Art-Net (ArtDmx) and sACN (E1.31) input over the WiFi AP
+// License: MIT
+// ============================================================================
+
+#include "NetworkDMX.h"
+
+#if defined(ENABLE_NETWORK_DMX) && !defined(SKULLSTEPPER_SIMULATION)
+#ifndef ENABLE_WEB_INTERFACE
+#error "ENABLE_NETWORK_DMX needs ENABLE_WEB_INTERFACE (the WiFi access point)"
+#endif
+#include <WiFi.h>
+#include <lwip/sockets.h>
+#include "GlobalInterface.h"
+#include "DMXReceiver.h"
+#endif
+
+namespace NetworkDMX {
+
+// ----------------------------------------------------------------------------
+// Packet Layouts
+// ----------------------------------------------------------------------------
+
+// Art-Net 4: "Art-Net\0", OpCode (LE), ProtVer (BE), Sequence, Physical,
+// SubUni, Net, Length (BE), Data
+static const uint8_t ARTNET_ID[8] = { 'A', 'r', 't', '-', 'N', 'e', 't', 0 };
+static const uint16_t ARTNET_OP_DMX = 0x5000;
+static const uint16_t ARTNET_MIN_PROTOCOL = 14;
+static const size_t ARTDMX_DATA_OFFSET = 18;
+
+// E1.31: root layer (38 bytes incl. CID), framing layer (77), DMP layer (11 + slots)
+static const uint8_t ACN_ID[12] = { 'A', 'S', 'C', '-', 'E', '1', '.', '1', '7', 0, 0, 0 };
+static const uint32_t E131_ROOT_DATA = 0x00000004;
+static const uint32_t E131_ROOT_EXTENDED = 0x00000008;   // Sync and universe discovery
+static const uint32_t E131_FRAMING_DATA = 0x00000002;
+static const size_t E131_CID_OFFSET = 22;
+static const size_t E131_DATA_OFFSET = 126;               // After the start code
+static const uint8_t E131_OPT_PREVIEW = 0x80;
+static const uint8_t E131_OPT_TERMINATED = 0x40;
+static const uint8_t E131_MAX_PRIORITY = 200;
+
+static inline uint16_t be16(const uint8_t* p) {
+    return ((uint16_t)p[0] << 8) | p[1];
+}
+
+static inline uint32_t be32(const uint8_t* p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+// ----------------------------------------------------------------------------
+// Parsers
+// ----------------------------------------------------------------------------
+
+ParseResult parseArtDmx(const uint8_t* buffer, size_t length, Packet& out) {
+    if (length < 12 || memcmp(buffer, ARTNET_ID, sizeof(ARTNET_ID)) != 0) {
+        return ParseResult::MALFORMED;
+    }
+    uint16_t opcode = buffer[8] | ((uint16_t)buffer[9] << 8);
+    if (opcode != ARTNET_OP_DMX) {
+        return ParseResult::OTHER;    // ArtPoll, ArtSync, ...
+    }
+    if (length < ARTDMX_DATA_OFFSET || be16(buffer + 10) < ARTNET_MIN_PROTOCOL) {
+        return ParseResult::MALFORMED;
+    }
+    uint16_t slots = be16(buffer + 16);
+    if (slots < 2 || slots > DMX_UNIVERSE_SIZE || length < ARTDMX_DATA_OFFSET + slots) {
+        return ParseResult::MALFORMED;
+    }
+
+    out.protocol = Protocol::ARTNET;
+    out.universe = ((uint16_t)(buffer[15] & 0x7F) << 8) | buffer[14];
+    out.sequence = buffer[12];
+    out.priority = ARTNET_PRIORITY;
+    out.terminated = false;
+    out.slots = slots;
+    out.data = buffer + ARTDMX_DATA_OFFSET;
+    out.cid = nullptr;
+    return ParseResult::UNIVERSE_DATA;
+}
+
+ParseResult parseE131(const uint8_t* buffer, size_t length, Packet& out) {
+    // Root layer
+    if (length < E131_CID_OFFSET + 16 || be16(buffer) != 0x0010 || be16(buffer + 2) != 0x0000 ||
+        memcmp(buffer + 4, ACN_ID, sizeof(ACN_ID)) != 0) {
+        return ParseResult::MALFORMED;
+    }
+    uint32_t rootVector = be32(buffer + 18);
+    if (rootVector == E131_ROOT_EXTENDED) {
+        return ParseResult::OTHER;
+    }
+    if (rootVector != E131_ROOT_DATA || length < E131_DATA_OFFSET) {
+        return ParseResult::MALFORMED;
+    }
+
+    // Framing layer
+    if (be32(buffer + 40) != E131_FRAMING_DATA) {
+        return ParseResult::MALFORMED;
+    }
+    uint8_t priority = buffer[108];
+    uint8_t options = buffer[112];
+    uint16_t universe = be16(buffer + 113);
+    if (priority > E131_MAX_PRIORITY || universe == 0 || universe > DMX_NET_MAX_UNIVERSE) {
+        return ParseResult::MALFORMED;
+    }
+
+    // DMP layer: set property, address/data type 0xa1, first address 0, increment 1
+    if (buffer[117] != 0x02 || buffer[118] != 0xa1 || be16(buffer + 119) != 0 || be16(buffer + 121) != 1) {
+        return ParseResult::MALFORMED;
+    }
+    uint16_t count = be16(buffer + 123);   // Start code + slots
+    if (count < 1 || count > DMX_UNIVERSE_SIZE + 1 || length < E131_DATA_OFFSET - 1 + count) {
+        return ParseResult::MALFORMED;
+    }
+    if ((options & E131_OPT_PREVIEW) || buffer[125] != 0 || count == 1) {
+        return ParseResult::OTHER;    // Visualiser data, alternate start code, no slots
+    }
+
+    out.protocol = Protocol::SACN;
+    out.universe = universe;
+    out.sequence = buffer[111];
+    out.priority = priority;
+    out.terminated = (options & E131_OPT_TERMINATED) != 0;
+    out.slots = count - 1;
+    out.data = buffer + E131_DATA_OFFSET;
+    out.cid = buffer + E131_CID_OFFSET;
+    return ParseResult::UNIVERSE_DATA;
+}
+
+const char* protocolName(Protocol protocol) {
+    switch (protocol) {
+        case Protocol::ARTNET: return "Art-Net";
+        case Protocol::SACN:   return "sACN";
+        default:               return "none";
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Source Arbitration
+// ----------------------------------------------------------------------------
+
+static void releaseSource(SourceTable& table, int8_t index) {
+    table.sources[index].used = false;
+    if (table.active == index) table.active = -1;
+}
+
+static int8_t findSource(SourceTable& table, const Packet& packet, uint32_t address, uint32_t now) {
+    int8_t freeIndex = -1;
+    for (int8_t i = 0; i < (int8_t)MAX_SOURCES; i++) {
+        Source& src = table.sources[i];
+        if (!src.used) {
+            if (freeIndex < 0) freeIndex = i;
+            continue;
+        }
+        if (src.protocol != packet.protocol) continue;
+        if (packet.cid ? memcmp(src.cid, packet.cid, sizeof(src.cid)) == 0 : src.address == address) {
+            return i;
+        }
+    }
+
+    // Reuse a source that has gone quiet before giving up
+    if (freeIndex < 0) {
+        for (int8_t i = 0; i < (int8_t)MAX_SOURCES; i++) {
+            if (now - table.sources[i].lastMs > SOURCE_TIMEOUT_MS) {
+                releaseSource(table, i);
+                freeIndex = i;
+                break;
+            }
+        }
+    }
+    if (freeIndex < 0) return -1;
+
+    Source& src = table.sources[freeIndex];
+    memset(&src, 0, sizeof(src));
+    src.used = true;
+    src.protocol = packet.protocol;
+    src.address = address;
+    if (packet.cid) memcpy(src.cid, packet.cid, sizeof(src.cid));
+    return freeIndex;
+}
+
+/**
+ * Decide whether a source drives the output: the active one keeps it until a
+ * higher priority appears or it times out
+ */
+static bool claimOutput(SourceTable& table, int8_t index, uint32_t now, Stats& stats) {
+    if (table.active == index) return true;
+    if (table.active >= 0) {
+        const Source& current = table.sources[table.active];
+        bool expired = now - current.lastMs > SOURCE_TIMEOUT_MS;
+        if (!expired && table.sources[index].priority <= current.priority) return false;
+    }
+    table.active = index;
+    stats.sourceSwitches++;
+    return true;
+}
+
+void clearSources(SourceTable& table) {
+    memset(table.sources, 0, sizeof(table.sources));
+    table.active = -1;
+}
+
+Arbitration arbitrate(SourceTable& table, const Packet& packet, uint32_t address, uint32_t nowMs,
+                      Stats& stats) {
+    int8_t index = findSource(table, packet, address, nowMs);
+    if (index < 0) {
+        stats.sourcesDropped++;
+        return Arbitration::TABLE_FULL;
+    }
+    Source& src = table.sources[index];
+
+    // Stream termination: the source leaves now instead of timing out
+    if (packet.terminated) {
+        releaseSource(table, index);
+        return Arbitration::TERMINATED;
+    }
+
+    src.packets++;
+    bool sequenced = packet.protocol == Protocol::SACN || packet.sequence != 0;
+    if (sequenced && src.hasSequence && !sequenceAccepted(src.lastSequence, packet.sequence)) {
+        src.outOfOrder++;
+        stats.outOfOrder++;
+        return Arbitration::OUT_OF_ORDER;
+    }
+    src.hasSequence = sequenced;
+    src.lastSequence = packet.sequence;
+    src.priority = packet.priority;
+    src.lastMs = nowMs;
+
+    return claimOutput(table, index, nowMs, stats) ? Arbitration::FORWARD : Arbitration::STANDBY;
+}
+
+void expireSources(SourceTable& table, uint32_t nowMs) {
+    for (int8_t i = 0; i < (int8_t)MAX_SOURCES; i++) {
+        if (table.sources[i].used && nowMs - table.sources[i].lastMs > SOURCE_TIMEOUT_MS) {
+            releaseSource(table, i);
+        }
+    }
+}
+
+#if defined(ENABLE_NETWORK_DMX) && !defined(SKULLSTEPPER_SIMULATION)
+
+// ----------------------------------------------------------------------------
+// Receiver State (owned by the receive task)
+// ----------------------------------------------------------------------------
+
+static const uint32_t TASK_STACK_SIZE = 4096;
+static const UBaseType_t TASK_PRIORITY = 2;       // Above the web server task
+static const uint32_t RETRY_MS = 1000;            // Socket open retry
+
+static TaskHandle_t taskHandle = NULL;
+static int artnetSocket = -1;
+static int sacnSocket = -1;
+static uint16_t joinedUniverse = 0;     // sACN multicast group joined (0 = none)
+
+static uint8_t rxBuffer[MAX_PACKET_SIZE];
+static SourceTable table = { {}, -1 };
+static Stats stats;
+static volatile bool resetRequested = false;
+
+// ----------------------------------------------------------------------------
+// Sockets
+// ----------------------------------------------------------------------------
+
+static int openSocket(uint16_t port) {
+    int sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (sock < 0) return -1;
+
+    int enable = 1;
+    setsockopt(sock, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable));
+
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    if (bind(sock, (struct sockaddr*)&addr, sizeof(addr)) < 0) {
+        close(sock);
+        return -1;
+    }
+    return sock;
+}
+
+/**
+ * Join the sACN multicast group of a universe (239.255.hi.lo), leaving the old one
+ */
+static void joinUniverse(uint16_t universe) {
+    struct ip_mreq group;
+    group.imr_interface.s_addr = (uint32_t)WiFi.softAPIP();
+
+    if (joinedUniverse != 0) {
+        group.imr_multiaddr.s_addr = htonl(0xEFFF0000UL | joinedUniverse);
+        setsockopt(sacnSocket, IPPROTO_IP, IP_DROP_MEMBERSHIP, &group, sizeof(group));
+        joinedUniverse = 0;
+    }
+    if (universe == 0 || universe > DMX_NET_MAX_UNIVERSE) return;   // Art-Net only
+
+    group.imr_multiaddr.s_addr = htonl(0xEFFF0000UL | universe);
+    if (setsockopt(sacnSocket, IPPROTO_IP, IP_ADD_MEMBERSHIP, &group, sizeof(group)) == 0) {
+        joinedUniverse = universe;
+    } else {
+        Serial.printf("[NetDMX] Failed to join sACN group for universe %d (unicast only)\n", universe);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Receive Task
+// ----------------------------------------------------------------------------
+
+static void handlePacket(const uint8_t* buffer, size_t length, bool artnet, uint32_t address,
+                         uint16_t universe) {
+    stats.packets++;
+
+    Packet packet;
+    ParseResult result = artnet ? parseArtDmx(buffer, length, packet) : parseE131(buffer, length, packet);
+    if (result == ParseResult::MALFORMED) {
+        stats.malformed++;
+        return;
+    }
+    if (result != ParseResult::UNIVERSE_DATA) return;
+    if (packet.universe != universe) {
+        stats.otherUniverse++;
+        return;
+    }
+
+    if (arbitrate(table, packet, address, millis(), stats) != Arbitration::FORWARD) return;
+    if (DMXReceiver::submitNetworkFrame(packet.data, packet.slots, micros())) {
+        table.sources[table.active].frames++;
+        stats.frames++;
+    }
+}
+
+static void receiveAll(int sock, bool artnet, uint16_t universe) {
+    for (;;) {
+        struct sockaddr_in from;
+        socklen_t fromLength = sizeof(from);
+        int length = recvfrom(sock, rxBuffer, sizeof(rxBuffer), MSG_DONTWAIT,
+                              (struct sockaddr*)&from, &fromLength);
+        if (length <= 0) return;
+        handlePacket(rxBuffer, (size_t)length, artnet, from.sin_addr.s_addr, universe);
+    }
+}
+
+/**
+ * Core 1 receive task: open both ports, follow the configured universe,
+ * drain datagrams as they arrive and expire silent sources every POLL_MS
+ */
+static void receiveTask(void* parameter) {
+    for (;;) {
+        if (artnetSocket < 0) artnetSocket = openSocket(ARTNET_PORT);
+        if (sacnSocket < 0) sacnSocket = openSocket(SACN_PORT);
+        if (artnetSocket >= 0 && sacnSocket >= 0) break;
+        vTaskDelay(pdMS_TO_TICKS(RETRY_MS));
+    }
+    Serial.printf("[NetDMX] Listening on UDP %d (Art-Net) and %d (sACN)\n", ARTNET_PORT, SACN_PORT);
+
+    uint16_t universe = DMX_NET_UNIVERSE;
+    uint16_t listening = 0xFFFF;    // Universe the source table belongs to
+    for (;;) {
+        if (resetRequested) {
+            memset(&stats, 0, sizeof(stats));
+            clearSources(table);
+            resetRequested = false;
+        }
+
+        // Universe changes apply live
+        SAFE_READ_CONFIG(dmxUniverse, universe);
+        if (universe != listening) {
+            joinUniverse(universe);
+            listening = universe;
+            clearSources(table);
+        }
+
+        fd_set readSet;
+        FD_ZERO(&readSet);
+        FD_SET(artnetSocket, &readSet);
+        FD_SET(sacnSocket, &readSet);
+        struct timeval timeout;
+        timeout.tv_sec = 0;
+        timeout.tv_usec = POLL_MS * 1000;
+        int ready = select(max(artnetSocket, sacnSocket) + 1, &readSet, NULL, NULL, &timeout);
+
+        if (ready > 0) {
+            if (FD_ISSET(artnetSocket, &readSet)) receiveAll(artnetSocket, true, universe);
+            if (FD_ISSET(sacnSocket, &readSet)) receiveAll(sacnSocket, false, universe);
+        }
+        expireSources(table, millis());
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Public Interface
+// ----------------------------------------------------------------------------
+
+bool initialize() {
+    if (taskHandle != NULL) return true;
+
+    BaseType_t result = xTaskCreatePinnedToCore(
+        receiveTask,
+        "NetworkDMX",
+        TASK_STACK_SIZE,
+        NULL,
+        TASK_PRIORITY,
+        &taskHandle,
+        1  // Core 1 - with the WiFi stack
+    );
+    if (result != pdPASS) {
+        Serial.println("[NetDMX] Failed to create receive task");
+        taskHandle = NULL;
+        return false;
+    }
+    return true;
+}
+
+bool isRunning() {
+    return artnetSocket >= 0 && sacnSocket >= 0;
+}
+
+void getStats(Stats& out) {
+    out = stats;
+}
+
+bool getSourceStats(uint8_t index, SourceStats& out) {
+    memset(&out, 0, sizeof(out));
+    if (index >= MAX_SOURCES || !table.sources[index].used) return false;
+
+    const Source& src = table.sources[index];
+    out.protocol = src.protocol;
+    out.address = src.address;
+    out.priority = src.priority;
+    out.active = table.active == (int8_t)index;
+    out.packets = src.packets;
+    out.frames = src.frames;
+    out.outOfOrder = src.outOfOrder;
+    out.ageMs = millis() - src.lastMs;
+    return true;
+}
+
+void resetStats() {
+    resetRequested = true;
+}
+
+#else // ENABLE_NETWORK_DMX not defined or host build
+
+bool initialize() {
+    return false;
+}
+
+bool isRunning() {
+    return false;
+}
+
+void getStats(Stats& out) {
+    memset(&out, 0, sizeof(out));
+}
+
+bool getSourceStats(uint8_t index, SourceStats& out) {
+    memset(&out, 0, sizeof(out));
+    return false;
+}
+
+void resetStats() {
+}
+
+#endif // ENABLE_NETWORK_DMX && !SKULLSTEPPER_SIMULATION
+
+} // namespace NetworkDMX
@@ -0,0 +1,228 @@
+// ============================================================================
+// File: NetworkDMX.h
+// Project: SkullStepperV4 - ESP32-S3 Modular Stepper Control System
+// Version: 4.2.0
+// Date: 2026-10-15
+// Author: Tim Rosener
+// Description: Art-Net (ArtDmx) and sACN (E1.31) input over the WiFi AP
+// License: MIT
+//
+// A Core 1 task receives UDP on the Art-Net (6454) and sACN (5568) ports of
+// the access point, parses each datagram in place in a static buffer (no
+// allocation per packet) and hands the universe selected by dmxUniverse to
+// DMXReceiver, which runs it through the same snapshot, validation and
+// personality pipeline as the RS-485 input (dmxInput = network).
+//
+// Each sender is tracked as a source (protocol, address and sACN CID):
+// - Packets whose sequence number is behind the source's last one (within
+//   SEQUENCE_WINDOW) arrived out of order and are dropped, so a late packet
+//   never moves the head back to an older value
+// - One source drives the output: the highest sACN priority (Art-Net counts
+//   as priority 100); another source takes over only when the active one
+//   times out (SOURCE_TIMEOUT_MS) or terminates its sACN stream
+// - Per-source packet, frame and out-of-order counters for diagnostics
+//
+// parseArtDmx(), parseE131() and sequenceAccepted() are pure functions of
+// the packet bytes; arbitrate() and expireSources() work on a SourceTable
+// passed in, so both halves run off-target (extras/host). Disable with
+// ENABLE_NETWORK_DMX in ProjectConfig.h.
+// ============================================================================
+
+#ifndef NETWORKDMX_H
+#define NETWORKDMX_H
+
+#include <Arduino.h>
+#include "ProjectConfig.h"
+#include "HardwareConfig.h"
+
+// ============================================================================
+// NetworkDMX Namespace - Art-Net / sACN Universe Input
+// ============================================================================
+
+namespace NetworkDMX {
+
+    // ------------------------------------------------------------------------
+    // Constants
+    // ------------------------------------------------------------------------
+
+    const uint16_t ARTNET_PORT = 6454;
+    const uint16_t SACN_PORT = 5568;
+    const uint16_t MAX_PACKET_SIZE = 638;      // Full E1.31 data packet (ArtDmx is 530)
+    const uint8_t MAX_SOURCES = 4;             // Senders tracked at once
+    const uint32_t SOURCE_TIMEOUT_MS = 2500;   // E1.31 network data loss time
+    const int8_t SEQUENCE_WINDOW = 20;         // Sequence steps back that count as out of order
+    const uint8_t ARTNET_PRIORITY = 100;       // Art-Net has no priority - sACN default
+    const uint32_t POLL_MS = 100;              // Task wake without packets (source expiry, universe change)
+
+    // ------------------------------------------------------------------------
+    // Types
+    // ------------------------------------------------------------------------
+
+    enum class Protocol : uint8_t {
+        NONE,
+        ARTNET,
+        SACN
+    };
+
+    enum class ParseResult : uint8_t {
+        UNIVERSE_DATA,   // DMX data for a universe (fields of Packet valid)
+        OTHER,           // Valid packet of another kind (ArtPoll, sACN sync, preview data...)
+        MALFORMED        // Not a valid packet of the protocol
+    };
+
+    /**
+     * One parsed universe packet (data points into the receive buffer)
+     */
+    struct Packet {
+        Protocol protocol;
+        uint16_t universe;      // Art-Net 15-bit port address, sACN universe
+        uint8_t sequence;       // 0 = Art-Net sequencing disabled
+        uint8_t priority;       // sACN 0-200, ARTNET_PRIORITY for Art-Net
+        bool terminated;        // sACN stream terminated - source is leaving
+        uint16_t slots;         // Channels in data (1-512)
+        const uint8_t* data;    // Channel 1 onwards (start code stripped)
+        const uint8_t* cid;     // sACN component identifier (16 bytes), nullptr for Art-Net
+    };
+
+    /**
+     * Receiver totals (since the last resetStats)
+     */
+    struct Stats {
+        uint32_t packets;          // Datagrams received on both ports
+        uint32_t malformed;        // Not parseable as Art-Net / E1.31
+        uint32_t otherUniverse;    // Universe data for another universe
+        uint32_t outOfOrder;       // Dropped as older than the source's last packet
+        uint32_t frames;           // Universes handed to DMXReceiver
+        uint32_t sourceSwitches;   // Changes of the active source
+        uint32_t sourcesDropped;   // New senders ignored with the source table full
+    };
+
+    /**
+     * One sender
+     */
+    struct SourceStats {
+        Protocol protocol;
+        uint32_t address;          // IPv4, network byte order
+        uint8_t priority;
+        bool active;               // Drives the output
+        uint32_t packets;          // Universe packets for our universe
+        uint32_t frames;           // Forwarded while active
+        uint32_t outOfOrder;
+        uint32_t ageMs;            // Since the last packet
+    };
+
+    /**
+     * Source table entry
+     */
+    struct Source {
+        bool used;
+        Protocol protocol;
+        uint32_t address;          // IPv4, network byte order
+        uint8_t cid[16];           // sACN component identifier
+        uint8_t priority;
+        bool hasSequence;
+        uint8_t lastSequence;
+        uint32_t lastMs;
+        uint32_t packets;
+        uint32_t frames;
+        uint32_t outOfOrder;
+    };
+
+    /**
+     * Senders of the selected universe and the one driving the output
+     */
+    struct SourceTable {
+        Source sources[MAX_SOURCES];
+        int8_t active;             // Index into sources, -1 = none
+    };
+
+    enum class Arbitration : uint8_t {
+        FORWARD,        // From the active source - hand the frame on
+        STANDBY,        // Valid, but another source drives the output
+        OUT_OF_ORDER,   // Behind the source's last sequence number - dropped
+        TERMINATED,     // sACN stream terminated - source released
+        TABLE_FULL      // New sender with no free entry - ignored
+    };
+
+    // ------------------------------------------------------------------------
+    // Interface
+    // ------------------------------------------------------------------------
+
+    /**
+     * Start the receive task (after the WiFi access point is up)
+     * @return true if the task was started
+     */
+    bool initialize();
+
+    /**
+     * Check that both UDP ports are open
+     */
+    bool isRunning();
+
+    /**
+     * Copy the receiver totals (read without locking, diagnostics only)
+     */
+    void getStats(Stats& stats);
+
+    /**
+     * Copy one source's statistics
+     * @param index 0 to MAX_SOURCES-1
+     * @return false for an unused entry
+     */
+    bool getSourceStats(uint8_t index, SourceStats& stats);
+
+    /**
+     * Clear the totals and forget all sources (applied by the receive task)
+     */
+    void resetStats();
+
+    /**
+     * Parse an Art-Net datagram
+     * @param buffer Datagram bytes
+     * @param length Datagram length
+     * @param out Receives the universe fields for UNIVERSE_DATA
+     */
+    ParseResult parseArtDmx(const uint8_t* buffer, size_t length, Packet& out);
+
+    /**
+     * Parse an E1.31 datagram (data packets, ANSI E1.31-2016)
+     */
+    ParseResult parseE131(const uint8_t* buffer, size_t length, Packet& out);
+
+    /**
+     * Check a sequence number against a source's last one
+     * @return false if next is at most SEQUENCE_WINDOW steps behind or equal to last
+     */
+    inline bool sequenceAccepted(uint8_t last, uint8_t next) {
+        int8_t diff = (int8_t)(next - last);
+        return diff > 0 || diff <= -SEQUENCE_WINDOW;
+    }
+
+    /**
+     * Forget all sources
+     */
+    void clearSources(SourceTable& table);
+
+    /**
+     * Track a universe packet's source and decide whether it drives the output
+     * The active source keeps the output until a higher priority appears, it
+     * times out or it terminates its stream
+     * @param packet Parsed UNIVERSE_DATA packet of the selected universe
+     * @param address Sender IPv4 (network byte order)
+     * @param nowMs Receive time (ms)
+     * @param stats outOfOrder, sourceSwitches and sourcesDropped are counted here
+     * @return FORWARD if the frame should be used (table.active is its source)
+     */
+    Arbitration arbitrate(SourceTable& table, const Packet& packet, uint32_t address, uint32_t nowMs,
+                          Stats& stats);
+
+    /**
+     * Release sources silent for more than SOURCE_TIMEOUT_MS
+     */
+    void expireSources(SourceTable& table, uint32_t nowMs);
+
+    const char* protocolName(Protocol protocol);
+
+} // namespace NetworkDMX
+
+#endif // NETWORKDMX_H
@@ -9,6 +9,17 @@
 
 // Optional modules - enable/disable features
 #define ENABLE_WEB_INTERFACE  // PsychicHttp implementation - compatible with ESP32 core 3.x
+#define ENABLE_LOOP_PROFILER  // Cycle-count histograms for the Core 0 control loop (PROFILE command)
+#define ENABLE_MOTION_TRACE   // Binary motion event recorder (TRACE command, /api/trace)
+#define ENABLE_NETWORK_DMX    // Art-Net / sACN input over the WiFi AP (needs ENABLE_WEB_INTERFACE)
+
+// Step pulse backend: ODStepper (default) or precomputed RMT pulse blocks
+// (deterministic 25% duty, up to 40kHz - see StepperRmt.h)
+// #define STEPPER_BACKEND_RMT
+
+// Core 0 deferred log level: 0 none, 1 error, 2 warn, 3 info, 4 debug
+// Records above this level compile out of the real-time tasks (see CoreLog.h)
+#define CORE_LOG_LEVEL 4
 
 // Future modules (not yet implemented)
 // #define ENABLE_SAFETY_MONITOR
@@ -12,8 +12,15 @@
 #include "SerialInterface.h"
 #include "SystemConfig.h"
 #include "StepperController.h"
+#include "CueEngine.h"
 #include "DMXReceiver.h"
+#include "DMXPersonality.h"
+#include "NetworkDMX.h"
+#include "FixedPoint.h"
 #include "InputValidation.h"
+#include "LoopProfiler.h"
+#include "CoreLog.h"
+#include "MotionTrace.h"
 #include <ArduinoJson.h>
 #include <esp_random.h>
 
@@ -34,8 +41,8 @@ namespace SerialInterface {
   static uint32_t g_lastStatusTime = 0;
   static uint16_t g_commandCounter = 0;
   
-  // Command buffer for processing
-  static char g_commandBuffer[256];
+  // Command buffer for processing (sized for a JSON path of ~20 waypoints)
+  static char g_commandBuffer[768];
   static size_t g_bufferIndex = 0;
   
   // Response buffer for formatting
@@ -114,6 +121,79 @@ namespace SerialInterface {
     return (*endPtr == '\0' || *endPtr == ' ' || *endPtr == '\t');
   }
   
+  // Mode band of a DMX mode channel value
+  static const char* dmxModeLabel(uint8_t modeValue) {
+    switch (DMXReceiver::detectMode(modeValue)) {
+      case DMXReceiver::DMXMode::STOP:    return "STOP";
+      case DMXReceiver::DMXMode::CONTROL: return "CONTROL";
+      case DMXReceiver::DMXMode::CUE:     return "CUE";
+      case DMXReceiver::DMXMode::HOME:    return "HOME";
+    }
+    return "UNKNOWN";
+  }
+  
+  // Print a personality's channel layout (nothing for an empty slot)
+  static void printPersonalityLayout(uint8_t slot) {
+    DMXPersonality::Personality personality;
+    if (!DMXPersonality::getPersonality(slot, personality)) {
+      return;
+    }
+    Serial.printf("Personality %d: %s%s%s\n", slot, personality.name,
+                  (slot < DMXPersonality::BUILTIN_COUNT) ? " (built in)" : "",
+                  (slot == DMXReceiver::getPersonalitySlot()) ? " [ACTIVE]" : "");
+    for (uint8_t i = 0; i < personality.count; i++) {
+      const DMXPersonality::ChannelDef& def = personality.channels[i];
+      Serial.printf("  Ch+%d", def.coarse);
+      if (def.fine != DMXPersonality::NO_FINE) {
+        Serial.printf("/+%d", def.fine);
+      }
+      if (def.role == DMXPersonality::Role::MODE) {
+        Serial.println(": mode (1-100=STOP, 101-200=CONTROL, 201-254=CUE, 255=HOME)");
+      } else {
+        Serial.printf(": %s, %s %d-%d%%\n", DMXPersonality::roleName(def.role),
+                      DMXPersonality::curveName(def.curve), def.rangeLow, def.rangeHigh);
+      }
+    }
+  }
+  
+  // Take a trailing "AXIS <n>" off a motion command's parameters (axis 0 without it)
+  // Sends the error and returns false for an axis that does not exist
+  static bool takeAxisParam(String& params, uint8_t& axis) {
+    axis = 0;
+    int index = params.startsWith("AXIS ") ? 0 : params.indexOf(" AXIS ");
+    if (index == -1) {
+      return true;
+    }
+    int32_t value;
+    String axisStr = params.substring(params.indexOf("AXIS ", index) + 5);
+    axisStr.trim();
+    if (!InputValidation::parseAndValidateInt(axisStr.c_str(), value, 0,
+                                              StepperController::getAxisCount() - 1, "AXIS")) {
+      Serial.printf("ERROR: AXIS must be 0-%d\n", StepperController::getAxisCount() - 1);
+      return false;
+    }
+    axis = (uint8_t)value;
+    params = params.substring(0, index);
+    params.trim();
+    return true;
+  }
+  
+  // Read the optional "axis" field of a JSON motion command (axis 0 without it)
+  // Sends the error and returns false for an axis that does not exist
+  static bool jsonAxisParam(JsonVariantConst doc, uint8_t& axis) {
+    axis = 0;
+    if (!doc.containsKey("axis")) {
+      return true;
+    }
+    if (!doc["axis"].is<int>() || doc["axis"].as<int>() < 0 ||
+        doc["axis"].as<int>() >= StepperController::getAxisCount()) {
+      Serial.println("{\"status\":\"error\",\"message\":\"Axis out of range\"}");
+      return false;
+    }
+    axis = (uint8_t)doc["axis"].as<int>();
+    return true;
+  }
+  
   // Start range test between two positions
   bool startRangeTest(int32_t pos1, int32_t pos2) {
     g_rangeTestActive = true;
@@ -301,6 +381,15 @@ namespace SerialInterface {
         return true;
       }
     }
+    else if (param == "profileshape" || param == "profile") {
+      MotionProfile profile = config->defaultProfile;
+      profile.shape = ProfileShape::TRAPEZOIDAL;
+      if (SystemConfigMgr::setMotionProfile(profile) && SystemConfigMgr::commitChanges()) {
+        sendInfo("Profile shape reset to default (TRAPEZOIDAL)");
+        sendOK();
+        return true;
+      }
+    }
     else if (param == "homingspeed") {
       config->homingSpeed = 940.0f;  // Default homing speed
       if (SystemConfigMgr::commitChanges()) {
@@ -309,6 +398,14 @@ namespace SerialInterface {
         return true;
       }
     }
+    else if (param == "homingfastspeed" || param == "homingfast") {
+      config->homingFastSpeed = 0.0f;  // Default: single-speed homing
+      if (SystemConfigMgr::commitChanges()) {
+        sendInfo("Homing fast speed reset to default (OFF)");
+        sendOK();
+        return true;
+      }
+    }
     else if (param == "limitsafetymargin" || param == "limitmargin") {
       config->limitSafetyMargin = 400.0f;  // Default safety margin
       if (SystemConfigMgr::commitChanges()) {
@@ -341,6 +438,22 @@ namespace SerialInterface {
         return true;
       }
     }
+    else if (param == "verifyhoming") {
+      config->verifyHoming = false;  // Default: off
+      if (SystemConfigMgr::commitChanges()) {
+        sendInfo("Verify homing reset to default (OFF)");
+        sendOK();
+        return true;
+      }
+    }
+    else if (param == "limitfiltersamples" || param == "limitfilter") {
+      config->limitFilterSamples = LIMIT_FILTER_SAMPLES;
+      if (SystemConfigMgr::commitChanges()) {
+        sendInfo("Limit filter samples reset to default");
+        sendOK();
+        return true;
+      }
+    }
     else if (param == "dmxstartchannel" || param == "dmxchannel") {
       if (SystemConfigMgr::setDMXConfig(DMX_START_CHANNEL, config->dmxScale, config->dmxOffset) && SystemConfigMgr::commitChanges()) {
         sendInfo("DMX start channel reset to default");
@@ -362,6 +475,44 @@ namespace SerialInterface {
         return true;
       }
     }
+    else if (param == "dmxinterpolation" || param == "dmxinterp") {
+      config->dmxInterpolation = true;  // Default: on
+      if (SystemConfigMgr::commitChanges()) {
+        sendInfo("DMX interpolation reset to default (ON)");
+        sendOK();
+        return true;
+      }
+    }
+    else if (param == "dmxinterpdelayms" || param == "dmxinterpdelay") {
+      config->dmxInterpDelayMs = DMX_INTERP_DELAY_MS;
+      if (SystemConfigMgr::commitChanges()) {
+        sendInfo("DMX interpolation delay reset to default");
+        sendOK();
+        return true;
+      }
+    }
+    else if (param == "dmxpersonality") {
+      if (DMXReceiver::selectPersonality(DMX_PERSONALITY) && SystemConfigMgr::commitChanges()) {
+        sendInfo("DMX personality reset to default (0)");
+        sendOK();
+        return true;
+      }
+    }
+    else if (param == "dmxinput") {
+      if (DMXReceiver::setInput((DMXReceiver::DMXInput)DMX_INPUT) && SystemConfigMgr::commitChanges()) {
+        sendInfo("DMX input reset to default (RS-485)");
+        sendOK();
+        return true;
+      }
+    }
+    else if (param == "dmxuniverse") {
+      config->dmxUniverse = DMX_NET_UNIVERSE;
+      if (SystemConfigMgr::commitChanges()) {
+        sendInfo("DMX network universe reset to default");
+        sendOK();
+        return true;
+      }
+    }
     else if (param == "verbosity") {
       g_verbosityLevel = 2;
       sendInfo("Verbosity reset to default");
@@ -369,6 +520,11 @@ namespace SerialInterface {
       return true;
     }
     else if (param == "dmx") {
+      config->dmxInterpolation = true;
+      config->dmxInterpDelayMs = DMX_INTERP_DELAY_MS;
+      config->dmxUniverse = DMX_NET_UNIVERSE;
+      DMXReceiver::selectPersonality(DMX_PERSONALITY);
+      DMXReceiver::setInput((DMXReceiver::DMXInput)DMX_INPUT);
       if (SystemConfigMgr::setDMXConfig(DMX_START_CHANNEL, 1.0f, 0) && SystemConfigMgr::commitChanges()) {
         sendInfo("All DMX settings reset to defaults");
         sendOK();
@@ -381,7 +537,9 @@ namespace SerialInterface {
       profile.acceleration = DEFAULT_ACCELERATION;
       profile.deceleration = DEFAULT_ACCELERATION;
       profile.jerk = 1000.0f;
+      profile.shape = ProfileShape::TRAPEZOIDAL;
       config->homingSpeed = 940.0f;
+      config->homingFastSpeed = 0.0f;
       if (SystemConfigMgr::setMotionProfile(profile) && SystemConfigMgr::commitChanges()) {
         sendInfo("All motion settings reset to defaults");
         sendOK();
@@ -389,7 +547,7 @@ namespace SerialInterface {
       }
     }
     else {
-      sendError("Unknown parameter. Available: maxSpeed, acceleration, deceleration, jerk, homingSpeed, homePositionPercent, autoHomeOnBoot, autoHomeOnEstop, dmxStartChannel, dmxScale, dmxOffset, verbosity, dmx, motion");
+      sendError("Unknown parameter. Available: maxSpeed, acceleration, deceleration, jerk, profileShape, homingSpeed, homingFastSpeed, homePositionPercent, autoHomeOnBoot, autoHomeOnEstop, verifyHoming, limitFilterSamples, dmxStartChannel, dmxScale, dmxOffset, dmxInterpolation, dmxInterpDelayMs, dmxPersonality, dmxInput, dmxUniverse, verbosity, dmx, motion");
       return false;
     }
     
@@ -596,12 +754,25 @@ namespace SerialInterface {
       }
     }
     else if (mainCmd == "MOVE") {
+      uint8_t axis;
+      if (!takeAxisParam(params, axis)) {
+        return false;
+      }
       if (params == "") {
         sendError("MOVE requires position parameter");
         return false;
       }
+      // Optional ramp shape after the position: MOVE <pos> [SCURVE|TRAP] [AXIS <n>]
+      String positionStr = params;
+      String shapeStr = "";
+      int shapeIndex = params.indexOf(' ');
+      if (shapeIndex != -1) {
+        positionStr = params.substring(0, shapeIndex);
+        shapeStr = params.substring(shapeIndex + 1);
+        shapeStr.trim();
+      }
       int32_t position;
-      if (!InputValidation::parseAndValidateInt(params.c_str(), position,
+      if (!InputValidation::parseAndValidateInt(positionStr.c_str(), position,
                                                 ParamLimits::MIN_POSITION,
                                                 ParamLimits::MAX_POSITION,
                                                 "MOVE position")) {
@@ -609,18 +780,115 @@ namespace SerialInterface {
         return false;
       }
       MotionCommand cmd = createMotionCommand(CommandType::MOVE_ABSOLUTE, position);
+      cmd.axis = axis;
+      if (shapeStr.length() > 0 && !SystemConfigMgr::parseProfileShape(shapeStr.c_str(), cmd.profile.shape)) {
+        sendError("Profile shape must be SCURVE or TRAP");
+        return false;
+      }
       return sendMotionCommand(cmd);
     }
+    else if (mainCmd == "PATH") {
+      // Waypoint path: PATH ADD <pos> [speed], PATH RUN, PATH CLEAR, PATH
+      if (params == "") {
+        Serial.printf("Path: %d waypoint(s) queued, %s\n", StepperController::getPathQueueDepth(),
+                      StepperController::isPathRunning() ? "RUNNING" : "idle");
+        return true;
+      }
+      if (params.startsWith("ADD ")) {
+        String addParams = params.substring(4);
+        addParams.trim();
+        String positionStr = addParams;
+        String speedStr = "";
+        int speedIndex = addParams.indexOf(' ');
+        if (speedIndex != -1) {
+          positionStr = addParams.substring(0, speedIndex);
+          speedStr = addParams.substring(speedIndex + 1);
+          speedStr.trim();
+        }
+        int32_t position;
+        if (!InputValidation::parseAndValidateInt(positionStr.c_str(), position,
+                                                  ParamLimits::MIN_POSITION,
+                                                  ParamLimits::MAX_POSITION,
+                                                  "PATH position")) {
+          sendError("Invalid position value or out of range");
+          return false;
+        }
+        float speed = 0;
+        if (speedStr.length() > 0 &&
+            !InputValidation::parseAndValidateFloat(speedStr.c_str(), speed,
+                                                    ParamLimits::MIN_SPEED,
+                                                    ParamLimits::MAX_SPEED,
+                                                    "PATH speed")) {
+          sendError("Invalid speed value or out of range");
+          return false;
+        }
+        MotionCommand cmd = createMotionCommand(CommandType::PATH_APPEND, position, speed);
+        return sendMotionCommand(cmd);
+      }
+      if (params == "RUN" || params == "START") {
+        MotionCommand cmd = createMotionCommand(CommandType::PATH_START);
+        return sendMotionCommand(cmd);
+      }
+      if (params == "CLEAR") {
+        MotionCommand cmd = createMotionCommand(CommandType::PATH_CLEAR);
+        return sendMotionCommand(cmd);
+      }
+      sendError("Usage: PATH [ADD <position> [speed] | RUN | CLEAR]");
+      return false;
+    }
+    else if (mainCmd == "CUE") {
+      // Keyframe cues: CUE PLAY <id>, CUE DELETE <id>, CUE / CUE LIST
+      // Cues are uploaded with the JSON "cue" command
+      if (params == "" || params == "LIST") {
+        StaticJsonDocument<512> doc;
+        CueEngine::listTracks(doc);
+        int8_t active = StepperController::getActiveCue();
+        Serial.printf("Cues (playing: %s):\n", active >= 0 ? String(active).c_str() : "none");
+        for (JsonObject cue : doc["cues"].as<JsonArray>()) {
+          Serial.printf("  %d: %d keyframes, %.3fs%s\n", cue["id"].as<int>(), cue["keyframes"].as<int>(),
+                        cue["duration"].as<float>(), cue["loop"].as<bool>() ? ", loop" : "");
+        }
+        return true;
+      }
+      int spaceIdx = params.indexOf(' ');
+      String action = (spaceIdx == -1) ? params : params.substring(0, spaceIdx);
+      int32_t id;
+      if (spaceIdx == -1 ||
+          !InputValidation::parseAndValidateInt(params.substring(spaceIdx + 1).c_str(), id,
+                                                0, CueEngine::MAX_CUES - 1, "CUE id")) {
+        sendError("Usage: CUE [LIST | PLAY <0-7> | DELETE <0-7>]");
+        return false;
+      }
+      if (action == "PLAY") {
+        MotionCommand cmd = createMotionCommand(CommandType::CUE_PLAY);
+        cmd.cueId = id;
+        return sendMotionCommand(cmd);
+      }
+      if (action == "DELETE") {
+        if (!CueEngine::deleteTrack(id)) {
+          sendError("Cue store busy");
+          return false;
+        }
+        sendInfo("Cue deleted");
+        return true;
+      }
+      sendError("Usage: CUE [LIST | PLAY <0-7> | DELETE <0-7>]");
+      return false;
+    }
     else if (mainCmd == "MOVEHOME" || mainCmd == "GOTOHOME") {
+      uint8_t axis;
+      if (!takeAxisParam(params, axis)) {
+        return false;
+      }
       // Check if system is homed
-      if (!StepperController::isHomed()) {
+      if (!StepperController::isHomed(axis)) {
         sendError("System must be homed before moving to home position");
         return false;
       }
       
       // Get position limits and home percentage
       int32_t minPos, maxPos;
-      if (!StepperController::getPositionLimits(minPos, maxPos)) {
+      if (!StepperController::getPositionLimits(minPos, maxPos, axis)) {
         sendError("Unable to get position limits");
         return false;
       }
@@ -639,14 +907,68 @@ namespace SerialInterface {
       Serial.printf("INFO: Target position: %d (%.1f%% of range)\n", homePosition, config->homePositionPercent);
       
       MotionCommand cmd = createMotionCommand(CommandType::MOVE_ABSOLUTE, homePosition);
+      cmd.axis = axis;
       return sendMotionCommand(cmd);
     }
+    else if (mainCmd == "LIMITS") {
+      // User limits per axis: LIMITS lists them, LIMITS <min> <max> [AXIS <n>] sets and stores them
+      uint8_t axis;
+      if (!takeAxisParam(params, axis)) {
+        return false;
+      }
+      if (params == "") {
+        for (uint8_t i = 0; i < StepperController::getAxisCount(); i++) {
+          int32_t userMin = 0, userMax = 0, minPos = 0, maxPos = 0;
+          StepperController::getUserLimits(userMin, userMax, i);
+          if (StepperController::getPositionLimits(minPos, maxPos, i)) {
+            Serial.printf("Axis %d: user limits %d to %d, operating range %d to %d\n", i, userMin, userMax, minPos, maxPos);
+          } else {
+            Serial.printf("Axis %d: user limits %d to %d, not homed\n", i, userMin, userMax);
+          }
+        }
+        return true;
+      }
+      int spaceIdx = params.indexOf(' ');
+      int32_t minPos, maxPos;
+      if (spaceIdx == -1 ||
+          !InputValidation::parseAndValidateInt(params.substring(0, spaceIdx).c_str(), minPos,
+                                                ParamLimits::MIN_POSITION, ParamLimits::MAX_POSITION, "LIMITS min") ||
+          !InputValidation::parseAndValidateInt(params.substring(spaceIdx + 1).c_str(), maxPos,
+                                                ParamLimits::MIN_POSITION, ParamLimits::MAX_POSITION, "LIMITS max")) {
+        sendError("Usage: LIMITS [<min> <max>] [AXIS <n>]");
+        return false;
+      }
+      if (!StepperController::setUserLimits(minPos, maxPos, axis)) {
+        sendError("Limits not stored (min must be below max)");
+        return false;
+      }
+      sendOK();
+      return true;
+    }
     else if (mainCmd == "HOME") {
+      uint8_t axis;
+      if (!takeAxisParam(params, axis)) {
+        return false;
+      }
+      if (params == "FULL") {
+        // Sweep both switches even when verifyHoming is enabled
+        if (!StepperController::startHoming(true, axis)) {
+          sendError("Failed to queue home command");
+          return false;
+        }
+        return true;
+      }
       MotionCommand cmd = createMotionCommand(CommandType::HOME);
+      cmd.axis = axis;
       return sendMotionCommand(cmd);
     }
     else if (mainCmd == "STOP") {
+      uint8_t axis;
+      if (!takeAxisParam(params, axis)) {
+        return false;
+      }
       MotionCommand cmd = createMotionCommand(CommandType::STOP);
+      cmd.axis = axis;
       return sendMotionCommand(cmd);
     }
     else if (mainCmd == "ESTOP" || mainCmd == "EMERGENCY") {
@@ -663,6 +985,10 @@ namespace SerialInterface {
     }
     else if (mainCmd == "SPEED") {
       // Live speed adjustment without saving to flash
+      uint8_t axis;
+      if (!takeAxisParam(params, axis)) {
+        return false;
+      }
       if (params == "") {
         sendError("SPEED requires value parameter");
         return false;
@@ -678,6 +1004,7 @@ namespace SerialInterface {
       
       // Send immediate speed change command
       MotionCommand cmd = createMotionCommand(CommandType::SET_SPEED);
+      cmd.axis = axis;
       cmd.profile.maxSpeed = speed;
       if (sendMotionCommand(cmd)) {
         sendInfo("Speed adjusted (not saved to flash)");
@@ -688,6 +1015,10 @@ namespace SerialInterface {
     }
     else if (mainCmd == "ACCEL") {
       // Live acceleration adjustment without saving to flash
+      uint8_t axis;
+      if (!takeAxisParam(params, axis)) {
+        return false;
+      }
       if (params == "") {
         sendError("ACCEL requires value parameter");
         return false;
@@ -703,6 +1034,7 @@ namespace SerialInterface {
       
       // Send immediate acceleration change command
       MotionCommand cmd = createMotionCommand(CommandType::SET_ACCELERATION);
+      cmd.axis = axis;
       cmd.profile.acceleration = accel;
       if (sendMotionCommand(cmd)) {
         sendInfo("Acceleration adjusted (not saved to flash)");
@@ -780,6 +1112,27 @@ namespace SerialInterface {
     else if (mainCmd == "PARAMS") {
       return sendParameterList();
     }
+    else if (mainCmd == "PROFILE") {
+      if (params == "RESET") {
+        LoopProfiler::reset();
+        sendInfo("Control loop profile cleared");
+        sendOK();
+        return true;
+      }
+      return sendProfile();
+    }
+    else if (mainCmd == "TRACE") {
+      if (params == "CLEAR") {
+        MotionTrace::clear();
+        sendInfo("Motion trace cleared");
+        sendOK();
+        return true;
+      }
+      if (params == "DUMP") {
+        return sendTraceDump();
+      }
+      return sendTrace();
+    }
     else if (mainCmd == "DIAG") {
       if (params == "ON" || params == "1") {
         StepperController::enableStepDiagnostics(true);
@@ -834,7 +1187,13 @@ namespace SerialInterface {
       if (params == "STATUS") {
         Serial.println("\n=== DMX Status ===");
         Serial.printf("Signal Present: %s\n", DMXReceiver::isSignalPresent() ? "YES" : "NO");
+        Serial.printf("Input: %s\n", (DMXReceiver::getInput() == DMXReceiver::DMXInput::NETWORK) ? "network (Art-Net/sACN)" : "RS-485");
         Serial.printf("Base Channel: %d\n", DMXReceiver::getBaseChannel());
+        DMXPersonality::Personality personality;
+        if (DMXPersonality::getPersonality(DMXReceiver::getPersonalitySlot(), personality)) {
+          Serial.printf("Personality: %d (%s), %d channels\n", DMXReceiver::getPersonalitySlot(),
+                        personality.name, DMXReceiver::getFootprint());
+        }
         
         uint32_t lastUpdate = DMXReceiver::getLastUpdateTime();
         if (lastUpdate > 0) {
@@ -844,9 +1203,7 @@ namespace SerialInterface {
         }
         
         // Show channel values
-        uint8_t channels[5];
-        DMXReceiver::getChannelCache(channels);
-        char buffer[128];
+        char buffer[160];
         DMXReceiver::getFormattedChannelValues(buffer, sizeof(buffer));
         Serial.println(buffer);
         
@@ -855,16 +1212,40 @@ namespace SerialInterface {
         DMXReceiver::getPacketStats(total, errors);
         Serial.printf("Packets: %lu total, %lu errors\n", total, errors);
         
-        // Interpret channel values
+        // Show frame timing
+        DMXReceiver::FrameStats frameStats;
+        if (DMXReceiver::getFrameStats(frameStats)) {
+          Serial.printf("Frames: %lu processed, %lu skipped, %.1f Hz\n",
+                       frameStats.frames, frameStats.skippedFrames, frameStats.rateHz);
+          Serial.printf("Interval: avg %lu us, min %lu us, max %lu us\n",
+                       frameStats.intervalAvgUs, frameStats.intervalMinUs, frameStats.intervalMaxUs);
+          Serial.printf("Jitter: avg %lu us, max %lu us\n", frameStats.jitterAvgUs, frameStats.jitterMaxUs);
+          Serial.printf("Frame->Command: avg %lu us, max %lu us (%lu commands)\n",
+                       frameStats.latencyAvgUs, frameStats.latencyMaxUs, frameStats.commandFrames);
+          Serial.print("  Latency <=");
+          for (uint8_t i = 0; i < DMXReceiver::LATENCY_BUCKETS; i++) {
+            if (DMXReceiver::LATENCY_BUCKET_US[i] == UINT32_MAX) {
+              Serial.printf(" | >%luus: %lu", DMXReceiver::LATENCY_BUCKET_US[i - 1], frameStats.latencyBuckets[i]);
+            } else {
+              Serial.printf(" %luus: %lu", DMXReceiver::LATENCY_BUCKET_US[i], frameStats.latencyBuckets[i]);
+            }
+          }
+          Serial.println();
+        } else {
+          Serial.println("Frames: none yet");
+        }
+        
+        // Interpret channel values (as decoded by the personality)
+        DMXPersonality::Values values;
+        DMXReceiver::getDecodedValues(values);
         Serial.println("\nChannel Interpretation:");
-        Serial.printf("  Position: %d (MSB) + %d (LSB)\n", channels[0], channels[1]);
-        Serial.printf("  Acceleration: %d (%.1f%% of max)\n", channels[2], (channels[2] / 255.0) * 100);
-        Serial.printf("  Speed: %d (%.1f%% of max)\n", channels[3], (channels[3] / 255.0) * 100);
-        Serial.printf("  Mode: %d (", channels[4]);
-        if (channels[4] <= 84) Serial.print("STOP");
-        else if (channels[4] <= 170) Serial.print("DMX CONTROL");
-        else Serial.print("FORCE HOME");
-        Serial.println(")");
+        Serial.printf("  Position: %.2f%% of range\n",
+                      FixedPoint::fractionToPercent(values.value[(uint8_t)DMXPersonality::Role::POSITION]));
+        Serial.printf("  Acceleration: %.1f%% of max\n",
+                      FixedPoint::fractionToPercent(values.value[(uint8_t)DMXPersonality::Role::ACCELERATION]));
+        Serial.printf("  Speed: %.1f%% of max\n",
+                      FixedPoint::fractionToPercent(values.value[(uint8_t)DMXPersonality::Role::SPEED]));
+        Serial.printf("  Mode: %d (%s)\n", values.mode, dmxModeLabel(values.mode));
         
         Serial.println("================\n");
         return true;
@@ -905,16 +1286,13 @@ namespace SerialInterface {
         Serial.println("\nDMX Monitor Mode - Press any key to exit");
         Serial.println("Base Channel: " + String(DMXReceiver::getBaseChannel()));
         Serial.println("Watching for DMX data...");
-        Serial.println("\nChannel Layout:");
-        Serial.println("  Ch+0: Position MSB (coarse 8-bit)");
-        Serial.println("  Ch+1: Position LSB (fine 16-bit)");
-        Serial.println("  Ch+2: Acceleration (0-255 = 0-100%)");
-        Serial.println("  Ch+3: Speed (0-255 = 0-100%)");
-        Serial.println("  Ch+4: Mode (0-84=STOP, 85-170=CONTROL, 171-255=HOME)\n");
+        printPersonalityLayout(DMXReceiver::getPersonalitySlot());
+        Serial.println();
         
         // Enter monitoring loop
         uint32_t lastPrint = 0;
-        uint8_t lastChannels[5] = {0};
+        uint8_t lastChannels[DMXReceiver::MAX_CHANNELS] = {0};
+        uint32_t lastSequence = 0;
         bool firstPrint = true;
         
         while (!Serial.available()) {
@@ -922,12 +1300,21 @@ namespace SerialInterface {
             lastPrint = millis();
             
             if (DMXReceiver::isSignalPresent()) {
-              uint8_t channels[5];
-              DMXReceiver::getChannelCache(channels);
+              // Nothing to compare until a new frame arrives
+              uint32_t sequence = DMXReceiver::getUniverseSequence();
+              if (sequence == lastSequence && !firstPrint) {
+                continue;
+              }
+              lastSequence = sequence;
+              
+              uint8_t channels[DMXReceiver::MAX_CHANNELS];
+              uint8_t count = DMXReceiver::getChannelCache(channels, DMXReceiver::MAX_CHANNELS);
+              DMXPersonality::Values values;
+              DMXReceiver::getDecodedValues(values);
               
               // Check if any channel changed
               bool changed = false;
-              for (int i = 0; i < 5; i++) {
+              for (int i = 0; i < count; i++) {
                 if (channels[i] != lastChannels[i] || firstPrint) {
                   changed = true;
                   lastChannels[i] = channels[i];
@@ -937,41 +1324,28 @@ namespace SerialInterface {
               if (changed || firstPrint) {
                 firstPrint = false;
                 
-                // Clear line and print channel values
+                // Clear line and print channel values (first 8 channels of a longer layout)
+                uint8_t shown = (count > 8) ? 8 : count;
                 Serial.print("\r");
                 Serial.printf("Ch%d-Ch%d: [", 
                   DMXReceiver::getBaseChannel(), 
-                  DMXReceiver::getBaseChannel() + 4);
-                
-                // Print each channel with color coding for changes
-                for (int i = 0; i < 5; i++) {
+                  DMXReceiver::getBaseChannel() + count - 1);
+                for (int i = 0; i < shown; i++) {
                   if (i > 0) Serial.print(",");
                   Serial.printf("%3d", channels[i]);
                 }
-                Serial.print("] ");
+                Serial.print((shown < count) ? ",...] " : "] ");
                 
                 // Add interpretations
-                Serial.print("Pos:");
-                if (channels[1] == 0) {
-                  // 8-bit mode
-                  Serial.printf("%3d%% ", (channels[0] * 100) / 255);
-                } else {
-                  // 16-bit mode
-                  uint16_t pos16 = (channels[0] << 8) | channels[1];
-                  Serial.printf("%3d%% ", (pos16 * 100) / 65535);
-                }
-                
-                Serial.printf("Acc:%3d%% Spd:%3d%% Mode:", 
-                  (channels[2] * 100) / 255,
-                  (channels[3] * 100) / 255);
-                
-                if (channels[4] <= 84) Serial.print("STOP    ");
-                else if (channels[4] <= 170) Serial.print("CONTROL ");
-                else Serial.print("HOME    ");
+                Serial.printf("Pos:%5.1f%% Acc:%3.0f%% Spd:%3.0f%% Mode:%-8s",
+                  FixedPoint::fractionToPercent(values.value[(uint8_t)DMXPersonality::Role::POSITION]),
+                  FixedPoint::fractionToPercent(values.value[(uint8_t)DMXPersonality::Role::ACCELERATION]),
+                  FixedPoint::fractionToPercent(values.value[(uint8_t)DMXPersonality::Role::SPEED]),
+                  dmxModeLabel(values.mode));
                 
                 // Add raw values in hex for debugging
                 Serial.print(" [HEX:");
-                for (int i = 0; i < 5; i++) {
+                for (int i = 0; i < shown; i++) {
                   Serial.printf(" %02X", channels[i]);
                 }
                 Serial.print("]");
@@ -1004,16 +1378,16 @@ namespace SerialInterface {
             Serial.println("\n--- Direct Channel Read Test ---");
             
             // Test reading individual channels
-            for (int ch = DMXReceiver::getBaseChannel(); ch < DMXReceiver::getBaseChannel() + 5; ch++) {
+            for (int ch = DMXReceiver::getBaseChannel(); ch < DMXReceiver::getBaseChannel() + DMXReceiver::getFootprint(); ch++) {
               uint16_t value = DMXReceiver::getChannelValue(ch);
               Serial.printf("Channel %3d: %3d (0x%02X)\n", ch, value, value);
             }
             
             // Also show the cached values
             Serial.println("\n--- Cached Values ---");
-            uint8_t cached[5];
-            DMXReceiver::getChannelCache(cached);
-            for (int i = 0; i < 5; i++) {
+            uint8_t cached[DMXReceiver::MAX_CHANNELS];
+            uint8_t count = DMXReceiver::getChannelCache(cached, DMXReceiver::MAX_CHANNELS);
+            for (int i = 0; i < count; i++) {
               Serial.printf("Cache[%d]: %3d (0x%02X)\n", i, cached[i], cached[i]);
             }
             
@@ -1074,25 +1448,107 @@ namespace SerialInterface {
         Serial.println("\nScan complete\n");
         return true;
       }
+      else if (params == "RESET") {
+        // Restart packet and frame timing statistics
+        DMXReceiver::resetStats();
+        sendOK();
+        return true;
+      }
       else if (params.startsWith("CHANNEL ")) {
         // Set base channel
         String channelStr = params.substring(8);
         int channel = channelStr.toInt();
-        if (channel >= 1 && channel <= 508) {
+        int lastBase = 513 - DMXReceiver::getFootprint();
+        if (channel >= 1 && channel <= lastBase) {
           if (DMXReceiver::setBaseChannel(channel)) {
             Serial.printf("DMX base channel set to %d\n", channel);
-            Serial.printf("Now monitoring channels %d-%d\n", channel, channel + 4);
+            Serial.printf("Now monitoring channels %d-%d\n", channel, channel + DMXReceiver::getFootprint() - 1);
             sendOK();
           } else {
             sendError("Failed to set base channel");
           }
         } else {
-          sendError("Channel must be 1-508 (to allow for 5 channels)");
+          Serial.printf("ERROR: Channel must be 1-%d (to allow for %d channels)\n", lastBase, DMXReceiver::getFootprint());
+        }
+        return true;
+      }
+      else if (params == "NET" || params == "NET RESET") {
+#ifdef ENABLE_NETWORK_DMX
+        if (params == "NET RESET") {
+          NetworkDMX::resetStats();
+          sendOK();
+          return true;
+        }
+        uint16_t universe = DMX_NET_UNIVERSE;
+        SAFE_READ_CONFIG(dmxUniverse, universe);
+        NetworkDMX::Stats stats;
+        NetworkDMX::getStats(stats);
+        Serial.println("\n=== Network DMX ===");
+        Serial.printf("Input: %s\n", (DMXReceiver::getInput() == DMXReceiver::DMXInput::NETWORK) ? "network (active)" : "RS-485 (network packets not used)");
+        Serial.printf("Listening: %s, universe %d\n", NetworkDMX::isRunning() ? "YES" : "NO", universe);
+        Serial.printf("Packets: %lu total, %lu malformed, %lu other universes\n",
+                      stats.packets, stats.malformed, stats.otherUniverse);
+        Serial.printf("Frames: %lu forwarded, %lu out of order\n", stats.frames, stats.outOfOrder);
+        Serial.printf("Sources: %lu switches, %lu dropped (table full)\n", stats.sourceSwitches, stats.sourcesDropped);
+        
+        bool any = false;
+        for (uint8_t i = 0; i < NetworkDMX::MAX_SOURCES; i++) {
+          NetworkDMX::SourceStats source;
+          if (!NetworkDMX::getSourceStats(i, source)) continue;
+          any = true;
+          const uint8_t* ip = (const uint8_t*)&source.address;  // Network byte order
+          Serial.printf("%c %-7s %d.%d.%d.%d prio %3d: %lu packets, %lu frames, %lu out of order, last %lu ms ago\n",
+                        source.active ? '*' : ' ', NetworkDMX::protocolName(source.protocol),
+                        ip[0], ip[1], ip[2], ip[3], source.priority,
+                        source.packets, source.frames, source.outOfOrder, source.ageMs);
+        }
+        if (!any) {
+          Serial.println("No sources");
+        }
+        Serial.println("===================\n");
+#else
+        Serial.println("Network DMX disabled (ENABLE_NETWORK_DMX in ProjectConfig.h)");
+#endif
+        return true;
+      }
+      else if (params == "PERSONALITY" || params == "PERSONALITY LIST") {
+        Serial.println("\n=== DMX Personalities ===");
+        for (uint8_t slot = 0; slot < DMXPersonality::MAX_PERSONALITIES; slot++) {
+          printPersonalityLayout(slot);
+        }
+        Serial.println("=========================\n");
+        return true;
+      }
+      else if (params.startsWith("PERSONALITY DELETE ")) {
+        int slot = params.substring(19).toInt();
+        if (slot == DMXReceiver::getPersonalitySlot()) {
+          sendError("Personality is in use - select another one first");
+          return false;
         }
+        if (!DMXPersonality::deletePersonality(slot)) {
+          sendError("Only uploaded personalities (3-7) can be deleted");
+          return false;
+        }
+        sendOK();
+        return true;
+      }
+      else if (params.startsWith("PERSONALITY ")) {
+        String slotStr = params.substring(12);
+        int32_t slot;
+        if (!InputValidation::parseAndValidateInt(slotStr.c_str(), slot, 0, DMXPersonality::MAX_PERSONALITIES - 1,
+                                                  "personality")) {
+          sendError("Personality must be 0-7");
+          return false;
+        }
+        if (!DMXReceiver::selectPersonality((uint8_t)slot) || !SystemConfigMgr::commitChanges()) {
+          sendError("Personality slot is empty or does not fit after the base channel");
+          return false;
+        }
+        sendOK();
         return true;
       }
       else {
-        sendError("DMX commands: STATUS, MONITOR, TEST, DEBUG, SCAN, CHANNEL <n>");
+        sendError("DMX commands: STATUS, MONITOR, TEST, DEBUG, SCAN, CHANNEL <n>, PERSONALITY [<id>|DELETE <id>], NET [RESET], RESET");
         return false;
       }
     }
@@ -1143,7 +1599,7 @@ namespace SerialInterface {
   bool processJSONCommand(const char* jsonCommand) {
     sendDebug("Processing JSON command");
     
-    StaticJsonDocument<512> doc;
+    StaticJsonDocument<1536> doc;  // Sized for JSON path waypoint arrays
     DeserializationError error = deserializeJson(doc, jsonCommand);
     
     if (error) {
@@ -1177,13 +1633,47 @@ namespace SerialInterface {
       }
     }
     else if (command == "move") {
-      if (!doc.containsKey("position")) {
+      // {"command":"move","positions":[1000,2500]} moves the axes together (null = axis stays)
+      if (!doc.containsKey("position") && !doc.containsKey("positions")) {
         Serial.println("{\"status\":\"error\",\"message\":\"Missing position parameter\"}");
         return false;
       }
-      int32_t position = doc["position"];
-      MotionCommand cmd = createMotionCommand(CommandType::MOVE_ABSOLUTE, position);
-      if (sendMotionCommand(cmd)) {
+      ProfileShape shape = ProfileShape::CONFIGURED;
+      if (doc.containsKey("profile") && !SystemConfigMgr::parseProfileShape(doc["profile"], shape)) {
+        Serial.println("{\"status\":\"error\",\"message\":\"Invalid profile (use scurve or trapezoidal)\"}");
+        return false;
+      }
+      bool queued;
+      if (doc.containsKey("positions")) {
+        JsonArray positions = doc["positions"].as<JsonArray>();
+        if (positions.size() == 0 || positions.size() > StepperController::getAxisCount()) {
+          Serial.println("{\"status\":\"error\",\"message\":\"One position per axis required\"}");
+          return false;
+        }
+        int32_t targets[STEPPER_AXIS_COUNT] = {};
+        uint8_t axisMask = 0;
+        uint8_t axis = 0;
+        for (JsonVariant position : positions) {
+          if (!position.isNull()) {
+            axisMask |= (1 << axis);
+            targets[axis] = position.as<int32_t>();
+          }
+          axis++;
+        }
+        queued = StepperController::moveCoordinated(targets, axisMask, shape);
+      } else {
+        uint8_t axis;
+        if (!jsonAxisParam(doc, axis)) {
+          return false;
+        }
+        MotionCommand cmd = createMotionCommand(CommandType::MOVE_ABSOLUTE, doc["position"].as<int32_t>());
+        cmd.axis = axis;
+        if (shape != ProfileShape::CONFIGURED) {
+          cmd.profile.shape = shape;
+        }
+        queued = sendMotionCommand(cmd);
+      }
+      if (queued) {
         Serial.println("{\"status\":\"ok\",\"message\":\"Move command queued\"}");
         return true;
       } else {
@@ -1191,9 +1681,163 @@ namespace SerialInterface {
         return false;
       }
     }
+    else if (command == "path") {
+      // {"command":"path","waypoints":[{"position":1000,"speed":2000},...],"run":true}
+      // {"command":"path","action":"clear"}
+      if (doc.containsKey("action") && doc["action"].as<String>() == "clear") {
+        MotionCommand cmd = createMotionCommand(CommandType::PATH_CLEAR);
+        if (sendMotionCommand(cmd)) {
+          Serial.println("{\"status\":\"ok\",\"message\":\"Path clear queued\"}");
+          return true;
+        }
+        Serial.println("{\"status\":\"error\",\"message\":\"Failed to queue path clear\"}");
+        return false;
+      }
+      
+      JsonArray waypoints = doc["waypoints"].as<JsonArray>();
+      int queued = 0;
+      for (JsonObject waypoint : waypoints) {
+        if (!waypoint.containsKey("position")) {
+          Serial.println("{\"status\":\"error\",\"message\":\"Waypoint missing position\"}");
+          return false;
+        }
+        MotionCommand cmd = createMotionCommand(CommandType::PATH_APPEND,
+                                                waypoint["position"], waypoint["speed"] | 0.0f);
+        // Short wait so a long batch does not overrun the command queue
+        if (!StepperController::queueMotionCommand(cmd, pdMS_TO_TICKS(10))) {
+          Serial.printf("{\"status\":\"error\",\"message\":\"Command queue full after %d waypoints\"}\n", queued);
+          return false;
+        }
+        queued++;
+      }
+      
+      if (doc["run"] | false) {
+        MotionCommand cmd = createMotionCommand(CommandType::PATH_START);
+        if (!StepperController::queueMotionCommand(cmd, pdMS_TO_TICKS(10))) {
+          Serial.println("{\"status\":\"error\",\"message\":\"Failed to queue path start\"}");
+          return false;
+        }
+      }
+      Serial.printf("{\"status\":\"ok\",\"message\":\"%d waypoint(s) queued\"}\n", queued);
+      return true;
+    }
+    else if (command == "cue") {
+      // {"command":"cue","action":"upload","id":0,"loop":false,"keyframes":[[0,1000,0],[500,3000,2000],...]}
+      // "append" adds keyframes to a cue, "play"/"delete" take an id, "list" reports stored cues
+      String action = doc["action"] | "list";
+      action.toLowerCase();
+      if (action == "upload" || action == "append") {
+        const char* error = nullptr;
+        if (!CueEngine::uploadTrackJson(doc.as<JsonObjectConst>(), action == "append", error)) {
+          Serial.printf("{\"status\":\"error\",\"message\":\"%s\"}\n", error);
+          return false;
+        }
+        Serial.println("{\"status\":\"ok\",\"message\":\"Cue stored\"}");
+        return true;
+      }
+      if (action == "list") {
+        StaticJsonDocument<512> response;
+        response["status"] = "ok";
+        CueEngine::listTracks(response);
+        response["playing"] = StepperController::getActiveCue();
+        serializeJson(response, Serial);
+        Serial.println();
+        return true;
+      }
+      int id = doc["id"] | -1;
+      if (id < 0 || id >= CueEngine::MAX_CUES) {
+        Serial.println("{\"status\":\"error\",\"message\":\"Cue id out of range (0-7)\"}");
+        return false;
+      }
+      if (action == "play") {
+        MotionCommand cmd = createMotionCommand(CommandType::CUE_PLAY);
+        cmd.cueId = id;
+        if (sendMotionCommand(cmd)) {
+          Serial.println("{\"status\":\"ok\",\"message\":\"Cue play queued\"}");
+          return true;
+        }
+        Serial.println("{\"status\":\"error\",\"message\":\"Failed to queue cue play\"}");
+        return false;
+      }
+      if (action == "delete") {
+        if (CueEngine::deleteTrack(id)) {
+          Serial.println("{\"status\":\"ok\",\"message\":\"Cue deleted\"}");
+          return true;
+        }
+        Serial.println("{\"status\":\"error\",\"message\":\"Cue store busy\"}");
+        return false;
+      }
+      Serial.println("{\"status\":\"error\",\"message\":\"Unknown cue action\"}");
+      return false;
+    }
+    else if (command == "personality") {
+      // {"command":"personality","action":"upload","id":3,"name":"venue","channels":[{"role":"position","coarse":0,"fine":1},...]}
+      // "select"/"delete" take an id, "list" reports the personalities
+      String action = doc["action"] | "list";
+      action.toLowerCase();
+      if (action == "upload") {
+        const char* error = nullptr;
+        if (!DMXPersonality::uploadJson(doc.as<JsonObjectConst>(), error)) {
+          Serial.printf("{\"status\":\"error\",\"message\":\"%s\"}\n", error);
+          return false;
+        }
+        if (doc["id"] == DMXReceiver::getPersonalitySlot()) {
+          DMXReceiver::selectPersonality(DMXReceiver::getPersonalitySlot(), false);  // Recompile the active layout
+        }
+        Serial.println("{\"status\":\"ok\",\"message\":\"Personality stored\"}");
+        return true;
+      }
+      if (action == "list") {
+        StaticJsonDocument<768> response;
+        response["status"] = "ok";
+        DMXPersonality::listPersonalities(response);
+        response["active"] = DMXReceiver::getPersonalitySlot();
+        serializeJson(response, Serial);
+        Serial.println();
+        return true;
+      }
+      int id = doc["id"] | -1;
+      if (id < 0 || id >= DMXPersonality::MAX_PERSONALITIES) {
+        Serial.println("{\"status\":\"error\",\"message\":\"Personality id out of range (0-7)\"}");
+        return false;
+      }
+      if (action == "select") {
+        if (DMXReceiver::selectPersonality(id) && SystemConfigMgr::commitChanges()) {
+          Serial.println("{\"status\":\"ok\",\"message\":\"Personality selected\"}");
+          return true;
+        }
+        Serial.println("{\"status\":\"error\",\"message\":\"Personality slot is empty or does not fit after the base channel\"}");
+        return false;
+      }
+      if (action == "delete") {
+        if (id == DMXReceiver::getPersonalitySlot()) {
+          Serial.println("{\"status\":\"error\",\"message\":\"Personality is in use\"}");
+          return false;
+        }
+        if (DMXPersonality::deletePersonality(id)) {
+          Serial.println("{\"status\":\"ok\",\"message\":\"Personality deleted\"}");
+          return true;
+        }
+        Serial.println("{\"status\":\"error\",\"message\":\"Only uploaded personalities (3-7) can be deleted\"}");
+        return false;
+      }
+      Serial.println("{\"status\":\"error\",\"message\":\"Unknown personality action\"}");
+      return false;
+    }
     else if (command == "home") {
-      MotionCommand cmd = createMotionCommand(CommandType::HOME);
-      if (sendMotionCommand(cmd)) {
+      uint8_t axis;
+      if (!jsonAxisParam(doc, axis)) {
+        return false;
+      }
+      bool queued;
+      if (doc["full"] | false) {
+        queued = StepperController::startHoming(true, axis);
+      } else {
+        MotionCommand cmd = createMotionCommand(CommandType::HOME);
+        cmd.axis = axis;
+        queued = sendMotionCommand(cmd);
+      }
+      if (queued) {
         Serial.println("{\"status\":\"ok\",\"message\":\"Home command queued\"}");
         return true;
       } else {
@@ -1202,7 +1846,12 @@ namespace SerialInterface {
       }
     }
     else if (command == "stop") {
+      uint8_t axis;
+      if (!jsonAxisParam(doc, axis)) {
+        return false;
+      }
       MotionCommand cmd = createMotionCommand(CommandType::STOP);
+      cmd.axis = axis;
       if (sendMotionCommand(cmd)) {
         Serial.println("{\"status\":\"ok\",\"message\":\"Stop command queued\"}");
         return true;
@@ -1211,6 +1860,35 @@ namespace SerialInterface {
         return false;
       }
     }
+    else if (command == "speed" || command == "accel") {
+      // {"command":"speed","value":2000,"axis":1} - live change as SPEED/ACCEL, not saved
+      uint8_t axis;
+      if (!jsonAxisParam(doc, axis)) {
+        return false;
+      }
+      bool isSpeed = (command == "speed");
+      float value = doc["value"] | 0.0f;
+      if (!InputValidation::validateFloat(value,
+                                          isSpeed ? ParamLimits::MIN_SPEED : ParamLimits::MIN_ACCELERATION,
+                                          isSpeed ? ParamLimits::MAX_SPEED : ParamLimits::MAX_ACCELERATION)) {
+        Serial.println("{\"status\":\"error\",\"message\":\"Value missing or out of range\"}");
+        return false;
+      }
+      MotionCommand cmd = createMotionCommand(isSpeed ? CommandType::SET_SPEED : CommandType::SET_ACCELERATION);
+      cmd.axis = axis;
+      if (isSpeed) {
+        cmd.profile.maxSpeed = value;
+      } else {
+        cmd.profile.acceleration = value;
+      }
+      if (sendMotionCommand(cmd)) {
+        Serial.println("{\"status\":\"ok\",\"message\":\"Live change queued\"}");
+        return true;
+      } else {
+        Serial.println("{\"status\":\"error\",\"message\":\"Failed to queue live change\"}");
+        return false;
+      }
+    }
     else if (command == "enable") {
       MotionCommand cmd = createMotionCommand(CommandType::ENABLE);
       if (sendMotionCommand(cmd)) {
@@ -1390,6 +2068,55 @@ namespace SerialInterface {
         return false;
       }
     }
+    else if (param == "jerk") {
+      float jerk;
+      if (!InputValidation::parseAndValidateFloat(value, jerk,
+                                                  ParamLimits::MIN_JERK,
+                                                  ParamLimits::MAX_JERK,
+                                                  "jerk")) {
+        sendError("Invalid jerk value or out of range");
+        return false;
+      }
+      sendDebug("Setting jerk");
+      MotionProfile profile = config->defaultProfile;
+      profile.jerk = jerk;
+      if (SystemConfigMgr::setMotionProfile(profile)) {
+        if (SystemConfigMgr::commitChanges()) {
+          sendInfo("Jerk updated successfully (applies to S-curve moves)");
+          sendOK();
+          return true;
+        } else {
+          sendError("Failed to save jerk to flash");
+          return false;
+        }
+      } else {
+        sendError("Invalid jerk value (must be 0-50000 steps/sec³)");
+        return false;
+      }
+    }
+    else if (param == "profileshape" || param == "profile") {
+      ProfileShape shape;
+      if (!SystemConfigMgr::parseProfileShape(value, shape) || shape == ProfileShape::CONFIGURED) {
+        sendError("Profile shape must be TRAPEZOIDAL or SCURVE");
+        return false;
+      }
+      sendDebug("Setting profile shape");
+      MotionProfile profile = config->defaultProfile;
+      profile.shape = shape;
+      if (SystemConfigMgr::setMotionProfile(profile)) {
+        if (SystemConfigMgr::commitChanges()) {
+          sendInfo("Profile shape updated successfully");
+          sendOK();
+          return true;
+        } else {
+          sendError("Failed to save profile shape to flash");
+          return false;
+        }
+      } else {
+        sendError("Invalid profile shape");
+        return false;
+      }
+    }
     else if (param == "homingspeed") {
       float speed;
       if (!InputValidation::parseAndValidateFloat(value, speed,
@@ -1410,6 +2137,26 @@ namespace SerialInterface {
         return false;
       }
     }
+    else if (param == "homingfastspeed" || param == "homingfast") {
+      float speed;
+      if (!InputValidation::parseAndValidateFloat(value, speed, 0.0f,
+                                                  ParamLimits::MAX_HOMING_SPEED,
+                                                  "homingFastSpeed")) {
+        sendError("Invalid homing fast speed (0 = off, up to 10000 steps/sec)");
+        return false;
+      }
+      sendDebug("Setting homing fast speed");
+      config->homingFastSpeed = speed;
+      if (SystemConfigMgr::commitChanges()) {
+        sendInfo(speed > config->homingSpeed ? "Two-speed homing enabled" :
+                 "Two-speed homing off (fast speed must exceed homingSpeed)");
+        sendOK();
+        return true;
+      } else {
+        sendError("Failed to save homing fast speed to flash");
+        return false;
+      }
+    }
     else if (param == "limitsafetymargin" || param == "limitmargin") {
       float margin;
       if (!parseFloat(value, margin) || margin < 50 || margin > 1000) {
@@ -1470,6 +2217,124 @@ namespace SerialInterface {
         return false;
       }
     }
+    else if (param == "verifyhoming") {
+      bool enabled = (String(value).equalsIgnoreCase("true") || String(value) == "1" || String(value).equalsIgnoreCase("on"));
+      sendDebug("Setting verify homing");
+      config->verifyHoming = enabled;
+      if (SystemConfigMgr::commitChanges()) {
+        sendInfo("Verify homing updated successfully");
+        sendOK();
+        return true;
+      } else {
+        sendError("Failed to save verify homing to flash");
+        return false;
+      }
+    }
+    else if (param == "limitfiltersamples" || param == "limitfilter") {
+      int32_t samples;
+      if (!InputValidation::parseAndValidateInt(value, samples, 1, LIMIT_FILTER_MAX_SAMPLES,
+                                                "limitFilterSamples")) {
+        sendError("Invalid limit filter samples (1-32)");
+        return false;
+      }
+      sendDebug("Setting limit filter samples");
+      config->limitFilterSamples = (uint8_t)samples;
+      if (SystemConfigMgr::commitChanges()) {
+        sendInfo("Limit filter samples updated successfully");
+        sendOK();
+        return true;
+      } else {
+        sendError("Failed to save limit filter samples to flash");
+        return false;
+      }
+    }
+    else if (param == "dmxinterpolation" || param == "dmxinterp") {
+      bool enabled = (String(value).equalsIgnoreCase("true") || String(value) == "1" || String(value).equalsIgnoreCase("on"));
+      sendDebug("Setting DMX interpolation");
+      config->dmxInterpolation = enabled;
+      if (SystemConfigMgr::commitChanges()) {
+        sendInfo(enabled ? "DMX interpolation enabled" : "DMX interpolation disabled (setpoints used as received)");
+        sendOK();
+        return true;
+      } else {
+        sendError("Failed to save DMX interpolation to flash");
+        return false;
+      }
+    }
+    else if (param == "dmxinterpdelayms" || param == "dmxinterpdelay") {
+      int32_t delayMs;
+      if (!InputValidation::parseAndValidateInt(value, delayMs, 0, DMX_INTERP_MAX_DELAY_MS,
+                                                "dmxInterpDelayMs")) {
+        sendError("Invalid DMX interpolation delay (0-100 ms)");
+        return false;
+      }
+      sendDebug("Setting DMX interpolation delay");
+      config->dmxInterpDelayMs = (uint8_t)delayMs;
+      if (SystemConfigMgr::commitChanges()) {
+        sendInfo("DMX interpolation delay updated successfully");
+        sendOK();
+        return true;
+      } else {
+        sendError("Failed to save DMX interpolation delay to flash");
+        return false;
+      }
+    }
+    else if (param == "dmxpersonality") {
+      int32_t slot;
+      if (!InputValidation::parseAndValidateInt(value, slot, 0, DMX_PERSONALITY_SLOTS - 1, "dmxPersonality")) {
+        sendError("Invalid DMX personality (0-7)");
+        return false;
+      }
+      if (!DMXReceiver::selectPersonality((uint8_t)slot)) {
+        sendError("Personality slot is empty or does not fit after the base channel");
+        return false;
+      }
+      if (SystemConfigMgr::commitChanges()) {
+        sendInfo("DMX personality updated successfully");
+        sendOK();
+        return true;
+      } else {
+        sendError("Failed to save DMX personality to flash");
+        return false;
+      }
+    }
+    else if (param == "dmxinput") {
+      String input(value);
+      DMXReceiver::DMXInput selected;
+      if (input.equalsIgnoreCase("uart") || input.equalsIgnoreCase("rs485") || input == "0") {
+        selected = DMXReceiver::DMXInput::UART;
+      } else if (input.equalsIgnoreCase("network") || input.equalsIgnoreCase("net") || input == "1") {
+        selected = DMXReceiver::DMXInput::NETWORK;
+      } else {
+        sendError("Invalid DMX input (uart or network)");
+        return false;
+      }
+      DMXReceiver::setInput(selected);
+      if (SystemConfigMgr::commitChanges()) {
+        sendInfo("DMX input updated successfully");
+        sendOK();
+        return true;
+      } else {
+        sendError("Failed to save DMX input to flash");
+        return false;
+      }
+    }
+    else if (param == "dmxuniverse") {
+      int32_t universe;
+      if (!InputValidation::parseAndValidateInt(value, universe, 0, DMX_NET_MAX_UNIVERSE, "dmxUniverse")) {
+        sendError("Invalid DMX network universe (0-63999)");
+        return false;
+      }
+      config->dmxUniverse = (uint16_t)universe;
+      if (SystemConfigMgr::commitChanges()) {
+        sendInfo("DMX network universe updated successfully");
+        sendOK();
+        return true;
+      } else {
+        sendError("Failed to save DMX network universe to flash");
+        return false;
+      }
+    }
     else {
       sendError("Unknown configuration parameter");
       return false;
@@ -1503,6 +2368,14 @@ namespace SerialInterface {
       profile.jerk = setObj["jerk"];
       configChanged = true;
     }
+    if (setObj.containsKey("profileShape")) {
+      if (!SystemConfigMgr::parseProfileShape(setObj["profileShape"], profile.shape) ||
+          profile.shape == ProfileShape::CONFIGURED) {
+        Serial.println("{\"status\":\"error\",\"message\":\"profileShape must be trapezoidal or scurve\"}");
+        return false;
+      }
+      configChanged = true;
+    }
     
     // Apply motion profile changes
     if (configChanged) {
@@ -1552,6 +2425,53 @@ namespace SerialInterface {
       configChanged = true;
     }
     
+    if (setObj.containsKey("dmxInterpolation")) {
+      config->dmxInterpolation = setObj["dmxInterpolation"];
+      configChanged = true;
+    }
+    
+    if (setObj.containsKey("dmxInterpDelayMs")) {
+      int32_t delayMs = setObj["dmxInterpDelayMs"];
+      if (delayMs < 0 || delayMs > DMX_INTERP_MAX_DELAY_MS) {
+        Serial.println("{\"status\":\"error\",\"message\":\"Invalid DMX interpolation delay\"}");
+        return false;
+      }
+      config->dmxInterpDelayMs = (uint8_t)delayMs;
+      configChanged = true;
+    }
+    
+    if (setObj.containsKey("dmxPersonality")) {
+      int32_t slot = setObj["dmxPersonality"];
+      if (slot < 0 || slot >= DMX_PERSONALITY_SLOTS || !DMXReceiver::selectPersonality((uint8_t)slot)) {
+        Serial.println("{\"status\":\"error\",\"message\":\"Invalid DMX personality\"}");
+        return false;
+      }
+      configChanged = true;
+    }
+    
+    if (setObj.containsKey("dmxUniverse")) {
+      int32_t universe = setObj["dmxUniverse"];
+      if (universe < 0 || universe > DMX_NET_MAX_UNIVERSE) {
+        Serial.println("{\"status\":\"error\",\"message\":\"Invalid DMX network universe\"}");
+        return false;
+      }
+      config->dmxUniverse = (uint16_t)universe;
+      configChanged = true;
+    }
+    
+    if (setObj.containsKey("dmxInput")) {
+      const char* input = setObj["dmxInput"] | "";
+      if (strcmp(input, "uart") == 0) {
+        DMXReceiver::setInput(DMXReceiver::DMXInput::UART);
+      } else if (strcmp(input, "network") == 0) {
+        DMXReceiver::setInput(DMXReceiver::DMXInput::NETWORK);
+      } else {
+        Serial.println("{\"status\":\"error\",\"message\":\"Invalid DMX input (uart or network)\"}");
+        return false;
+      }
+      configChanged = true;
+    }
+    
     // Commit changes if any were made
     if (configChanged) {
       if (SystemConfigMgr::commitChanges()) {
@@ -1601,18 +2521,27 @@ namespace SerialInterface {
       case SystemState::EMERGENCY_STOP: Serial.println("EMERGENCY_STOP"); break;
     }
     
-    // Motion information
-    int32_t currentPos, targetPos;
-    float currentSpeed;
-    bool stepperEnabled;
-    
-    SAFE_READ_STATUS(currentPosition, currentPos);
-    SAFE_READ_STATUS(targetPosition, targetPos);
-    SAFE_READ_STATUS(currentSpeed, currentSpeed);
-    SAFE_READ_STATUS(stepperEnabled, stepperEnabled);
+    // Motion information (one consistent snapshot)
+    SystemStatus status;
+    readSystemStatus(status);
+    int32_t currentPos = status.currentPosition;
+    int32_t targetPos = status.targetPosition;
+    float currentSpeed = status.currentSpeed;
+    bool stepperEnabled = status.stepperEnabled;
     
     Serial.printf("Position: %d steps (target: %d)\n", currentPos, targetPos);
     Serial.printf("Speed: %.1f steps/sec\n", currentSpeed);
+    if (status.timeToArrival > 0) {
+      Serial.printf("ETA: %.1f s\n", status.timeToArrival / 1000.0f);
+    }
+    for (uint8_t i = 1; i < StepperController::getAxisCount(); i++) {
+      StepperController::AxisStatus axisStatus;
+      StepperController::getAxisStatus(i, axisStatus);
+      Serial.printf("Axis %d: %d steps (target: %d), %.1f steps/sec, %s%s\n", i,
+                    axisStatus.currentPosition, axisStatus.targetPosition, axisStatus.currentSpeed,
+                    axisStatus.homed ? "homed" : "NOT HOMED",
+                    axisStatus.limitFault ? ", LIMIT FAULT" : "");
+    }
     Serial.printf("Stepper: %s\n", stepperEnabled ? "ENABLED" : "DISABLED");
     
     // Show homing status
@@ -1626,6 +2555,32 @@ namespace SerialInterface {
             Serial.printf("Position Limits: %d to %d steps (range: %d)\n", 
                          minPos, maxPos, maxPos - minPos);
         }
+        StepperController::HomingTimes homing;
+        StepperController::getHomingTimes(homing);
+        if (homing.total > 0) {
+            Serial.printf("Last Homing: %lu ms%s%s (find L %lu, release L %lu, find R %lu, release R %lu, home %lu)\n",
+                         homing.total, homing.fastApproach ? " two-speed" : "",
+                         homing.verified ? " verified" : "",
+                         homing.findLeft, homing.releaseLeft, homing.findRight,
+                         homing.releaseRight, homing.moveHome);
+        }
+        int32_t calibratedRange = StepperController::getCalibratedRange();
+        if (calibratedRange > 0) {
+            Serial.printf("Stored Range: %d steps\n", calibratedRange);
+        }
+    }
+    
+    // Limit stop path - edge to stop latency and overrun past the edge
+    StepperController::LimitStopStats limitStats;
+    StepperController::getLimitStopStats(limitStats);
+    Serial.printf("Limit Filter: %d samples, %lu edges, %lu glitches filtered, %lu ring overflows\n",
+                  limitStats.filterSamples, limitStats.edges, limitStats.glitches, limitStats.ringOverflows);
+    Serial.printf("Edge Latch: %d steps before confirmation (max %d)\n",
+                  limitStats.lastLatchDelta, limitStats.maxLatchDelta);
+    if (limitStats.stops > 0) {
+        Serial.printf("Limit Stops: %lu (latency %lu us, max %lu us; overrun %d steps, max %d)\n",
+                      limitStats.stops, limitStats.lastLatencyUs, limitStats.maxLatencyUs,
+                      limitStats.lastOverrun, limitStats.maxOverrun);
     }
     
     // Show limit fault status
@@ -1639,11 +2594,30 @@ namespace SerialInterface {
     if (config) {
       Serial.printf("Max Speed: %.1f steps/sec\n", config->defaultProfile.maxSpeed);
       Serial.printf("Acceleration: %.1f steps/sec²\n", config->defaultProfile.acceleration);
+      Serial.printf("Profile Shape: %s (jerk %.0f steps/sec³)\n",
+                    SystemConfigMgr::profileShapeToString(config->defaultProfile.shape),
+                    config->defaultProfile.jerk);
       Serial.printf("DMX Channel: %d\n", config->dmxStartChannel);
       Serial.printf("DMX Scale: %.2f steps/unit\n", config->dmxScale);
       Serial.printf("DMX Offset: %d steps\n", config->dmxOffset);
     }
     
+    StepperController::CommandQueueStats cmdStats;
+    StepperController::getCommandQueueStats(cmdStats);
+    Serial.printf("Commands: %lu received, %lu processed, %lu coalesced, %lu dropped, %lu queue full\n",
+                  cmdStats.received, cmdStats.processed, cmdStats.coalesced,
+                  cmdStats.dropped, cmdStats.queueFull);
+    Serial.printf("Path: %d waypoint(s) queued, %s\n", StepperController::getPathQueueDepth(),
+                  StepperController::isPathRunning() ? "RUNNING" : "idle");
+    if (StepperController::getActiveCue() >= 0) {
+      Serial.printf("Cue: %d playing\n", StepperController::getActiveCue());
+    }
+    
+    CoreLog::Stats logStats;
+    CoreLog::getStats(logStats);
+    Serial.printf("Core Log: %lu written, %lu dropped, high water %lu/%d\n",
+                  logStats.written, logStats.dropped, logStats.highWater, logStats.capacity);
+    
     Serial.printf("Uptime: %lu ms\n", getSystemUptime());
     Serial.println("=====================\n");
     
@@ -1651,30 +2625,79 @@ namespace SerialInterface {
   }
   
   bool sendJSONStatus() {
-    StaticJsonDocument<512> doc;
+    StaticJsonDocument<1024> doc;
     
     // System state
     SystemState state = getSystemState();
     doc["systemState"] = (int)state;
     
-    // Motion information
-    int32_t currentPos, targetPos;
-    float currentSpeed;
-    bool stepperEnabled;
-    
-    SAFE_READ_STATUS(currentPosition, currentPos);
-    SAFE_READ_STATUS(targetPosition, targetPos);
-    SAFE_READ_STATUS(currentSpeed, currentSpeed);
-    SAFE_READ_STATUS(stepperEnabled, stepperEnabled);
+    // Motion information (one consistent snapshot)
+    SystemStatus status;
+    readSystemStatus(status);
+    int32_t currentPos = status.currentPosition;
+    int32_t targetPos = status.targetPosition;
+    float currentSpeed = status.currentSpeed;
+    bool stepperEnabled = status.stepperEnabled;
     
     doc["position"]["current"] = currentPos;
     doc["position"]["target"] = targetPos;
     doc["speed"] = currentSpeed;
+    doc["eta"] = status.timeToArrival;
     doc["stepperEnabled"] = stepperEnabled;
     doc["isHomed"] = StepperController::isHomed();
     doc["limitFaultActive"] = StepperController::isLimitFaultActive();
     doc["uptime"] = getSystemUptime();
     
+    // Every axis, on boards driving more than one
+    if (StepperController::getAxisCount() > 1) {
+      JsonArray axes = doc.createNestedArray("axes");
+      for (uint8_t i = 0; i < StepperController::getAxisCount(); i++) {
+        StepperController::AxisStatus axisStatus;
+        StepperController::getAxisStatus(i, axisStatus);
+        JsonObject axis = axes.createNestedObject();
+        axis["position"] = axisStatus.currentPosition;
+        axis["target"] = axisStatus.targetPosition;
+        axis["speed"] = axisStatus.currentSpeed;
+        axis["eta"] = axisStatus.timeToArrival;
+        axis["homed"] = axisStatus.homed;
+        axis["limitFault"] = axisStatus.limitFault;
+      }
+    }
+    
+    StepperController::CommandQueueStats cmdStats;
+    StepperController::getCommandQueueStats(cmdStats);
+    doc["commands"]["received"] = cmdStats.received;
+    doc["commands"]["processed"] = cmdStats.processed;
+    doc["commands"]["coalesced"] = cmdStats.coalesced;
+    doc["commands"]["dropped"] = cmdStats.dropped;
+    doc["commands"]["queueFull"] = cmdStats.queueFull;
+    doc["path"]["queued"] = StepperController::getPathQueueDepth();
+    doc["path"]["running"] = StepperController::isPathRunning();
+    doc["cue"] = StepperController::getActiveCue();
+    
+    StepperController::HomingTimes homing;
+    StepperController::getHomingTimes(homing);
+    doc["homing"]["total"] = homing.total;
+    doc["homing"]["twoSpeed"] = homing.fastApproach;
+    doc["homing"]["verified"] = homing.verified;
+    JsonArray phases = doc["homing"].createNestedArray("phases");
+    phases.add(homing.findLeft);
+    phases.add(homing.releaseLeft);
+    phases.add(homing.findRight);
+    phases.add(homing.releaseRight);
+    phases.add(homing.moveHome);
+    
+    StepperController::LimitStopStats limitStats;
+    StepperController::getLimitStopStats(limitStats);
+    doc["limitStop"]["stops"] = limitStats.stops;
+    doc["limitStop"]["latencyUs"] = limitStats.lastLatencyUs;
+    doc["limitStop"]["maxLatencyUs"] = limitStats.maxLatencyUs;
+    doc["limitStop"]["overrun"] = limitStats.lastOverrun;
+    doc["limitStop"]["maxOverrun"] = limitStats.maxOverrun;
+    doc["limitStop"]["glitches"] = limitStats.glitches;
+    doc["limitStop"]["overflows"] = limitStats.ringOverflows;
+    doc["limitStop"]["latchDelta"] = limitStats.lastLatchDelta;
+    
     // Configuration summary
     SystemConfig* config = SystemConfigMgr::getConfig();
     if (config) {
@@ -1699,7 +2722,7 @@ namespace SerialInterface {
     }
     
     // Create comprehensive JSON output with metadata
-    StaticJsonDocument<2048> doc;
+    StaticJsonDocument<4096> doc;  // ~33 parameters with value/range/units/description
     
     // Current configuration values
     doc["config"]["motion"]["maxSpeed"]["value"] = config->defaultProfile.maxSpeed;
@@ -1724,7 +2747,11 @@ namespace SerialInterface {
     doc["config"]["motion"]["jerk"]["min"] = 0.0;
     doc["config"]["motion"]["jerk"]["max"] = 50000.0;
     doc["config"]["motion"]["jerk"]["units"] = "steps/sec³";
-    doc["config"]["motion"]["jerk"]["description"] = "Jerk limitation";
+    doc["config"]["motion"]["jerk"]["description"] = "Jerk limit for S-curve moves";
+    
+    doc["config"]["motion"]["profileShape"]["value"] = SystemConfigMgr::profileShapeToString(config->defaultProfile.shape);
+    doc["config"]["motion"]["profileShape"]["options"] = "trapezoidal, scurve";
+    doc["config"]["motion"]["profileShape"]["description"] = "Ramp shape used when a move does not specify one";
     
     doc["config"]["motion"]["targetPosition"]["value"] = config->defaultProfile.targetPosition;
     doc["config"]["motion"]["targetPosition"]["units"] = "steps";
@@ -1757,6 +2784,12 @@ namespace SerialInterface {
     doc["config"]["position"]["homingSpeed"]["units"] = "steps/sec";
     doc["config"]["position"]["homingSpeed"]["description"] = "Speed used during homing sequence";
     
+    doc["config"]["position"]["homingFastSpeed"]["value"] = config->homingFastSpeed;
+    doc["config"]["position"]["homingFastSpeed"]["min"] = 0.0;
+    doc["config"]["position"]["homingFastSpeed"]["max"] = 10000.0;
+    doc["config"]["position"]["homingFastSpeed"]["units"] = "steps/sec";
+    doc["config"]["position"]["homingFastSpeed"]["description"] = "Fast switch approach for two-speed homing (0 = off)";
+    
     doc["config"]["position"]["homePositionPercent"]["value"] = config->homePositionPercent;
     doc["config"]["position"]["homePositionPercent"]["min"] = 0.0;
     doc["config"]["position"]["homePositionPercent"]["max"] = 100.0;
@@ -1786,6 +2819,29 @@ namespace SerialInterface {
     doc["config"]["dmx"]["timeout"]["units"] = "milliseconds";
     doc["config"]["dmx"]["timeout"]["description"] = "DMX signal timeout";
     
+    doc["config"]["dmx"]["interpolation"]["value"] = config->dmxInterpolation;
+    doc["config"]["dmx"]["interpolation"]["description"] = "Upsample DMX setpoints between frames";
+    
+    doc["config"]["dmx"]["interpDelayMs"]["value"] = config->dmxInterpDelayMs;
+    doc["config"]["dmx"]["interpDelayMs"]["min"] = 0;
+    doc["config"]["dmx"]["interpDelayMs"]["max"] = DMX_INTERP_MAX_DELAY_MS;
+    doc["config"]["dmx"]["interpDelayMs"]["units"] = "milliseconds";
+    doc["config"]["dmx"]["interpDelayMs"]["description"] = "Interpolation delay (0 = predict a frame ahead, >= frame interval = no prediction)";
+    
+    doc["config"]["dmx"]["personality"]["value"] = config->dmxPersonality;
+    doc["config"]["dmx"]["personality"]["min"] = 0;
+    doc["config"]["dmx"]["personality"]["max"] = DMX_PERSONALITY_SLOTS - 1;
+    doc["config"]["dmx"]["personality"]["description"] = "Channel layout (0-2 built in, 3-7 uploaded)";
+    
+    doc["config"]["dmx"]["input"]["value"] = config->dmxInput ? "network" : "uart";
+    doc["config"]["dmx"]["input"]["options"] = "uart, network";
+    doc["config"]["dmx"]["input"]["description"] = "DMX source: RS-485 or Art-Net/sACN over the WiFi AP";
+    
+    doc["config"]["dmx"]["universe"]["value"] = config->dmxUniverse;
+    doc["config"]["dmx"]["universe"]["min"] = 0;
+    doc["config"]["dmx"]["universe"]["max"] = DMX_NET_MAX_UNIVERSE;
+    doc["config"]["dmx"]["universe"]["description"] = "Network universe (Art-Net port address 0-32767, sACN 1-63999)";
+    
     // Safety configuration
     doc["config"]["safety"]["enableLimitSwitches"]["value"] = config->enableLimitSwitches;
     doc["config"]["safety"]["enableLimitSwitches"]["description"] = "Monitor limit switch inputs";
@@ -1799,6 +2855,12 @@ namespace SerialInterface {
     doc["config"]["safety"]["emergencyDeceleration"]["units"] = "steps/sec²";
     doc["config"]["safety"]["emergencyDeceleration"]["description"] = "Emergency stop deceleration rate";
     
+    doc["config"]["safety"]["limitFilterSamples"]["value"] = config->limitFilterSamples;
+    doc["config"]["safety"]["limitFilterSamples"]["min"] = 1;
+    doc["config"]["safety"]["limitFilterSamples"]["max"] = LIMIT_FILTER_MAX_SAMPLES;
+    doc["config"]["safety"]["limitFilterSamples"]["units"] = "samples";
+    doc["config"]["safety"]["limitFilterSamples"]["description"] = "Limit switch glitch filter samples, 50 us apart";
+    
     // System configuration
     doc["config"]["system"]["statusUpdateInterval"]["value"] = config->statusUpdateInterval;
     doc["config"]["system"]["statusUpdateInterval"]["min"] = 10;
@@ -1841,13 +2903,24 @@ namespace SerialInterface {
   bool sendHelp() {
     Serial.println("\n=== SkullStepperV4 Commands ===");
     Serial.println("Motion Commands:");
-    Serial.println("  MOVE <position>     - Move to absolute position");
+    Serial.println("  MOVE <position> [SCURVE|TRAP] - Move to absolute position");
+    Serial.println("                        Optional ramp shape overrides profileShape");
     Serial.println("  MOVEHOME            - Move to configured home position");
+    Serial.println("  PATH ADD <pos> [speed] - Queue a waypoint (blended with its neighbours)");
+    Serial.println("  PATH RUN            - Run queued waypoints (more can be added while running)");
+    Serial.println("  PATH CLEAR          - Drop waypoints, decelerating if a path is running");
+    Serial.println("  PATH                - Show waypoint queue");
+    Serial.println("  CUE PLAY <0-7>      - Play a stored keyframe cue (moves to its start first)");
+    Serial.println("  CUE DELETE <0-7>    - Erase a stored cue");
+    Serial.println("  CUE / CUE LIST      - List stored cues");
     Serial.println("  HOME                - Start auto-range homing sequence:");
     Serial.println("                        1. Find left limit & set as home (0)");
     Serial.println("                        2. Find right limit to determine range");
     Serial.println("                        3. Set operating bounds with safety margins");
     Serial.println("                        4. Move to center of detected range");
+    Serial.println("                        Two-speed when homingFastSpeed > homingSpeed");
+    Serial.println("                        With verifyHoming on, a matching left switch reuses the stored range");
+    Serial.println("  HOME FULL           - Homing with a full sweep of both switches (recalibrates)");
     Serial.println("  STOP                - Stop current motion");
     Serial.println("  ESTOP               - Emergency stop");
     Serial.println("  ENABLE              - Enable stepper motor");
@@ -1863,6 +2936,15 @@ namespace SerialInterface {
     Serial.println("                        Moves to 10 random positions");
     Serial.println("                        Press any key to stop");
     Serial.println("  DIAG ON/OFF         - Enable/disable step timing diagnostics");
+    Serial.println("  PROFILE             - Core 0 control loop cycles per zone and wake jitter");
+    Serial.println("  PROFILE RESET       - Clear the control loop profile");
+    Serial.println("  TRACE               - Motion trace summary and the newest events");
+    Serial.println("  TRACE DUMP          - Motion trace as a hex-encoded binary blob");
+    Serial.println("  TRACE CLEAR         - Clear the motion trace");
+    Serial.println("  LIMITS              - User position limits and operating range per axis");
+    Serial.println("  LIMITS <min> <max>  - Set and store user position limits");
+    Serial.println("  MOVE, MOVEHOME, HOME, STOP, SPEED, ACCEL and LIMITS take a trailing AXIS <n>");
+    Serial.println("                        (default axis 0), e.g. HOME FULL AXIS 1");
     Serial.println();
     Serial.println("Information Commands:");
     Serial.println("  STATUS              - Show system status");
@@ -1879,6 +2961,9 @@ namespace SerialInterface {
     Serial.println();
     Serial.println("JSON Commands:");
     Serial.println("  {\"command\":\"move\",\"position\":1000}");
+    Serial.println("  {\"command\":\"path\",\"waypoints\":[{\"position\":1000,\"speed\":2000}],\"run\":true}");
+    Serial.println("  {\"command\":\"cue\",\"action\":\"upload\",\"id\":0,\"keyframes\":[[0,1000,0],[800,4000,0]]}");
+    Serial.println("      [timeMs, position, velocity]; \"append\" adds keyframes, \"loop\":true repeats");
     Serial.println("  {\"command\":\"status\"}");
     Serial.println("  {\"command\":\"config\",\"get\":\"all\"}");
     Serial.println("  {\"command\":\"config\",\"set\":{\"maxSpeed\":2000}}");
@@ -1887,6 +2972,7 @@ namespace SerialInterface {
     Serial.println();
     Serial.println("Examples:");
     Serial.println("  MOVE 1000           - Move to position 1000");
+    Serial.println("  MOVE 1000 SCURVE    - Jerk-limited move to position 1000");
     Serial.println("  CONFIG SET maxSpeed 2000 - Set max speed");
     Serial.println("===============================\n");
     
@@ -1903,9 +2989,14 @@ namespace SerialInterface {
     Serial.println("  deceleration        Range: 0-20000 steps/sec²   Default: 500");
     Serial.println("                      (Currently uses same value as acceleration)");
     Serial.println("  jerk                Range: 0-50000 steps/sec³   Default: 1000");
-    Serial.println("                      Jerk limitation (future use)");
+    Serial.println("                      Jerk limit for S-curve moves");
+    Serial.println("  profileShape        Values: TRAPEZOIDAL, SCURVE Default: TRAPEZOIDAL");
+    Serial.println("                      Ramp shape used when a move does not specify one");
     Serial.println("  homingSpeed         Range: 0-10000 steps/sec    Default: 940");
     Serial.println("                      Speed used during homing sequence");
+    Serial.println("  homingFastSpeed     Range: 0-10000 steps/sec    Default: 0 (off)");
+    Serial.println("                      Two-speed homing: fast approach, then slow");
+    Serial.println("                      re-approach at homingSpeed for the reference");
     Serial.println("  limitSafetyMargin   Range: 0-1000 steps          Default: 400");
     Serial.println("                      Distance to stay away from limit switches");
     Serial.println("  homePositionPercent Range: 0-100 %              Default: 50");
@@ -1914,6 +3005,14 @@ namespace SerialInterface {
     Serial.println("                      Automatically home on system startup");
     Serial.println("  autoHomeOnEstop     Boolean: true/false         Default: false");
     Serial.println("                      Automatically home after E-stop/limit fault");
+    Serial.println("  verifyHoming        Boolean: true/false         Default: false");
+    Serial.println("                      Home on the left switch only and check it against");
+    Serial.println("                      the stored range; full sweep on mismatch");
+    
+    Serial.println("\nSafety Parameters:");
+    Serial.println("  limitFilterSamples  Range: 1-32                 Default: 8");
+    Serial.println("                      Limit switch samples (50 us apart) that must agree");
+    Serial.println("                      before a switch edge stops the motor");
     
     Serial.println("\nDMX Parameters:");
     Serial.println("  dmxStartChannel     Range: 1-512                Default: 1");
@@ -1924,6 +3023,17 @@ namespace SerialInterface {
     Serial.println("  dmxOffset           Range: Any integer          Default: 0");
     Serial.println("                      Position offset in steps");
     Serial.println("                      Final position = (DMX × scale) + offset");
+    Serial.println("  dmxInterpolation    Boolean: true/false         Default: true");
+    Serial.println("                      Upsample DMX setpoints between frames");
+    Serial.println("  dmxInterpDelayMs    Range: 0-100                Default: 10");
+    Serial.println("                      Interpolation delay: 0 predicts a frame ahead (least");
+    Serial.println("                      lag), one frame interval or more never overshoots");
+    Serial.println("  dmxPersonality      Range: 0-7                  Default: 0");
+    Serial.println("                      Channel layout (see DMX PERSONALITY)");
+    Serial.println("  dmxInput            Values: uart, network       Default: uart");
+    Serial.println("                      RS-485 or Art-Net/sACN over the WiFi AP (see DMX NET)");
+    Serial.println("  dmxUniverse         Range: 0-63999              Default: 1");
+    Serial.println("                      Network universe (Art-Net 0-32767, sACN 1-63999)");
     
     Serial.println("\nSystem Parameters:");
     Serial.println("  verbosity           Range: 0-3                  Default: 2");
@@ -1933,12 +3043,17 @@ namespace SerialInterface {
     Serial.println("  CONFIG SET maxSpeed 2000        # Set max speed to 2000 steps/sec");
     Serial.println("  CONFIG SET acceleration 1500    # Set acceleration to 1500 steps/sec²");
     Serial.println("  CONFIG SET homingSpeed 1500     # Set homing speed to 1500 steps/sec");
+    Serial.println("  CONFIG SET homingFastSpeed 5000 # Approach switches at 5000, re-approach at homingSpeed");
     Serial.println("  CONFIG SET homePositionPercent 75  # Return to 75% of range after homing");
     Serial.println("  CONFIG SET autoHomeOnBoot true  # Enable auto-homing on startup");
     Serial.println("  CONFIG SET autoHomeOnEstop on   # Enable auto-homing after E-stop");
     Serial.println("  CONFIG SET dmxStartChannel 10   # Monitor DMX channel 10");
     Serial.println("  CONFIG SET dmxScale 5.0         # 5 steps per DMX unit");
     Serial.println("  CONFIG SET dmxOffset 1000       # Add 1000 steps offset");
+    Serial.println("  CONFIG SET dmxInterpDelayMs 25  # Interpolate one 40Hz frame behind");
+    Serial.println("  CONFIG SET dmxPersonality 1     # 16-bit position on the standard layout");
+    Serial.println("  CONFIG SET dmxInput network     # Take DMX from Art-Net/sACN");
+    Serial.println("  CONFIG SET dmxUniverse 3        # Listen to network universe 3");
     
     Serial.println("\nReset Commands:");
     Serial.println("  CONFIG RESET <parameter>        # Reset single parameter");
@@ -1956,6 +3071,113 @@ namespace SerialInterface {
   // Motion Command Functions
   // ----------------------------------------------------------------------------
   
+  bool sendProfile() {
+    if (g_jsonMode) {
+      StaticJsonDocument<1536> doc;
+      LoopProfiler::exportJson(doc.to<JsonObject>());
+      serializeJson(doc, Serial);
+      Serial.println();
+      return true;
+    }
+    
+    uint32_t cyclesPerUs = LoopProfiler::cyclesPerMicrosecond();
+    Serial.println("\n=== Control Loop Profile (Core 0) ===");
+#ifdef ENABLE_LOOP_PROFILER
+    Serial.printf("CPU cycles at %lu MHz (p99 within 25%%)\n", cyclesPerUs);
+    Serial.println("Zone        Count       Min       Avg       P99       Max   Max(us)");
+    for (uint8_t i = 0; i < LoopProfiler::ZONE_COUNT; i++) {
+      LoopProfiler::Zone zone = (LoopProfiler::Zone)i;
+      LoopProfiler::Stats stats;
+      if (!LoopProfiler::getZoneStats(zone, stats)) {
+        Serial.printf("%-10s  (no samples)\n", LoopProfiler::zoneName(zone));
+        continue;
+      }
+      Serial.printf("%-10s %6lu %9lu %9lu %9lu %9lu %9lu\n", LoopProfiler::zoneName(zone),
+                    stats.count, stats.min, stats.avg, stats.p99, stats.max,
+                    stats.max / cyclesPerUs);
+    }
+    
+    LoopProfiler::Stats jitter;
+    if (LoopProfiler::getJitterStats(jitter)) {
+      Serial.printf("Wake jitter vs %dms period: min %lu us, avg %lu us, p99 %lu us, max %lu us (%lu wakes)\n",
+                    STEPPER_TASK_ACTIVE_MS, jitter.min, jitter.avg, jitter.p99, jitter.max, jitter.count);
+    } else {
+      Serial.println("Wake jitter: no timed wake-ups yet (motor idle)");
+    }
+#else
+    Serial.println("Profiler disabled (ENABLE_LOOP_PROFILER in ProjectConfig.h)");
+#endif
+    return true;
+  }
+  
+  bool sendTrace() {
+    MotionTrace::Summary summary;
+    MotionTrace::getSummary(summary);
+    
+    Serial.println("\n=== Motion Trace ===");
+#ifdef ENABLE_MOTION_TRACE
+    Serial.printf("%d/%d events held, %lu recorded, %lu overwritten\n",
+                  summary.held, summary.capacity, summary.recorded, summary.overwritten);
+    
+    uint8_t* blob = (uint8_t*)malloc(MotionTrace::maxDumpSize());
+    if (blob == nullptr) {
+      sendError("Not enough memory for the trace");
+      return false;
+    }
+    MotionTrace::dump(blob, MotionTrace::maxDumpSize());
+    uint16_t count = blob[6] | (blob[7] << 8);
+    uint32_t dumpUs = blob[8] | (blob[9] << 8) | (blob[10] << 16) | ((uint32_t)blob[11] << 24);
+    
+    // Newest events, oldest of them first, timed back from now
+    const uint16_t SHOWN = 16;
+    uint16_t first = (count > SHOWN) ? count - SHOWN : 0;
+    if (count > 0) {
+      Serial.println("    Age(ms)  Event          Arg     Id       Value");
+    }
+    for (uint16_t i = first; i < count; i++) {
+      const uint8_t* e = blob + TRACE_HEADER_SIZE + i * sizeof(MotionTrace::Record);
+      uint32_t timeUs = e[0] | (e[1] << 8) | (e[2] << 16) | ((uint32_t)e[3] << 24);
+      int32_t value = (int32_t)(e[8] | (e[9] << 8) | (e[10] << 16) | ((uint32_t)e[11] << 24));
+      Serial.printf("%11.1f  %-13s %4d %6d %11ld\n",
+                    (dumpUs - timeUs) / 1000.0f, MotionTrace::eventName((MotionTrace::Event)e[4]),
+                    e[5], e[6] | (e[7] << 8), (long)value);
+    }
+    free(blob);
+#else
+    Serial.println("Trace disabled (ENABLE_MOTION_TRACE in ProjectConfig.h)");
+#endif
+    return true;
+  }
+  
+  bool sendTraceDump() {
+    uint8_t* blob = (uint8_t*)malloc(MotionTrace::maxDumpSize());
+    if (blob == nullptr) {
+      sendError("Not enough memory for the trace");
+      return false;
+    }
+    size_t length = MotionTrace::dump(blob, MotionTrace::maxDumpSize());
+    
+    // Hex keeps the blob console-safe; format documented in MotionTrace.h
+    if (g_jsonMode) {
+      Serial.print("{\"trace\":\"");
+      for (size_t i = 0; i < length; i++) {
+        Serial.printf("%02x", blob[i]);
+      }
+      Serial.println("\"}");
+    } else {
+      Serial.printf("TRACE BEGIN %u\n", (unsigned int)length);
+      for (size_t i = 0; i < length; i++) {
+        Serial.printf("%02x", blob[i]);
+        if ((i % 32) == 31 || i == length - 1) {
+          Serial.println();
+        }
+      }
+      Serial.println("TRACE END");
+    }
+    free(blob);
+    return true;
+  }
+  
   bool sendMotionCommand(const MotionCommand& cmd) {
     if (g_motionCommandQueue == NULL) {
       sendError("Motion command queue not available");
@@ -1965,14 +3187,16 @@ namespace SerialInterface {
     // Check for limit fault before queuing motion commands
     if (StepperController::isLimitFaultActive() && 
         (cmd.type == CommandType::MOVE_ABSOLUTE || 
-         cmd.type == CommandType::MOVE_RELATIVE)) {
+         cmd.type == CommandType::MOVE_RELATIVE ||
+         cmd.type == CommandType::PATH_APPEND ||
+         cmd.type == CommandType::PATH_START)) {
       // Don't spam the queue with commands that will be rejected
       // The StepperController will log the rejection once
       return false;
     }
     
     // Try to send command to queue (non-blocking)
-    if (xQueueSend(g_motionCommandQueue, &cmd, 0) == pdTRUE) {
+    if (StepperController::queueMotionCommand(cmd)) {
       sendInfo("Motion command queued");
       return true;
     } else {
@@ -1994,7 +3218,7 @@ namespace SerialInterface {
     }
     
     // Override target position if specified
-    if (target != 0 || type == CommandType::MOVE_ABSOLUTE) {
+    if (target != 0 || type == CommandType::MOVE_ABSOLUTE || type == CommandType::PATH_APPEND) {
       cmd.profile.targetPosition = target;
     }
     
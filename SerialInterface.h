@@ -126,6 +126,24 @@ namespace SerialInterface {
    */
   bool sendParameterList();
   
+  /**
+   * Send the Core 0 control loop profile (per-zone cycles and wake jitter)
+   * @return true if profile sent
+   */
+  bool sendProfile();
+  
+  /**
+   * Send the motion trace summary and the newest events as text
+   * @return true if trace sent
+   */
+  bool sendTrace();
+  
+  /**
+   * Send the motion trace binary blob, hex encoded (TRACE BEGIN/END framing)
+   * @return true if trace sent
+   */
+  bool sendTraceDump();
+  
   // ----------------------------------------------------------------------------
   // Motion Command Functions
   // ----------------------------------------------------------------------------
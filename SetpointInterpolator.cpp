@@ -0,0 +1,209 @@
+// ============================================================================
+// File: SetpointInterpolator.cpp
+// Project: SkullStepperV4 - ESP32-S3 Modular Stepper Control System
+// Version: 4.2.0
+// Date: 2026-10-15
+// Author: Tim Rosener
+// Description: Predictive setpoint upsampling implementation
+// License: MIT
+// ============================================================================
+
+#include "SetpointInterpolator.h"
+#include <math.h>
+
+namespace SetpointInterpolator {
+
+// ============================================================================
+// History
+// ============================================================================
+
+/**
+ * Sample by age order (0 = oldest)
+ */
+static const Sample& historyAt(const State& state, uint8_t index) {
+    return state.history[(state.head + index) % HISTORY_SIZE];
+}
+
+static const Sample& newest(const State& state) {
+    return historyAt(state, state.count - 1);
+}
+
+/**
+ * Append a sample, dropping the oldest when the history is full
+ */
+static void push(State& state, int32_t position, uint32_t timeMs) {
+    if (state.count == HISTORY_SIZE) {
+        state.head = (state.head + 1) % HISTORY_SIZE;
+        state.count--;
+    }
+    Sample& slot = state.history[(state.head + state.count) % HISTORY_SIZE];
+    slot.position = position;
+    slot.timeMs = timeMs;
+    state.count++;
+}
+
+/**
+ * Least-squares setpoint rate and average frame interval over the history
+ */
+static void fit(State& state) {
+    state.velocity = 0.0f;
+    state.intervalMs = 0;
+    if (state.count < 2) {
+        return;
+    }
+
+    // Times and positions relative to the newest frame keep the sums small
+    const Sample& last = newest(state);
+    float meanT = 0.0f;
+    float meanP = 0.0f;
+    for (uint8_t i = 0; i < state.count; i++) {
+        meanT += (int32_t)(historyAt(state, i).timeMs - last.timeMs);
+        meanP += historyAt(state, i).position - last.position;
+    }
+    meanT /= state.count;
+    meanP /= state.count;
+
+    float sxx = 0.0f;
+    float sxy = 0.0f;
+    for (uint8_t i = 0; i < state.count; i++) {
+        float t = (int32_t)(historyAt(state, i).timeMs - last.timeMs) - meanT;
+        float p = (historyAt(state, i).position - last.position) - meanP;
+        sxx += t * t;
+        sxy += t * p;
+    }
+    if (sxx > 0.0f) {
+        state.velocity = sxy / sxx * 1000.0f;
+    }
+    state.intervalMs = (last.timeMs - historyAt(state, 0).timeMs) / (state.count - 1);
+}
+
+// ============================================================================
+// Output
+// ============================================================================
+
+/**
+ * How far past the newest frame the rate is extrapolated (ms)
+ */
+static int32_t predictionHorizon(const State& state) {
+    uint32_t horizon = state.intervalMs * MAX_PREDICTION_FRAMES;
+    return (int32_t)((horizon < STALE_MS) ? horizon : STALE_MS);
+}
+
+/**
+ * Delayed setpoint at a time, before blending
+ */
+static float model(const State& state, uint32_t nowMs) {
+    const Sample& last = newest(state);
+    int32_t age = (int32_t)(nowMs - last.timeMs);
+    if (age > (int32_t)STALE_MS) {
+        return (float)last.position;  // Stream stopped - no more prediction
+    }
+
+    // Past the newest frame: predict with the fitted rate
+    int32_t t = age - (int32_t)state.delayMs;
+    if (t >= 0) {
+        int32_t ahead = (t < predictionHorizon(state)) ? t : predictionHorizon(state);
+        return last.position + state.velocity * ahead / 1000.0f;
+    }
+
+    // Inside the received frames: straight line between the two around t
+    for (uint8_t i = state.count - 1; i > 0; i--) {
+        const Sample& a = historyAt(state, i - 1);
+        const Sample& b = historyAt(state, i);
+        int32_t ta = (int32_t)(a.timeMs - last.timeMs);
+        if (t >= ta) {
+            int32_t tb = (int32_t)(b.timeMs - last.timeMs);
+            float f = (tb > ta) ? (float)(t - ta) / (tb - ta) : 1.0f;
+            return a.position + f * (b.position - a.position);
+        }
+    }
+    return (float)historyAt(state, 0).position;
+}
+
+/**
+ * Part of the last correction still applied at a time
+ */
+static float blend(const State& state, uint32_t nowMs) {
+    if (state.blendOffset == 0.0f || state.intervalMs == 0) {
+        return 0.0f;
+    }
+    int32_t elapsed = (int32_t)(nowMs - state.blendStartMs);
+    if (elapsed <= 0) {
+        return state.blendOffset;
+    }
+    if (elapsed >= (int32_t)state.intervalMs) {
+        return 0.0f;
+    }
+    return state.blendOffset * (1.0f - (float)elapsed / state.intervalMs);
+}
+
+// ============================================================================
+// Interface
+// ============================================================================
+
+void reset(State& state) {
+    state.head = 0;
+    state.count = 0;
+    state.velocity = 0.0f;
+    state.intervalMs = 0;
+    state.blendOffset = 0.0f;
+    state.blendStartMs = 0;
+}
+
+void addSample(State& state, int32_t position, uint32_t timeMs, uint32_t delayMs) {
+    if (delayMs > MAX_DELAY_MS) {
+        delayMs = MAX_DELAY_MS;
+    }
+
+    // First frame, or the first after a pause - nothing to predict from
+    if (state.count == 0 || (int32_t)(timeMs - newest(state).timeMs) > (int32_t)STALE_MS) {
+        reset(state);
+        push(state, position, timeMs);
+        state.delayMs = delayMs;
+        return;
+    }
+
+    // What was being output when this frame arrived
+    float before = model(state, timeMs) + blend(state, timeMs);
+
+    const Sample& last = newest(state);
+    if (timeMs == last.timeMs) {
+        // Two frames in the same millisecond - the later one wins
+        state.history[(state.head + state.count - 1) % HISTORY_SIZE].position = position;
+    } else {
+        if (position == last.position) {
+            // Held setpoint - the motion before the hold says nothing about now
+            Sample held = last;
+            state.head = 0;
+            state.count = 1;
+            state.history[0] = held;
+        }
+        push(state, position, timeMs);
+    }
+    state.delayMs = delayMs;
+    fit(state);
+
+    // Blend the step between the old and new estimate out over one frame
+    state.blendOffset = before - model(state, timeMs);
+    state.blendStartMs = timeMs;
+}
+
+int32_t sample(const State& state, uint32_t nowMs) {
+    if (state.count == 0) {
+        return 0;
+    }
+    return (int32_t)lroundf(model(state, nowMs) + blend(state, nowMs));
+}
+
+float velocity(const State& state, uint32_t nowMs) {
+    if (state.count < 2) {
+        return 0.0f;
+    }
+    int32_t age = (int32_t)(nowMs - newest(state).timeMs);
+    if (age > (int32_t)STALE_MS || age - (int32_t)state.delayMs > predictionHorizon(state)) {
+        return 0.0f;
+    }
+    return state.velocity;
+}
+
+} // namespace SetpointInterpolator
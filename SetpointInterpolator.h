@@ -0,0 +1,108 @@
+// ============================================================================
+// File: SetpointInterpolator.h
+// Project: SkullStepperV4 - ESP32-S3 Modular Stepper Control System
+// Version: 4.2.0
+// Date: 2026-10-15
+// Author: Tim Rosener
+// Description: Predictive upsampling of streamed setpoints (DMX follow mode)
+// License: MIT
+//
+// DMX delivers a new setpoint every 23-44 ms; the stepper task runs every
+// 2 ms while following. The interpolator keeps the last few setpoints with
+// their frame times, fits the setpoint rate over them, and answers "where
+// is the setpoint now" at any time in between:
+// - The output is the setpoint stream delayed by delayMs. Inside the
+//   received frames it interpolates between them; past the newest frame it
+//   predicts with the fitted rate, for at most MAX_PREDICTION_FRAMES frame
+//   intervals
+// - delayMs trades latency for prediction: 0 predicts a whole frame ahead
+//   (least lag, overshoots a little when a fade stops); one frame interval
+//   or more only interpolates (no overshoot, one frame of extra lag)
+// - When a frame disagrees with what was being predicted, the difference
+//   is blended out over one frame interval instead of jumping
+//
+// Pure computation - no hardware, no RTOS. Owned by the Core 0 task.
+// ============================================================================
+
+#ifndef SETPOINTINTERPOLATOR_H
+#define SETPOINTINTERPOLATOR_H
+
+#include <stdint.h>
+#include "HardwareConfig.h"
+
+// ============================================================================
+// SetpointInterpolator Namespace - Streamed Setpoint Upsampling
+// ============================================================================
+
+namespace SetpointInterpolator {
+
+    // ------------------------------------------------------------------------
+    // Constants
+    // ------------------------------------------------------------------------
+
+    const uint8_t HISTORY_SIZE = 4;            // Frames in the rate fit
+    const uint8_t MAX_PREDICTION_FRAMES = 2;   // Prediction horizon past the newest frame
+    const uint32_t STALE_MS = 150;             // No frame for this long = setpoint at rest
+    const uint32_t MAX_DELAY_MS = DMX_INTERP_MAX_DELAY_MS;  // Upper bound for delayMs
+
+    // ------------------------------------------------------------------------
+    // Types
+    // ------------------------------------------------------------------------
+
+    /**
+     * One received setpoint
+     */
+    struct Sample {
+        int32_t position;
+        uint32_t timeMs;
+    };
+
+    /**
+     * Interpolator state for one setpoint stream
+     */
+    struct State {
+        Sample history[HISTORY_SIZE];  // Ring, oldest first from head
+        uint8_t head;
+        uint8_t count;
+        uint32_t delayMs;              // Output delay behind the newest frames
+        float velocity;                // Fitted setpoint rate (steps/sec), 0 while held
+        uint32_t intervalMs;           // Average frame interval (0 = unknown)
+        float blendOffset;             // Output correction still being blended out (steps)
+        uint32_t blendStartMs;
+    };
+
+    // ------------------------------------------------------------------------
+    // Interface
+    // ------------------------------------------------------------------------
+
+    /**
+     * Forget the stream (the next sample starts a fresh one)
+     */
+    void reset(State& state);
+
+    /**
+     * Take a new setpoint
+     * A sample after STALE_MS without one starts a fresh stream; a repeated
+     * setpoint is a hold and stops the prediction at once
+     * @param position Setpoint (steps)
+     * @param timeMs Frame time (ms)
+     * @param delayMs Output delay (0 to MAX_DELAY_MS)
+     */
+    void addSample(State& state, int32_t position, uint32_t timeMs, uint32_t delayMs);
+
+    /**
+     * Interpolated setpoint at a time
+     * @param nowMs Current time (ms)
+     * @return setpoint (steps); the newest setpoint once the stream is stale
+     */
+    int32_t sample(const State& state, uint32_t nowMs);
+
+    /**
+     * Setpoint rate for feed-forward at a time
+     * @return steps/sec, 0 while held, stale or past the prediction horizon
+     */
+    float velocity(const State& state, uint32_t nowMs);
+
+} // namespace SetpointInterpolator
+
+#endif // SETPOINTINTERPOLATOR_H
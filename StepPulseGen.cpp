@@ -0,0 +1,359 @@
+// ============================================================================
+// File: StepPulseGen.cpp
+// Project: SkullStepperV4 - ESP32-S3 Modular Stepper Control System
+// Version: 4.2.0
+// Date: 2026-10-15
+// Author: Tim Rosener
+// Description: Step pulse block generator implementation
+// License: MIT
+// ============================================================================
+
+#include "StepPulseGen.h"
+#include <math.h>
+#include <stdlib.h>
+
+namespace StepPulseGen {
+
+// Shortest step period the hardware accepts (MAX_STEP_FREQUENCY)
+static const uint32_t MIN_PERIOD_TICKS = MIN_STEP_PERIOD * TICKS_PER_US;
+static const uint32_t MIN_HIGH_TICKS = MIN_STEP_PULSE_WIDTH * TICKS_PER_US;
+static const uint32_t MAX_PERIOD_TICKS = 0xFFFFFFFFUL / 2;
+
+// ============================================================================
+// Block Building
+// ============================================================================
+
+/**
+ * Append a low-only symbol of up to 2 * MAX_DURATION ticks
+ * Never leaves a 1-tick remainder (a zero half would end the transmission)
+ * @return ticks consumed
+ */
+static uint32_t appendPause(Block& block, uint32_t ticks, uint32_t period) {
+    uint32_t take = ticks;
+    if (take > 2UL * MAX_DURATION) {
+        take = 2UL * MAX_DURATION;
+    }
+    if (ticks - take == 1) {
+        take--;
+    }
+    uint16_t first = (uint16_t)(take / 2);
+    block.symbols[block.count] = makeSymbol(first, false, (uint16_t)(take - first), false);
+    block.startTicks[block.count] = block.durationTicks;
+    block.periodTicks[block.count] = period;
+    block.count++;
+    block.durationTicks += take;
+    return take;
+}
+
+/**
+ * Append one step: high for a quarter of the period, low for the rest
+ * Low time beyond one symbol is owed as pause symbols (pendingLow)
+ */
+static void appendPulse(Generator& gen, Block& block, int8_t direction, uint32_t period) {
+    if (period < MIN_PERIOD_TICKS) {
+        period = MIN_PERIOD_TICKS;
+    }
+    uint32_t high = RMT_PULSE_WIDTH_FROM_PERIOD(period);
+    if (high < MIN_HIGH_TICKS) {
+        high = MIN_HIGH_TICKS;
+    }
+    if (high > MAX_DURATION) {
+        high = MAX_DURATION;
+    }
+    uint32_t low = period - high;
+    uint32_t first = low;
+    if (first > MAX_DURATION) {
+        first = (low - MAX_DURATION == 1) ? MAX_DURATION - 1 : MAX_DURATION;
+    }
+
+    block.symbols[block.count] = makeSymbol((uint16_t)high, true, (uint16_t)first, false);
+    block.startTicks[block.count] = block.durationTicks;
+    block.periodTicks[block.count] = period;
+    block.count++;
+    block.steps++;
+    block.direction = direction;
+    block.durationTicks += high + first;
+
+    gen.pendingLow = low - first;
+    gen.pendingPeriod = period;
+    gen.direction = direction;
+    gen.position += direction;
+}
+
+// ============================================================================
+// Ramp Generator
+// ============================================================================
+
+/**
+ * Direction of the next ramp step (0 if the ramp is finished)
+ */
+static int8_t rampDirection(const Generator& gen) {
+    if (gen.speed > 0.0f) return 1;
+    if (gen.speed < 0.0f) return -1;
+    if (gen.target > gen.position) return 1;
+    if (gen.target < gen.position) return -1;
+    return 0;
+}
+
+/**
+ * Advance the ramp by one step
+ * Speed changes per step by v² ± 2a (constant acceleration over one step);
+ * the period comes from the mean speed across the step, with the sub-tick
+ * remainder carried to the next step
+ * @return false if the ramp has finished (no step)
+ */
+static bool nextRampStep(Generator& gen, int8_t& direction, uint32_t& period) {
+    int32_t distance = gen.target - gen.position;
+    float v = fabsf(gen.speed);
+    if (distance == 0 && v == 0.0f) {
+        gen.rampActive = false;
+        gen.rampState = 0;
+        return false;
+    }
+
+    float twoA = 2.0f * gen.accel;
+    float v2 = v * v;
+    float vMax2 = gen.maxSpeed * gen.maxSpeed;
+    float next2;
+    direction = rampDirection(gen);
+    int8_t toward = (distance > 0) ? 1 : -1;
+
+    if (distance == 0 || direction != toward) {
+        // Wrong way (retarget or overshoot) - brake, the turn follows at standstill
+        next2 = v2 - twoA;
+        gen.rampState = RAMP_STATE_DECELERATING_FLAG;
+    } else {
+        float after = (float)(abs(distance) - 1);  // Steps left once this one is taken
+        float faster2 = fminf(v2 + twoA, vMax2);
+        if (v2 <= vMax2 && faster2 <= twoA * after) {
+            next2 = faster2;
+            gen.rampState = (faster2 > v2) ? RAMP_STATE_ACCELERATING_FLAG : 0;
+        } else if (v2 <= vMax2 && v2 <= twoA * after) {
+            next2 = v2;
+            gen.rampState = 0;  // Coasting
+        } else {
+            // Inside the stopping distance, or above a lowered speed limit
+            next2 = v2 - twoA;
+            if (v2 > vMax2 && v2 <= twoA * after && next2 < vMax2) {
+                next2 = vMax2;
+            }
+            gen.rampState = RAMP_STATE_DECELERATING_FLAG;
+        }
+        if (after == 0.0f) {
+            next2 = 0.0f;
+        }
+    }
+    float next = (next2 > 0.0f) ? sqrtf(next2) : 0.0f;
+
+    // A single step from or to standstill takes sqrt(2/a)
+    float mean = fmaxf((v + next) * 0.5f, fminf(sqrtf(gen.accel * 0.5f), gen.maxSpeed));
+    float exact = (float)TICKS_PER_SECOND / mean + gen.tickCarry;
+    if (exact > (float)MAX_PERIOD_TICKS) {
+        exact = (float)MAX_PERIOD_TICKS;
+    }
+    period = (uint32_t)exact;
+    gen.tickCarry = exact - (float)period;
+    gen.speed = direction * next;
+    return true;
+}
+
+// ============================================================================
+// Raw Commands
+// ============================================================================
+
+/**
+ * Convert a raw command duration to RMT ticks, carrying the remainder
+ */
+static uint32_t rawToTicks(Generator& gen, uint32_t rawTicks) {
+    uint64_t scaled = (uint64_t)rawTicks * TICKS_PER_SECOND + gen.rawCarry;
+    gen.rawCarry = (uint32_t)(scaled % TICKS_PER_S);
+    return (uint32_t)(scaled / TICKS_PER_S);
+}
+
+/**
+ * Direction of the next raw step (0 for a pause entry or an empty queue)
+ */
+static int8_t rawDirection(const Generator& gen) {
+    if (gen.queueCount == 0) return 0;
+    const stepper_command_s& entry = gen.queue[gen.queueHead];
+    if (entry.steps == 0) return 0;
+    return entry.count_up ? 1 : -1;
+}
+
+static void popEntry(Generator& gen) {
+    gen.queueHead = (gen.queueHead + 1) % RAW_QUEUE_LENGTH;
+    gen.queueCount--;
+    gen.entryStepsDone = 0;
+}
+
+// ============================================================================
+// Generator
+// ============================================================================
+
+void reset(Generator& gen, int32_t position) {
+    gen.position = position;
+    gen.target = position;
+    gen.speed = 0.0f;
+    gen.rampActive = false;
+    gen.rampState = 0;
+    gen.queueHead = 0;
+    gen.queueCount = 0;
+    gen.entryStepsDone = 0;
+    gen.queueEnd = position;
+    gen.direction = 0;
+    gen.tickCarry = 0.0f;
+    gen.rawCarry = 0;
+    gen.pendingLow = 0;
+    gen.pendingPeriod = 0;
+}
+
+void moveTo(Generator& gen, int32_t target) {
+    // The ramp takes over from a stream at the stream's current speed
+    gen.queueCount = 0;
+    gen.entryStepsDone = 0;
+    gen.target = target;
+    gen.rampActive = true;
+}
+
+void stopMove(Generator& gen) {
+    if (gen.queueCount > 0) {
+        // A stream stops where it is (as ODStepper drops its queue)
+        gen.queueCount = 0;
+        gen.entryStepsDone = 0;
+        gen.speed = 0.0f;
+        return;
+    }
+    if (!gen.rampActive) {
+        return;
+    }
+    int32_t stopDistance = (int32_t)ceilf(gen.speed * gen.speed / (2.0f * gen.accel));
+    gen.target = gen.position + (gen.speed >= 0.0f ? stopDistance : -stopDistance);
+}
+
+void shiftPosition(Generator& gen, int32_t delta) {
+    gen.position += delta;
+    gen.target += delta;
+    gen.queueEnd += delta;
+}
+
+int8_t addQueueEntry(Generator& gen, const stepper_command_s& cmd) {
+    if (gen.rampActive) return AQE_ERROR_RAMP_ACTIVE;
+    if (gen.queueCount >= RAW_QUEUE_LENGTH) return AQE_QUEUE_FULL;
+    if (gen.queueCount == 0) {
+        gen.queueEnd = gen.position;
+        gen.entryStepsDone = 0;
+    }
+    gen.queue[(gen.queueHead + gen.queueCount) % RAW_QUEUE_LENGTH] = cmd;
+    gen.queueCount++;
+    gen.queueEnd += cmd.count_up ? cmd.steps : -cmd.steps;
+    return AQE_OK;
+}
+
+bool hasWork(const Generator& gen) {
+    return gen.rampActive || gen.queueCount > 0 || gen.pendingLow > 1;
+}
+
+bool fillBlock(Generator& gen, Block& block) {
+    static const uint32_t maxTicks = RMT_BLOCK_MAX_US * TICKS_PER_US;
+    static const uint32_t setupTicks = RMT_DIR_SETUP_US * TICKS_PER_US;
+
+    block.count = 0;
+    block.steps = 0;
+    block.direction = 0;
+    block.durationTicks = 0;
+
+    while (block.count < RMT_BLOCK_SYMBOLS && block.durationTicks < maxTicks) {
+        // Low time owed by a long period or a raw pause (capped to the block)
+        if (gen.pendingLow > 1) {
+            uint32_t room = maxTicks - block.durationTicks;
+            uint32_t ticks = gen.pendingLow;
+            if (ticks > room && room >= 2 && ticks - room != 1) {
+                ticks = room;
+            }
+            gen.pendingLow -= appendPause(block, ticks, gen.pendingPeriod);
+            continue;
+        }
+
+        int8_t direction;
+        if (gen.rampActive) {
+            direction = rampDirection(gen);
+        } else if (gen.queueCount > 0) {
+            direction = rawDirection(gen);
+            if (direction == 0) {
+                // Pause entry
+                gen.pendingLow += rawToTicks(gen, gen.queue[gen.queueHead].ticks);
+                gen.pendingPeriod = 0;
+                gen.speed = 0.0f;
+                popEntry(gen);
+                continue;
+            }
+        } else {
+            // Idle - a raw stream has run out
+            gen.speed = 0.0f;
+            gen.rampState = 0;
+            gen.pendingLow = 0;
+            break;
+        }
+
+        if (direction != 0) {
+            if (block.direction != 0 && direction != block.direction) {
+                break;  // Reversal - the next block sets DIR first
+            }
+            if (block.steps == 0 && direction != gen.direction && block.durationTicks < setupTicks) {
+                // DIR changes as this block starts - hold STEP low while it settles
+                if (block.count >= RMT_BLOCK_SYMBOLS - 1) {
+                    break;
+                }
+                uint32_t setup = setupTicks - block.durationTicks;
+                appendPause(block, setup < 2 ? 2 : setup, 0);
+            }
+        }
+
+        uint32_t period;
+        if (gen.rampActive) {
+            if (!nextRampStep(gen, direction, period)) {
+                continue;  // Ramp finished - idle next time round
+            }
+        } else {
+            const stepper_command_s& entry = gen.queue[gen.queueHead];
+            period = rawToTicks(gen, entry.ticks);
+            gen.speed = (period > 0) ? direction * (float)TICKS_PER_SECOND / period : 0.0f;
+            if (++gen.entryStepsDone >= entry.steps) {
+                popEntry(gen);
+            }
+        }
+        // Any 1-tick leftover of a raw pause joins this step
+        period += gen.pendingLow;
+        gen.pendingLow = 0;
+        appendPulse(gen, block, direction, period);
+    }
+
+    return block.count > 0;
+}
+
+// ============================================================================
+// Block Playback
+// ============================================================================
+
+uint16_t stepsStarted(const Block& block, uint32_t elapsedTicks) {
+    uint16_t steps = 0;
+    for (uint16_t i = 0; i < block.count && block.startTicks[i] <= elapsedTicks; i++) {
+        if (isPulse(block.symbols[i])) {
+            steps++;
+        }
+    }
+    return steps;
+}
+
+uint32_t periodAt(const Block& block, uint32_t elapsedTicks) {
+    if (block.count == 0 || elapsedTicks >= block.durationTicks) {
+        return 0;
+    }
+    uint16_t i = 0;
+    while (i + 1 < block.count && block.startTicks[i + 1] <= elapsedTicks) {
+        i++;
+    }
+    return block.periodTicks[i];
+}
+
+} // namespace StepPulseGen
@@ -0,0 +1,182 @@
+// ============================================================================
+// File: StepPulseGen.h
+// Project: SkullStepperV4 - ESP32-S3 Modular Stepper Control System
+// Version: 4.2.0
+// Date: 2026-10-15
+// Author: Tim Rosener
+// Description: Step pulse block generator for the RMT step backend
+// License: MIT
+//
+// Turns the ramp generator (moveTo with speed and acceleration) and raw
+// step commands (streams) into blocks of RMT symbols: one symbol per step,
+// high for 25% of the step period and low for the rest, plus low-only pause
+// symbols for long gaps and direction setup. Periods are computed per step
+// and the sub-tick remainder is carried to the next step, so the average
+// rate is exact at any speed.
+//
+// Pure computation - no hardware, no RTOS. StepperRmt transmits the blocks;
+// a host build can fill blocks and inspect the symbol arrays directly.
+// ============================================================================
+
+#ifndef STEPPULSEGEN_H
+#define STEPPULSEGEN_H
+
+#include <stdint.h>
+#include "HardwareConfig.h"
+
+// FastAccelStepper names StepperController relies on (ODStepper is not
+// included with the RMT backend)
+#define RAMP_STATE_ACCELERATING_FLAG  4
+#define RAMP_STATE_DECELERATING_FLAG  8
+#define AQE_OK                        0
+#define AQE_QUEUE_FULL                1
+#define AQE_ERROR_RAMP_ACTIVE         (-1)
+#ifndef TICKS_PER_S
+#define TICKS_PER_S                   16000000L  // Raw command clock
+#endif
+
+struct stepper_command_s {
+    uint16_t ticks;     // Step period (or pause length when steps is 0) in TICKS_PER_S units
+    uint8_t steps;
+    bool count_up;
+};
+
+// ============================================================================
+// StepPulseGen Namespace - Pulse Block Generator
+// ============================================================================
+
+namespace StepPulseGen {
+
+    static const uint32_t TICKS_PER_SECOND = 80000000UL / RMT_CLK_DIV;  // RMT resolution
+    static const uint32_t TICKS_PER_US = TICKS_PER_SECOND / 1000000UL;
+    static const uint16_t MAX_DURATION = 0x7FFF;       // 15-bit symbol half
+    static const uint8_t RAW_QUEUE_LENGTH = 32;        // Raw command entries (as FastAccelStepper)
+
+    // ------------------------------------------------------------------------
+    // Types
+    // ------------------------------------------------------------------------
+
+    /**
+     * Generator state for one stepper
+     * Position, speed and ramp state describe the last generated pulse,
+     * which runs ahead of the motor by the blocks in flight
+     */
+    struct Generator {
+        // Ramp generator
+        int32_t position;       // Position after the last generated pulse
+        int32_t target;
+        float speed;            // Signed speed of the last generated pulse (steps/sec)
+        float maxSpeed;         // steps/sec
+        float accel;            // steps/sec²
+        bool rampActive;
+        uint8_t rampState;      // RAMP_STATE_* flags of the last pulse
+
+        // Raw commands (streams)
+        stepper_command_s queue[RAW_QUEUE_LENGTH];
+        uint8_t queueHead;
+        uint8_t queueCount;
+        uint8_t entryStepsDone; // Steps of the front entry already generated
+        int32_t queueEnd;       // Position once every queued entry has run
+
+        // Pulse timing
+        int8_t direction;       // Direction of the last pulse (0 = none yet)
+        float tickCarry;        // Sub-tick remainder of the ramp periods
+        uint32_t rawCarry;      // Remainder of the raw clock conversion (TICKS_PER_S units)
+        uint32_t pendingLow;    // Low time still owed (long step periods, raw pauses)
+        uint32_t pendingPeriod; // Step period the owed low time belongs to (0 = pause)
+    };
+
+    /**
+     * One block of symbols, transmitted as a single RMT transaction
+     * Every pulse in a block has the same direction
+     */
+    struct Block {
+        uint32_t symbols[RMT_BLOCK_SYMBOLS];      // rmt_symbol_word_t layout
+        uint32_t startTicks[RMT_BLOCK_SYMBOLS];   // Symbol start from the block start
+        uint32_t periodTicks[RMT_BLOCK_SYMBOLS];  // Step period of pulse symbols (0 = pause)
+        uint16_t count;          // Symbols used
+        uint16_t steps;          // Pulse symbols
+        int8_t direction;        // +1 / -1 for the pulses (0 = pauses only)
+        uint32_t durationTicks;
+    };
+
+    // ------------------------------------------------------------------------
+    // Symbols
+    // ------------------------------------------------------------------------
+
+    /**
+     * Pack one RMT symbol: level0 for duration0 ticks, then level1 for duration1
+     */
+    inline uint32_t makeSymbol(uint16_t duration0, bool level0, uint16_t duration1, bool level1) {
+        return (uint32_t)(duration0 & MAX_DURATION) | ((uint32_t)level0 << 15) |
+               ((uint32_t)(duration1 & MAX_DURATION) << 16) | ((uint32_t)level1 << 31);
+    }
+
+    /**
+     * Check whether a symbol is a step pulse (starts high)
+     */
+    inline bool isPulse(uint32_t symbol) {
+        return (symbol & 0x8000) != 0;
+    }
+
+    // ------------------------------------------------------------------------
+    // Generator
+    // ------------------------------------------------------------------------
+
+    /**
+     * Reset to standstill at a position (drops the ramp and raw commands)
+     */
+    void reset(Generator& gen, int32_t position);
+
+    /**
+     * Start or retarget the ramp generator (continues from the current speed)
+     * Drops queued raw commands
+     */
+    void moveTo(Generator& gen, int32_t target);
+
+    /**
+     * Decelerate to a stop at the current acceleration
+     */
+    void stopMove(Generator& gen);
+
+    /**
+     * Shift every position by the same amount (setCurrentPosition)
+     */
+    void shiftPosition(Generator& gen, int32_t delta);
+
+    /**
+     * Queue a raw step command
+     * @return AQE_OK, AQE_QUEUE_FULL, or AQE_ERROR_RAMP_ACTIVE while a ramp runs
+     */
+    int8_t addQueueEntry(Generator& gen, const stepper_command_s& cmd);
+
+    /**
+     * Check whether the generator still has steps or pauses to produce
+     */
+    bool hasWork(const Generator& gen);
+
+    /**
+     * Fill a block with the next pulses
+     * A block ends when it is full, reaches RMT_BLOCK_MAX_US, or the next
+     * step reverses; a reversal block starts with RMT_DIR_SETUP_US of low
+     * @return false if there was nothing to generate
+     */
+    bool fillBlock(Generator& gen, Block& block);
+
+    // ------------------------------------------------------------------------
+    // Block Playback
+    // ------------------------------------------------------------------------
+
+    /**
+     * Pulses of a block that have started elapsedTicks after its start
+     */
+    uint16_t stepsStarted(const Block& block, uint32_t elapsedTicks);
+
+    /**
+     * Step period at elapsedTicks into a block (0 while pausing)
+     */
+    uint32_t periodAt(const Block& block, uint32_t elapsedTicks);
+
+} // namespace StepPulseGen
+
+#endif // STEPPULSEGEN_H
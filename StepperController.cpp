@@ -14,7 +14,15 @@
 #include "StepperController.h"
 #include "HardwareConfig.h"
 #include "SystemConfig.h"
-#include <ODStepper.h>
+#include "MotionPlanner.h"
+#include "SetpointInterpolator.h"
+#include "CueEngine.h"
+#include "FixedPoint.h"
+#include "LoopProfiler.h"
+#include "CoreLog.h"
+#include "MotionTrace.h"
+#include "StepperHal.h"
+#include <Preferences.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/task.h>
 #include <freertos/semphr.h>
@@ -38,34 +46,19 @@ static const char* motionStateToString(MotionState state) {
     }
 }
 
-// Forward declarations of helper functions
-static void handleLimitFlags();
-static void updateHomingSequence();
-static void updateMotionStatus();
-static void checkAlarmStatus();
-static void startHomingSequence();
 
 // Task and synchronization
 static TaskHandle_t g_stepperTaskHandle = nullptr;
+
+// Task notification bits - each event source wakes the task immediately
+static const uint32_t NOTIFY_COMMAND = (1UL << 0);  // Motion command queued
+static const uint32_t NOTIFY_LIMIT   = (1UL << 1);  // Limit switch edge
+static const uint32_t NOTIFY_ALARM   = (1UL << 2);  // CL57Y ALARM edge
 static SemaphoreHandle_t g_stepperMutex = nullptr;
 static bool g_initialized = false;
 
-// ODStepper/FastAccelStepper instances
-static ODStepperEngine g_engine = ODStepperEngine();
-static ODStepper* g_stepper = nullptr;
-
-// Position tracking and limits
-static int32_t g_currentPosition = 0;
-static int32_t g_minPosition = MIN_POSITION_STEPS;
-static int32_t g_maxPosition = MAX_POSITION_STEPS;
-static bool g_positionLimitsValid = false;
-static bool g_systemHomed = false;
-
-// Motion state
-static MotionState g_motionState = MotionState::IDLE;
-static bool g_stepperEnabled = false;
-static float g_currentSpeed = 0.0f;
-static bool g_limitFaultActive = false;  // Latched limit fault flag
+// ODStepper/FastAccelStepper engine - one per board, shared by every axis
+static StepperHal::Engine g_engine;
 
 // Diagnostic timing data
 static bool g_enableStepDiagnostics = false;  // Diagnostics disabled - mechanical issue resolved
@@ -74,77 +67,339 @@ static uint32_t g_stepIntervals[10];  // Store last 10 step intervals
 static uint8_t g_stepIntervalIndex = 0;
 static MotionState g_lastMotionState = MotionState::IDLE;
 
-// Motion profile
-static MotionProfile g_currentProfile = {
-    .maxSpeed = DEFAULT_MAX_SPEED,
-    .acceleration = DEFAULT_ACCELERATION,
-    .deceleration = DEFAULT_ACCELERATION,  // FastAccelStepper uses same value
-    .jerk = 1000.0f,
-    .targetPosition = 0,
-    .enableLimits = true
+// Limit switch edges - the ISRs timestamp each edge into a lock-free ring
+// (single producer: all limit ISRs run on the core that attached them)
+struct LimitEdge {
+    uint32_t timeUs;    // micros() at the interrupt
+    uint8_t pin;        // Limit pin of one of the axes
+    bool active;        // Pin level at the interrupt (true = switch closed)
+};
+static LimitEdge g_limitEdgeRing[LIMIT_EDGE_RING_SIZE];
+static std::atomic<uint8_t> g_limitEdgeHead(0);  // Written by the limit ISRs only
+static std::atomic<uint8_t> g_limitEdgeTail(0);  // Written by the Core 0 task only
+static volatile uint32_t g_limitEdgeOverflows = 0;
+static StepperHal::OneShot g_limitFilterTimer;   // Wakes the task when a filter window ends
+
+// Glitch filter - an edge stays pending until the pin has held the new level
+// for (limitFilterSamples - 1) * LIMIT_FILTER_SAMPLE_US. The pin is sampled
+// on every task wake and once more by a one-shot timer at the end of the
+// window, so the task never spins waiting for it
+struct LimitFilter {
+    bool pending;           // Edge waiting for confirmation
+    bool level;             // Level being confirmed (true = switch closed)
+    uint32_t edgeUs;        // Edge timestamp (from the ISR, or the poll for a missed edge)
+    int32_t edgePosition;   // Position latched at the edge timestamp
 };
-
-// Limit switch handling with noise filtering
-static volatile bool g_leftLimitTriggered = false;
-static volatile bool g_rightLimitTriggered = false;
-static bool g_leftLimitState = false;
-static bool g_rightLimitState = false;
-static uint32_t g_leftLimitDebounceStart = 0;  // When debounce period started
-static uint32_t g_rightLimitDebounceStart = 0;
-
-// Cache for continuous monitoring
-static bool g_lastLeftPinReading = false;
-static bool g_lastRightPinReading = false;
 
 // Homing state machine
 enum class HomingState {
     IDLE,
     FINDING_LEFT,
     BACKING_OFF_LEFT,
+    REAPPROACH_LEFT,     // Two-speed homing: slow return to the left switch
     FINDING_RIGHT,
     BACKING_OFF_RIGHT,
+    REAPPROACH_RIGHT,    // Two-speed homing: slow return to the right switch
     MOVING_TO_CENTER,
     COMPLETE,
     ERROR
 };
 
-static HomingState g_homingState = HomingState::IDLE;
-static uint8_t g_homingProgress = 0;
-static int32_t g_detectedLeftLimit = 0;   // Actual position where left switch triggered
-static int32_t g_detectedRightLimit = 0;  // Actual position where right switch triggered
-static float g_homingSpeed = 940.0f;  // Homing speed (steps/sec) - loaded from config
-static float g_limitSafetyMargin = 400.0f;  // Total safety margin from switches - loaded from config
 static const uint32_t HOMING_TIMEOUT_MS = 90000; // 90 second timeout for finding limits (3x longer for full travel)
-static uint32_t g_homingStartTime = 0;
-static uint32_t g_homingPhaseStartTime = 0;
+
+// Two-speed homing: approach each switch at the fast speed, back off, then
+// re-approach and release at Axis::homingSpeedMilliHz for an accurate reference.
+// Release points come from the raw switch edge, not from stepping off it.
+static const int32_t HOMING_SEARCH_STEPS = 100000;     // Approach travel - should hit a limit before this
+static const int32_t HOMING_RELEASE_MAX_STEPS = 5000;  // Back-off allowed before the switch must release
+static const int32_t HOMING_CLEARANCE_STEPS = 200;     // Travel past the release before the slow re-approach
+
+// Calibrated range, persisted after every full sweep. Verify homing
+// re-references on the left switch alone and checks that switch's
+// trigger-to-release signature before trusting the stored range.
+struct HomingCalibration {
+    bool valid;
+    int32_t range;            // Right release point with the left release at 0 (steps)
+    int32_t leftHysteresis;   // Left switch trigger-to-release distance (steps)
+    int32_t rightHysteresis;  // Right switch trigger-to-release distance (steps, -1 = not measured)
+    int32_t speedMilliHz;     // Slow homing speed the signature was measured at
+};
+static const char* CALIBRATION_NAMESPACE = "skullcal";     // Kept apart from user config (axis N > 0 appends N)
+static const int32_t HOMING_VERIFY_TOLERANCE_STEPS = 40;   // Allowed left signature drift
+static Preferences g_calibrationPreferences;
 
 // CL57Y ALARM monitoring
-static bool g_alarmState = false;
 static uint32_t g_lastAlarmCheck = 0;
+static const uint32_t ALARM_POLL_INTERVAL_MS = 20;  // Fallback poll in case an edge is missed
 
 // Auto-home after E-stop
-static bool g_autoHomeRequested = false;
-static uint32_t g_autoHomeRequestTime = 0;
 static const uint32_t AUTO_HOME_DELAY_MS = 2000;  // 2 second delay after E-stop
 
 // Task health monitoring
 static uint32_t g_lastTaskUpdate = 0;
 static const uint32_t TASK_HEALTH_TIMEOUT_MS = 5000;  // Task is unhealthy if no update for 5 seconds
 
-// Motion timeout detection
-static uint32_t g_motionStartTime = 0;
-static const uint32_t MOTION_TIMEOUT_MS = 30000;  // 30 second timeout for any motion
+// Command queue statistics (written on Core 0, read anywhere)
+static CommandQueueStats g_commandStats = {};
+
+// Motion timeout - each move is armed with its planned duration (the ETA) and
+// counts as stuck once it runs past the ETA by the tolerance
+static const uint32_t MOTION_TIMEOUT_MARGIN_MS = 1000;    // Minimum tolerance past the ETA
+static const uint32_t MOTION_TIMEOUT_TOLERANCE_PCT = 25;  // Tolerance as a share of the ETA
+
+// Streamed moves - S-curves, waypoint paths and keyframe cues are sampled in
+// short chunks and fed into the FastAccelStepper command queue. A stream is a
+// sequence of pieces: one S-curve, one piece per waypoint segment, or one piece
+// per keyframe interval.
+enum class StreamSource : uint8_t {
+    NONE,
+    SCURVE,    // Single jerk-limited move (Axis::scurve)
+    PATH,      // Waypoint segments from Axis::path, oldest first
+    CUE        // Keyframe intervals from Axis::cueTrack
+};
+// Stream time is kept in integer microseconds; floats appear only where a
+// profile is sampled
+static const uint32_t STREAM_CHUNK_US = 1000;      // Profile sample period (1ms)
+static const uint32_t STREAM_LOOKAHEAD_US = 12000; // Profile time kept queued ahead of the motor
+static const uint32_t TICKS_PER_US = TICKS_PER_S / 1000000;
+
+// Follow mode - streaming setpoints (DMX) tracked with velocity feed-forward.
+// The ramp generator is aimed past the setpoint by the stopping distance, so it
+// never decelerates toward a target that the next frame will replace
+static const float FOLLOW_POSITION_GAIN = 5.0f;       // Catch-up speed per step of lag (1/s)
+static const float FOLLOW_VELOCITY_SMOOTHING = 0.4f;  // Weight of the newest setpoint rate sample
+static const float FOLLOW_MIN_SPEED = 10.0f;          // Speed floor while the setpoint moves (steps/sec)
+static const uint32_t FOLLOW_STALE_MS = 150;          // No new setpoint for this long = setpoint at rest
+
+// ============================================================================
+// Axis State
+// ============================================================================
+
+// Pins of one axis (HardwareConfig.h STEPPER_AXIS_PINS)
+struct AxisPins {
+    uint8_t step;
+    uint8_t dir;
+    uint8_t enable;
+    uint8_t alarm;
+    uint8_t leftLimit;
+    uint8_t rightLimit;
+};
+static const AxisPins AXIS_PINS[STEPPER_AXIS_COUNT] = STEPPER_AXIS_PINS;
+
+// Everything one stepper needs: its step generator, limits, homing state
+// machine, profile and active stream. The engine functions below take the
+// axis they work on; the Core 0 task services every axis each wake.
+struct Axis {
+    uint8_t index = 0;
+    const AxisPins* pins = nullptr;
+    StepperHal::Stepper* stepper = nullptr;
+    
+    // Position tracking and limits
+    int32_t currentPosition = 0;
+    int32_t targetPosition = 0;
+    int32_t minPosition = MIN_POSITION_STEPS;
+    int32_t maxPosition = MAX_POSITION_STEPS;
+    int32_t userMinPosition = MIN_POSITION_STEPS;  // User limits of axes 1..N (axis 0: SystemConfig)
+    int32_t userMaxPosition = MAX_POSITION_STEPS;
+    bool userLimitsSavePending = false;            // Stored by flushPendingSaves() on Core 1
+    bool positionLimitsValid = false;
+    bool systemHomed = false;
+    
+    // Motion state
+    MotionState motionState = MotionState::IDLE;
+    bool stepperEnabled = false;
+    int32_t currentSpeedMilliHz = 0;
+    bool limitFaultActive = false;  // Latched limit fault flag
+    
+    // Motion profile
+    MotionProfile currentProfile = {
+        .maxSpeed = DEFAULT_MAX_SPEED,
+        .acceleration = DEFAULT_ACCELERATION,
+        .deceleration = DEFAULT_ACCELERATION,  // FastAccelStepper uses same value
+        .jerk = 1000.0f,
+        .targetPosition = 0,
+        .enableLimits = true,
+        .shape = ProfileShape::CONFIGURED
+    };
+    
+    // Limit switches
+    LimitFilter leftFilter = {};
+    LimitFilter rightFilter = {};
+    bool leftLimitState = false;   // Confirmed (filtered) switch states
+    bool rightLimitState = false;
+    bool lastLeftPinReading = false;   // Raw pin levels from the last poll
+    bool lastRightPinReading = false;
+    
+    // Limit stop measurement
+    LimitStopStats limitStats = {};
+    bool overrunPending = false;        // Limit stop issued, waiting for standstill
+    int32_t overrunEdgePosition = 0;    // Edge position of that stop
+    
+    // Homing state machine
+    HomingState homingState = HomingState::IDLE;
+    uint8_t homingProgress = 0;
+    int32_t detectedLeftLimit = 0;   // Actual position where left switch triggered
+    int32_t detectedRightLimit = 0;  // Actual position where right switch triggered
+    int32_t homingSpeedMilliHz = 940000;  // Homing speed (milliHz) - loaded from config
+    int32_t limitSafetyMargin = 400;  // Total safety margin from switches (steps) - loaded from config
+    uint32_t homingStartTime = 0;
+    uint32_t homingPhaseStartTime = 0;
+    int32_t homingFastSpeedMilliHz = 0;   // Fast approach speed (0 = single-speed homing)
+    bool homingSlowPass = true;           // Current switch is on its slow (final) pass
+    bool homingMoveIssued = false;        // Approach/back-off move commanded for this state
+    bool homingEdgeStop = false;          // Approach stopped on a raw edge, awaiting the debounce
+    bool homingReleased = false;          // Final release seen, stopping before the rebase
+    int32_t homingReleasePosition = 0;    // Release point of the current switch
+    int32_t leftEdgePosition = 0;         // Position latched at the last confirmed left edge
+    int32_t rightEdgePosition = 0;        // Position latched at the last confirmed right edge
+    HomingTimes homingRun = {};           // Phase times of the sequence in progress
+    HomingTimes homingTimes = {};         // Phase times of the last completed sequence
+    
+    // Verify homing against the stored calibration
+    HomingCalibration calibration = {};
+    bool calibrationSavePending = false;  // Stored by flushPendingSaves() on Core 1 (under g_stepperMutex)
+    volatile bool fullHomingRequested = false;  // Next homing must sweep both switches
+    bool homingVerify = false;            // Sequence may finish after the left switch
+    bool leftTriggerMeasured = false;     // Left switch closed on a slow approach
+    bool rightTriggerMeasured = false;    // Right switch closed on a slow approach
+    int32_t leftTriggerPosition = 0;      // Left switch close point (pre-rebase coordinates)
+    int32_t rightTriggerPosition = 0;     // Right switch close point
+    int32_t leftHysteresis = -1;          // Measured this sequence (-1 = not measured)
+    
+    // CL57Y ALARM and auto-home after E-stop
+    bool alarmState = false;
+    bool autoHomeRequested = false;
+    uint32_t autoHomeRequestTime = 0;
+    
+    // Motion timeout
+    bool motionTimeoutArmed = false;
+    uint32_t motionArrivalTime = 0;       // millis() at the expected arrival
+    uint32_t motionDeadline = 0;          // millis() after which the move is stuck
+    
+    // Streamed moves
+    StreamSource streamSource = StreamSource::NONE;
+    uint32_t streamStartMicros = 0;   // Wall-clock time of the current piece t=0
+    uint32_t streamQueuedMicros = 0;  // Time into the current piece already queued (us)
+    int32_t streamQueuedSteps = 0;    // Steps of the current piece already queued
+    int32_t streamQueueEnd = 0;       // Expected position once the queue drains
+    bool streamCountUp = true;        // Direction of the last queued entry
+    uint16_t streamCarryTicks = 0;    // Remainder of the last entry's ticks, owed to the next one
+    int32_t pieceStart = 0;           // Current piece start position
+    int32_t pieceEnd = 0;             // Current piece end position
+    uint32_t pieceMicros = 0;         // Current piece duration (us)
+    MotionPlanner::SCurveProfile scurve = {};
+    MotionPlanner::PathBuffer path = {};  // Waypoints; the oldest executes while a path runs
+    bool pathFrontLoaded = false;     // Oldest waypoint segment is the current piece
+    CueEngine::CueTrack cueTrack = {};    // Private copy of the playing cue
+    int8_t cueId = -1;                // Playing cue slot (-1 = none)
+    bool cueApproach = false;         // Ramp generator moving to the first keyframe
+    int16_t cueKey = -1;              // Current interval start keyframe (-1 = not started)
+    
+    // Follow mode
+    bool followActive = false;
+    int32_t followSetpoint = 0;       // Latest setpoint, clamped to user limits
+    uint32_t followSampleTime = 0;    // Timestamp of the latest setpoint (ms)
+    float followVelocity = 0.0f;      // Estimated setpoint rate (steps/sec, signed)
+    float followMaxSpeed = 0.0f;      // Speed cap from the latest command
+    int32_t followLeadTarget = 0;     // Target last handed to the ramp generator
+    float followSpeed = 0.0f;         // Speed last handed to the ramp generator
+    SetpointInterpolator::State followInterp = {};  // Setpoint upsampling between frames
+    
+    // Coordinated move - the ramp generator runs a scaled copy of the
+    // master speed and acceleration until the axis is at rest again
+    bool coordinated = false;
+    
+    // Last states recorded in the motion trace and printed by homing
+    MotionState tracedMotionState = MotionState::IDLE;
+    HomingState tracedHomingState = HomingState::IDLE;
+    HomingState printedHomingState = HomingState::IDLE;
+};
+
+static Axis g_axes[STEPPER_AXIS_COUNT];
+
+// Per-axis snapshots for other tasks - a seqlock like SystemStatus, the
+// sequence is odd while the Core 0 task is writing
+static AxisStatus g_axisStatus[STEPPER_AXIS_COUNT];
+static std::atomic<uint32_t> g_axisStatusSequence(0);
+static portMUX_TYPE g_axisStatusLock = portMUX_INITIALIZER_UNLOCKED;
+
+// Flash writes stall both cores' cache, so the Core 0 task only flags them;
+// flushPendingSaves() writes from Core 1
+static bool g_configSavePending = false;  // Guarded by g_stepperMutex
+static const uint8_t AXIS_STATUS_READ_RETRIES = 8;  // Optimistic attempts before locking
+
+/**
+ * The axis the single-axis public interface reports on
+ */
+static inline Axis& primaryAxis() {
+    return g_axes[0];
+}
+
+/**
+ * Check if an axis is running its homing sequence
+ */
+static bool isAxisHoming(const Axis& axis) {
+    return (axis.homingState != HomingState::IDLE && 
+            axis.homingState != HomingState::COMPLETE &&
+            axis.homingState != HomingState::ERROR);
+}
+
+// Forward declarations of helper functions
+static void handleLimitFlags();
+static void updateHomingSequence(Axis& axis);
+static void updateMotionStatus(Axis& axis);
+static void publishMotionStatus();
+static void checkAlarmStatus(Axis& axis);
+static void startHomingSequence(Axis& axis);
+static float pieceVelocityAt(Axis& axis, float t);
 
 // ============================================================================
 // Interrupt Service Routines (MINIMAL!)
 // ============================================================================
 
-void IRAM_ATTR leftLimitISR() {
-    g_leftLimitTriggered = true;  // Single instruction only!
+/**
+ * Wake the stepper task from an ISR
+ */
+static inline void IRAM_ATTR notifyTaskFromISR(uint32_t bits) {
+    if (g_stepperTaskHandle != nullptr) {
+        BaseType_t higherPriorityTaskWoken = pdFALSE;
+        xTaskNotifyFromISR(g_stepperTaskHandle, bits, eSetBits, &higherPriorityTaskWoken);
+        portYIELD_FROM_ISR(higherPriorityTaskWoken);
+    }
+}
+
+static inline void IRAM_ATTR pushLimitEdge(uint8_t pin) {
+    uint8_t head = g_limitEdgeHead.load(std::memory_order_relaxed);
+    uint8_t next = (head + 1) & (LIMIT_EDGE_RING_SIZE - 1);
+    if (next == g_limitEdgeTail.load(std::memory_order_acquire)) {
+        g_limitEdgeOverflows++;  // Ring full - the poll still catches the level change
+        return;
+    }
+    g_limitEdgeRing[head].timeUs = StepperHal::micros();
+    g_limitEdgeRing[head].pin = pin;
+    g_limitEdgeRing[head].active = (StepperHal::readPin(pin) == LOW);
+    g_limitEdgeHead.store(next, std::memory_order_release);
+}
+
+/**
+ * Limit switch ISR - shared by every limit input, arg is the pin
+ */
+void IRAM_ATTR limitISR(void* arg) {
+    pushLimitEdge((uint8_t)(uintptr_t)arg);
+    notifyTaskFromISR(NOTIFY_LIMIT);
+}
+
+/**
+ * Glitch filter window end - runs in the timer task, not an ISR
+ */
+static void limitFilterTimerCallback(void* arg) {
+    if (g_stepperTaskHandle != nullptr) {
+        xTaskNotify(g_stepperTaskHandle, NOTIFY_LIMIT, eSetBits);
+    }
 }
 
-void IRAM_ATTR rightLimitISR() {
-    g_rightLimitTriggered = true;  // Single instruction only!
+void IRAM_ATTR alarmISR(void* arg) {
+    notifyTaskFromISR(NOTIFY_ALARM);
 }
 
 // ============================================================================
@@ -152,302 +407,817 @@ void IRAM_ATTR rightLimitISR() {
 // ============================================================================
 
 /**
- * Process left limit switch state change
+ * Stop streaming the active S-curve or path and drop queued waypoints
+ * Entries already queued still run unless the caller stops the motor
+ */
+static void cancelStream(Axis& axis) {
+    axis.streamSource = StreamSource::NONE;
+    axis.cueId = -1;
+    axis.cueApproach = false;
+    MotionPlanner::pathClear(axis.path);
+    axis.pathFrontLoaded = false;
+}
+
+/**
+ * Leave follow mode (the current ramp generator move is left running)
+ * Follow steers the ramp speed down to FOLLOW_MIN_SPEED - moves after it plan
+ * their ETA with the profile speed, so hand that back
+ */
+static void cancelFollow(Axis& axis) {
+    if (!axis.followActive) {
+        return;
+    }
+    axis.followActive = false;
+    axis.stepper->setSpeedInHz(axis.currentProfile.maxSpeed);
+}
+
+/**
+ * Give the ramp generator back the axis' own speed and acceleration
+ * after a coordinated move scaled them
+ */
+static void endCoordinatedMove(Axis& axis) {
+    if (!axis.coordinated) {
+        return;
+    }
+    axis.stepper->setSpeedInHz(axis.currentProfile.maxSpeed);
+    axis.stepper->setAcceleration(axis.currentProfile.acceleration);
+    axis.coordinated = false;
+}
+
+/**
+ * Force stop the motor and abandon any stream or follow in progress
+ */
+static void forceStopMotion(Axis& axis) {
+    cancelStream(axis);
+    cancelFollow(axis);
+    axis.stepper->forceStop();
+    axis.motionTimeoutArmed = false;
+    MotionTrace::record(MotionTrace::Event::FORCE_STOP, 0, 0, axis.stepper->getCurrentPosition());
+}
+
+/**
+ * Follow setpoint interpolation from configuration
+ * @param delayMs Receives the interpolation delay
+ * @return false if interpolation is off (setpoints are used as they arrive)
+ */
+static bool followInterpolation(uint32_t& delayMs) {
+    SystemConfig* config = SystemConfigMgr::getConfig();
+    if (!config || !config->dmxInterpolation) {
+        return false;
+    }
+    delayMs = config->dmxInterpDelayMs;  // Clamped by the interpolator
+    return true;
+}
+
+/**
+ * Glitch filter sample count from configuration
+ */
+static uint8_t limitFilterSamples() {
+    SystemConfig* config = SystemConfigMgr::getConfig();
+    uint8_t samples = config ? config->limitFilterSamples : LIMIT_FILTER_SAMPLES;
+    return constrain(samples, 1, LIMIT_FILTER_MAX_SAMPLES);
+}
+
+/**
+ * Position at an edge timestamp
+ * Backs the steps taken since the edge out of the current position at the
+ * current speed - exact to a step while the speed is steady over the few
+ * hundred microseconds between the ISR and the drain
+ */
+static int32_t positionAtEdge(Axis& axis, uint32_t edgeUs) {
+    if (!axis.stepper) return 0;
+    int32_t position = axis.stepper->getCurrentPosition();
+    int32_t elapsedUs = (int32_t)(StepperHal::micros() - edgeUs);
+    if (elapsedUs <= 0) return position;
+    // milliHz * us = 1e-9 steps
+    int64_t steps = ((int64_t)axis.stepper->getCurrentSpeedInMilliHz() * elapsedUs + 500000000LL) / 1000000000LL;
+    return position - (int32_t)steps;
+}
+
+/**
+ * Latch a confirmed edge position and record how far the motor travelled
+ * between the edge and the confirmation (what a polled sample would miss)
+ */
+static int32_t latchEdgePosition(Axis& axis, const LimitFilter& filter) {
+    int32_t delta = axis.stepper ? abs(axis.stepper->getCurrentPosition() - filter.edgePosition) : 0;
+    axis.limitStats.lastLatchDelta = delta;
+    if (delta > axis.limitStats.maxLatchDelta) {
+        axis.limitStats.maxLatchDelta = delta;
+    }
+    return filter.edgePosition;
+}
+
+/**
+ * Feed one switch edge into its glitch filter
+ * An edge back to the confirmed level cancels a pending change (glitch)
+ */
+static void filterLimitEdge(Axis& axis, LimitFilter& filter, bool confirmedState, bool level,
+                            uint32_t edgeUs, int32_t position) {
+    if (level != confirmedState) {
+        if (!filter.pending) {
+            filter.pending = true;
+            filter.level = level;
+            filter.edgeUs = edgeUs;
+            filter.edgePosition = position;
+        }
+    } else if (filter.pending) {
+        filter.pending = false;
+        axis.limitStats.glitches++;
+    }
+}
+
+/**
+ * Sample a pending edge without blocking
+ * Any sample at the old level discards the edge; it is confirmed once the
+ * window after the edge has passed with every sample (and no ISR edge back)
+ * at the new level
+ * @param recheckUs Lowered to the time left in the window while still pending
+ * @return true if the edge is confirmed
+ */
+static bool confirmLimitEdge(Axis& axis, LimitFilter& filter, uint8_t pin, uint32_t& recheckUs) {
+    if ((StepperHal::readPin(pin) == LOW) != filter.level) {
+        filter.pending = false;
+        axis.limitStats.glitches++;
+        return false;
+    }
+    uint32_t windowUs = (uint32_t)(limitFilterSamples() - 1) * LIMIT_FILTER_SAMPLE_US;
+    uint32_t elapsedUs = StepperHal::micros() - filter.edgeUs;
+    if (elapsedUs >= windowUs) {
+        filter.pending = false;
+        return true;
+    }
+    recheckUs = min(recheckUs, windowUs - elapsedUs);
+    return false;
+}
+
+/**
+ * Record a limit stop - latency now, overrun once the motor stands still
+ */
+static void recordLimitStop(Axis& axis, const LimitFilter& filter) {
+    uint32_t latency = StepperHal::micros() - filter.edgeUs;
+    axis.limitStats.stops++;
+    axis.limitStats.lastLatencyUs = latency;
+    if (latency > axis.limitStats.maxLatencyUs) {
+        axis.limitStats.maxLatencyUs = latency;
+    }
+    axis.overrunPending = true;
+    axis.overrunEdgePosition = filter.edgePosition;
+}
+
+/**
+ * Apply a confirmed left limit switch change
  * Called from Core 0 task only
  */
-static void processLeftLimit(bool currentReading, uint32_t currentTime) {
-    // Check if state is different from our known state
-    if (currentReading != g_leftLimitState) {
-        // Start or continue debounce timer
-        if (g_leftLimitDebounceStart == 0) {
-            g_leftLimitDebounceStart = currentTime;
-        } else if (currentTime - g_leftLimitDebounceStart >= LIMIT_SWITCH_DEBOUNCE) {
-            // State has been stable for debounce period - confirm the change
-            g_leftLimitState = currentReading;
-            g_leftLimitDebounceStart = 0;
-            g_leftLimitTriggered = false;  // Clear interrupt flag after processing
-            
-            if (g_leftLimitState) {
-            Serial.println("StepperController: Left limit ACTIVATED");
-            
-            // Handle based on current state
-            if (g_homingState != HomingState::FINDING_LEFT) {
+static void onLeftLimitChanged(Axis& axis) {
+    if (axis.leftLimitState) {
+        CORE_LOG_INFO("StepperController: Left limit ACTIVATED");
+        
+        // Handle based on current state
+        if (axis.homingState != HomingState::FINDING_LEFT &&
+            axis.homingState != HomingState::REAPPROACH_LEFT) {
             // Emergency stop if not homing
-            if (g_stepper && g_stepper->isRunning()) {
-            // Use emergency stop for proper state handling
-            g_stepper->forceStop();
-            g_motionState = MotionState::IDLE;
-            SAFE_WRITE_STATUS(safetyState, SafetyState::EMERGENCY_STOP);
-            g_limitFaultActive = true;  // Latch the fault
-            Serial.println("StepperController: EMERGENCY STOP - Left limit hit!");
-            Serial.println("StepperController: FAULT LATCHED - Homing required to clear.");
+            if (axis.stepper && axis.stepper->isRunning()) {
+                // Use emergency stop for proper state handling
+                forceStopMotion(axis);
+                recordLimitStop(axis, axis.leftFilter);
+                axis.motionState = MotionState::IDLE;
+                SAFE_WRITE_STATUS(safetyState, SafetyState::EMERGENCY_STOP);
+                axis.limitFaultActive = true;  // Latch the fault
+                CORE_LOG_ERROR("StepperController: EMERGENCY STOP - Left limit hit! (%lu us after edge)",
+                              axis.limitStats.lastLatencyUs);
+                CORE_LOG_ERROR("StepperController: FAULT LATCHED - Homing required to clear.");
                 
-                    // Check if auto-home on E-stop is enabled
-                    SystemConfig* config = SystemConfigMgr::getConfig();
-                    if (config && config->autoHomeOnEstop) {
-                    Serial.println("StepperController: AUTO-HOME ON E-STOP enabled - Will start homing after delay...");
-                    g_autoHomeRequested = true;
-                        g_autoHomeRequestTime = millis();
-                        }
-                    }
+                // Check if auto-home on E-stop is enabled
+                SystemConfig* config = SystemConfigMgr::getConfig();
+                if (config && config->autoHomeOnEstop) {
+                    CORE_LOG_INFO("StepperController: AUTO-HOME ON E-STOP enabled - Will start homing after delay...");
+                    axis.autoHomeRequested = true;
+                    axis.autoHomeRequestTime = StepperHal::millis();
                 }
-            } else {
-                Serial.println("StepperController: Left limit released");
-                // Note: Fault remains latched until cleared by successful homing
             }
         }
     } else {
-        // State matches - reset debounce timer and clear flag
-        g_leftLimitDebounceStart = 0;
-        g_leftLimitTriggered = false;
+        CORE_LOG_INFO("StepperController: Left limit released");
+        // Note: Fault remains latched until cleared by successful homing
     }
 }
 
 /**
- * Process right limit switch state change
+ * Apply a confirmed right limit switch change
  * Called from Core 0 task only
  */
-static void processRightLimit(bool currentReading, uint32_t currentTime) {
-    // Check if state is different from our known state
-    if (currentReading != g_rightLimitState) {
-        // Start or continue debounce timer
-        if (g_rightLimitDebounceStart == 0) {
-            g_rightLimitDebounceStart = currentTime;
-        } else if (currentTime - g_rightLimitDebounceStart >= LIMIT_SWITCH_DEBOUNCE) {
-            // State has been stable for debounce period - confirm the change
-            g_rightLimitState = currentReading;
-            g_rightLimitDebounceStart = 0;
-            g_rightLimitTriggered = false;  // Clear interrupt flag after processing
-            
-            if (g_rightLimitState) {
-            Serial.println("StepperController: Right limit ACTIVATED");
-            
-            // Handle based on current state
-            if (g_homingState != HomingState::FINDING_RIGHT) {
+static void onRightLimitChanged(Axis& axis) {
+    if (axis.rightLimitState) {
+        CORE_LOG_INFO("StepperController: Right limit ACTIVATED");
+        
+        // Handle based on current state
+        if (axis.homingState != HomingState::FINDING_RIGHT &&
+            axis.homingState != HomingState::REAPPROACH_RIGHT) {
             // Emergency stop if not homing
-            if (g_stepper && g_stepper->isRunning()) {
-            // Use emergency stop for proper state handling
-            g_stepper->forceStop();
-            g_motionState = MotionState::IDLE;
-            SAFE_WRITE_STATUS(safetyState, SafetyState::EMERGENCY_STOP);
-            g_limitFaultActive = true;  // Latch the fault
-            Serial.println("StepperController: EMERGENCY STOP - Right limit hit!");
-            Serial.println("StepperController: FAULT LATCHED - Homing required to clear.");
+            if (axis.stepper && axis.stepper->isRunning()) {
+                // Use emergency stop for proper state handling
+                forceStopMotion(axis);
+                recordLimitStop(axis, axis.rightFilter);
+                axis.motionState = MotionState::IDLE;
+                SAFE_WRITE_STATUS(safetyState, SafetyState::EMERGENCY_STOP);
+                axis.limitFaultActive = true;  // Latch the fault
+                CORE_LOG_ERROR("StepperController: EMERGENCY STOP - Right limit hit! (%lu us after edge)",
+                              axis.limitStats.lastLatencyUs);
+                CORE_LOG_ERROR("StepperController: FAULT LATCHED - Homing required to clear.");
                 
-                    // Check if auto-home on E-stop is enabled
-                        SystemConfig* config = SystemConfigMgr::getConfig();
-                        if (config && config->autoHomeOnEstop) {
-                            Serial.println("StepperController: AUTO-HOME ON E-STOP enabled - Will start homing after delay...");
-                            g_autoHomeRequested = true;
-                            g_autoHomeRequestTime = millis();
-                        }
-                    }
+                // Check if auto-home on E-stop is enabled
+                SystemConfig* config = SystemConfigMgr::getConfig();
+                if (config && config->autoHomeOnEstop) {
+                    CORE_LOG_INFO("StepperController: AUTO-HOME ON E-STOP enabled - Will start homing after delay...");
+                    axis.autoHomeRequested = true;
+                    axis.autoHomeRequestTime = StepperHal::millis();
                 }
-            } else {
-                Serial.println("StepperController: Right limit released");
-                // Note: Fault remains latched until cleared by successful homing
             }
         }
     } else {
-        // State matches - reset debounce timer and clear flag
-        g_rightLimitDebounceStart = 0;
-        g_rightLimitTriggered = false;
+        CORE_LOG_INFO("StepperController: Right limit released");
+        // Note: Fault remains latched until cleared by successful homing
     }
 }
 
 /**
- * Check limit switches with continuous monitoring
+ * Drain ISR edges in arrival order into the filters of their axes, each
+ * positioned at its own timestamp
  * Called from Core 0 task only
  */
-static void checkLimitSwitches() {
-    uint32_t currentTime = millis();
-    
+static void drainLimitEdges() {
+    uint8_t tail = g_limitEdgeTail.load(std::memory_order_relaxed);
+    uint8_t head = g_limitEdgeHead.load(std::memory_order_acquire);
+    while (tail != head) {
+        const LimitEdge& edge = g_limitEdgeRing[tail];
+        for (Axis& axis : g_axes) {
+            if (edge.pin == axis.pins->leftLimit) {
+                filterLimitEdge(axis, axis.leftFilter, axis.leftLimitState, edge.active, edge.timeUs,
+                                positionAtEdge(axis, edge.timeUs));
+            } else if (edge.pin == axis.pins->rightLimit) {
+                filterLimitEdge(axis, axis.rightFilter, axis.rightLimitState, edge.active, edge.timeUs,
+                                positionAtEdge(axis, edge.timeUs));
+            } else {
+                continue;
+            }
+            axis.limitStats.edges++;
+            break;
+        }
+        tail = (tail + 1) & (LIMIT_EDGE_RING_SIZE - 1);
+    }
+    g_limitEdgeTail.store(tail, std::memory_order_release);
+}
+
+/**
+ * Check one axis' limit switches: poll for missed edges, then confirm
+ * pending edges (drainLimitEdges() runs first)
+ * @param recheckUs Lowered to the earliest end of a pending filter window
+ * Called from Core 0 task only
+ */
+static void checkLimitSwitches(Axis& axis, uint32_t& recheckUs) {
     // Always read current pin states (continuous monitoring)
-    bool leftPinReading = (digitalRead(LEFT_LIMIT_PIN) == LOW);
-    bool rightPinReading = (digitalRead(RIGHT_LIMIT_PIN) == LOW);
+    bool leftPinReading = (StepperHal::readPin(axis.pins->leftLimit) == LOW);
+    bool rightPinReading = (StepperHal::readPin(axis.pins->rightLimit) == LOW);
+    
+    // A level change with no pending edge means the ring missed it - the
+    // poll becomes the edge
+    if (leftPinReading != axis.leftLimitState && !axis.leftFilter.pending) {
+        uint32_t nowUs = StepperHal::micros();
+        filterLimitEdge(axis, axis.leftFilter, axis.leftLimitState, leftPinReading, nowUs, positionAtEdge(axis, nowUs));
+    }
+    if (rightPinReading != axis.rightLimitState && !axis.rightFilter.pending) {
+        uint32_t nowUs = StepperHal::micros();
+        filterLimitEdge(axis, axis.rightFilter, axis.rightLimitState, rightPinReading, nowUs, positionAtEdge(axis, nowUs));
+    }
+    axis.lastLeftPinReading = leftPinReading;
+    axis.lastRightPinReading = rightPinReading;
+    
+    // Confirm pending edges - a mismatching sample discards the edge,
+    // otherwise its latched position becomes the switch position
+    if (axis.leftFilter.pending && confirmLimitEdge(axis, axis.leftFilter, axis.pins->leftLimit, recheckUs)) {
+        axis.leftLimitState = axis.leftFilter.level;
+        axis.leftEdgePosition = latchEdgePosition(axis, axis.leftFilter);
+        MotionTrace::recordAt(axis.leftFilter.edgeUs, MotionTrace::Event::LIMIT_EDGE,
+                              axis.leftLimitState ? 0x02 : 0x00, 0, axis.leftEdgePosition);
+        onLeftLimitChanged(axis);
+    }
+    if (axis.rightFilter.pending && confirmLimitEdge(axis, axis.rightFilter, axis.pins->rightLimit, recheckUs)) {
+        axis.rightLimitState = axis.rightFilter.level;
+        axis.rightEdgePosition = latchEdgePosition(axis, axis.rightFilter);
+        MotionTrace::recordAt(axis.rightFilter.edgeUs, MotionTrace::Event::LIMIT_EDGE,
+                              axis.rightLimitState ? 0x03 : 0x01, 0, axis.rightEdgePosition);
+        onRightLimitChanged(axis);
+    }
+    
+    // Overrun past the edge, measured once the limit stop has finished
+    if (axis.overrunPending && axis.stepper && !axis.stepper->isRunning()) {
+        int32_t overrun = abs(axis.stepper->getCurrentPosition() - axis.overrunEdgePosition);
+        axis.limitStats.lastOverrun = overrun;
+        if (overrun > axis.limitStats.maxOverrun) {
+            axis.limitStats.maxOverrun = overrun;
+        }
+        axis.overrunPending = false;
+        CORE_LOG_INFO("StepperController: Limit stop overrun %d steps past the edge", overrun);
+    }
+    
+    // Limit states are published with the rest of the cycle in publishMotionStatus()
+}
+
+/**
+ * Homing speed for the current pass (fast approach or slow final pass)
+ */
+static int32_t homingPassSpeed(Axis& axis) {
+    return axis.homingSlowPass ? axis.homingSpeedMilliHz : axis.homingFastSpeedMilliHz;
+}
+
+/**
+ * Homing speed for travel that needs no precision (move to home)
+ */
+static int32_t homingTravelSpeed(Axis& axis) {
+    return (axis.homingFastSpeedMilliHz > 0) ? axis.homingFastSpeedMilliHz : axis.homingSpeedMilliHz;
+}
+
+/**
+ * Record the duration of the homing phase that just ended and start the next
+ */
+static void endHomingPhase(Axis& axis, uint32_t& phaseTime) {
+    uint32_t now = StepperHal::millis();
+    phaseTime = now - axis.homingPhaseStartTime;
+    axis.homingPhaseStartTime = now;
+}
+
+/**
+ * Enter an approach or back-off state; the move is issued once the motor stops
+ */
+static void setHomingState(Axis& axis, HomingState state) {
+    axis.homingState = state;
+    axis.homingMoveIssued = false;
+    axis.homingEdgeStop = false;
+    axis.homingReleased = false;
+}
+
+enum class HomingApproach : uint8_t {
+    MOVING,      // Still travelling (or stopped on an edge, awaiting the debounce)
+    FOUND,       // Switch confirmed, motor stopped
+    NOT_FOUND    // Move completed without reaching the switch
+};
+
+/**
+ * Drive toward a switch and stop on its raw edge
+ * Stopping on the edge instead of the debounced state keeps overtravel to
+ * one poll interval, which is what makes a fast approach safe. An edge the
+ * debounce does not confirm (noise) restarts the approach.
+ * @param distance Relative approach move, issued once the motor is stopped
+ * @param speed Approach speed (milliHz)
+ * @param pinActive Raw switch reading
+ * @param confirmed Debounced switch state
+ */
+static HomingApproach serviceHomingApproach(Axis& axis, int32_t distance, int32_t speed,
+                                            bool pinActive, bool confirmed) {
+    if (!axis.homingMoveIssued) {
+        if (!axis.stepper->isRunning()) {
+            axis.stepper->setSpeedInMilliHz(speed);
+            axis.stepper->move(distance);
+            axis.homingMoveIssued = true;
+        }
+        return HomingApproach::MOVING;
+    }
+    if (pinActive || confirmed) {
+        if (axis.stepper->isRunning()) {
+            forceStopMotion(axis);
+            axis.homingEdgeStop = true;
+        }
+        return confirmed ? HomingApproach::FOUND : HomingApproach::MOVING;
+    }
+    if (!axis.stepper->isRunning()) {
+        if (axis.homingEdgeStop) {
+            axis.homingMoveIssued = false;  // Edge was noise - approach again
+            axis.homingEdgeStop = false;
+            return HomingApproach::MOVING;
+        }
+        return HomingApproach::NOT_FOUND;
+    }
+    return HomingApproach::MOVING;
+}
+
+/**
+ * Preferences namespace of an axis' calibration ("skullcal", "skullcal1", ...)
+ */
+static const char* calibrationNamespace(const Axis& axis, char* buffer, size_t size) {
+    if (axis.index == 0) {
+        return CALIBRATION_NAMESPACE;  // Keeps single-axis calibrations valid
+    }
+    snprintf(buffer, size, "%s%d", CALIBRATION_NAMESPACE, axis.index);
+    return buffer;
+}
+
+/**
+ * Load the stored homing calibration (range and switch signature)
+ */
+static void loadCalibration(Axis& axis) {
+    char name[16];
+    memset(&axis.calibration, 0, sizeof(axis.calibration));
+    if (!g_calibrationPreferences.begin(calibrationNamespace(axis, name, sizeof(name)), true)) {
+        return;  // Nothing stored yet
+    }
+    axis.calibration.range = g_calibrationPreferences.getInt("range", 0);
+    axis.calibration.leftHysteresis = g_calibrationPreferences.getInt("hystL", -1);
+    axis.calibration.rightHysteresis = g_calibrationPreferences.getInt("hystR", -1);
+    axis.calibration.speedMilliHz = g_calibrationPreferences.getInt("speed", 0);
+    if (axis.index > 0) {
+        axis.userMinPosition = g_calibrationPreferences.getInt("userMin", MIN_POSITION_STEPS);
+        axis.userMaxPosition = g_calibrationPreferences.getInt("userMax", MAX_POSITION_STEPS);
+    }
+    g_calibrationPreferences.end();
     
-    // Process left limit if pin changed OR interrupt fired
-    if (leftPinReading != g_lastLeftPinReading || g_leftLimitTriggered) {
-        processLeftLimit(leftPinReading, currentTime);
-        g_lastLeftPinReading = leftPinReading;
+    axis.calibration.valid = axis.calibration.range > 0 && axis.calibration.leftHysteresis >= 0;
+    if (axis.calibration.valid) {
+        CORE_LOG_INFO("StepperController: Stored range %d steps (left switch hysteresis %d)",
+                     axis.calibration.range, axis.calibration.leftHysteresis);
     }
+}
+
+/**
+ * Persist a homing calibration measured by a full sweep
+ * Called from Core 1 only (flushPendingSaves), without g_stepperMutex held
+ */
+static void saveCalibration(const Axis& axis, const HomingCalibration& calibration) {
+    char name[16];
+    if (!g_calibrationPreferences.begin(calibrationNamespace(axis, name, sizeof(name)), false)) {
+        CORE_LOG_INFO("StepperController: Failed to store homing calibration");
+        return;
+    }
+    g_calibrationPreferences.putInt("range", calibration.range);
+    g_calibrationPreferences.putInt("hystL", calibration.leftHysteresis);
+    g_calibrationPreferences.putInt("hystR", calibration.rightHysteresis);
+    g_calibrationPreferences.putInt("speed", calibration.speedMilliHz);
+    g_calibrationPreferences.end();
     
-    // Process right limit if pin changed OR interrupt fired
-    if (rightPinReading != g_lastRightPinReading || g_rightLimitTriggered) {
-        processRightLimit(rightPinReading, currentTime);
-        g_lastRightPinReading = rightPinReading;
+    CORE_LOG_INFO("StepperController: Stored range %d steps for verify homing", calibration.range);
+}
+
+/**
+ * Persist the user limits of axis 1..N next to its calibration
+ * Called from Core 1 only, without g_stepperMutex held
+ */
+static void saveUserLimits(const Axis& axis, int32_t minPos, int32_t maxPos) {
+    char name[16];
+    if (!g_calibrationPreferences.begin(calibrationNamespace(axis, name, sizeof(name)), false)) {
+        CORE_LOG_INFO("StepperController: Failed to store axis %d user limits", axis.index);
+        return;
+    }
+    g_calibrationPreferences.putInt("userMin", minPos);
+    g_calibrationPreferences.putInt("userMax", maxPos);
+    g_calibrationPreferences.end();
+}
+
+/**
+ * User limits of an axis (not yet constrained to its operating range)
+ * Axis 0 keeps them in SystemConfig minPosition/maxPosition; axes 1..N keep
+ * their own, so homing one axis never moves another axis' limits
+ */
+static void readUserLimits(const Axis& axis, int32_t& minPos, int32_t& maxPos) {
+    SystemConfig* config = SystemConfigMgr::getConfig();
+    if (axis.index == 0 && config) {
+        minPos = config->minPosition;
+        maxPos = config->maxPosition;
+    } else if (axis.index == 0) {
+        minPos = axis.minPosition;
+        maxPos = axis.maxPosition;
+    } else {
+        minPos = axis.userMinPosition;
+        maxPos = axis.userMaxPosition;
+    }
+}
+
+/**
+ * Change an axis' user limits from the Core 0 task and flag them for saving
+ */
+static void writeUserLimits(Axis& axis, int32_t minPos, int32_t maxPos) {
+    SystemConfig* config = SystemConfigMgr::getConfig();
+    if (axis.index == 0) {
+        if (config) {
+            config->minPosition = minPos;
+            config->maxPosition = maxPos;
+            g_configSavePending = true;  // Saved from Core 1
+        }
+        return;
+    }
+    axis.userMinPosition = minPos;
+    axis.userMaxPosition = maxPos;
+    axis.userLimitsSavePending = true;
+}
+
+/**
+ * Check this sequence's left switch signature against the stored one
+ * @return true if the stored range can be trusted without a sweep
+ */
+static bool calibrationMatches(Axis& axis) {
+    if (axis.leftHysteresis < 0) {
+        CORE_LOG_INFO("StepperController: Left switch not measured on a slow pass - running full sweep");
+        return false;
+    }
+    int32_t drift = abs(axis.leftHysteresis - axis.calibration.leftHysteresis);
+    if (drift > HOMING_VERIFY_TOLERANCE_STEPS) {
+        CORE_LOG_INFO("StepperController: Left switch hysteresis %d, stored %d - running full sweep",
+                     axis.leftHysteresis, axis.calibration.leftHysteresis);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Apply the detected range and move to the configured home position
+ * Shared by the full sweep and verify homing
+ */
+static void beginMoveToHome(Axis& axis) {
+    axis.maxPosition = axis.detectedRightLimit - axis.limitSafetyMargin;
+    axis.positionLimitsValid = true;
+    
+    // If this axis' user limits are not set or invalid, set them to its physical limits
+    int32_t userMinPos, userMaxPos;
+    readUserLimits(axis, userMinPos, userMaxPos);
+    bool minLimitInvalid = (userMinPos < axis.minPosition || userMinPos >= axis.maxPosition);
+    bool maxLimitInvalid = (userMaxPos > axis.maxPosition || userMaxPos <= axis.minPosition);
+    if (minLimitInvalid || maxLimitInvalid) {
+        writeUserLimits(axis, minLimitInvalid ? axis.minPosition : userMinPos,
+                        maxLimitInvalid ? axis.maxPosition : userMaxPos);
     }
     
-    // Update global status
-    SAFE_WRITE_STATUS(limitsActive[0], g_leftLimitState);
-    SAFE_WRITE_STATUS(limitsActive[1], g_rightLimitState);
+    // Get configuration
+    SystemConfig* config = SystemConfigMgr::getConfig();
+    if (config) {
+        // Calculate home position based on configured percentage
+        float homePercent = config->homePositionPercent;
+        int32_t homePosition = FixedPoint::lerp(axis.minPosition, axis.maxPosition,
+                                                FixedPoint::fractionFromPercent(homePercent));
+        
+        // Move to configured home position
+        axis.stepper->setSpeedInMilliHz(homingTravelSpeed(axis));  // Use homing speed, not max speed
+        axis.stepper->moveTo(homePosition);
+        axis.homingState = HomingState::MOVING_TO_CENTER;
+        
+        // Print summary once when transitioning to MOVING_TO_CENTER
+        CORE_LOG_INFO("StepperController: Physical limits: 0 to %d, Operating range: %d to %d (%d steps), margin: %d", 
+                     axis.detectedRightLimit, axis.minPosition, axis.maxPosition, 
+                     axis.maxPosition - axis.minPosition, axis.limitSafetyMargin);
+        CORE_LOG_INFO("StepperController: Moving to %.1f%% of range", homePercent);
+    } else {
+        // No config, just use center position
+        int32_t homePosition = (axis.minPosition + axis.maxPosition) / 2;
+        axis.stepper->setSpeedInMilliHz(homingTravelSpeed(axis));  // Use homing speed, not max speed
+        axis.stepper->moveTo(homePosition);
+        axis.homingState = HomingState::MOVING_TO_CENTER;
+        
+        CORE_LOG_INFO("StepperController: Range detected: %d to %d, moving to center", 
+                     axis.minPosition, axis.maxPosition);
+    }
 }
 
 /**
  * Update homing sequence state machine
  * Called from Core 0 task only
  */
-static void updateHomingSequence() {
+static void updateHomingSequence(Axis& axis) {
     if (xSemaphoreTake(g_stepperMutex, pdMS_TO_TICKS(1)) != pdTRUE) {
         return; // Skip this cycle if can't get mutex quickly
     }
     
     // Track state changes to avoid repeated messages
-    static HomingState lastPrintedState = HomingState::IDLE;
-    bool stateChanged = (g_homingState != lastPrintedState);
+    bool stateChanged = (axis.homingState != axis.printedHomingState);
     
     // Check for overall homing timeout
-    if (millis() - g_homingStartTime > HOMING_TIMEOUT_MS) {
-        if (g_homingState != HomingState::ERROR) {
-            g_homingState = HomingState::ERROR;
-            g_stepper->forceStop();
-            Serial.println("StepperController: ERROR - Homing timeout!");
+    if (StepperHal::millis() - axis.homingStartTime > HOMING_TIMEOUT_MS) {
+        if (axis.homingState != HomingState::ERROR) {
+            axis.homingState = HomingState::ERROR;
+            forceStopMotion(axis);
+            CORE_LOG_ERROR("StepperController: ERROR - Homing timeout!");
         }
     }
     
-    switch (g_homingState) {
+    switch (axis.homingState) {
         case HomingState::FINDING_LEFT:
-            g_homingProgress = 10;
-            if (g_leftLimitState) {
-                // Found left limit, record position
-                g_detectedLeftLimit = g_stepper->getCurrentPosition();
-                g_stepper->forceStop();
-                g_homingState = HomingState::BACKING_OFF_LEFT;
-                g_homingPhaseStartTime = millis();
-                Serial.printf("StepperController: Found left limit at position %d\n", g_detectedLeftLimit);
-            } else if (!g_stepper->isRunning()) {
-                // Movement stopped without finding limit - error
-                g_homingState = HomingState::ERROR;
-                Serial.println("StepperController: ERROR - Left limit not found");
+            axis.homingProgress = 10;
+            switch (serviceHomingApproach(axis, -HOMING_SEARCH_STEPS, homingPassSpeed(axis),
+                                          axis.lastLeftPinReading, axis.leftLimitState)) {
+                case HomingApproach::FOUND:
+                    // Found left limit - the switch closed at the latched edge
+                    axis.detectedLeftLimit = axis.leftEdgePosition;
+                    if (axis.homingSlowPass) {
+                        axis.leftTriggerPosition = axis.leftEdgePosition;
+                        axis.leftTriggerMeasured = true;
+                    }
+                    endHomingPhase(axis, axis.homingRun.findLeft);
+                    setHomingState(axis, HomingState::BACKING_OFF_LEFT);
+                    CORE_LOG_INFO("StepperController: Found left limit at position %d (latched %d steps before confirmation)",
+                                 axis.detectedLeftLimit, axis.limitStats.lastLatchDelta);
+                    break;
+                case HomingApproach::NOT_FOUND:
+                    // Movement stopped without finding limit - error
+                    axis.homingState = HomingState::ERROR;
+                    CORE_LOG_ERROR("StepperController: ERROR - Left limit not found");
+                    break;
+                default:
+                    break;
             }
             break;
             
         case HomingState::BACKING_OFF_LEFT:
-            g_homingProgress = 25;
-            if (!g_stepper->isRunning()) {
-                // Check if we need to continue backing off or if we're done
-                if (g_leftLimitState) {
-                    // Still on limit, back off slowly to find exact release point
-                    g_stepper->move(10);  // Move 10 steps at a time to find release point
-                } else {
-                    // Switch has released - this is our physical limit position
-                    // Set coordinate system with this point as 0
-                    g_stepper->setCurrentPosition(0);
-                    g_currentPosition = 0;
-                    g_detectedLeftLimit = 0;  // Left limit is at position 0
-                    g_minPosition = (int32_t)g_limitSafetyMargin;  // Operating minimum is margin away from switch
+            axis.homingProgress = 25;
+            if (!axis.homingMoveIssued) {
+                // Drive off the switch in one move; the release edge ends it
+                if (!axis.stepper->isRunning()) {
+                    axis.stepper->setSpeedInMilliHz(homingPassSpeed(axis));
+                    axis.stepper->move(HOMING_RELEASE_MAX_STEPS);
+                    axis.homingMoveIssued = true;
+                }
+            } else if (axis.homingReleased) {
+                if (!axis.stepper->isRunning()) {
+                    axis.leftHysteresis = axis.leftTriggerMeasured ?
+                                       axis.homingReleasePosition - axis.leftTriggerPosition : -1;
+                    
+                    // The release point becomes position 0
+                    int32_t position = axis.stepper->getCurrentPosition() - axis.homingReleasePosition;
+                    axis.stepper->setCurrentPosition(position);
+                    axis.currentPosition = position;
+                    axis.detectedLeftLimit = 0;  // Left limit is at position 0
+                    axis.minPosition = axis.limitSafetyMargin;  // Operating minimum is margin away from switch
+                    endHomingPhase(axis, axis.homingRun.releaseLeft);
+                    
+                    if (axis.homingVerify && calibrationMatches(axis)) {
+                        // Left switch matches the stored signature - skip the sweep
+                        axis.detectedRightLimit = axis.calibration.range;
+                        axis.homingRun.verified = true;
+                        CORE_LOG_INFO("StepperController: Home verified against stored range (%d steps)",
+                                     axis.calibration.range);
+                        beginMoveToHome(axis);
+                        break;
+                    }
                     
-                    // Start moving to find right limit - use a much larger distance
-                    g_stepper->setSpeedInHz(g_homingSpeed);
-                    g_stepper->moveTo(100000); // Move 100k steps - should hit limit before this
-                    g_homingState = HomingState::FINDING_RIGHT;
-                    g_homingPhaseStartTime = millis();
-                    Serial.println("StepperController: Home position set, finding right limit");
+                    // Find the right limit next, fast again if two-speed homing is on
+                    axis.homingSlowPass = (axis.homingFastSpeedMilliHz == 0);
+                    setHomingState(axis, HomingState::FINDING_RIGHT);
+                    CORE_LOG_INFO("StepperController: Home position set, finding right limit");
+                }
+            } else if (!axis.leftLimitState) {
+                // Switch has released - this is our physical limit position
+                axis.homingReleasePosition = axis.leftEdgePosition;
+                if (!axis.homingSlowPass) {
+                    // Fast pass: clear the switch, then come back slowly
+                    axis.stepper->moveTo(axis.homingReleasePosition + HOMING_CLEARANCE_STEPS);
+                    axis.homingSlowPass = true;
+                    setHomingState(axis, HomingState::REAPPROACH_LEFT);
+                } else {
+                    axis.homingReleased = true;
+                    axis.stepper->stopMove();
                 }
+            } else if (!axis.stepper->isRunning()) {
+                axis.homingState = HomingState::ERROR;
+                CORE_LOG_ERROR("StepperController: ERROR - Left limit did not release");
             }
             break;
             
-        case HomingState::FINDING_RIGHT:
-            g_homingProgress = 50;
-            if (g_rightLimitState) {
-                // Found right limit, record position
-                g_detectedRightLimit = g_stepper->getCurrentPosition();
-                g_stepper->forceStop();
-                g_homingState = HomingState::BACKING_OFF_RIGHT;
-                g_homingPhaseStartTime = millis();
-                Serial.printf("StepperController: Found right limit at position %d\n", g_detectedRightLimit);
-            } else if (!g_stepper->isRunning()) {
-                // Movement stopped without finding limit - error
-                g_homingState = HomingState::ERROR;
-                Serial.println("StepperController: ERROR - Right limit not found (reached max travel)");
-            } else if (millis() - g_homingPhaseStartTime > HOMING_TIMEOUT_MS) {
-                // Timeout waiting for right limit
-                g_stepper->forceStop();
-                g_homingState = HomingState::ERROR;
-                Serial.println("StepperController: ERROR - Right limit not found (timeout)");
+        case HomingState::REAPPROACH_LEFT:
+            axis.homingProgress = 30;
+            switch (serviceHomingApproach(axis, -(HOMING_CLEARANCE_STEPS + HOMING_RELEASE_MAX_STEPS),
+                                          axis.homingSpeedMilliHz, axis.lastLeftPinReading, axis.leftLimitState)) {
+                case HomingApproach::FOUND:
+                    axis.detectedLeftLimit = axis.leftEdgePosition;
+                    axis.leftTriggerPosition = axis.leftEdgePosition;
+                    axis.leftTriggerMeasured = true;
+                    setHomingState(axis, HomingState::BACKING_OFF_LEFT);
+                    break;
+                case HomingApproach::NOT_FOUND:
+                    axis.homingState = HomingState::ERROR;
+                    CORE_LOG_ERROR("StepperController: ERROR - Left limit lost on re-approach");
+                    break;
+                default:
+                    break;
             }
             break;
             
-        case HomingState::BACKING_OFF_RIGHT:
-            g_homingProgress = 75;
-            if (!g_stepper->isRunning()) {
-                // Check if we need to continue backing off or if we're done
-                if (g_rightLimitState) {
-                    // Still on limit, back off slowly to find exact release point
-                    g_stepper->move(-10);  // Move 10 steps at a time to find release point
-                } else {
-                    // Switch has released - this is our physical limit position
-                    g_detectedRightLimit = g_stepper->getCurrentPosition();
-                    g_maxPosition = g_detectedRightLimit - (int32_t)g_limitSafetyMargin;
-                    g_positionLimitsValid = true;
-                    
-                    // Get configuration
-                    SystemConfig* config = SystemConfigMgr::getConfig();
-                if (config) {
-                    // If user limits are not set or invalid, set them to physical limits
-                    bool minLimitUpdated = false;
-                    bool maxLimitUpdated = false;
-                    if (config->minPosition < g_minPosition || config->minPosition >= g_maxPosition) {
-                        config->minPosition = g_minPosition;
-                        minLimitUpdated = true;
-                    }
-                    if (config->maxPosition > g_maxPosition || config->maxPosition <= g_minPosition) {
-                        config->maxPosition = g_maxPosition;
-                        maxLimitUpdated = true;
+        case HomingState::FINDING_RIGHT:
+            axis.homingProgress = 50;
+            switch (serviceHomingApproach(axis, HOMING_SEARCH_STEPS, homingPassSpeed(axis),
+                                          axis.lastRightPinReading, axis.rightLimitState)) {
+                case HomingApproach::FOUND:
+                    // Found right limit - the switch closed at the latched edge
+                    axis.detectedRightLimit = axis.rightEdgePosition;
+                    if (axis.homingSlowPass) {
+                        axis.rightTriggerPosition = axis.rightEdgePosition;
+                        axis.rightTriggerMeasured = true;
                     }
-                    
-                    // Save the updated configuration
-                    SystemConfigMgr::saveToEEPROM();
-                    
-                    // Calculate home position based on configured percentage
-                    float homePercent = config->homePositionPercent;
-                    int32_t range = g_maxPosition - g_minPosition;
-                    int32_t homePosition = g_minPosition + (int32_t)((range * homePercent) / 100.0f);
-                    
-                    // Move to configured home position
-                    g_stepper->setSpeedInHz(g_homingSpeed);  // Use homing speed, not max speed
-                    g_stepper->moveTo(homePosition);
-                    g_homingState = HomingState::MOVING_TO_CENTER;
-                    
-                    // Print summary once when transitioning to MOVING_TO_CENTER
-                    Serial.printf("StepperController: Physical limits: 0 to %d, Operating range: %d to %d (%d steps), margin: %.0f\n", 
-                                 g_detectedRightLimit, g_minPosition, g_maxPosition, 
-                                 g_maxPosition - g_minPosition, g_limitSafetyMargin);
-                    Serial.printf("StepperController: Moving to %.1f%% of range\n", homePercent);
-                } else {
-                    // No config, just use center position
-                    int32_t homePosition = (g_minPosition + g_maxPosition) / 2;
-                    g_stepper->setSpeedInHz(g_homingSpeed);  // Use homing speed, not max speed
-                    g_stepper->moveTo(homePosition);
-                    g_homingState = HomingState::MOVING_TO_CENTER;
-                    
-                    Serial.printf("StepperController: Range detected: %d to %d, moving to center\n", 
-                                 g_minPosition, g_maxPosition);
+                    endHomingPhase(axis, axis.homingRun.findRight);
+                    setHomingState(axis, HomingState::BACKING_OFF_RIGHT);
+                    CORE_LOG_INFO("StepperController: Found right limit at position %d (latched %d steps before confirmation)",
+                                 axis.detectedRightLimit, axis.limitStats.lastLatchDelta);
+                    break;
+                case HomingApproach::NOT_FOUND:
+                    // Movement stopped without finding limit - error
+                    axis.homingState = HomingState::ERROR;
+                    CORE_LOG_ERROR("StepperController: ERROR - Right limit not found (reached max travel)");
+                    break;
+                default:
+                    if (StepperHal::millis() - axis.homingPhaseStartTime > HOMING_TIMEOUT_MS) {
+                        // Timeout waiting for right limit
+                        forceStopMotion(axis);
+                        axis.homingState = HomingState::ERROR;
+                        CORE_LOG_ERROR("StepperController: ERROR - Right limit not found (timeout)");
                     }
-                }
+                    break;
             }
             break;
             
-        case HomingState::MOVING_TO_CENTER:
-            g_homingProgress = 90;
-            if (!g_stepper->isRunning()) {
-                // Homing complete!
-                g_homingState = HomingState::COMPLETE;
-                g_homingProgress = 100;
-                g_systemHomed = true;
-                g_motionState = MotionState::IDLE;
-                g_limitFaultActive = false;  // Clear any limit faults after successful homing
-                SAFE_WRITE_STATUS(safetyState, SafetyState::NORMAL);  // Clear safety state
+        case HomingState::REAPPROACH_RIGHT:
+            axis.homingProgress = 70;
+            switch (serviceHomingApproach(axis, HOMING_CLEARANCE_STEPS + HOMING_RELEASE_MAX_STEPS,
+                                          axis.homingSpeedMilliHz, axis.lastRightPinReading, axis.rightLimitState)) {
+                case HomingApproach::FOUND:
+                    axis.detectedRightLimit = axis.rightEdgePosition;
+                    axis.rightTriggerPosition = axis.rightEdgePosition;
+                    axis.rightTriggerMeasured = true;
+                    setHomingState(axis, HomingState::BACKING_OFF_RIGHT);
+                    break;
+                case HomingApproach::NOT_FOUND:
+                    axis.homingState = HomingState::ERROR;
+                    CORE_LOG_ERROR("StepperController: ERROR - Right limit lost on re-approach");
+                    break;
+                default:
+                    break;
+            }
+            break;
+            
+        case HomingState::BACKING_OFF_RIGHT:
+            axis.homingProgress = 75;
+            if (!axis.homingMoveIssued) {
+                if (!axis.stepper->isRunning()) {
+                    axis.stepper->setSpeedInMilliHz(homingPassSpeed(axis));
+                    axis.stepper->move(-HOMING_RELEASE_MAX_STEPS);
+                    axis.homingMoveIssued = true;
+                }
+            } else if (axis.rightLimitState) {
+                if (!axis.stepper->isRunning()) {
+                    axis.homingState = HomingState::ERROR;
+                    CORE_LOG_ERROR("StepperController: ERROR - Right limit did not release");
+                }
+            } else if (!axis.homingSlowPass) {
+                // Fast pass: clear the switch, then come back slowly
+                axis.stepper->moveTo(axis.rightEdgePosition - HOMING_CLEARANCE_STEPS);
+                axis.homingSlowPass = true;
+                setHomingState(axis, HomingState::REAPPROACH_RIGHT);
+            } else {
+                // Switch has released - this is our physical limit position
+                // The move to home retargets the running motor, no stop needed
+                axis.detectedRightLimit = axis.rightEdgePosition;
+                endHomingPhase(axis, axis.homingRun.releaseRight);
                 
-                uint32_t homingTime = millis() - g_homingStartTime;
-                Serial.printf("StepperController: Homing complete! Position: %d, Time: %lu ms\n",
-                             g_stepper->getCurrentPosition(), homingTime);
+                // Store the range and switch signature for verify homing
+                if (axis.leftHysteresis >= 0) {
+                    axis.calibration.valid = true;
+                    axis.calibration.range = axis.detectedRightLimit;
+                    axis.calibration.leftHysteresis = axis.leftHysteresis;
+                    axis.calibration.rightHysteresis = axis.rightTriggerMeasured ?
+                                                    axis.rightTriggerPosition - axis.detectedRightLimit : -1;
+                    axis.calibration.speedMilliHz = axis.homingSpeedMilliHz;
+                    axis.calibrationSavePending = true;
+                }
+                beginMoveToHome(axis);
+            }
+            break;
+            
+        case HomingState::MOVING_TO_CENTER:
+            axis.homingProgress = 90;
+            if (!axis.stepper->isRunning()) {
+                // Homing complete!
+                axis.homingState = HomingState::COMPLETE;
+                axis.homingProgress = 100;
+                axis.systemHomed = true;
+                axis.motionState = MotionState::IDLE;
+                axis.limitFaultActive = false;  // Clear any limit faults after successful homing
+                SAFE_WRITE_STATUS(safetyState, SafetyState::NORMAL);  // Clear safety state
+
+                // Moves plan their ETA with the profile speed - leave homing speed behind
+                axis.stepper->setSpeedInHz(axis.currentProfile.maxSpeed);
+
+                endHomingPhase(axis, axis.homingRun.moveHome);
+                axis.homingRun.total = StepperHal::millis() - axis.homingStartTime;
+                axis.homingTimes = axis.homingRun;
+                CORE_LOG_INFO("StepperController: Homing complete! Position: %d, Time: %lu ms",
+                             axis.stepper->getCurrentPosition(), axis.homingRun.total);
+                CORE_LOG_INFO("StepperController: Phases (ms) - find left %lu, release left %lu, "
+                              "find right %lu, release right %lu, move home %lu%s",
+                              axis.homingRun.findLeft, axis.homingRun.releaseLeft,
+                              axis.homingRun.findRight, axis.homingRun.releaseRight,
+                              axis.homingRun.moveHome, axis.homingRun.fastApproach ? " (two-speed)" : "");
+                if (axis.homingRun.verified) {
+                    CORE_LOG_INFO("StepperController: Range verified from stored calibration");
+                }
             }
             break;
             
         case HomingState::ERROR:
-            g_homingProgress = 0;
-            g_motionState = MotionState::IDLE;
+            axis.homingProgress = 0;
+            axis.motionState = MotionState::IDLE;
             SAFE_WRITE_STATUS(safetyState, SafetyState::POSITION_ERROR);
             break;
             
@@ -456,73 +1226,808 @@ static void updateHomingSequence() {
     }
     
     // Update last printed state to track changes
-    lastPrintedState = g_homingState;
+    axis.printedHomingState = axis.homingState;
+    
+    xSemaphoreGive(g_stepperMutex);
+}
+
+/**
+ * Final target of the motion in progress (end of the stream, not the next chunk)
+ * Called with the stepper mutex held
+ */
+static int32_t commandedTarget(Axis& axis) {
+    if (axis.streamSource == StreamSource::SCURVE) {
+        return axis.scurve.startPosition + axis.scurve.direction * axis.scurve.distance;
+    } else if (axis.streamSource == StreamSource::CUE) {
+        return axis.cueTrack.keys[axis.cueTrack.count - 1].position;
+    } else if (axis.streamSource == StreamSource::PATH) {
+        return (axis.path.count > 0) ?
+            MotionPlanner::pathAt(axis.path, axis.path.count - 1)->target : axis.streamQueueEnd;
+    }
+    return axis.stepper->targetPos();
+}
+
+/**
+ * Record motion and homing state changes in the motion trace
+ * Called from Core 0 task only, after the motion state is updated
+ */
+static void traceStateChanges(Axis& axis) {
+    if (axis.motionState != axis.tracedMotionState) {
+        MotionTrace::record(MotionTrace::Event::RAMP_PHASE, (uint8_t)axis.motionState, 0, axis.currentPosition);
+        axis.tracedMotionState = axis.motionState;
+    }
+    if (axis.homingState != axis.tracedHomingState) {
+        MotionTrace::record(MotionTrace::Event::HOMING_PHASE, (uint8_t)axis.homingState, 0, axis.currentPosition);
+        axis.tracedHomingState = axis.homingState;
+    }
+}
+
+/**
+ * Update motion status in global status structure
+ * Called from Core 0 task only
+ */
+static void updateMotionStatus(Axis& axis) {
+    if (xSemaphoreTake(g_stepperMutex, pdMS_TO_TICKS(1)) != pdTRUE) {
+        return; // Skip this cycle if can't get mutex quickly
+    }
+    
+    // Update position and speed
+    if (axis.stepper) {
+        axis.currentPosition = axis.stepper->getCurrentPosition();
+        axis.targetPosition = commandedTarget(axis);
+        // Kept in milliHz; converted to steps/sec when published
+        axis.currentSpeedMilliHz = axis.stepper->getCurrentSpeedInMilliHz();
+        
+        // Update motion state
+        if (axis.homingState != HomingState::IDLE && 
+            axis.homingState != HomingState::COMPLETE &&
+            axis.homingState != HomingState::ERROR) {
+            axis.motionState = MotionState::HOMING;
+        } else if (axis.streamSource == StreamSource::SCURVE) {
+            // Motion phase follows the profile segment at the current time
+            float t = FixedPoint::microsToSeconds((int32_t)(StepperHal::micros() - axis.streamStartMicros));
+            uint8_t segment = MotionPlanner::segmentAt(axis.scurve, t);
+            if (segment < 3) {
+                axis.motionState = MotionState::ACCELERATING;
+            } else if (segment == 3) {
+                axis.motionState = MotionState::CONSTANT_VELOCITY;
+            } else {
+                axis.motionState = MotionState::DECELERATING;
+            }
+        } else if (axis.streamSource == StreamSource::CUE && axis.cueKey >= 0) {
+            // Keyframe motion changes direction freely - classify by speed trend
+            float t = FixedPoint::microsToSeconds((int32_t)(StepperHal::micros() - axis.streamStartMicros));
+            float speedNow = fabsf(pieceVelocityAt(axis, t));
+            float speedNext = fabsf(pieceVelocityAt(axis, t + FixedPoint::microsToSeconds(STREAM_CHUNK_US)));
+            if (speedNow < 1.0f && speedNext < 1.0f) {
+                axis.motionState = MotionState::IDLE;  // Holding between keyframes
+            } else if (speedNext > speedNow + 1.0f) {
+                axis.motionState = MotionState::ACCELERATING;
+            } else if (speedNext < speedNow - 1.0f) {
+                axis.motionState = MotionState::DECELERATING;
+            } else {
+                axis.motionState = MotionState::CONSTANT_VELOCITY;
+            }
+        } else if (axis.streamSource == StreamSource::PATH && axis.pathFrontLoaded) {
+            // Phase within the executing waypoint segment
+            const MotionPlanner::PathSegment* seg = MotionPlanner::pathAt(axis.path, 0);
+            float t = FixedPoint::microsToSeconds((int32_t)(StepperHal::micros() - axis.streamStartMicros));
+            if (t < seg->accelTime) {
+                axis.motionState = MotionState::ACCELERATING;
+            } else if (t < seg->accelTime + seg->cruiseTime) {
+                axis.motionState = MotionState::CONSTANT_VELOCITY;
+            } else if (axis.stepper->isRunning()) {
+                axis.motionState = MotionState::DECELERATING;
+            } else {
+                axis.motionState = MotionState::IDLE;
+            }
+        } else if (axis.stepper->isRunning()) {
+            // Determine motion phase based on speed and acceleration
+            if (axis.stepper->isRampGeneratorActive()) {
+                uint8_t rampState = axis.stepper->rampState();
+                if (rampState & RAMP_STATE_ACCELERATING_FLAG) {
+                    axis.motionState = MotionState::ACCELERATING;
+                } else if (rampState & RAMP_STATE_DECELERATING_FLAG) {
+                    axis.motionState = MotionState::DECELERATING;
+                } else {
+                    axis.motionState = MotionState::CONSTANT_VELOCITY;
+                }
+            } else {
+                axis.motionState = MotionState::CONSTANT_VELOCITY;
+            }
+        } else {
+            axis.motionState = MotionState::IDLE;
+            endCoordinatedMove(axis);
+        }
+        traceStateChanges(axis);
+    }
+    
+    xSemaphoreGive(g_stepperMutex);
+}
+
+/**
+ * Arm the motion timeout for a move expected to arrive in expectedMs
+ */
+static void armMotionTimeout(Axis& axis, uint32_t expectedMs) {
+    uint32_t tolerance = max(MOTION_TIMEOUT_MARGIN_MS, expectedMs / 100 * MOTION_TIMEOUT_TOLERANCE_PCT);
+    axis.motionArrivalTime = StepperHal::millis() + expectedMs;
+    axis.motionDeadline = axis.motionArrivalTime + tolerance;
+    axis.motionTimeoutArmed = true;
+}
+
+/**
+ * Arm the motion timeout for a stream ending remainingMicros after the
+ * current piece start (the piece may start slightly ahead, in the look-ahead)
+ */
+static void armStreamTimeout(Axis& axis, uint32_t remainingMicros) {
+    int32_t untilEnd = (int32_t)(axis.streamStartMicros + remainingMicros - StepperHal::micros());
+    armMotionTimeout(axis, untilEnd > 0 ? (uint32_t)untilEnd / 1000 + 1 : 0);
+}
+
+/**
+ * Expected time for the ramp generator to reach a target from the current motion
+ * @return milliseconds
+ */
+static uint32_t rampArrivalMs(Axis& axis, int32_t target, float maxSpeed) {
+    float seconds = MotionPlanner::moveDuration(target - axis.stepper->getCurrentPosition(),
+                                                FixedPoint::fromMilli(axis.stepper->getCurrentSpeedInMilliHz()),
+                                                maxSpeed, axis.currentProfile.acceleration);
+    return (uint32_t)ceilf(seconds * 1000.0f);
+}
+
+/**
+ * Time until the armed move is expected to arrive
+ * @return milliseconds, 0 when at rest or already past the ETA
+ */
+static uint32_t timeToArrivalMs(Axis& axis) {
+    if (!axis.motionTimeoutArmed) {
+        return 0;
+    }
+    int32_t remaining = (int32_t)(axis.motionArrivalTime - StepperHal::millis());
+    return remaining > 0 ? (uint32_t)remaining : 0;
+}
+
+/**
+ * Publish this cycle's motion fields - every axis to the axis snapshots,
+ * axis 0 also to the global status, each in one write
+ * Called from Core 0 task only, once per cycle
+ */
+static void publishMotionStatus() {
+    AxisStatus snapshot[STEPPER_AXIS_COUNT];
+    for (uint8_t i = 0; i < STEPPER_AXIS_COUNT; i++) {
+        Axis& axis = g_axes[i];
+        AxisStatus& status = snapshot[i];
+        status.currentPosition = axis.currentPosition;
+        status.targetPosition = axis.targetPosition;
+        status.currentSpeed = FixedPoint::fromMilli(axis.currentSpeedMilliHz);
+        status.timeToArrival = timeToArrivalMs(axis);
+        status.motionState = axis.motionState;
+        status.stepperEnabled = axis.stepperEnabled;
+        status.limitsActive[0] = axis.leftLimitState;
+        status.limitsActive[1] = axis.rightLimitState;
+        status.stepperAlarm = axis.alarmState;
+        status.homed = axis.systemHomed;
+        status.homing = isAxisHoming(axis);
+        status.limitFault = axis.limitFaultActive;
+    }
+    
+    portENTER_CRITICAL(&g_axisStatusLock);
+    g_axisStatusSequence.fetch_add(1, std::memory_order_relaxed);  // Odd: write in progress
+    std::atomic_thread_fence(std::memory_order_release);
+    memcpy(g_axisStatus, snapshot, sizeof(g_axisStatus));
+    g_axisStatusSequence.fetch_add(1, std::memory_order_release);  // Even: snapshot stable
+    portEXIT_CRITICAL(&g_axisStatusLock);
+    
+    const AxisStatus& primary = snapshot[0];
+    beginStatusWrite();
+    g_systemStatus.currentPosition = primary.currentPosition;
+    g_systemStatus.targetPosition = primary.targetPosition;
+    g_systemStatus.currentSpeed = primary.currentSpeed;
+    g_systemStatus.motionState = primary.motionState;
+    g_systemStatus.stepperEnabled = primary.stepperEnabled;
+    g_systemStatus.limitsActive[0] = primary.limitsActive[0];
+    g_systemStatus.limitsActive[1] = primary.limitsActive[1];
+    g_systemStatus.stepperAlarm = primary.stepperAlarm;
+    g_systemStatus.timeToArrival = primary.timeToArrival;
+    endStatusWrite();
+}
+
+/**
+ * Make a piece current and reset the per-piece counters
+ */
+static void beginPiece(Axis& axis, int32_t start, int32_t end, uint32_t durationMicros) {
+    axis.pieceStart = start;
+    axis.pieceEnd = end;
+    axis.pieceMicros = durationMicros;
+    axis.streamQueuedMicros = 0;
+    axis.streamQueuedSteps = 0;
+}
+
+/**
+ * Offset from the current piece start at time t (signed, fractional steps)
+ */
+static float piecePositionAt(Axis& axis, float t) {
+    switch (axis.streamSource) {
+        case StreamSource::PATH: {
+            const MotionPlanner::PathSegment& seg = *MotionPlanner::pathAt(axis.path, 0);
+            float distance = MotionPlanner::segmentPositionAt(seg, t);
+            return (seg.target >= seg.start) ? distance : -distance;
+        }
+        case StreamSource::CUE:
+            return CueEngine::hermitePosition(axis.cueTrack.keys[axis.cueKey],
+                                              axis.cueTrack.keys[axis.cueKey + 1], t) - axis.pieceStart;
+        default:
+            return axis.scurve.direction * MotionPlanner::positionAt(axis.scurve, t);
+    }
+}
+
+/**
+ * Velocity of the current piece at time t (signed, steps/sec)
+ */
+static float pieceVelocityAt(Axis& axis, float t) {
+    switch (axis.streamSource) {
+        case StreamSource::PATH: {
+            if (!axis.pathFrontLoaded) {
+                return 0.0f;
+            }
+            const MotionPlanner::PathSegment& seg = *MotionPlanner::pathAt(axis.path, 0);
+            float speed = MotionPlanner::segmentVelocityAt(seg, t);
+            return (seg.target >= seg.start) ? speed : -speed;
+        }
+        case StreamSource::CUE:
+            return (axis.cueKey >= 0) ?
+                CueEngine::hermiteVelocity(axis.cueTrack.keys[axis.cueKey], axis.cueTrack.keys[axis.cueKey + 1], t) : 0.0f;
+        default:
+            return axis.scurve.direction * MotionPlanner::velocityAt(axis.scurve, t);
+    }
+}
+
+/**
+ * Planned time of the queued waypoint segments, oldest included
+ * @return seconds
+ */
+static float pathRemainingSeconds(Axis& axis) {
+    float total = 0.0f;
+    for (uint8_t i = 0; i < axis.path.count; i++) {
+        total += MotionPlanner::segmentDuration(*MotionPlanner::pathAt(axis.path, i));
+    }
+    return total;
+}
+
+/**
+ * Playback time of one pass through the playing cue
+ * @return microseconds
+ */
+static uint32_t cueDurationMicros(Axis& axis) {
+    return (axis.cueTrack.keys[axis.cueTrack.count - 1].time - axis.cueTrack.keys[0].time) * 1000;
+}
+
+/**
+ * Load the next waypoint segment or keyframe interval once the current
+ * piece is fully queued
+ * @return true if a new piece is current
+ */
+static bool advancePiece(Axis& axis) {
+    // The next piece starts where this one ends on the profile clock
+    axis.streamStartMicros += axis.pieceMicros;
+    axis.pieceMicros = 0;
+    
+    if (axis.streamSource == StreamSource::CUE) {
+        if (axis.cueKey + 1 >= axis.cueTrack.count - 1) {
+            if (!axis.cueTrack.loop) {
+                return false;
+            }
+            axis.cueKey = 0;  // Loop closes on itself - wrap without a gap
+            armStreamTimeout(axis, cueDurationMicros(axis));  // Each pass gets its own ETA
+        } else {
+            axis.cueKey++;
+        }
+        const CueEngine::Keyframe& from = axis.cueTrack.keys[axis.cueKey];
+        const CueEngine::Keyframe& to = axis.cueTrack.keys[axis.cueKey + 1];
+        beginPiece(axis, from.position, to.position, (to.time - from.time) * 1000);
+        return true;
+    }
+    
+    if (axis.streamSource != StreamSource::PATH) {
+        return false;
+    }
+    
+    if (axis.pathFrontLoaded) {
+        MotionPlanner::pathPop(axis.path);
+        axis.pathFrontLoaded = false;
+    }
+    
+    MotionPlanner::PathSegment* seg = MotionPlanner::pathAt(axis.path, 0);
+    if (seg == nullptr) {
+        return false;
+    }
+    
+    beginPiece(axis, seg->start, seg->target, FixedPoint::secondsToMicros(MotionPlanner::segmentDuration(*seg)));
+    axis.pathFrontLoaded = true;
+    armStreamTimeout(axis, FixedPoint::secondsToMicros(pathRemainingSeconds(axis)));  // Waypoints may have been added
+    return true;
+}
+
+/**
+ * Stream the active S-curve, path or cue into the step queue
+ * Keeps STREAM_LOOKAHEAD_US of profile queued ahead of the motor
+ * Called from Core 0 task only, every wake while active
+ */
+static void serviceStream(Axis& axis) {
+    if (axis.streamSource == StreamSource::NONE) {
+        return;
+    }
+    
+    // Another move took over (ramp generator) or the queue was flushed (force stop)
+    if (axis.stepper->isRampGeneratorActive() ||
+        axis.stepper->getPositionAfterCommandsCompleted() != axis.streamQueueEnd) {
+        cancelStream(axis);
+        return;
+    }
+    
+    while (true) {
+        if (axis.streamQueuedMicros >= axis.pieceMicros && !advancePiece(axis)) {
+            // Everything queued - finished once the motor has run the queue out
+            if (!axis.stepper->isRunning()) {
+                cancelStream(axis);
+            }
+            return;
+        }
+        
+        // Signed: negative while the queue is ahead of a piece that has not started
+        int32_t elapsed = (int32_t)(StepperHal::micros() - axis.streamStartMicros);
+        int32_t queued = (int32_t)axis.streamQueuedMicros;
+        if (elapsed > queued) {
+            // Queue ran dry - slide the profile clock so the move resumes where it left off
+            axis.streamStartMicros += (uint32_t)(elapsed - queued);
+            elapsed = queued;
+        }
+        if (queued - elapsed >= (int32_t)STREAM_LOOKAHEAD_US || axis.stepper->isQueueFull()) {
+            return;
+        }
+        
+        uint32_t chunkEnd = axis.streamQueuedMicros + STREAM_CHUNK_US;
+        if (chunkEnd + STREAM_CHUNK_US / 2 > axis.pieceMicros) {
+            chunkEnd = axis.pieceMicros;  // Fold a short tail into the last chunk
+        }
+        
+        // Last chunk lands exactly on the piece end regardless of float rounding
+        int32_t chunkTarget = (chunkEnd >= axis.pieceMicros) ? axis.pieceEnd - axis.pieceStart :
+                              (int32_t)lroundf(piecePositionAt(axis, FixedPoint::microsToSeconds(chunkEnd)));
+        int32_t delta = chunkTarget - axis.streamQueuedSteps;
+        if (delta != 0) {
+            axis.streamCountUp = (delta > 0);
+        }
+        int32_t steps = min(abs(delta), (int32_t)255);  // Queue entry limit
+        // An entry spaces its steps evenly, so a chunk runs whole ticks per step;
+        // the remainder rides on the next entry and the queue never drifts from
+        // the profile clock by more than one entry's remainder
+        uint32_t chunkTicks = (chunkEnd - axis.streamQueuedMicros) * TICKS_PER_US + axis.streamCarryTicks;
+        
+        // Zero steps queues a pause of the chunk length (slow start/end of a ramp)
+        struct stepper_command_s entry;
+        entry.steps = (uint8_t)steps;
+        entry.ticks = (uint16_t)(steps > 0 ? chunkTicks / steps : chunkTicks);
+        entry.count_up = axis.streamCountUp;
+        if (axis.stepper->addQueueEntry(&entry) != AQE_OK) {
+            return;  // Retry on the next wake
+        }
+        
+        axis.streamCarryTicks = (uint16_t)(chunkTicks - (uint32_t)entry.ticks * max(steps, (int32_t)1));
+        axis.streamQueuedMicros = chunkEnd;
+        axis.streamQueuedSteps += axis.streamCountUp ? steps : -steps;
+        axis.streamQueueEnd = axis.pieceStart + axis.streamQueuedSteps;
+    }
+}
+
+/**
+ * Reset the stream clock and queue bookkeeping for a new stream from standstill
+ */
+static void beginStream(Axis& axis, StreamSource source) {
+    axis.streamSource = source;
+    axis.streamStartMicros = StepperHal::micros();
+    axis.streamQueueEnd = axis.stepper->getCurrentPosition();
+    axis.pieceStart = axis.pieceEnd = axis.streamQueueEnd;
+    axis.pieceMicros = 0;
+    axis.streamQueuedMicros = 0;
+    axis.streamQueuedSteps = 0;
+    axis.streamCarryTicks = 0;
+}
+
+/**
+ * Plan and start a jerk-limited move from standstill
+ * @return false if no profile could be planned (caller uses the ramp generator)
+ */
+static bool startSCurveMove(Axis& axis, int32_t targetPos, float maxSpeed, float accel, float jerk) {
+    int32_t startPos = axis.stepper->getCurrentPosition();
+    if (!MotionPlanner::planSCurve(startPos, targetPos, maxSpeed, accel, jerk, axis.scurve)) {
+        return false;
+    }
+    
+    beginStream(axis, StreamSource::SCURVE);
+    beginPiece(axis, startPos, targetPos, FixedPoint::secondsToMicros(axis.scurve.totalTime));
+    armStreamTimeout(axis, axis.pieceMicros);
+    
+    if (g_enableStepDiagnostics) {
+        CORE_LOG_INFO("StepperController: S-curve %d steps - %.3fs (trapezoid %.3fs), peak %.0f steps/s, %.0f steps/s²",
+                      axis.scurve.distance, axis.scurve.totalTime,
+                      MotionPlanner::trapezoidDuration(axis.scurve.distance, maxSpeed, accel),
+                      axis.scurve.peakVelocity, axis.scurve.peakAccel);
+    }
+    
+    serviceStream(axis);  // Prime the queue now rather than on the next wake
+    return true;
+}
+
+/**
+ * Start executing the queued waypoints from standstill
+ * @return false if there is nothing to run
+ */
+static bool startPath(Axis& axis) {
+    MotionPlanner::PathSegment* first = MotionPlanner::pathAt(axis.path, 0);
+    if (first == nullptr) {
+        return false;
+    }
+    
+    // Waypoints may have been queued while another move was still running
+    first->start = axis.stepper->getCurrentPosition();
+    MotionPlanner::pathReplan(axis.path, 0, 0.0f);
+    
+    if (g_enableStepDiagnostics) {
+        CORE_LOG_INFO("StepperController: Path %d waypoints - planned %.3fs", axis.path.count, pathRemainingSeconds(axis));
+    }
+    
+    beginStream(axis, StreamSource::PATH);
+    axis.pathFrontLoaded = false;
+    serviceStream(axis);  // Loads the first segment and primes the queue
+    return true;
+}
+
+/**
+ * Clamp a target to the user-configured range (within the homed limits)
+ */
+static int32_t clampToUserLimits(Axis& axis, int32_t target) {
+    int32_t userMinPos, userMaxPos;
+    readUserLimits(axis, userMinPos, userMaxPos);
+    userMinPos = constrain(userMinPos, axis.minPosition, axis.maxPosition);
+    userMaxPos = constrain(userMaxPos, axis.minPosition, axis.maxPosition);
+    return constrain(target, userMinPos, userMaxPos);
+}
+
+/**
+ * Start keyframe playback with the motor at rest on the first keyframe
+ * Keyframe intervals play back-to-back on the stream clock, so timing does
+ * not depend on when the task wakes
+ */
+static void beginCuePlayback(Axis& axis) {
+    axis.cueApproach = false;
+    beginStream(axis, StreamSource::CUE);
+    axis.cueKey = -1;
+    armStreamTimeout(axis, cueDurationMicros(axis));
+    
+    if (g_enableStepDiagnostics) {
+        CORE_LOG_INFO("StepperController: Cue %d playing - %d keyframes, %.3fs%s",
+                      axis.cueId, axis.cueTrack.count, axis.cueTrack.keys[axis.cueTrack.count - 1].time / 1000.0f,
+                      axis.cueTrack.loop ? " (loop)" : "");
+    }
+    serviceStream(axis);  // Prime the queue now rather than on the next wake
+}
+
+/**
+ * Start a stored cue
+ * If the motor is not resting on the first keyframe it is moved there with
+ * the ramp generator first; playback begins once it arrives
+ * @param id Cue slot
+ * @return false if the cue is empty, unplayable or outside the user limits
+ */
+static bool startCue(Axis& axis, uint8_t id) {
+    cancelStream(axis);
+    if (!CueEngine::getTrack(id, axis.cueTrack)) {
+        CORE_LOG_INFO("StepperController: Cue %d not playable (empty, incomplete or store busy)", id);
+        return false;
+    }
+    
+    for (uint8_t i = 0; i < axis.cueTrack.count; i++) {
+        int32_t position = axis.cueTrack.keys[i].position;
+        if (axis.positionLimitsValid && clampToUserLimits(axis, position) != position) {
+            CORE_LOG_WARN("StepperController: REJECTED - Cue %d keyframe %d (%d) outside user limits",
+                          id, i, position);
+            return false;
+        }
+    }
+    
+    axis.cueId = id;
+    int32_t cueStart = axis.cueTrack.keys[0].position;
+    if (!axis.stepper->isRunning() && axis.stepper->getCurrentPosition() == cueStart) {
+        beginCuePlayback(axis);
+    } else {
+        axis.cueApproach = true;
+        axis.stepper->moveTo(cueStart);
+        // The ETA covers the approach and, unless looping, the whole cue
+        armMotionTimeout(axis, rampArrivalMs(axis, cueStart, axis.currentProfile.maxSpeed) +
+                         (axis.cueTrack.loop ? 0 : cueDurationMicros(axis) / 1000));
+    }
+    return true;
+}
+
+/**
+ * Begin playback once the approach move has reached the first keyframe
+ * Called from Core 0 task only, every wake while approaching
+ */
+static void serviceCueApproach(Axis& axis) {
+    if (axis.stepper->isRunning()) {
+        return;
+    }
+    if (axis.stepper->getCurrentPosition() == axis.cueTrack.keys[0].position) {
+        beginCuePlayback(axis);
+    } else {
+        // Approach was stopped or redirected - the cue is abandoned
+        CORE_LOG_INFO("StepperController: Cue %d abandoned before start", axis.cueId);
+        cancelStream(axis);
+    }
+}
+
+/**
+ * Resolve a per-move shape against the configured default
+ */
+static ProfileShape resolveProfileShape(ProfileShape shape) {
+    if (shape == ProfileShape::TRAPEZOIDAL || shape == ProfileShape::SCURVE) {
+        return shape;
+    }
+    SystemConfig* config = SystemConfigMgr::getConfig();
+    if (config && config->defaultProfile.shape == ProfileShape::SCURVE) {
+        return ProfileShape::SCURVE;
+    }
+    return ProfileShape::TRAPEZOIDAL;
+}
+
+/**
+ * Start a move to an already-clamped target with the requested ramp shape
+ * S-curves start from standstill only; retargeting a running motor uses the
+ * ramp generator, which blends from the current speed
+ */
+static void startMove(Axis& axis, int32_t targetPos, const MotionProfile& profile) {
+    cancelStream(axis);
+    
+    if (resolveProfileShape(profile.shape) == ProfileShape::SCURVE && !axis.stepper->isRunning()) {
+        float jerk = (profile.jerk > 0) ? profile.jerk : axis.currentProfile.jerk;
+        if (startSCurveMove(axis, targetPos, axis.currentProfile.maxSpeed,
+                            axis.currentProfile.acceleration, jerk)) {
+            return;
+        }
+    }
+    axis.stepper->moveTo(targetPos);
+    armMotionTimeout(axis, rampArrivalMs(axis, targetPos, axis.currentProfile.maxSpeed));
+}
+
+/**
+ * Start a coordinated move: every axis in cmd.axisMask runs a copy of one
+ * master trajectory scaled to its own distance, so all axes start together
+ * and arrive together on a straight line through axis space
+ * The master covers the longest distance at the profile speed, acceleration
+ * and jerk (0 = the lowest of the moving axes, so none exceeds its own)
+ * Called with the mutex held
+ * @return false if an axis is not homed, still moving, or has no stepper
+ */
+static bool startCoordinatedMove(const MotionCommand& cmd) {
+    int32_t targets[STEPPER_AXIS_COUNT];
+    int32_t masterDistance = 0;
+    float lowestSpeed = 0.0f, lowestAccel = 0.0f, lowestJerk = 0.0f;
+    
+    for (uint8_t i = 0; i < STEPPER_AXIS_COUNT; i++) {
+        if (!(cmd.axisMask & (1 << i))) {
+            continue;
+        }
+        Axis& axis = g_axes[i];
+        if (axis.limitFaultActive || !axis.systemHomed || !axis.positionLimitsValid) {
+            CORE_LOG_WARN("StepperController: REJECTED - Axis %d not homed or limit fault active. Home required.", i);
+            SAFE_WRITE_STATUS(safetyState, SafetyState::POSITION_ERROR);
+            return false;
+        }
+        if (axis.stepper->isRunning() || axis.streamSource != StreamSource::NONE || axis.cueApproach) {
+            CORE_LOG_WARN("StepperController: REJECTED - Coordinated move requires axis %d at rest", i);
+            return false;
+        }
+        
+        targets[i] = cmd.profile.enableLimits ? clampToUserLimits(axis, cmd.axisTargets[i]) : cmd.axisTargets[i];
+        masterDistance = max(masterDistance, abs(targets[i] - axis.stepper->getCurrentPosition()));
+        if (lowestSpeed == 0.0f || axis.currentProfile.maxSpeed < lowestSpeed) {
+            lowestSpeed = axis.currentProfile.maxSpeed;
+        }
+        if (lowestAccel == 0.0f || axis.currentProfile.acceleration < lowestAccel) {
+            lowestAccel = axis.currentProfile.acceleration;
+        }
+        if (lowestJerk == 0.0f || axis.currentProfile.jerk < lowestJerk) {
+            lowestJerk = axis.currentProfile.jerk;
+        }
+    }
+    if (masterDistance == 0) {
+        CORE_LOG_INFO("StepperController: Coordinated move - all axes already on target");
+        return true;
+    }
+    
+    float maxSpeed = (cmd.profile.maxSpeed > 0) ? cmd.profile.maxSpeed : lowestSpeed;
+    float accel = (cmd.profile.acceleration > 0) ? cmd.profile.acceleration : lowestAccel;
+    float jerk = (cmd.profile.jerk > 0) ? cmd.profile.jerk : lowestJerk;
+    bool scurve = (resolveProfileShape(cmd.profile.shape) == ProfileShape::SCURVE);
+    uint32_t expectedMs = (uint32_t)ceilf(MotionPlanner::trapezoidDuration(masterDistance, maxSpeed, accel) * 1000.0f);
+    
+    // Same shape, every parameter scaled by distance: identical timing per axis
+    for (uint8_t i = 0; i < STEPPER_AXIS_COUNT; i++) {
+        if (!(cmd.axisMask & (1 << i))) {
+            continue;
+        }
+        Axis& axis = g_axes[i];
+        cancelFollow(axis);
+        int32_t distance = abs(targets[i] - axis.stepper->getCurrentPosition());
+        if (distance == 0) {
+            continue;
+        }
+        float scale = (float)distance / (float)masterDistance;
+        
+        if (!scurve || !startSCurveMove(axis, targets[i], maxSpeed * scale, accel * scale, jerk * scale)) {
+            axis.stepper->setSpeedInMilliHz(max((int32_t)1, FixedPoint::toMilli(maxSpeed * scale)));
+            axis.stepper->setAcceleration(max((int32_t)1, (int32_t)lroundf(accel * scale)));
+            axis.stepper->moveTo(targets[i]);
+            axis.coordinated = true;
+            armMotionTimeout(axis, expectedMs);
+        }
+        MotionTrace::record(MotionTrace::Event::MOVE_START, (uint8_t)cmd.type, cmd.commandId, targets[i]);
+    }
+    
+    if (g_enableStepDiagnostics) {
+        CORE_LOG_INFO("StepperController: Coordinated move - master %d steps, %.0f steps/s, %.0f steps/s², %s",
+                      masterDistance, maxSpeed, accel, scurve ? "S-curve" : "trapezoid");
+    }
+    return true;
+}
+
+/**
+ * Decelerate a streamed move to a stop
+ * Hands the motor to the ramp generator, which continues from the queued speed
+ */
+static void stopStream(Axis& axis) {
+    float v = (axis.streamQueuedMicros < axis.pieceMicros) ?
+              pieceVelocityAt(axis, FixedPoint::microsToSeconds(axis.streamQueuedMicros)) : 0.0f;
+    int32_t stopOffset = (int32_t)(v * fabsf(v) / (2.0f * axis.currentProfile.acceleration));
+    int32_t stopTarget = axis.streamQueueEnd + stopOffset;
+    cancelStream(axis);
+    axis.stepper->moveTo(stopTarget);
+}
+
+/**
+ * Add a waypoint to the path and re-run the look-ahead
+ * While a path runs, the executing segment is left as planned and
+ * blending starts from the segment after it
+ * @param profile targetPosition, maxSpeed (0 = current) and acceleration (0 = current)
+ * @return false if the path buffer is full
+ */
+static bool appendWaypoint(Axis& axis, const MotionProfile& profile) {
+    int32_t target = axis.positionLimitsValid && profile.enableLimits ?
+                     clampToUserLimits(axis, profile.targetPosition) : profile.targetPosition;
+    float maxSpeed = (profile.maxSpeed > 0) ? profile.maxSpeed : axis.currentProfile.maxSpeed;
+    float accel = (profile.acceleration > 0) ? profile.acceleration : axis.currentProfile.acceleration;
+    
+    // Start is only used for the first waypoint; it is re-anchored on PATH_START
+    int32_t start;
+    if (axis.streamSource == StreamSource::PATH) {
+        start = axis.streamQueueEnd;
+    } else if (axis.stepper->isRunning()) {
+        start = axis.stepper->targetPos();
+    } else {
+        start = axis.stepper->getCurrentPosition();
+    }
+    
+    if (!MotionPlanner::pathAppend(axis.path, start, target, maxSpeed, accel)) {
+        CORE_LOG_INFO("StepperController: Path full (%d waypoints) - waypoint %d rejected",
+                      MotionPlanner::PATH_BUFFER_SIZE, target);
+        return false;
+    }
     
-    xSemaphoreGive(g_stepperMutex);
+    MotionPlanner::pathReplan(axis.path, axis.pathFrontLoaded ? 1 : 0, 0.0f);
+    return true;
 }
 
 /**
- * Update motion status in global status structure
+ * Steer the ramp generator toward the follow setpoint
+ * Speed is the setpoint rate plus a proportional catch-up term; the target
+ * leads the setpoint by the stopping distance while the setpoint is moving.
+ * With interpolation on, the setpoint between frames comes from the
+ * SetpointInterpolator (every wake, so at the housekeeping rate)
  * Called from Core 0 task only
  */
-static void updateMotionStatus() {
-    if (xSemaphoreTake(g_stepperMutex, pdMS_TO_TICKS(1)) != pdTRUE) {
-        return; // Skip this cycle if can't get mutex quickly
+static void updateFollow(Axis& axis) {
+    uint32_t now = StepperHal::millis();
+    uint32_t age = now - axis.followSampleTime;
+    uint32_t delayMs;
+    float velocity;
+    int32_t extrapolated;
+    if (followInterpolation(delayMs) && axis.followInterp.count > 0) {
+        velocity = SetpointInterpolator::velocity(axis.followInterp, now);
+        extrapolated = SetpointInterpolator::sample(axis.followInterp, now);
+    } else {
+        // Latest setpoint extrapolated to now with the smoothed frame rate
+        velocity = (age > FOLLOW_STALE_MS) ? 0.0f : axis.followVelocity;
+        extrapolated = axis.followSetpoint + (int32_t)(velocity * age / 1000.0f);
     }
     
-    // Update position and speed
-    if (g_stepper) {
-        g_currentPosition = g_stepper->getCurrentPosition();
-        // Convert from milliHz to steps/sec
-        int32_t speedMilliHz = g_stepper->getCurrentSpeedInMilliHz();
-        g_currentSpeed = speedMilliHz / 1000.0f;
-        
-        // Update motion state
-        if (g_homingState != HomingState::IDLE && 
-            g_homingState != HomingState::COMPLETE &&
-            g_homingState != HomingState::ERROR) {
-            g_motionState = MotionState::HOMING;
-        } else if (g_stepper->isRunning()) {
-            // Determine motion phase based on speed and acceleration
-            if (g_stepper->isRampGeneratorActive()) {
-                uint8_t rampState = g_stepper->rampState();
-                if (rampState & RAMP_STATE_ACCELERATING_FLAG) {
-                    g_motionState = MotionState::ACCELERATING;
-                } else if (rampState & RAMP_STATE_DECELERATING_FLAG) {
-                    g_motionState = MotionState::DECELERATING;
-                } else {
-                    g_motionState = MotionState::CONSTANT_VELOCITY;
-                }
-            } else {
-                g_motionState = MotionState::CONSTANT_VELOCITY;
-            }
-        } else {
-            g_motionState = MotionState::IDLE;
-        }
+    // Feed-forward stops at the soft limits
+    int32_t predicted = clampToUserLimits(axis, extrapolated);
+    if (predicted != extrapolated) {
+        velocity = 0.0f;
     }
     
-    xSemaphoreGive(g_stepperMutex);
+    int32_t leadTarget = predicted;
+    float speed = axis.followMaxSpeed;
+    if (velocity != 0.0f) {
+        float direction = (velocity > 0) ? 1.0f : -1.0f;
+        float lag = (predicted - axis.stepper->getCurrentPosition()) * direction;
+        speed = constrain(fabsf(velocity) + FOLLOW_POSITION_GAIN * lag,
+                          FOLLOW_MIN_SPEED, axis.followMaxSpeed);
+        float stoppingDistance = speed * speed / (2.0f * axis.currentProfile.acceleration);
+        leadTarget = clampToUserLimits(axis, predicted + (int32_t)(direction * stoppingDistance));
+    }
+    
+    // Only disturb the ramp generator when something actually changed
+    if (leadTarget != axis.followLeadTarget || fabsf(speed - axis.followSpeed) > axis.followSpeed * 0.02f) {
+        axis.stepper->setSpeedInHz((uint32_t)speed);
+        axis.stepper->moveTo(leadTarget);
+        axis.followLeadTarget = leadTarget;
+        axis.followSpeed = speed;
+    }
+    
+    // Setpoint at rest and reached - plain positioning from here on
+    if (velocity == 0.0f && age > FOLLOW_STALE_MS && !axis.stepper->isRunning()) {
+        cancelFollow(axis);
+    }
+}
+
+/**
+ * Take a new follow setpoint and update the setpoint rate estimate
+ * Called from processMotionCommand (stepper mutex held)
+ */
+static void applyFollowSetpoint(Axis& axis, const MotionCommand& cmd) {
+    int32_t setpoint = clampToUserLimits(axis, cmd.profile.targetPosition);
+    uint32_t dt = cmd.timestamp - axis.followSampleTime;
+    
+    if (!axis.followActive || dt > FOLLOW_STALE_MS) {
+        // Fresh stream - no rate history yet
+        axis.followVelocity = 0.0f;
+        axis.followLeadTarget = axis.stepper->targetPos();
+        axis.followSpeed = 0.0f;
+        SetpointInterpolator::reset(axis.followInterp);
+        cancelStream(axis);
+    } else if (setpoint == axis.followSetpoint) {
+        axis.followVelocity = 0.0f;  // Setpoint held - stop leading immediately
+    } else if (dt > 0) {
+        float rate = (setpoint - axis.followSetpoint) * 1000.0f / dt;
+        axis.followVelocity += FOLLOW_VELOCITY_SMOOTHING * (rate - axis.followVelocity);
+    }
+    
+    uint32_t delayMs;
+    if (followInterpolation(delayMs)) {
+        SetpointInterpolator::addSample(axis.followInterp, setpoint, cmd.timestamp, delayMs);
+    }
     
-    // Update global status (thread-safe)
-    SAFE_WRITE_STATUS(currentPosition, g_currentPosition);
-    SAFE_WRITE_STATUS(currentSpeed, g_currentSpeed);
-    SAFE_WRITE_STATUS(motionState, g_motionState);
-    SAFE_WRITE_STATUS(stepperEnabled, g_stepperEnabled);
+    axis.followActive = true;
+    axis.followSetpoint = setpoint;
+    axis.followSampleTime = cmd.timestamp;
+    axis.followMaxSpeed = (cmd.profile.maxSpeed > 0) ? cmd.profile.maxSpeed : axis.currentProfile.maxSpeed;
+    updateFollow(axis);
 }
 
 /**
  * Check CL57Y ALARM status
  * Called from Core 0 task only
  */
-static void checkAlarmStatus() {
-    bool alarmActive = (digitalRead(STEPPER_ALARM_PIN) == LOW); // Active low
+static void checkAlarmStatus(Axis& axis) {
+    bool alarmActive = (StepperHal::readPin(axis.pins->alarm) == LOW); // Active low
     
-    if (alarmActive != g_alarmState) {
-        g_alarmState = alarmActive;
-        SAFE_WRITE_STATUS(stepperAlarm, g_alarmState);
+    if (alarmActive != axis.alarmState) {
+        axis.alarmState = alarmActive;
         
-        if (g_alarmState) {
-            Serial.println("StepperController: WARNING - CL57Y ALARM active!");
+        if (axis.alarmState) {
+            CORE_LOG_WARN("StepperController: WARNING - CL57Y ALARM active!");
             SAFE_WRITE_STATUS(safetyState, SafetyState::STEPPER_ALARM);
             
             // Could trigger emergency stop here if desired
@@ -535,172 +2040,460 @@ static void checkAlarmStatus() {
  * Start homing sequence
  * Internal helper called with mutex already held
  */
-static void startHomingSequence() {
-    Serial.println("StepperController: Starting homing sequence...");
+static void startHomingSequence(Axis& axis) {
+    CORE_LOG_INFO("StepperController: Starting homing sequence...");
+    
+    // Homing drives the ramp generator directly and has its own timeouts
+    cancelStream(axis);
+    axis.motionTimeoutArmed = false;
     
     // Reset homing state
-    g_homingState = HomingState::FINDING_LEFT;
-    g_homingProgress = 0;
-    g_systemHomed = false;
-    g_positionLimitsValid = false;
-    g_homingStartTime = millis();
-    g_homingPhaseStartTime = millis();
+    setHomingState(axis, HomingState::FINDING_LEFT);
+    axis.homingProgress = 0;
+    axis.systemHomed = false;
+    axis.positionLimitsValid = false;
+    axis.homingStartTime = StepperHal::millis();
+    axis.homingPhaseStartTime = StepperHal::millis();
+    memset(&axis.homingRun, 0, sizeof(axis.homingRun));
     
     // Reload homing parameters from configuration in case they were changed
     SystemConfig* config = SystemConfigMgr::getConfig();
     if (config) {
-        g_homingSpeed = config->homingSpeed;
-        g_limitSafetyMargin = config->limitSafetyMargin;
-        Serial.printf("StepperController: Homing speed: %.1f steps/sec, Safety margin: %.0f steps\n", 
-                     g_homingSpeed, g_limitSafetyMargin);
+        axis.homingSpeedMilliHz = FixedPoint::toMilli(config->homingSpeed);
+        axis.limitSafetyMargin = (int32_t)config->limitSafetyMargin;
+        // Two-speed homing only when the fast approach is actually faster
+        axis.homingFastSpeedMilliHz = (config->homingFastSpeed > config->homingSpeed) ?
+                                   FixedPoint::toMilli(config->homingFastSpeed) : 0;
+        CORE_LOG_INFO("StepperController: Homing speed: %.1f steps/sec, Safety margin: %d steps", 
+                     FixedPoint::fromMilli(axis.homingSpeedMilliHz), axis.limitSafetyMargin);
+        if (axis.homingFastSpeedMilliHz > 0) {
+            CORE_LOG_INFO("StepperController: Fast approach: %.1f steps/sec",
+                         FixedPoint::fromMilli(axis.homingFastSpeedMilliHz));
+        }
+    }
+    axis.homingRun.fastApproach = (axis.homingFastSpeedMilliHz > 0);
+    axis.homingSlowPass = !axis.homingRun.fastApproach;
+    
+    // Verify homing needs a stored signature measured at the same slow speed
+    axis.leftTriggerMeasured = false;
+    axis.rightTriggerMeasured = false;
+    axis.leftHysteresis = -1;
+    axis.homingVerify = false;
+    if (config && config->verifyHoming && !axis.fullHomingRequested) {
+        if (!axis.calibration.valid) {
+            CORE_LOG_INFO("StepperController: No stored range - running full sweep");
+        } else if (axis.calibration.speedMilliHz != axis.homingSpeedMilliHz) {
+            CORE_LOG_INFO("StepperController: Stored range measured at another homing speed - running full sweep");
+        } else {
+            axis.homingVerify = true;
+            CORE_LOG_INFO("StepperController: Verifying against stored range (%d steps)",
+                         axis.calibration.range);
+        }
     }
+    axis.fullHomingRequested = false;
     
-    // Set homing speed from configuration
-    g_stepper->setSpeedInHz(g_homingSpeed);
-    g_stepper->setAcceleration(g_currentProfile.acceleration);
+    // Set approach speed from configuration
+    axis.stepper->setSpeedInMilliHz(homingPassSpeed(axis));
+    axis.stepper->setAcceleration(axis.currentProfile.acceleration);
     
     // Check initial limit switch states
-    if (g_leftLimitState && g_rightLimitState) {
+    if (axis.leftLimitState && axis.rightLimitState) {
         // Both limits active - error condition
-        Serial.println("StepperController: ERROR - Both limit switches active!");
-        g_homingState = HomingState::ERROR;
-        g_motionState = MotionState::IDLE;
+        CORE_LOG_ERROR("StepperController: ERROR - Both limit switches active!");
+        axis.homingState = HomingState::ERROR;
+        axis.motionState = MotionState::IDLE;
         return;
     }
     
     // Check if we're already at left limit
-    if (g_leftLimitState) {
-        Serial.println("StepperController: Already at left limit, backing off");
-        g_homingState = HomingState::BACKING_OFF_LEFT;
-        // Back off by twice the safety margin since we don't know exact position
-        g_stepper->move((int32_t)g_limitSafetyMargin * 2);
+    if (axis.leftLimitState) {
+        CORE_LOG_INFO("StepperController: Already at left limit, backing off");
+        // Back-off move is issued by the state machine; the release edge ends it
+        setHomingState(axis, HomingState::BACKING_OFF_LEFT);
     } 
     // Check if we're at right limit (need to move left first)
-    else if (g_rightLimitState) {
-        Serial.println("StepperController: At right limit, moving to find left limit");
-        g_stepper->moveTo(-100000); // Move left to find left limit
+    else if (axis.rightLimitState) {
+        CORE_LOG_INFO("StepperController: At right limit, moving to find left limit");
+        axis.stepper->move(-HOMING_SEARCH_STEPS); // Move left to find left limit
+        axis.homingMoveIssued = true;
     }
     // Normal case - not at any limit
     else {
-        Serial.println("StepperController: Not at limits, moving to find left limit");
-        g_stepper->moveTo(-100000); // Move left to find left limit
+        CORE_LOG_INFO("StepperController: Not at limits, moving to find left limit");
+        axis.stepper->move(-HOMING_SEARCH_STEPS); // Move left to find left limit
+        axis.homingMoveIssued = true;
     }
     
-    g_motionState = MotionState::HOMING;
+    axis.motionState = MotionState::HOMING;
     
-    Serial.printf("StepperController: Homing at %.1f steps/sec, timeout %lu ms\n", 
-                  g_homingSpeed, HOMING_TIMEOUT_MS);
+    CORE_LOG_INFO("StepperController: Homing at %.1f steps/sec, timeout %lu ms", 
+                  FixedPoint::fromMilli(homingPassSpeed(axis)), HOMING_TIMEOUT_MS);
 }
 
 // ============================================================================
 // Core 0 Task Implementation
 // ============================================================================
 
+/**
+ * Commands drainCommandQueue() holds back for one axis
+ */
+struct PendingCommands {
+    MotionCommand speed, accel, move;
+    bool hasSpeed, hasAccel, hasMove;
+};
+
+/**
+ * Apply one axis' held-back commands in a fixed order: speed,
+ * acceleration, then the (single) coalesced move - and clear them
+ * @param includeMove false leaves the pending move untouched
+ */
+static void flushPendingCommands(PendingCommands& pending, bool includeMove = true) {
+    if (pending.hasSpeed) {
+        processMotionCommand(pending.speed);
+        g_commandStats.processed++;
+    }
+    if (pending.hasAccel) {
+        processMotionCommand(pending.accel);
+        g_commandStats.processed++;
+    }
+    if (includeMove && pending.hasMove) {
+        processMotionCommand(pending.move);
+        g_commandStats.processed++;
+        pending.hasMove = false;
+    }
+    pending.hasSpeed = pending.hasAccel = false;
+}
+
+/**
+ * Drain every queued command and coalesce them per axis before applying:
+ * - Latest MOVE_ABSOLUTE / FOLLOW_TARGET wins; MOVE_RELATIVE folds into the pending move
+ * - SET_SPEED / SET_ACCELERATION merge (latest value wins, also into the move)
+ * - STOP discards moves queued before it for its axis; EMERGENCY_STOP
+ *   discards every move and HOME in the batch, on every axis
+ * - MOVE_COORDINATED replaces the pending moves of the axes it names
+ * - HOME / ENABLE / DISABLE / PATH_* / CUE_PLAY keep their order relative
+ *   to the other commands of their axis
+ * Called from Core 0 task only
+ */
+static void drainCommandQueue() {
+    MotionCommand cmd;
+    PendingCommands pendingAxes[STEPPER_AXIS_COUNT] = {};
+    bool estopInBatch = false;
+    
+    while (xQueueReceive(g_motionCommandQueue, &cmd, 0) == pdTRUE) {
+        g_commandStats.received++;
+        MotionTrace::record(MotionTrace::Event::COMMAND, (uint8_t)cmd.type, cmd.commandId,
+                            cmd.profile.targetPosition);
+        
+        if (cmd.axis >= STEPPER_AXIS_COUNT) {
+            processMotionCommand(cmd);  // Rejected and logged there
+            g_commandStats.dropped++;
+            continue;
+        }
+        PendingCommands& pending = pendingAxes[cmd.axis];
+        
+        switch (cmd.type) {
+            case CommandType::MOVE_ABSOLUTE:
+            case CommandType::FOLLOW_TARGET:
+                if (estopInBatch) {
+                    g_commandStats.dropped++;
+                    break;
+                }
+                if (pending.hasMove) {
+                    g_commandStats.coalesced++;
+                }
+                pending.move = cmd;
+                pending.hasMove = true;
+                break;
+                
+            case CommandType::MOVE_RELATIVE:
+                if (estopInBatch) {
+                    g_commandStats.dropped++;
+                    break;
+                }
+                if (pending.hasMove) {
+                    // Fold the offset into the pending move, keeping its type
+                    pending.move.profile.targetPosition += cmd.profile.targetPosition;
+                    g_commandStats.coalesced++;
+                } else {
+                    pending.move = cmd;
+                    pending.hasMove = true;
+                }
+                break;
+                
+            case CommandType::SET_SPEED:
+                if (pending.hasSpeed) {
+                    g_commandStats.coalesced++;
+                }
+                pending.speed = cmd;
+                pending.hasSpeed = true;
+                if (pending.hasMove) {
+                    pending.move.profile.maxSpeed = cmd.profile.maxSpeed;
+                }
+                break;
+                
+            case CommandType::SET_ACCELERATION:
+                if (pending.hasAccel) {
+                    g_commandStats.coalesced++;
+                }
+                pending.accel = cmd;
+                pending.hasAccel = true;
+                if (pending.hasMove) {
+                    pending.move.profile.acceleration = cmd.profile.acceleration;
+                    pending.move.profile.deceleration = cmd.profile.acceleration;
+                }
+                break;
+                
+            case CommandType::STOP:
+            case CommandType::EMERGENCY_STOP:
+                // Parameter changes still apply, then stop immediately
+                for (PendingCommands& stopped : pendingAxes) {
+                    if (&stopped != &pending && cmd.type == CommandType::STOP) {
+                        continue;  // A STOP only affects its own axis
+                    }
+                    if (stopped.hasMove) {
+                        g_commandStats.dropped++;
+                        stopped.hasMove = false;
+                    }
+                    flushPendingCommands(stopped, false);
+                }
+                if (cmd.type == CommandType::EMERGENCY_STOP) {
+                    estopInBatch = true;
+                }
+                processMotionCommand(cmd);
+                g_commandStats.processed++;
+                break;
+                
+            case CommandType::MOVE_COORDINATED:
+                if (estopInBatch) {
+                    g_commandStats.dropped++;
+                    break;
+                }
+                // Supersedes the moves pending on its axes; their parameter
+                // changes apply first
+                for (uint8_t i = 0; i < STEPPER_AXIS_COUNT; i++) {
+                    if (!(cmd.axisMask & (1 << i))) {
+                        continue;
+                    }
+                    if (pendingAxes[i].hasMove) {
+                        g_commandStats.coalesced++;
+                        pendingAxes[i].hasMove = false;
+                    }
+                    flushPendingCommands(pendingAxes[i]);
+                }
+                processMotionCommand(cmd);
+                g_commandStats.processed++;
+                break;
+                
+            case CommandType::HOME:
+            case CommandType::PATH_APPEND:
+            case CommandType::PATH_START:
+            case CommandType::CUE_PLAY:
+                if (estopInBatch) {
+                    g_commandStats.dropped++;
+                    break;
+                }
+                // Fall through - order sensitive
+            default:
+                flushPendingCommands(pending);
+                processMotionCommand(cmd);
+                g_commandStats.processed++;
+                break;
+        }
+    }
+    
+    for (PendingCommands& pending : pendingAxes) {
+        flushPendingCommands(pending);
+    }
+}
+
+/**
+ * Check whether an axis needs housekeeping at the fast rate
+ * True while moving, homing, filtering a limit edge or waiting to auto-home
+ */
+static bool needsFastHousekeeping(Axis& axis) {
+    return (axis.stepper && axis.stepper->isRunning()) ||
+           axis.streamSource != StreamSource::NONE || axis.cueApproach || axis.followActive ||
+           isAxisHoming(axis) ||
+           axis.leftFilter.pending || axis.rightFilter.pending || axis.overrunPending ||
+           axis.autoHomeRequested;
+}
+
 void stepperControllerTask(void* parameter) {
-    const TickType_t xFrequency = pdMS_TO_TICKS(2); // 2ms for less frequent GPIO reads
-    TickType_t xLastWakeTime = xTaskGetTickCount();
+    const TickType_t activePeriod = pdMS_TO_TICKS(STEPPER_TASK_ACTIVE_MS);
+    const TickType_t idlePeriod = pdMS_TO_TICKS(STEPPER_TASK_IDLE_MS);
     
     // Add this task to watchdog
     esp_task_wdt_add(NULL);
     
-    Serial.println("StepperController: Core 0 task started");
-    Serial.println("StepperController: Continuous limit monitoring enabled (2ms interval)");
-    Serial.println("StepperController: Watchdog timer active (10s timeout)");
+    CORE_LOG_INFO("StepperController: Core 0 task started");
+    CORE_LOG_INFO("StepperController: Event-driven wakeups, housekeeping %dms active / %dms idle",
+                  STEPPER_TASK_ACTIVE_MS, STEPPER_TASK_IDLE_MS);
+    CORE_LOG_INFO("StepperController: Watchdog timer active (10s timeout)");
     
     uint32_t lastWdtFeed = 0;
+    uint32_t wakeReasons = 0;
     
     while (true) {
+        // Profiler stamps - each zone records from its start stamp
+        uint32_t cycleStart = LoopProfiler::now();
+        uint32_t zoneStart = cycleStart;
+        
         // Update task health timestamp
-        g_lastTaskUpdate = millis();
+        g_lastTaskUpdate = StepperHal::millis();
+        // ====================================================================
+        // Check limit switches with continuous monitoring (every wake)
+        // ====================================================================
+        drainLimitEdges();
+        uint32_t limitRecheckUs = UINT32_MAX;
+        for (Axis& axis : g_axes) {
+            checkLimitSwitches(axis, limitRecheckUs);
+        }
+        if (limitRecheckUs != UINT32_MAX) {
+            // Sample again when the earliest pending window ends
+            StepperHal::startOneShot(g_limitFilterTimer, limitRecheckUs);
+        }
+        zoneStart = LoopProfiler::record(LoopProfiler::Zone::LIMITS, zoneStart);
+        
         // ====================================================================
-        // Check limit switches with continuous monitoring (every cycle - 2ms)
+        // Drain and coalesce all pending motion commands (every wake)
         // ====================================================================
-        checkLimitSwitches();
+        drainCommandQueue();
+        zoneStart = LoopProfiler::record(LoopProfiler::Zone::COMMANDS, zoneStart);
         
         // ====================================================================
-        // Process motion commands from queue (every cycle)
+        // Keep the step queue filled for an active stream (every wake)
         // ====================================================================
-        MotionCommand cmd;
-        if (xQueueReceive(g_motionCommandQueue, &cmd, 0) == pdTRUE) {
-            processMotionCommand(cmd);
+        for (Axis& axis : g_axes) {
+            if (axis.cueApproach) {
+                serviceCueApproach(axis);
+            }
+            serviceStream(axis);
+        }
+        
+        // ====================================================================
+        // Track the streaming setpoint in follow mode (every wake)
+        // ====================================================================
+        for (Axis& axis : g_axes) {
+            if (axis.followActive) {
+                updateFollow(axis);
+            }
         }
+        zoneStart = LoopProfiler::record(LoopProfiler::Zone::STREAM, zoneStart);
         
         // ====================================================================
         // Update homing sequence if in progress (every cycle)
         // ====================================================================
-        if (g_homingState != HomingState::IDLE && 
-            g_homingState != HomingState::COMPLETE &&
-            g_homingState != HomingState::ERROR) {
-            updateHomingSequence();
+        for (Axis& axis : g_axes) {
+            if (isAxisHoming(axis)) {
+                updateHomingSequence(axis);
+                zoneStart = LoopProfiler::record(LoopProfiler::Zone::HOMING, zoneStart);
+            }
         }
         
         // ====================================================================
         // Update motion status (every cycle)
         // ====================================================================
-        updateMotionStatus();
+        for (Axis& axis : g_axes) {
+            updateMotionStatus(axis);
+        }
+        zoneStart = LoopProfiler::record(LoopProfiler::Zone::STATUS, zoneStart);
         
         // ====================================================================
-        // Check CL57Y ALARM (every 10 cycles = 20ms)
+        // Check CL57Y ALARM (on edge, with a 20ms fallback poll)
         // ====================================================================
-        static uint8_t alarmCounter = 0;
-        if (++alarmCounter >= 10) {
-            alarmCounter = 0;
-            checkAlarmStatus();
+        if ((wakeReasons & NOTIFY_ALARM) || StepperHal::millis() - g_lastAlarmCheck >= ALARM_POLL_INTERVAL_MS) {
+            g_lastAlarmCheck = StepperHal::millis();
+            for (Axis& axis : g_axes) {
+                checkAlarmStatus(axis);
+            }
+            LoopProfiler::record(LoopProfiler::Zone::ALARM, zoneStart);
         }
         
         // ====================================================================
         // Handle Auto-Home Request After E-Stop
         // ====================================================================
-        if (g_autoHomeRequested) {
+        for (Axis& axis : g_axes) {
+            if (!axis.autoHomeRequested) {
+                continue;
+            }
+            zoneStart = LoopProfiler::now();
             // Debug output to track auto-home state
             static uint32_t lastDebugTime = 0;
-            if (millis() - lastDebugTime > 1000) {  // Print debug every second
-                Serial.printf("StepperController: Auto-home debug - requested=%d, running=%d, homingState=%d, timeElapsed=%lu, limitFault=%d\n",
-                             g_autoHomeRequested, g_stepper->isRunning(), (int)g_homingState, 
-                             millis() - g_autoHomeRequestTime, g_limitFaultActive);
-                lastDebugTime = millis();
+            if (StepperHal::millis() - lastDebugTime > 1000) {  // Print debug every second
+                CORE_LOG_DEBUG("StepperController: Auto-home debug - axis=%d, requested=%d, running=%d, homingState=%d, timeElapsed=%lu, limitFault=%d",
+                              axis.index, axis.autoHomeRequested, axis.stepper->isRunning(), (int)axis.homingState, 
+                              StepperHal::millis() - axis.autoHomeRequestTime, axis.limitFaultActive);
+                lastDebugTime = StepperHal::millis();
             }
             
-            if (!g_stepper->isRunning() && 
-                (g_homingState == HomingState::IDLE || g_homingState == HomingState::COMPLETE) &&
-                (millis() - g_autoHomeRequestTime >= AUTO_HOME_DELAY_MS)) {
+            if (!axis.stepper->isRunning() && 
+                (axis.homingState == HomingState::IDLE || axis.homingState == HomingState::COMPLETE) &&
+                (StepperHal::millis() - axis.autoHomeRequestTime >= AUTO_HOME_DELAY_MS)) {
                 
-                Serial.println("StepperController: Starting automatic homing after E-stop...");
+                CORE_LOG_INFO("StepperController: Starting automatic homing of axis %d after E-stop...", axis.index);
                 
                 // Clear the limit fault first to allow homing
-                if (g_limitFaultActive) {
-                    Serial.println("StepperController: Clearing limit fault to allow auto-homing...");
-                    g_limitFaultActive = false;
+                if (axis.limitFaultActive) {
+                    CORE_LOG_INFO("StepperController: Clearing limit fault to allow auto-homing...");
+                    axis.limitFaultActive = false;
                 }
                 
-                g_autoHomeRequested = false;
+                axis.autoHomeRequested = false;
                 
                 // Create a HOME command and process it directly
                 MotionCommand homeCmd;
                 homeCmd.type = CommandType::HOME;
-                homeCmd.timestamp = millis();
+                homeCmd.axis = axis.index;
+                homeCmd.timestamp = StepperHal::millis();
                 processMotionCommand(homeCmd);
             }
+            LoopProfiler::record(LoopProfiler::Zone::AUTO_HOME, zoneStart);
         }
         
         // Feed watchdog timer periodically (every second)
-        if (millis() - lastWdtFeed > 1000) {
+        if (StepperHal::millis() - lastWdtFeed > 1000) {
             esp_task_wdt_reset();
-            lastWdtFeed = millis();
+            lastWdtFeed = StepperHal::millis();
+        }
+        
+        // Check for motion timeout - a move has overrun its ETA by the tolerance
+        for (Axis& axis : g_axes) {
+            if (!axis.motionTimeoutArmed) {
+                continue;
+            }
+            if (!axis.stepper->isRunning() && !axis.cueApproach && axis.streamSource == StreamSource::NONE) {
+                axis.motionTimeoutArmed = false;  // Arrived (or stopped) - nothing to watch
+            } else if ((int32_t)(StepperHal::millis() - axis.motionDeadline) > 0) {
+                CORE_LOG_ERROR("ERROR: Motion timeout on axis %d - %lums past the ETA, stopping motor!",
+                               axis.index, StepperHal::millis() - axis.motionArrivalTime);
+                forceStopMotion(axis);
+                axis.motionState = MotionState::IDLE;
+                SAFE_WRITE_STATUS(safetyState, SafetyState::POSITION_ERROR);  // Use existing error state
+            }
         }
         
-        // Check for motion timeout
-        if (g_stepper->isRunning() && g_motionStartTime > 0 && 
-            (millis() - g_motionStartTime > MOTION_TIMEOUT_MS)) {
-            Serial.println("ERROR: Motion timeout detected - stopping motor!");
-            g_stepper->forceStop();
-            g_motionState = MotionState::IDLE;
-            SAFE_WRITE_STATUS(safetyState, SafetyState::POSITION_ERROR);  // Use existing error state
-            g_motionStartTime = 0;  // Reset timeout
+        // ====================================================================
+        // Publish status snapshot (once per cycle, never blocks)
+        // ====================================================================
+        zoneStart = LoopProfiler::now();
+        publishMotionStatus();
+        LoopProfiler::record(LoopProfiler::Zone::PUBLISH, zoneStart);
+        LoopProfiler::record(LoopProfiler::Zone::CYCLE, cycleStart);
+        
+        // Sleep until the next event or housekeeping tick (fast while active)
+        bool fastHousekeeping = false;
+        for (Axis& axis : g_axes) {
+            fastHousekeeping = fastHousekeeping || needsFastHousekeeping(axis);
         }
+        uint32_t sleepStartUs = StepperHal::micros();
+        wakeReasons = 0;
+        StepperHal::waitForWake(wakeReasons, fastHousekeeping ? activePeriod : idlePeriod);
         
-        // Precise 2ms timing
-        vTaskDelayUntil(&xLastWakeTime, xFrequency);
+        // Jitter is measured on timed wake-ups against the 2ms active period
+        if (fastHousekeeping && wakeReasons == 0) {
+            LoopProfiler::recordWake(StepperHal::micros() - sleepStartUs, STEPPER_TASK_ACTIVE_MS * 1000UL);
+        }
     }
 }
 
@@ -723,60 +2516,80 @@ bool initialize() {
         return false;
     }
     
-    // Configure GPIO pins
-    pinMode(LEFT_LIMIT_PIN, INPUT_PULLUP);
-    pinMode(RIGHT_LIMIT_PIN, INPUT_PULLUP);
-    pinMode(STEPPER_ALARM_PIN, INPUT_PULLUP);
-    
     // Initialize ODStepper engine
     g_engine.init();
     
-    // Create stepper connected to step pin
-    g_stepper = g_engine.stepperConnectToPin(STEPPER_STEP_PIN);
-    if (g_stepper == nullptr) {
-        Serial.println("StepperController: ERROR - Failed to connect to step pin");
-        vSemaphoreDelete(g_stepperMutex);
-        return false;
+    SystemConfig* config = SystemConfigMgr::getConfig();
+    if (!config) {
+        Serial.println("StepperController: WARNING - Using default config values");
     }
     
-    // Configure stepper pins
-    g_stepper->setDirectionPin(STEPPER_DIR_PIN);
-    // Set enable pin with HIGH = enabled (inverted from default)
-    g_stepper->setEnablePin(STEPPER_ENABLE_PIN, false);  // false = HIGH enables stepper
-    g_stepper->setAutoEnable(false);  // Keep motor enabled to avoid startup issues
-    
-    // Load saved configuration from SystemConfig
-    SystemConfig* config = SystemConfigMgr::getConfig();
-    if (config) {
-        // Update motion profile with saved values
-        g_currentProfile.maxSpeed = config->defaultProfile.maxSpeed;
-        g_currentProfile.acceleration = config->defaultProfile.acceleration;
-        g_currentProfile.deceleration = config->defaultProfile.acceleration; // Same value
-        g_currentProfile.jerk = config->defaultProfile.jerk;
-        g_currentProfile.enableLimits = config->defaultProfile.enableLimits;
+    for (uint8_t i = 0; i < STEPPER_AXIS_COUNT; i++) {
+        Axis& axis = g_axes[i];
+        axis.index = i;
+        axis.pins = &AXIS_PINS[i];
         
-        // Load homing parameters
-        g_homingSpeed = config->homingSpeed;
-        g_limitSafetyMargin = config->limitSafetyMargin;
+        // Configure GPIO pins
+        StepperHal::configureInput(axis.pins->leftLimit);
+        StepperHal::configureInput(axis.pins->rightLimit);
+        StepperHal::configureInput(axis.pins->alarm);
         
-        Serial.printf("StepperController: Loaded config - Speed: %.1f, Accel: %.1f, Homing: %.1f, Margin: %.0f\n",
-                     g_currentProfile.maxSpeed, g_currentProfile.acceleration, g_homingSpeed, g_limitSafetyMargin);
-    } else {
-        Serial.println("StepperController: WARNING - Using default config values");
+        // Create stepper connected to step pin
+        axis.stepper = g_engine.stepperConnectToPin(axis.pins->step);
+        if (axis.stepper == nullptr) {
+            Serial.printf("StepperController: ERROR - Failed to connect axis %d to step pin\n", i);
+            for (Axis& other : g_axes) {
+                other.stepper = nullptr;
+            }
+            vSemaphoreDelete(g_stepperMutex);
+            return false;
+        }
+        
+        // Configure stepper pins
+        axis.stepper->setDirectionPin(axis.pins->dir);
+        // Set enable pin with HIGH = enabled (inverted from default)
+        axis.stepper->setEnablePin(axis.pins->enable, false);  // false = HIGH enables stepper
+        axis.stepper->setAutoEnable(false);  // Keep motor enabled to avoid startup issues
+        
+        // Load saved configuration from SystemConfig (shared by every axis)
+        if (config) {
+            // Update motion profile with saved values
+            axis.currentProfile.maxSpeed = config->defaultProfile.maxSpeed;
+            axis.currentProfile.acceleration = config->defaultProfile.acceleration;
+            axis.currentProfile.deceleration = config->defaultProfile.acceleration; // Same value
+            axis.currentProfile.jerk = config->defaultProfile.jerk;
+            axis.currentProfile.enableLimits = config->defaultProfile.enableLimits;
+            axis.currentProfile.shape = config->defaultProfile.shape;
+            
+            // Load homing parameters
+            axis.homingSpeedMilliHz = FixedPoint::toMilli(config->homingSpeed);
+            axis.limitSafetyMargin = (int32_t)config->limitSafetyMargin;
+            
+            Serial.printf("StepperController: Axis %d loaded config - Speed: %.1f, Accel: %.1f, Homing: %.1f, Margin: %d\n",
+                         i, axis.currentProfile.maxSpeed, axis.currentProfile.acceleration,
+                         FixedPoint::fromMilli(axis.homingSpeedMilliHz), axis.limitSafetyMargin);
+        }
+        
+        // Range and switch signature from the last full homing sweep
+        loadCalibration(axis);
+        
+        // Set motion parameters
+        axis.stepper->setSpeedInHz(axis.currentProfile.maxSpeed);
+        axis.stepper->setAcceleration(axis.currentProfile.acceleration);
+        axis.stepper->setCurrentPosition(0);
+        
+        // Enable the stepper
+        axis.stepper->enableOutputs();
+        axis.stepperEnabled = true;
+        
+        // Attach limit switch interrupts (minimal ISRs, the pin tells the axis)
+        StepperHal::attachPinChange(axis.pins->leftLimit, limitISR, (void*)(uintptr_t)axis.pins->leftLimit);
+        StepperHal::attachPinChange(axis.pins->rightLimit, limitISR, (void*)(uintptr_t)axis.pins->rightLimit);
+        StepperHal::attachPinChange(axis.pins->alarm, alarmISR, nullptr);
     }
     
-    // Set motion parameters
-    g_stepper->setSpeedInHz(g_currentProfile.maxSpeed);
-    g_stepper->setAcceleration(g_currentProfile.acceleration);
-    g_stepper->setCurrentPosition(0);
-    
-    // Enable the stepper
-    g_stepper->enableOutputs();
-    g_stepperEnabled = true;
-    
-    // Attach limit switch interrupts (minimal ISRs)
-    attachInterrupt(digitalPinToInterrupt(LEFT_LIMIT_PIN), leftLimitISR, CHANGE);
-    attachInterrupt(digitalPinToInterrupt(RIGHT_LIMIT_PIN), rightLimitISR, CHANGE);
+    // Glitch filter window timer (armed by the task while an edge is pending)
+    g_limitFilterTimer = StepperHal::createOneShot(limitFilterTimerCallback, nullptr);
     
     // Create Core 0 task for real-time control
     BaseType_t result = xTaskCreatePinnedToCore(
@@ -791,28 +2604,31 @@ bool initialize() {
     
     if (result != pdPASS) {
         Serial.println("StepperController: ERROR - Failed to create Core 0 task");
-        g_stepper = nullptr;
+        for (Axis& axis : g_axes) {
+            axis.stepper = nullptr;
+        }
         vSemaphoreDelete(g_stepperMutex);
         return false;
     }
     
     // Initialize limit states and cache
-    g_leftLimitState = (digitalRead(LEFT_LIMIT_PIN) == LOW);
-    g_rightLimitState = (digitalRead(RIGHT_LIMIT_PIN) == LOW);
-    g_lastLeftPinReading = g_leftLimitState;
-    g_lastRightPinReading = g_rightLimitState;
-    
-    // Clear interrupt flags at startup
-    g_leftLimitTriggered = false;
-    g_rightLimitTriggered = false;
+    for (Axis& axis : g_axes) {
+        axis.leftLimitState = (StepperHal::readPin(axis.pins->leftLimit) == LOW);
+        axis.rightLimitState = (StepperHal::readPin(axis.pins->rightLimit) == LOW);
+        axis.lastLeftPinReading = axis.leftLimitState;
+        axis.lastRightPinReading = axis.rightLimitState;
+    }
     
     g_initialized = true;
     
     Serial.println("StepperController: Initialization complete");
     Serial.println("StepperController: Running on Core 0 for real-time performance");
-    Serial.printf("StepperController: Limit switches - Left: %s, Right: %s\n",
-                  g_leftLimitState ? "ACTIVE" : "inactive",
-                  g_rightLimitState ? "ACTIVE" : "inactive");
+    for (const Axis& axis : g_axes) {
+        Serial.printf("StepperController: Axis %d limit switches - Left: %s, Right: %s\n",
+                      axis.index,
+                      axis.leftLimitState ? "ACTIVE" : "inactive",
+                      axis.rightLimitState ? "ACTIVE" : "inactive");
+    }
     
     // Clear message about homing requirement
     Serial.println("\n*** IMPORTANT: HOMING REQUIRED ***");
@@ -824,42 +2640,61 @@ bool initialize() {
 }
 
 bool processMotionCommand(const MotionCommand& cmd) {
-    if (!g_initialized || g_stepper == nullptr) {
+    if (cmd.axis >= STEPPER_AXIS_COUNT) {
+        CORE_LOG_WARN("StepperController: REJECTED - No axis %d", cmd.axis);
+        return false;
+    }
+    Axis& axis = g_axes[cmd.axis];
+    if (!g_initialized || axis.stepper == nullptr) {
         return false;
     }
     
     if (xSemaphoreTake(g_stepperMutex, pdMS_TO_TICKS(10)) != pdTRUE) {
-        Serial.println("StepperController: Failed to acquire mutex for command");
+        CORE_LOG_WARN("StepperController: Failed to acquire mutex for command");
         // Release any held resources and return
         return false;
     }
     
     bool success = false;
     
+    // Coordinated moves check and drive every axis they name
+    if (cmd.type == CommandType::MOVE_COORDINATED) {
+        success = startCoordinatedMove(cmd);
+        xSemaphoreGive(g_stepperMutex);
+        return success;
+    }
+    
+    // Anything else on this axis ends its part of a coordinated move
+    endCoordinatedMove(axis);
+    
     // Check if homing is required before allowing motion
     bool isMotionCommand = (cmd.type == CommandType::MOVE_ABSOLUTE || 
-                           cmd.type == CommandType::MOVE_RELATIVE);
+                           cmd.type == CommandType::MOVE_RELATIVE ||
+                           cmd.type == CommandType::FOLLOW_TARGET ||
+                           cmd.type == CommandType::PATH_APPEND ||
+                           cmd.type == CommandType::PATH_START ||
+                           cmd.type == CommandType::CUE_PLAY);
     
     if (isMotionCommand) {
         // Check for limit fault
-        if (g_limitFaultActive) {
-            Serial.println("StepperController: REJECTED - Limit fault active. Home required.");
+        if (axis.limitFaultActive) {
+            CORE_LOG_WARN("StepperController: REJECTED - Limit fault active. Home required.");
             SAFE_WRITE_STATUS(safetyState, SafetyState::POSITION_ERROR);
             xSemaphoreGive(g_stepperMutex);
             return false;
         }
         
         // Check if system has been homed
-        if (!g_systemHomed) {
-            Serial.println("StepperController: REJECTED - System not homed. Home required before movement.");
+        if (!axis.systemHomed) {
+            CORE_LOG_WARN("StepperController: REJECTED - System not homed. Home required before movement.");
             SAFE_WRITE_STATUS(safetyState, SafetyState::POSITION_ERROR);
             xSemaphoreGive(g_stepperMutex);
             return false;
         }
         
         // Check if position limits are valid
-        if (!g_positionLimitsValid) {
-            Serial.println("StepperController: REJECTED - Position limits not established. Home required.");
+        if (!axis.positionLimitsValid) {
+            CORE_LOG_WARN("StepperController: REJECTED - Position limits not established. Home required.");
             SAFE_WRITE_STATUS(safetyState, SafetyState::POSITION_ERROR);
             xSemaphoreGive(g_stepperMutex);
             return false;
@@ -867,31 +2702,42 @@ bool processMotionCommand(const MotionCommand& cmd) {
     }
     
     // Also reject speed/acceleration changes if there's a limit fault
-    if (g_limitFaultActive && 
+    if (axis.limitFaultActive && 
         (cmd.type == CommandType::SET_SPEED ||
          cmd.type == CommandType::SET_ACCELERATION)) {
-        Serial.println("StepperController: REJECTED - Limit fault active. Home required.");
+        CORE_LOG_WARN("StepperController: REJECTED - Limit fault active. Home required.");
         SAFE_WRITE_STATUS(safetyState, SafetyState::POSITION_ERROR);
         xSemaphoreGive(g_stepperMutex);
         return false;
     }
     
+    // Anything that moves or stops the motor ends follow mode
+    if (axis.followActive &&
+        cmd.type != CommandType::FOLLOW_TARGET &&
+        cmd.type != CommandType::SET_SPEED &&
+        cmd.type != CommandType::SET_ACCELERATION &&
+        cmd.type != CommandType::ENABLE &&
+        cmd.type != CommandType::PATH_APPEND &&
+        cmd.type != CommandType::PATH_CLEAR) {
+        cancelFollow(axis);
+    }
+    
     switch (cmd.type) {
         case CommandType::MOVE_ABSOLUTE:
             // Apply speed and acceleration from the command profile if they are different
-            if (cmd.profile.maxSpeed > 0 && cmd.profile.maxSpeed != g_currentProfile.maxSpeed) {
-                g_stepper->setSpeedInHz(cmd.profile.maxSpeed);
-                g_currentProfile.maxSpeed = cmd.profile.maxSpeed;
-                Serial.printf("StepperController: Setting speed to %.1f for this move\n", cmd.profile.maxSpeed);
+            if (cmd.profile.maxSpeed > 0 && cmd.profile.maxSpeed != axis.currentProfile.maxSpeed) {
+                axis.stepper->setSpeedInHz(cmd.profile.maxSpeed);
+                axis.currentProfile.maxSpeed = cmd.profile.maxSpeed;
+                CORE_LOG_INFO("StepperController: Setting speed to %.1f for this move", cmd.profile.maxSpeed);
             }
-            if (cmd.profile.acceleration > 0 && cmd.profile.acceleration != g_currentProfile.acceleration) {
-                g_stepper->setAcceleration(cmd.profile.acceleration);
-                g_currentProfile.acceleration = cmd.profile.acceleration;
-                g_currentProfile.deceleration = cmd.profile.acceleration;
-                Serial.printf("StepperController: Setting acceleration to %.1f for this move\n", cmd.profile.acceleration);
+            if (cmd.profile.acceleration > 0 && cmd.profile.acceleration != axis.currentProfile.acceleration) {
+                axis.stepper->setAcceleration(cmd.profile.acceleration);
+                axis.currentProfile.acceleration = cmd.profile.acceleration;
+                axis.currentProfile.deceleration = cmd.profile.acceleration;
+                CORE_LOG_INFO("StepperController: Setting acceleration to %.1f for this move", cmd.profile.acceleration);
             }
             
-            if (g_positionLimitsValid && cmd.profile.enableLimits) {
+            if (axis.positionLimitsValid && cmd.profile.enableLimits) {
                 // Get user-configured limits from SystemConfig
                 SystemConfig* config = SystemConfigMgr::getConfig();
                 if (config) {
@@ -900,29 +2746,28 @@ bool processMotionCommand(const MotionCommand& cmd) {
                     int32_t userMaxPos = config->maxPosition;
                     
                     // Ensure user limits are within physical limits
-                    userMinPos = constrain(userMinPos, g_minPosition, g_maxPosition);
-                    userMaxPos = constrain(userMaxPos, g_minPosition, g_maxPosition);
+                    userMinPos = constrain(userMinPos, axis.minPosition, axis.maxPosition);
+                    userMaxPos = constrain(userMaxPos, axis.minPosition, axis.maxPosition);
                     
                     // Clamp target to user-configured range
                     int32_t targetPos = constrain(cmd.profile.targetPosition, 
                                                 userMinPos, userMaxPos);
-                    g_stepper->moveTo(targetPos);
+                    startMove(axis, targetPos, cmd.profile);
                     
                     if (targetPos != cmd.profile.targetPosition) {
-                        Serial.printf("StepperController: Move clamped from %d to %d (user limits: %d-%d)\n", 
+                        CORE_LOG_INFO("StepperController: Move clamped from %d to %d (user limits: %d-%d)", 
                                     cmd.profile.targetPosition, targetPos, userMinPos, userMaxPos);
                     }
                 } else {
                     // Fallback to physical limits if config not available
                     int32_t targetPos = constrain(cmd.profile.targetPosition, 
-                                                g_minPosition, g_maxPosition);
-                    g_stepper->moveTo(targetPos);
+                                                axis.minPosition, axis.maxPosition);
+                    startMove(axis, targetPos, cmd.profile);
                 }
             } else {
                 // No limits or limits disabled
-                g_stepper->moveTo(cmd.profile.targetPosition);
+                startMove(axis, cmd.profile.targetPosition, cmd.profile);
             }
-            g_motionStartTime = millis();  // Track when motion started for timeout detection
             success = true;
             // Removed debug output for move commands as requested
             break;
@@ -930,20 +2775,20 @@ bool processMotionCommand(const MotionCommand& cmd) {
         case CommandType::MOVE_RELATIVE:
             {
                 // Apply speed and acceleration from the command profile if they are different
-                if (cmd.profile.maxSpeed > 0 && cmd.profile.maxSpeed != g_currentProfile.maxSpeed) {
-                    g_stepper->setSpeedInHz(cmd.profile.maxSpeed);
-                    g_currentProfile.maxSpeed = cmd.profile.maxSpeed;
-                    Serial.printf("StepperController: Setting speed to %.1f for this move\n", cmd.profile.maxSpeed);
+                if (cmd.profile.maxSpeed > 0 && cmd.profile.maxSpeed != axis.currentProfile.maxSpeed) {
+                    axis.stepper->setSpeedInHz(cmd.profile.maxSpeed);
+                    axis.currentProfile.maxSpeed = cmd.profile.maxSpeed;
+                    CORE_LOG_INFO("StepperController: Setting speed to %.1f for this move", cmd.profile.maxSpeed);
                 }
-                if (cmd.profile.acceleration > 0 && cmd.profile.acceleration != g_currentProfile.acceleration) {
-                    g_stepper->setAcceleration(cmd.profile.acceleration);
-                    g_currentProfile.acceleration = cmd.profile.acceleration;
-                    g_currentProfile.deceleration = cmd.profile.acceleration;
-                    Serial.printf("StepperController: Setting acceleration to %.1f for this move\n", cmd.profile.acceleration);
+                if (cmd.profile.acceleration > 0 && cmd.profile.acceleration != axis.currentProfile.acceleration) {
+                    axis.stepper->setAcceleration(cmd.profile.acceleration);
+                    axis.currentProfile.acceleration = cmd.profile.acceleration;
+                    axis.currentProfile.deceleration = cmd.profile.acceleration;
+                    CORE_LOG_INFO("StepperController: Setting acceleration to %.1f for this move", cmd.profile.acceleration);
                 }
                 
-                int32_t targetPos = g_currentPosition + cmd.profile.targetPosition;
-                if (g_positionLimitsValid && cmd.profile.enableLimits) {
+                int32_t targetPos = axis.currentPosition + cmd.profile.targetPosition;
+                if (axis.positionLimitsValid && cmd.profile.enableLimits) {
                     // Get user-configured limits from SystemConfig
                     SystemConfig* config = SystemConfigMgr::getConfig();
                     if (config) {
@@ -952,123 +2797,201 @@ bool processMotionCommand(const MotionCommand& cmd) {
                         int32_t userMaxPos = config->maxPosition;
                         
                         // Ensure user limits are within physical limits
-                        userMinPos = constrain(userMinPos, g_minPosition, g_maxPosition);
-                        userMaxPos = constrain(userMaxPos, g_minPosition, g_maxPosition);
+                        userMinPos = constrain(userMinPos, axis.minPosition, axis.maxPosition);
+                        userMaxPos = constrain(userMaxPos, axis.minPosition, axis.maxPosition);
                         
                         // Clamp target to user-configured range
                         targetPos = constrain(targetPos, userMinPos, userMaxPos);
                         
-                        if (targetPos != (g_currentPosition + cmd.profile.targetPosition)) {
-                            Serial.printf("StepperController: Relative move clamped to %d (user limits: %d-%d)\n", 
+                        if (targetPos != (axis.currentPosition + cmd.profile.targetPosition)) {
+                            CORE_LOG_INFO("StepperController: Relative move clamped to %d (user limits: %d-%d)", 
                                         targetPos, userMinPos, userMaxPos);
                         }
                     } else {
                         // Fallback to physical limits if config not available
-                        targetPos = constrain(targetPos, g_minPosition, g_maxPosition);
+                        targetPos = constrain(targetPos, axis.minPosition, axis.maxPosition);
                     }
                 }
-                g_stepper->moveTo(targetPos);
-                g_motionStartTime = millis();  // Track when motion started for timeout detection
-                success = true;
-                Serial.printf("StepperController: Move relative %d\n", cmd.profile.targetPosition);
+                startMove(axis, targetPos, cmd.profile);
+                    success = true;
+                CORE_LOG_INFO("StepperController: Move relative %d", cmd.profile.targetPosition);
+            }
+            break;
+            
+        case CommandType::FOLLOW_TARGET:
+            if (cmd.profile.acceleration > 0 && cmd.profile.acceleration != axis.currentProfile.acceleration) {
+                axis.stepper->setAcceleration(cmd.profile.acceleration);
+                axis.currentProfile.acceleration = cmd.profile.acceleration;
+                axis.currentProfile.deceleration = cmd.profile.acceleration;
+            }
+            if (cmd.profile.maxSpeed > 0) {
+                axis.currentProfile.maxSpeed = cmd.profile.maxSpeed;
+            }
+            applyFollowSetpoint(axis, cmd);
+            armMotionTimeout(axis, rampArrivalMs(axis, axis.followSetpoint, axis.followMaxSpeed));  // Re-armed every frame
+            success = true;
+            break;
+            
+        case CommandType::PATH_APPEND:
+            success = appendWaypoint(axis, cmd.profile);
+            break;
+            
+        case CommandType::PATH_START:
+            if (axis.streamSource == StreamSource::PATH) {
+                success = true;  // Already running - new waypoints join the look-ahead
+            } else if (axis.path.count == 0) {
+                CORE_LOG_INFO("StepperController: Path empty - nothing to run");
+            } else if (axis.stepper->isRunning()) {
+                CORE_LOG_WARN("StepperController: REJECTED - Path start requires the motor at rest");
+            } else {
+                success = startPath(axis);
+            }
+            break;
+            
+        case CommandType::PATH_CLEAR:
+            if (axis.streamSource == StreamSource::PATH) {
+                stopStream(axis);  // Decelerate from the queued speed, path is dropped
+            } else {
+                MotionPlanner::pathClear(axis.path);
             }
+            success = true;
+            CORE_LOG_INFO("StepperController: Path cleared");
+            break;
+            
+        case CommandType::CUE_PLAY:
+            success = startCue(axis, cmd.cueId);
             break;
             
         case CommandType::SET_SPEED:
-            g_stepper->setSpeedInHz(cmd.profile.maxSpeed);
-            g_currentProfile.maxSpeed = cmd.profile.maxSpeed;
+            axis.stepper->setSpeedInHz(cmd.profile.maxSpeed);
+            axis.currentProfile.maxSpeed = cmd.profile.maxSpeed;
             
             // Apply immediately to current motion if moving
-            if (g_stepper->isRunning()) {
+            if (axis.stepper->isRunning()) {
                 // FastAccelStepper will smoothly transition to new speed
-                Serial.printf("StepperController: Changing speed to %.1f during active motion\n", 
+                CORE_LOG_INFO("StepperController: Changing speed to %.1f during active motion", 
                               cmd.profile.maxSpeed);
             } else {
-                Serial.printf("StepperController: Set speed to %.1f (will apply to next move)\n", 
+                CORE_LOG_INFO("StepperController: Set speed to %.1f (will apply to next move)", 
                               cmd.profile.maxSpeed);
             }
             success = true;
             break;
             
         case CommandType::SET_ACCELERATION:
-            g_stepper->setAcceleration(cmd.profile.acceleration);
-            g_currentProfile.acceleration = cmd.profile.acceleration;
-            g_currentProfile.deceleration = cmd.profile.acceleration; // Same value
+            axis.stepper->setAcceleration(cmd.profile.acceleration);
+            axis.currentProfile.acceleration = cmd.profile.acceleration;
+            axis.currentProfile.deceleration = cmd.profile.acceleration; // Same value
             
             // Apply immediately to current motion if moving
-            if (g_stepper->isRunning()) {
+            if (axis.stepper->isRunning()) {
                 // FastAccelStepper will use new acceleration for speed changes
-                Serial.printf("StepperController: Changing acceleration to %.1f during active motion\n", 
+                CORE_LOG_INFO("StepperController: Changing acceleration to %.1f during active motion", 
                               cmd.profile.acceleration);
             } else {
-                Serial.printf("StepperController: Set acceleration to %.1f (will apply to next move)\n", 
+                CORE_LOG_INFO("StepperController: Set acceleration to %.1f (will apply to next move)", 
                               cmd.profile.acceleration);
             }
             success = true;
             break;
             
         case CommandType::HOME:
-            if (g_homingState == HomingState::IDLE || 
-                g_homingState == HomingState::COMPLETE ||
-                g_homingState == HomingState::ERROR) {
-                startHomingSequence();
+            if (axis.homingState == HomingState::IDLE || 
+                axis.homingState == HomingState::COMPLETE ||
+                axis.homingState == HomingState::ERROR) {
+                startHomingSequence(axis);
                 success = true;
             }
             break;
             
         case CommandType::STOP:
-            g_stepper->stopMove();
+            if (axis.streamSource != StreamSource::NONE) {
+                stopStream(axis);
+            }
+            axis.stepper->stopMove();
+            armMotionTimeout(axis, (uint32_t)ceilf(fabsf(FixedPoint::fromMilli(axis.stepper->getCurrentSpeedInMilliHz())) /
+                                             axis.currentProfile.acceleration * 1000.0f));  // Stopping time
             success = true;
-            Serial.println("StepperController: Stop commanded");
+            CORE_LOG_INFO("StepperController: Stop commanded");
             break;
             
         case CommandType::EMERGENCY_STOP:
-            g_stepper->forceStop();
-            g_motionState = MotionState::IDLE;
+            // Stops every axis, whichever one the command names
+            for (Axis& stopped : g_axes) {
+                forceStopMotion(stopped);
+                stopped.motionState = MotionState::IDLE;
+            }
             SAFE_WRITE_STATUS(safetyState, SafetyState::EMERGENCY_STOP);
             success = true;
-            Serial.println("StepperController: EMERGENCY STOP!");
+            CORE_LOG_INFO("StepperController: EMERGENCY STOP!");
             break;
             
         case CommandType::ENABLE:
-            g_stepper->enableOutputs();
-            g_stepperEnabled = true;
+            axis.stepper->enableOutputs();
+            axis.stepperEnabled = true;
             success = true;
-            Serial.println("StepperController: Outputs enabled");
+            CORE_LOG_INFO("StepperController: Outputs enabled");
             break;
             
         case CommandType::DISABLE:
-            g_stepper->disableOutputs();
-            g_stepperEnabled = false;
+            axis.stepper->disableOutputs();
+            axis.stepperEnabled = false;
             success = true;
-            Serial.println("StepperController: Outputs disabled");
+            CORE_LOG_INFO("StepperController: Outputs disabled");
             break;
             
         default:
-            Serial.printf("StepperController: Unknown command type %d\n", (int)cmd.type);
+            CORE_LOG_INFO("StepperController: Unknown command type %d", (int)cmd.type);
             break;
     }
     
+    if (success && (cmd.type == CommandType::MOVE_ABSOLUTE || cmd.type == CommandType::MOVE_RELATIVE ||
+                    cmd.type == CommandType::PATH_START || cmd.type == CommandType::CUE_PLAY)) {
+        MotionTrace::record(MotionTrace::Event::MOVE_START, (uint8_t)cmd.type, cmd.commandId,
+                            commandedTarget(axis));
+    }
+    
     xSemaphoreGive(g_stepperMutex);
     return success;
 }
 
 // Thread-safe public interface functions
 
+bool queueMotionCommand(const MotionCommand& cmd, TickType_t timeout) {
+    if (g_motionCommandQueue == nullptr) {
+        return false;
+    }
+    
+    if (xQueueSend(g_motionCommandQueue, &cmd, timeout) != pdTRUE) {
+        g_commandStats.queueFull++;
+        MotionTrace::record(MotionTrace::Event::QUEUE_OVERFLOW, (uint8_t)cmd.type, cmd.commandId,
+                            cmd.profile.targetPosition);
+        return false;
+    }
+    
+    // Wake the Core 0 task so the command is applied now, not on the next tick
+    if (g_stepperTaskHandle != nullptr) {
+        xTaskNotify(g_stepperTaskHandle, NOTIFY_COMMAND, eSetBits);
+    }
+    return true;
+}
+
 bool emergencyStop() {
     MotionCommand cmd;
     cmd.type = CommandType::EMERGENCY_STOP;
-    cmd.timestamp = millis();
+    cmd.timestamp = StepperHal::millis();
     
     // Try to queue command for Core 0 processing
-    if (xQueueSend(g_motionCommandQueue, &cmd, pdMS_TO_TICKS(10)) == pdTRUE) {
+    if (queueMotionCommand(cmd, pdMS_TO_TICKS(10)) == pdTRUE) {
         return true;
     }
     
     // If queue fails, try direct access (emergency!)
-    if (g_initialized && g_stepper) {
+    if (g_initialized) {
         if (xSemaphoreTake(g_stepperMutex, pdMS_TO_TICKS(10)) == pdTRUE) {
-            g_stepper->forceStop();
+            for (Axis& axis : g_axes) {
+                forceStopMotion(axis);
+            }
             xSemaphoreGive(g_stepperMutex);
             return true;
         }
@@ -1080,9 +3003,9 @@ bool emergencyStop() {
 bool enable(bool state) {
     MotionCommand cmd;
     cmd.type = state ? CommandType::ENABLE : CommandType::DISABLE;
-    cmd.timestamp = millis();
+    cmd.timestamp = StepperHal::millis();
     
-    return xQueueSend(g_motionCommandQueue, &cmd, pdMS_TO_TICKS(10)) == pdTRUE;
+    return queueMotionCommand(cmd, pdMS_TO_TICKS(10)) == pdTRUE;
 }
 
 int32_t getCurrentPosition() {
@@ -1108,9 +3031,10 @@ bool isMoving() {
 }
 
 MotionProfile getMotionProfile() {
+    Axis& axis = primaryAxis();
     MotionProfile profile;
     if (xSemaphoreTake(g_stepperMutex, pdMS_TO_TICKS(10)) == pdTRUE) {
-        profile = g_currentProfile;
+        profile = axis.currentProfile;
         xSemaphoreGive(g_stepperMutex);
     }
     return profile;
@@ -1120,16 +3044,16 @@ bool setMotionProfile(const MotionProfile& profile) {
     MotionCommand cmd;
     cmd.type = CommandType::SET_SPEED;
     cmd.profile = profile;
-    cmd.timestamp = millis();
+    cmd.timestamp = StepperHal::millis();
     
     // Queue speed change
-    if (xQueueSend(g_motionCommandQueue, &cmd, pdMS_TO_TICKS(10)) != pdTRUE) {
+    if (queueMotionCommand(cmd, pdMS_TO_TICKS(10)) != pdTRUE) {
         return false;
     }
     
     // Queue acceleration change
     cmd.type = CommandType::SET_ACCELERATION;
-    return xQueueSend(g_motionCommandQueue, &cmd, pdMS_TO_TICKS(10)) == pdTRUE;
+    return queueMotionCommand(cmd, pdMS_TO_TICKS(10)) == pdTRUE;
 }
 
 bool isEnabled() {
@@ -1155,123 +3079,196 @@ bool getTimingDiagnostics(uint32_t& stepInterval, float& dutyCycle) {
     return true;
 }
 
-bool startHoming() {
-    if (!g_initialized) return false;
+bool startHoming(bool fullSweep, uint8_t axisIndex) {
+    if (!g_initialized || axisIndex >= STEPPER_AXIS_COUNT) return false;
+    Axis& axis = g_axes[axisIndex];
+    
+    // Read by startHomingSequence() on Core 0
+    if (fullSweep) {
+        axis.fullHomingRequested = true;
+    }
     
     MotionCommand cmd;
     cmd.type = CommandType::HOME;
-    cmd.timestamp = millis();
+    cmd.axis = axisIndex;
+    cmd.timestamp = StepperHal::millis();
     
-    return xQueueSend(g_motionCommandQueue, &cmd, pdMS_TO_TICKS(10)) == pdTRUE;
+    return queueMotionCommand(cmd, pdMS_TO_TICKS(10)) == pdTRUE;
 }
 
 bool isHoming() {
-    return (g_homingState != HomingState::IDLE && 
-            g_homingState != HomingState::COMPLETE &&
-            g_homingState != HomingState::ERROR);
+    return isAxisHoming(primaryAxis());
 }
 
 uint8_t getHomingProgress() {
-    return g_homingProgress;
+    Axis& axis = primaryAxis();
+    return axis.homingProgress;
 }
 
-bool isHomed() {
-    return g_systemHomed;
+bool isHomed(uint8_t axisIndex) {
+    return axisIndex < STEPPER_AXIS_COUNT && g_axes[axisIndex].systemHomed;
 }
 
-bool getPositionLimits(int32_t& minPos, int32_t& maxPos) {
-    if (!g_positionLimitsValid) {
+bool getPositionLimits(int32_t& minPos, int32_t& maxPos, uint8_t axisIndex) {
+    if (axisIndex >= STEPPER_AXIS_COUNT || !g_axes[axisIndex].positionLimitsValid) {
         return false;
     }
+    Axis& axis = g_axes[axisIndex];
     
-    minPos = g_minPosition;
-    maxPos = g_maxPosition;
+    minPos = axis.minPosition;
+    maxPos = axis.maxPosition;
     return true;
 }
 
-bool getDetectedLimits(int32_t& leftLimit, int32_t& rightLimit) {
-    if (!g_positionLimitsValid) {
+bool getDetectedLimits(int32_t& leftLimit, int32_t& rightLimit, uint8_t axisIndex) {
+    if (axisIndex >= STEPPER_AXIS_COUNT || !g_axes[axisIndex].positionLimitsValid) {
         return false;
     }
+    Axis& axis = g_axes[axisIndex];
     
-    leftLimit = g_detectedLeftLimit;  // Should be 0 after homing
-    rightLimit = g_detectedRightLimit;
+    leftLimit = axis.detectedLeftLimit;  // Should be 0 after homing
+    rightLimit = axis.detectedRightLimit;
+    return true;
+}
+
+bool getUserLimits(int32_t& minPos, int32_t& maxPos, uint8_t axisIndex) {
+    if (axisIndex >= STEPPER_AXIS_COUNT) {
+        return false;
+    }
+    readUserLimits(g_axes[axisIndex], minPos, maxPos);
+    return true;
+}
+
+bool setUserLimits(int32_t minPos, int32_t maxPos, uint8_t axisIndex) {
+    if (!g_initialized || axisIndex >= STEPPER_AXIS_COUNT || minPos >= maxPos) {
+        return false;
+    }
+    Axis& axis = g_axes[axisIndex];
+    if (axisIndex == 0) {
+        return SystemConfigMgr::setPositionLimits(minPos, maxPos) && SystemConfigMgr::saveToEEPROM();
+    }
+    if (xSemaphoreTake(g_stepperMutex, pdMS_TO_TICKS(10)) != pdTRUE) {
+        return false;
+    }
+    axis.userMinPosition = minPos;
+    axis.userMaxPosition = maxPos;
+    axis.userLimitsSavePending = false;  // Written below
+    xSemaphoreGive(g_stepperMutex);
+    saveUserLimits(axis, minPos, maxPos);
     return true;
 }
 
 void getLimitStates(bool& leftLimit, bool& rightLimit) {
-    leftLimit = g_leftLimitState;
-    rightLimit = g_rightLimitState;
+    Axis& axis = primaryAxis();
+    leftLimit = axis.leftLimitState;
+    rightLimit = axis.rightLimitState;
 }
 
-bool moveTo(int32_t position) {
+bool moveTo(int32_t position, uint8_t axisIndex) {
+    if (axisIndex >= STEPPER_AXIS_COUNT) return false;
+    Axis& axis = g_axes[axisIndex];
     MotionCommand cmd;
     cmd.type = CommandType::MOVE_ABSOLUTE;
-    cmd.profile = g_currentProfile;
+    cmd.axis = axisIndex;
+    cmd.profile = axis.currentProfile;
     cmd.profile.targetPosition = position;
     cmd.profile.enableLimits = true;  // Ensure limits are enforced
-    cmd.timestamp = millis();
+    cmd.timestamp = StepperHal::millis();
     
-    return xQueueSend(g_motionCommandQueue, &cmd, pdMS_TO_TICKS(10)) == pdTRUE;
+    return queueMotionCommand(cmd, pdMS_TO_TICKS(10)) == pdTRUE;
 }
 
-bool move(int32_t steps) {
+bool move(int32_t steps, uint8_t axisIndex) {
+    if (axisIndex >= STEPPER_AXIS_COUNT) return false;
+    Axis& axis = g_axes[axisIndex];
     MotionCommand cmd;
     cmd.type = CommandType::MOVE_RELATIVE;
-    cmd.profile = g_currentProfile;
+    cmd.axis = axisIndex;
+    cmd.profile = axis.currentProfile;
     cmd.profile.targetPosition = steps;
     cmd.profile.enableLimits = true;  // Ensure limits are enforced
-    cmd.timestamp = millis();
+    cmd.timestamp = StepperHal::millis();
     
-    return xQueueSend(g_motionCommandQueue, &cmd, pdMS_TO_TICKS(10)) == pdTRUE;
+    return queueMotionCommand(cmd, pdMS_TO_TICKS(10)) == pdTRUE;
 }
 
-bool stop() {
+bool stop(uint8_t axisIndex) {
+    if (axisIndex >= STEPPER_AXIS_COUNT) return false;
     MotionCommand cmd;
     cmd.type = CommandType::STOP;
-    cmd.timestamp = millis();
+    cmd.axis = axisIndex;
+    cmd.timestamp = StepperHal::millis();
     
-    return xQueueSend(g_motionCommandQueue, &cmd, pdMS_TO_TICKS(10)) == pdTRUE;
+    return queueMotionCommand(cmd, pdMS_TO_TICKS(10)) == pdTRUE;
 }
 
-bool setMaxSpeed(float speed) {
-    if (speed <= 0 || speed > MAX_STEP_FREQUENCY) {
+bool setMaxSpeed(float speed, uint8_t axisIndex) {
+    if (speed <= 0 || speed > MAX_STEP_FREQUENCY || axisIndex >= STEPPER_AXIS_COUNT) {
         return false;
     }
+    Axis& axis = g_axes[axisIndex];
     
     MotionCommand cmd;
     cmd.type = CommandType::SET_SPEED;
-    cmd.profile = g_currentProfile;
+    cmd.axis = axisIndex;
+    cmd.profile = axis.currentProfile;
     cmd.profile.maxSpeed = speed;
-    cmd.timestamp = millis();
+    cmd.timestamp = StepperHal::millis();
     
-    return xQueueSend(g_motionCommandQueue, &cmd, pdMS_TO_TICKS(10)) == pdTRUE;
+    return queueMotionCommand(cmd, pdMS_TO_TICKS(10)) == pdTRUE;
 }
 
-bool setAcceleration(float accel) {
-    if (accel <= 0) {
+bool setAcceleration(float accel, uint8_t axisIndex) {
+    if (accel <= 0 || axisIndex >= STEPPER_AXIS_COUNT) {
         return false;
     }
+    Axis& axis = g_axes[axisIndex];
     
     MotionCommand cmd;
     cmd.type = CommandType::SET_ACCELERATION;
-    cmd.profile = g_currentProfile;
+    cmd.axis = axisIndex;
+    cmd.profile = axis.currentProfile;
     cmd.profile.acceleration = accel;
     cmd.profile.deceleration = accel; // FastAccelStepper uses same value
-    cmd.timestamp = millis();
+    cmd.timestamp = StepperHal::millis();
+    
+    return queueMotionCommand(cmd, pdMS_TO_TICKS(10)) == pdTRUE;
+}
+
+bool moveCoordinated(const int32_t targets[], uint8_t axisMask, ProfileShape shape) {
+    if (axisMask == 0 || axisMask >= (1 << STEPPER_AXIS_COUNT)) {
+        return false;
+    }
+    MotionCommand cmd = {};
+    cmd.type = CommandType::MOVE_COORDINATED;
+    SystemConfig* config = SystemConfigMgr::getConfig();
+    if (config) {
+        cmd.profile = config->defaultProfile;
+    }
+    if (shape != ProfileShape::CONFIGURED) {
+        cmd.profile.shape = shape;
+    }
+    cmd.axisMask = axisMask;
+    for (uint8_t i = 0; i < STEPPER_AXIS_COUNT; i++) {
+        if (axisMask & (1 << i)) {
+            cmd.axisTargets[i] = targets[i];
+        }
+    }
+    cmd.timestamp = StepperHal::millis();
     
-    return xQueueSend(g_motionCommandQueue, &cmd, pdMS_TO_TICKS(10)) == pdTRUE;
+    return queueMotionCommand(cmd, pdMS_TO_TICKS(10)) == pdTRUE;
 }
 
 int32_t distanceToGo() {
-    if (!g_initialized || g_stepper == nullptr) {
+    Axis& axis = primaryAxis();
+    if (!g_initialized || axis.stepper == nullptr) {
         return 0;
     }
     
     int32_t distance = 0;
     if (xSemaphoreTake(g_stepperMutex, pdMS_TO_TICKS(10)) == pdTRUE) {
         // Calculate distance from current position to target
-        distance = g_stepper->targetPos() - g_stepper->getCurrentPosition();
+        distance = axis.stepper->targetPos() - axis.stepper->getCurrentPosition();
         xSemaphoreGive(g_stepperMutex);
     }
     
@@ -1302,7 +3299,77 @@ bool enableStepDiagnostics(bool enable) {
 }
 
 bool isLimitFaultActive() {
-    return g_limitFaultActive;
+    Axis& axis = primaryAxis();
+    return axis.limitFaultActive;
+}
+
+void getCommandQueueStats(CommandQueueStats& stats) {
+    stats = g_commandStats;
+}
+
+void getHomingTimes(HomingTimes& times) {
+    Axis& axis = primaryAxis();
+    times = axis.homingTimes;
+}
+
+int32_t getCalibratedRange() {
+    Axis& axis = primaryAxis();
+    return axis.calibration.valid ? axis.calibration.range : 0;
+}
+
+void getLimitStopStats(LimitStopStats& stats) {
+    Axis& axis = primaryAxis();
+    stats = axis.limitStats;
+    stats.ringOverflows = g_limitEdgeOverflows;
+    stats.filterSamples = limitFilterSamples();
+}
+
+uint8_t getPathQueueDepth() {
+    Axis& axis = primaryAxis();
+    return axis.path.count;
+}
+
+bool isPathRunning() {
+    Axis& axis = primaryAxis();
+    return axis.streamSource == StreamSource::PATH;
+}
+
+int8_t getActiveCue() {
+    Axis& axis = primaryAxis();
+    return axis.cueId;
+}
+
+uint8_t getAxisCount() {
+    return STEPPER_AXIS_COUNT;
+}
+
+bool getAxisStatus(uint8_t axis, AxisStatus& status) {
+    if (axis >= STEPPER_AXIS_COUNT) {
+        return false;
+    }
+    // Seqlock read, as readSystemStatus()
+    for (uint8_t attempt = 0; attempt < AXIS_STATUS_READ_RETRIES; attempt++) {
+        uint32_t before = g_axisStatusSequence.load(std::memory_order_acquire);
+        if (before & 1) {
+            continue;  // Core 0 task is publishing
+        }
+        status = g_axisStatus[axis];
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (g_axisStatusSequence.load(std::memory_order_relaxed) == before) {
+            return true;
+        }
+    }
+    
+    portENTER_CRITICAL(&g_axisStatusLock);
+    status = g_axisStatus[axis];
+    portEXIT_CRITICAL(&g_axisStatusLock);
+    return true;
+}
+
+uint32_t getTimeToArrival() {
+    uint32_t eta = 0;
+    SAFE_READ_STATUS(timeToArrival, eta);
+    return eta;
 }
 
 bool update() {
@@ -1313,10 +3380,56 @@ bool update() {
 
 bool isTaskHealthy() {
     // Check if task has updated within last 5 seconds
-    uint32_t timeSinceUpdate = millis() - g_lastTaskUpdate;
+    uint32_t timeSinceUpdate = StepperHal::millis() - g_lastTaskUpdate;
     return (timeSinceUpdate < 5000);  // Healthy if updated within 5 seconds
 }
 
+bool flushPendingSaves() {
+    if (!g_initialized) return false;
+    
+    // Copy what is pending under the mutex, write flash outside it
+    HomingCalibration calibrations[STEPPER_AXIS_COUNT];
+    bool saveCalibrations[STEPPER_AXIS_COUNT] = {};
+    int32_t userLimits[STEPPER_AXIS_COUNT][2];
+    bool saveUserLimitsPending[STEPPER_AXIS_COUNT] = {};
+    bool saveConfig = false;
+    if (xSemaphoreTake(g_stepperMutex, pdMS_TO_TICKS(5)) != pdTRUE) {
+        return false;  // Try again next loop
+    }
+    for (Axis& axis : g_axes) {
+        if (axis.calibrationSavePending) {
+            calibrations[axis.index] = axis.calibration;
+            saveCalibrations[axis.index] = true;
+            axis.calibrationSavePending = false;
+        }
+        if (axis.userLimitsSavePending) {
+            userLimits[axis.index][0] = axis.userMinPosition;
+            userLimits[axis.index][1] = axis.userMaxPosition;
+            saveUserLimitsPending[axis.index] = true;
+            axis.userLimitsSavePending = false;
+        }
+    }
+    saveConfig = g_configSavePending;
+    g_configSavePending = false;
+    xSemaphoreGive(g_stepperMutex);
+    
+    bool wrote = saveConfig;
+    for (const Axis& axis : g_axes) {
+        if (saveCalibrations[axis.index]) {
+            saveCalibration(axis, calibrations[axis.index]);
+            wrote = true;
+        }
+        if (saveUserLimitsPending[axis.index]) {
+            saveUserLimits(axis, userLimits[axis.index][0], userLimits[axis.index][1]);
+            wrote = true;
+        }
+    }
+    if (saveConfig) {
+        SystemConfigMgr::saveToEEPROM();
+    }
+    return wrote;
+}
+
 uint32_t getLastTaskUpdateTime() {
     return g_lastTaskUpdate;
 }
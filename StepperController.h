@@ -22,6 +22,75 @@
 
 namespace StepperController {
     
+    // ------------------------------------------------------------------------
+    // Diagnostic Structures
+    // ------------------------------------------------------------------------
+    
+    /**
+     * Motion command queue statistics (since boot)
+     */
+    struct CommandQueueStats {
+        uint32_t received;    // Commands pulled from the queue
+        uint32_t processed;   // Commands actually executed after coalescing
+        uint32_t coalesced;   // Commands merged into a later command of the same kind
+        uint32_t dropped;     // Moves discarded because a STOP/E-STOP preempted them
+        uint32_t queueFull;   // Sends rejected because the queue was full
+    };
+    
+    /**
+     * Phase durations of the last completed homing sequence (ms)
+     * Release phases include the slow re-approach when two-speed homing is on
+     */
+    struct HomingTimes {
+        uint32_t findLeft;      // Approach to the left switch
+        uint32_t releaseLeft;   // Back-off to the left release point (new zero)
+        uint32_t findRight;     // Travel to the right switch
+        uint32_t releaseRight;  // Back-off to the right release point
+        uint32_t moveHome;      // Move to the configured home position
+        uint32_t total;         // Whole sequence
+        bool fastApproach;      // Sequence used two-speed homing
+        bool verified;          // Range taken from the stored calibration (no sweep)
+    };
+    
+    /**
+     * Limit switch stop path statistics (since boot)
+     * Latency runs from the ISR edge timestamp to forceStop(), overrun from
+     * the position at the edge to the position at standstill. The latch
+     * delta is the travel between the edge and its confirmation - the error
+     * a position sampled on confirmation would have had.
+     */
+    struct LimitStopStats {
+        uint32_t edges;          // Switch edges taken from the ISR ring
+        uint32_t glitches;       // Edges rejected by the glitch filter
+        uint32_t ringOverflows;  // Edges lost because the ring was full
+        uint32_t stops;          // Limit stops executed
+        uint32_t lastLatencyUs;  // Edge to stop on the last limit stop (us)
+        uint32_t maxLatencyUs;   // Worst edge to stop latency (us)
+        int32_t lastOverrun;     // Steps past the edge on the last limit stop
+        int32_t maxOverrun;      // Worst overrun (steps)
+        int32_t lastLatchDelta;  // Edge to confirmation travel on the last switch change (steps)
+        int32_t maxLatchDelta;   // Worst latch delta (steps)
+        uint8_t filterSamples;   // Glitch filter sample count in use
+    };
+    
+    /**
+     * Snapshot of one axis, published by the Core 0 task every cycle
+     * (axis 0 is also published to SystemStatus)
+     */
+    struct AxisStatus {
+        int32_t currentPosition;
+        int32_t targetPosition;
+        float currentSpeed;         // steps/sec
+        uint32_t timeToArrival;     // ms until the current move is expected to finish (0 = at rest)
+        MotionState motionState;
+        bool stepperEnabled;
+        bool limitsActive[2];       // [LEFT, RIGHT]
+        bool stepperAlarm;
+        bool homed;
+        bool homing;
+        bool limitFault;
+    };
+    
     // ------------------------------------------------------------------------
     // Public Interface Functions
     // ------------------------------------------------------------------------
@@ -48,6 +117,15 @@ namespace StepperController {
      */
     bool processMotionCommand(const MotionCommand& cmd);
     
+    /**
+     * Queue a motion command for the Core 0 task and wake it immediately
+     * All modules should send commands through this instead of xQueueSend
+     * @param cmd Motion command to queue
+     * @param timeout Ticks to wait for queue space (0 = non-blocking)
+     * @return true if command queued
+     */
+    bool queueMotionCommand(const MotionCommand& cmd, TickType_t timeout = 0);
+    
     /**
      * Emergency stop with maximum deceleration
      * Thread-safe, can be called from any core
@@ -126,9 +204,12 @@ namespace StepperController {
     /**
      * Start homing sequence with auto-range detection
      * Finds left limit, then right limit to determine range
-     * @return true if homing started
+     * With verifyHoming set, a matching left switch reuses the stored range
+     * @param fullSweep Sweep both switches even when verifyHoming is set
+     * @param axis Axis to home
+     * @return true if homing was queued (false for an axis that does not exist)
      */
-    bool startHoming();
+    bool startHoming(bool fullSweep, uint8_t axis);
     
     /**
      * Check if homing is in progress
@@ -144,25 +225,49 @@ namespace StepperController {
     
     /**
      * Check if system has been homed
+     * @param axis Axis to check
      * @return true if homing completed successfully
      */
-    bool isHomed();
+    bool isHomed(uint8_t axis);
     
     /**
      * Get operating position limits (includes safety margin)
      * @param minPos Returns minimum position (left limit + margin)
      * @param maxPos Returns maximum position (right limit - margin)
+     * @param axis Axis to read
      * @return true if limits are valid (homed)
      */
-    bool getPositionLimits(int32_t& minPos, int32_t& maxPos);
+    bool getPositionLimits(int32_t& minPos, int32_t& maxPos, uint8_t axis);
     
     /**
      * Get actual detected limit switch positions (no margin)
      * @param leftLimit Returns actual left switch position (0)
      * @param rightLimit Returns actual right switch position
+     * @param axis Axis to read
      * @return true if limits are valid (homed)
      */
-    bool getDetectedLimits(int32_t& leftLimit, int32_t& rightLimit);
+    bool getDetectedLimits(int32_t& leftLimit, int32_t& rightLimit, uint8_t axis);
+    
+    /**
+     * Get the user position limits of an axis (moves and follow are clamped
+     * to them inside the operating range)
+     * Axis 0 uses SystemConfig minPosition/maxPosition; axes 1..N keep their
+     * own, stored with their calibration
+     * @param minPos Returns the lower user limit
+     * @param maxPos Returns the upper user limit
+     * @param axis Axis to read
+     * @return false if the axis does not exist
+     */
+    bool getUserLimits(int32_t& minPos, int32_t& maxPos, uint8_t axis);
+    
+    /**
+     * Set and store the user position limits of an axis (Core 1 only - writes flash)
+     * @param minPos Lower user limit
+     * @param maxPos Upper user limit
+     * @param axis Axis to set
+     * @return false if the axis does not exist or minPos is not below maxPos
+     */
+    bool setUserLimits(int32_t minPos, int32_t maxPos, uint8_t axis);
     
     /**
      * Check limit switch states
@@ -178,36 +283,51 @@ namespace StepperController {
     /**
      * Move to absolute position with limit checking
      * @param position Target position in steps
+     * @param axis Axis to move
      * @return true if move accepted
      */
-    bool moveTo(int32_t position);
+    bool moveTo(int32_t position, uint8_t axis);
     
     /**
      * Move relative to current position
      * @param steps Number of steps to move (signed)
+     * @param axis Axis to move
      * @return true if move accepted
      */
-    bool move(int32_t steps);
+    bool move(int32_t steps, uint8_t axis);
     
     /**
      * Stop with normal deceleration
+     * @param axis Axis to stop
      * @return true if stop initiated
      */
-    bool stop();
+    bool stop(uint8_t axis);
     
     /**
      * Set maximum speed
      * @param speed Maximum speed in steps/sec
+     * @param axis Axis to set
      * @return true if speed accepted
      */
-    bool setMaxSpeed(float speed);
+    bool setMaxSpeed(float speed, uint8_t axis);
     
     /**
      * Set acceleration/deceleration
      * @param accel Acceleration in steps/sec²
+     * @param axis Axis to set
      * @return true if acceleration accepted
      */
-    bool setAcceleration(float accel);
+    bool setAcceleration(float accel, uint8_t axis);
+    
+    /**
+     * Move several axes together (MOVE_COORDINATED with the configured profile)
+     * Used by the JSON "positions" move on serial and /api/command
+     * @param targets Absolute target per axis (only the axes in axisMask are read)
+     * @param axisMask Bit per axis to move
+     * @param shape Ramp shape (CONFIGURED = profileShape setting)
+     * @return true if the move was queued; the axes must be homed and at rest
+     */
+    bool moveCoordinated(const int32_t targets[], uint8_t axisMask, ProfileShape shape);
     
     /**
      * Get distance to target position
@@ -234,6 +354,71 @@ namespace StepperController {
      */
     bool isLimitFaultActive();
     
+    /**
+     * Get motion command queue statistics
+     * @param stats Returns received/processed/coalesced/dropped/queue-full counts
+     */
+    void getCommandQueueStats(CommandQueueStats& stats);
+    
+    /**
+     * Get phase timing of the last completed homing sequence
+     * @param times Receives the phase durations (all zero before the first homing)
+     */
+    void getHomingTimes(HomingTimes& times);
+    
+    /**
+     * Get the range stored by the last full homing sweep
+     * @return steps between the release points (0 if never calibrated)
+     */
+    int32_t getCalibratedRange();
+    
+    /**
+     * Get limit switch stop latency, overrun and glitch filter statistics
+     * @param stats Receives the counters
+     */
+    void getLimitStopStats(LimitStopStats& stats);
+    
+    /**
+     * Get the number of waypoint segments queued or executing
+     * @return segments in the path buffer (0 when idle)
+     */
+    uint8_t getPathQueueDepth();
+    
+    /**
+     * Check if a waypoint path is executing
+     * @return true while a path streams to the motor
+     */
+    bool isPathRunning();
+    
+    /**
+     * Get the cue currently playing
+     * @return cue slot, -1 if no cue is playing
+     */
+    int8_t getActiveCue();
+    
+    /**
+     * Get the number of axes driven by this board (STEPPER_AXIS_COUNT)
+     */
+    uint8_t getAxisCount();
+    
+    /**
+     * Read one consistent snapshot of an axis (lock-free, any core)
+     * The functions above without an axis argument report on axis 0;
+     * the motion, homing and limit functions take the axis (default 0)
+     * @param axis Axis index
+     * @param status Receives the snapshot
+     * @return false if the axis does not exist
+     */
+    bool getAxisStatus(uint8_t axis, AxisStatus& status);
+    
+    /**
+     * Get the expected time to arrival of the current move
+     * Planned from distance, speed and acceleration when the move starts
+     * (S-curves, paths and cues use their planned duration)
+     * @return milliseconds, 0 when at rest or already past the ETA
+     */
+    uint32_t getTimeToArrival();
+    
     /**
      * Check if the task is healthy (responding within timeout)
      * @return true if task has updated within last 5 seconds
@@ -246,6 +431,13 @@ namespace StepperController {
      */
     uint32_t getLastTaskUpdateTime();
     
+    /**
+     * Write calibration and configuration saves flagged by the Core 0 task
+     * Called from the Core 1 loop - flash writes never run on the motion core
+     * @return true if anything was written
+     */
+    bool flushPendingSaves();
+    
 } // namespace StepperController
 
 #endif // STEPPERCONTROLLER_H
\ No newline at end of file
@@ -0,0 +1,142 @@
+// ============================================================================
+// File: StepperHal.h
+// Project: SkullStepperV4 - ESP32-S3 Modular Stepper Control System
+// Version: 4.2.0
+// Date: 2026-10-15
+// Author: Tim Rosener
+// Description: Hardware seam for StepperController (clock, GPIO, step engine)
+// License: MIT
+//
+// StepperController reaches the clock, the limit/alarm inputs, the step
+// engine, its one-shot timer and its task wake-up only through this header. On the ESP32 every
+// call is a forced-inline pass-through to Arduino, ODStepper and FreeRTOS,
+// so the generated code is unchanged (and the ISR paths stay in IRAM).
+// A host build defines SKULLSTEPPER_SIMULATION and gets StepperSim instead:
+// a virtual clock, a ramp-model step engine and limit switches driven by
+// the simulated carriage position. SKULLSTEPPER_SIMULATION is set by the
+// host build only - never in ProjectConfig.h.
+// With STEPPER_BACKEND_RMT (ProjectConfig.h) the target build takes its step
+// engine from StepperRmt (precomputed RMT pulse blocks) instead of ODStepper.
+// ============================================================================
+
+#ifndef STEPPERHAL_H
+#define STEPPERHAL_H
+
+#include <Arduino.h>
+#include "ProjectConfig.h"
+
+#ifdef SKULLSTEPPER_SIMULATION
+
+#include "StepperSim.h"
+
+// ============================================================================
+// StepperHal Namespace - Simulation Backend
+// ============================================================================
+
+namespace StepperHal {
+
+    typedef StepperSim::Engine Engine;
+    typedef StepperSim::Stepper Stepper;
+
+    inline uint32_t millis() { return StepperSim::millis(); }
+    inline uint32_t micros() { return StepperSim::micros(); }
+    inline int readPin(uint8_t pin) { return StepperSim::readPin(pin); }
+    inline void delayMicros(uint32_t us) { StepperSim::advance(us); }
+    inline void configureInput(uint8_t pin) {}
+    inline void attachPinChange(uint8_t pin, void (*handler)(void*), void* arg) {
+        StepperSim::attachPinChange(pin, handler, arg);
+    }
+
+    typedef StepperSim::OneShot OneShot;
+    inline OneShot createOneShot(void (*callback)(void*), void* arg) {
+        return StepperSim::createOneShot(callback, arg);
+    }
+    inline void startOneShot(OneShot timer, uint32_t us) { StepperSim::startOneShot(timer, us); }
+
+    /**
+     * Sleep in virtual time until notified or the timeout passes
+     */
+    inline BaseType_t waitForWake(uint32_t& reasons, TickType_t timeout) {
+        return StepperSim::waitForWake(reasons, timeout);
+    }
+
+} // namespace StepperHal
+
+#else // Target build
+
+#ifdef STEPPER_BACKEND_RMT
+#include "StepperRmt.h"
+#else
+#include <ODStepper.h>
+#endif
+#include <esp_attr.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+// ============================================================================
+// StepperHal Namespace - ESP32 Backend
+// ============================================================================
+
+namespace StepperHal {
+
+#ifdef STEPPER_BACKEND_RMT
+    typedef StepperRmt::Engine Engine;
+    typedef StepperRmt::Stepper Stepper;
+#else
+    typedef ODStepperEngine Engine;
+    typedef ODStepper Stepper;
+#endif
+
+    FORCE_INLINE_ATTR uint32_t millis() { return ::millis(); }
+    FORCE_INLINE_ATTR uint32_t micros() { return ::micros(); }
+    FORCE_INLINE_ATTR int readPin(uint8_t pin) { return digitalRead(pin); }
+    FORCE_INLINE_ATTR void delayMicros(uint32_t us) { delayMicroseconds(us); }
+    FORCE_INLINE_ATTR void configureInput(uint8_t pin) { pinMode(pin, INPUT_PULLUP); }
+    FORCE_INLINE_ATTR void attachPinChange(uint8_t pin, void (*handler)(void*), void* arg) {
+        attachInterruptArg(digitalPinToInterrupt(pin), handler, arg, CHANGE);
+    }
+
+    typedef esp_timer_handle_t OneShot;
+
+    /**
+     * Create a one-shot timer (callback runs in the esp_timer task)
+     * @return timer, or nullptr if it could not be created
+     */
+    inline OneShot createOneShot(void (*callback)(void*), void* arg) {
+        esp_timer_create_args_t args = {};
+        args.callback = callback;
+        args.arg = arg;
+        args.dispatch_method = ESP_TIMER_TASK;
+        args.name = "stepperOneShot";
+        OneShot timer = nullptr;
+        if (esp_timer_create(&args, &timer) != ESP_OK) {
+            return nullptr;
+        }
+        return timer;
+    }
+
+    /**
+     * (Re)start a one-shot timer - a running timer is restarted with the new delay
+     */
+    inline void startOneShot(OneShot timer, uint32_t us) {
+        if (!timer) return;
+        esp_timer_stop(timer);  // Fails harmlessly when not running
+        esp_timer_start_once(timer, us);
+    }
+
+    /**
+     * Block the calling task until notified or the timeout passes
+     * @param reasons Receives the notification bits (0 on timeout)
+     * @param timeout Ticks to wait
+     * @return pdTRUE if notified
+     */
+    FORCE_INLINE_ATTR BaseType_t waitForWake(uint32_t& reasons, TickType_t timeout) {
+        return xTaskNotifyWait(0, UINT32_MAX, &reasons, timeout);
+    }
+
+} // namespace StepperHal
+
+#endif // SKULLSTEPPER_SIMULATION
+
+#endif // STEPPERHAL_H
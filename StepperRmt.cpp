@@ -0,0 +1,362 @@
+// ============================================================================
+// File: StepperRmt.cpp
+// Project: SkullStepperV4 - ESP32-S3 Modular Stepper Control System
+// Version: 4.2.0
+// Date: 2026-10-15
+// Author: Tim Rosener
+// Description: RMT step pulse backend implementation
+// License: MIT
+// ============================================================================
+
+#include "StepperRmt.h"
+
+#if defined(STEPPER_BACKEND_RMT) && !defined(SKULLSTEPPER_SIMULATION)
+
+#include <freertos/task.h>
+#include <driver/gpio.h>
+#include <esp_attr.h>
+
+namespace StepperRmt {
+
+// ----------------------------------------------------------------------------
+// Private Module Variables
+// ----------------------------------------------------------------------------
+
+static Stepper g_steppers[RMT_MAX_STEPPERS];
+static uint8_t g_stepperCount = 0;
+static TaskHandle_t g_refillTask = nullptr;
+
+static const uint8_t NO_PIN = 0xFF;
+
+// ============================================================================
+// Refill Task and TX-Done Interrupt
+// ============================================================================
+
+static void refillTask(void* parameter) {
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(RMT_REFILL_POLL_MS));
+        for (uint8_t i = 0; i < g_stepperCount; i++) {
+            g_steppers[i].service();
+        }
+    }
+}
+
+static bool IRAM_ATTR onTransDone(rmt_channel_handle_t channel, const rmt_tx_done_event_data_t* event, void* userData) {
+    return static_cast<Stepper*>(userData)->blockDone();
+}
+
+// ============================================================================
+// Stepper
+// ============================================================================
+
+Stepper::Stepper()
+    : m_channel(nullptr), m_encoder(nullptr), m_mutex(nullptr),
+      m_dirPin(NO_PIN), m_dirHighCountsUp(true), m_enablePin(NO_PIN), m_enableLowActive(true),
+      m_active(0), m_inFlight(0), m_activeStartUs(0), m_donePosition(0) {
+    portMUX_INITIALIZE(&m_lock);
+    StepPulseGen::reset(m_gen, 0);
+    m_gen.maxSpeed = 1000.0f;
+    m_gen.accel = 1000.0f;
+}
+
+bool Stepper::attach(uint8_t stepPin) {
+    m_mutex = xSemaphoreCreateMutex();
+    if (m_mutex == nullptr) {
+        return false;
+    }
+
+    rmt_tx_channel_config_t channelConfig = {};
+    channelConfig.gpio_num = (gpio_num_t)stepPin;
+    channelConfig.clk_src = RMT_CLK_SRC_DEFAULT;
+    channelConfig.resolution_hz = StepPulseGen::TICKS_PER_SECOND;
+    channelConfig.mem_block_symbols = RMT_MEM_BLOCK_NUM * SOC_RMT_MEM_WORDS_PER_CHANNEL;
+    channelConfig.trans_queue_depth = 2;      // Double buffering: one running, one queued
+    channelConfig.flags.io_od_mode = 1;       // Open-drain, as ODStepper drives the CL57Y inputs
+    if (rmt_new_tx_channel(&channelConfig, &m_channel) != ESP_OK) {
+        m_channel = nullptr;
+        return false;
+    }
+
+    rmt_copy_encoder_config_t encoderConfig = {};
+    rmt_tx_event_callbacks_t callbacks = {};
+    callbacks.on_trans_done = onTransDone;
+    if (rmt_new_copy_encoder(&encoderConfig, &m_encoder) != ESP_OK ||
+        rmt_tx_register_event_callbacks(m_channel, &callbacks, this) != ESP_OK ||
+        rmt_enable(m_channel) != ESP_OK) {
+        if (m_encoder) {
+            rmt_del_encoder(m_encoder);
+            m_encoder = nullptr;
+        }
+        rmt_del_channel(m_channel);
+        m_channel = nullptr;
+        return false;
+    }
+    return true;
+}
+
+void Stepper::setDirectionPin(uint8_t pin, bool dirHighCountsUp, uint16_t delayUs) {
+    // delayUs is covered by the RMT_DIR_SETUP_US pause in front of a reversal
+    m_dirPin = pin;
+    m_dirHighCountsUp = dirHighCountsUp;
+    pinMode(pin, OUTPUT_OPEN_DRAIN);
+    writeDirection(1);
+}
+
+void Stepper::setEnablePin(uint8_t pin, bool lowActive) {
+    m_enablePin = pin;
+    m_enableLowActive = lowActive;
+    pinMode(pin, OUTPUT_OPEN_DRAIN);
+}
+
+void Stepper::enableOutputs() {
+    if (m_enablePin != NO_PIN) {
+        digitalWrite(m_enablePin, m_enableLowActive ? LOW : HIGH);
+    }
+}
+
+void Stepper::disableOutputs() {
+    if (m_enablePin != NO_PIN) {
+        digitalWrite(m_enablePin, m_enableLowActive ? HIGH : LOW);
+    }
+}
+
+void IRAM_ATTR Stepper::writeDirection(int8_t direction) {
+    if (m_dirPin != NO_PIN) {
+        gpio_set_level((gpio_num_t)m_dirPin, (direction > 0) == m_dirHighCountsUp ? 1 : 0);
+    }
+}
+
+void Stepper::wakeRefill() {
+    if (g_refillTask) {
+        xTaskNotifyGive(g_refillTask);
+    }
+}
+
+int8_t Stepper::setSpeedInMilliHz(uint32_t milliHz) {
+    if (milliHz == 0) return -1;
+    xSemaphoreTake(m_mutex, portMAX_DELAY);
+    m_gen.maxSpeed = milliHz / 1000.0f;
+    xSemaphoreGive(m_mutex);
+    return 0;
+}
+
+int8_t Stepper::setAcceleration(int32_t stepsPerSec2) {
+    if (stepsPerSec2 <= 0) return -1;
+    xSemaphoreTake(m_mutex, portMAX_DELAY);
+    m_gen.accel = (float)stepsPerSec2;
+    xSemaphoreGive(m_mutex);
+    return 0;
+}
+
+int8_t Stepper::moveTo(int32_t position, bool blocking) {
+    xSemaphoreTake(m_mutex, portMAX_DELAY);
+    StepPulseGen::moveTo(m_gen, position);
+    xSemaphoreGive(m_mutex);
+    wakeRefill();
+    return 0;
+}
+
+void Stepper::stopMove() {
+    xSemaphoreTake(m_mutex, portMAX_DELAY);
+    StepPulseGen::stopMove(m_gen);
+    xSemaphoreGive(m_mutex);
+    wakeRefill();
+}
+
+void Stepper::forceStop() {
+    xSemaphoreTake(m_mutex, portMAX_DELAY);
+    int32_t position = getCurrentPosition();
+
+    // Disabling the channel aborts the running block and drops the queued one
+    rmt_disable(m_channel);
+    rmt_enable(m_channel);
+
+    portENTER_CRITICAL(&m_lock);
+    m_inFlight = 0;
+    m_donePosition = position;
+    portEXIT_CRITICAL(&m_lock);
+
+    StepPulseGen::reset(m_gen, position);
+    xSemaphoreGive(m_mutex);
+}
+
+void Stepper::setCurrentPosition(int32_t position) {
+    xSemaphoreTake(m_mutex, portMAX_DELAY);
+    portENTER_CRITICAL(&m_lock);
+    int32_t delta = position - m_donePosition;
+    if (m_inFlight > 0) {
+        const StepPulseGen::Block& block = m_blocks[m_active];
+        uint32_t elapsed = (micros() - m_activeStartUs) * StepPulseGen::TICKS_PER_US;
+        delta -= block.direction * StepPulseGen::stepsStarted(block, elapsed);
+    }
+    m_donePosition += delta;
+    portEXIT_CRITICAL(&m_lock);
+    StepPulseGen::shiftPosition(m_gen, delta);
+    xSemaphoreGive(m_mutex);
+}
+
+int8_t Stepper::addQueueEntry(const struct stepper_command_s* cmd, bool start) {
+    xSemaphoreTake(m_mutex, portMAX_DELAY);
+    int8_t result = StepPulseGen::addQueueEntry(m_gen, *cmd);
+    xSemaphoreGive(m_mutex);
+    if (result == AQE_OK) {
+        wakeRefill();
+    }
+    return result;
+}
+
+int32_t Stepper::getPositionAfterCommandsCompleted() const {
+    xSemaphoreTake(m_mutex, portMAX_DELAY);
+    int32_t position = m_gen.rampActive ? m_gen.target :
+                       (m_gen.queueCount > 0 ? m_gen.queueEnd : m_gen.position);
+    xSemaphoreGive(m_mutex);
+    return position;
+}
+
+int32_t Stepper::getCurrentPosition() const {
+    portENTER_CRITICAL(&m_lock);
+    int32_t position = m_donePosition;
+    if (m_inFlight > 0) {
+        const StepPulseGen::Block& block = m_blocks[m_active];
+        uint32_t elapsed = (micros() - m_activeStartUs) * StepPulseGen::TICKS_PER_US;
+        position += block.direction * StepPulseGen::stepsStarted(block, elapsed);
+    }
+    portEXIT_CRITICAL(&m_lock);
+    return position;
+}
+
+int32_t Stepper::getCurrentSpeedInMilliHz(bool realtime) const {
+    int32_t speed = 0;
+    portENTER_CRITICAL(&m_lock);
+    if (m_inFlight > 0) {
+        const StepPulseGen::Block& block = m_blocks[m_active];
+        uint32_t elapsed = (micros() - m_activeStartUs) * StepPulseGen::TICKS_PER_US;
+        uint32_t period = StepPulseGen::periodAt(block, elapsed);
+        if (period > 0) {
+            speed = block.direction * (int32_t)((uint64_t)StepPulseGen::TICKS_PER_SECOND * 1000 / period);
+        }
+    }
+    portEXIT_CRITICAL(&m_lock);
+    return speed;
+}
+
+bool Stepper::isRunning() const {
+    // Under the mutex: the refill task retires the ramp and queues its last
+    // block in one step, so the motor never looks idle in between
+    xSemaphoreTake(m_mutex, portMAX_DELAY);
+    bool running = StepPulseGen::hasWork(m_gen) || m_inFlight > 0;
+    xSemaphoreGive(m_mutex);
+    return running;
+}
+
+void Stepper::service() {
+    if (m_channel == nullptr) {
+        return;
+    }
+
+    rmt_transmit_config_t transmitConfig = {};
+    transmitConfig.loop_count = 0;
+    transmitConfig.flags.eot_level = RMT_IDLE_LEVEL;
+
+    xSemaphoreTake(m_mutex, portMAX_DELAY);
+    while (true) {
+        portENTER_CRITICAL(&m_lock);
+        uint8_t inFlight = m_inFlight;
+        uint8_t next = (m_active + inFlight) & 1;
+        portEXIT_CRITICAL(&m_lock);
+        if (inFlight >= 2) {
+            break;
+        }
+
+        StepPulseGen::Block& block = m_blocks[next];
+        if (!StepPulseGen::fillBlock(m_gen, block)) {
+            break;
+        }
+
+        portENTER_CRITICAL(&m_lock);
+        if (m_inFlight == 0) {
+            // Channel idle - this block starts now
+            m_active = next;
+            m_activeStartUs = micros();
+            if (block.direction != 0) {
+                writeDirection(block.direction);
+            }
+        }
+        m_inFlight++;
+        portEXIT_CRITICAL(&m_lock);
+
+        if (rmt_transmit(m_channel, m_encoder, block.symbols, block.count * sizeof(uint32_t), &transmitConfig) != ESP_OK) {
+            // Not sent: book it as done so the position stays consistent with the generator
+            portENTER_CRITICAL(&m_lock);
+            m_inFlight--;
+            m_donePosition += block.direction * block.steps;
+            portEXIT_CRITICAL(&m_lock);
+            break;
+        }
+    }
+    xSemaphoreGive(m_mutex);
+}
+
+bool IRAM_ATTR Stepper::blockDone() {
+    portENTER_CRITICAL_ISR(&m_lock);
+    if (m_inFlight == 0) {
+        portEXIT_CRITICAL_ISR(&m_lock);  // Aborted by forceStop
+        return false;
+    }
+    const StepPulseGen::Block& done = m_blocks[m_active];
+    m_donePosition += done.direction * done.steps;
+    m_active ^= 1;
+    m_inFlight--;
+    m_activeStartUs = micros();
+    if (m_inFlight > 0 && m_blocks[m_active].direction != 0) {
+        writeDirection(m_blocks[m_active].direction);
+    }
+    portEXIT_CRITICAL_ISR(&m_lock);
+
+    BaseType_t higherPriorityTaskWoken = pdFALSE;
+    if (g_refillTask) {
+        vTaskNotifyGiveFromISR(g_refillTask, &higherPriorityTaskWoken);
+    }
+    return higherPriorityTaskWoken == pdTRUE;
+}
+
+// ============================================================================
+// Engine
+// ============================================================================
+
+void Engine::init(uint8_t cpuCore) {
+    if (g_refillTask) {
+        return;
+    }
+    BaseType_t result = xTaskCreatePinnedToCore(
+        refillTask,                 // Task function
+        "StepperRmt",               // Name
+        RMT_REFILL_TASK_STACK,      // Stack size
+        nullptr,                    // Parameters
+        RMT_REFILL_TASK_PRIORITY,   // Priority
+        &g_refillTask,              // Task handle
+        cpuCore                     // Core
+    );
+    if (result != pdPASS) {
+        g_refillTask = nullptr;
+        Serial.println("StepperRmt: ERROR - Failed to create refill task");
+    }
+}
+
+Stepper* Engine::stepperConnectToPin(uint8_t stepPin, uint8_t driverType) {
+    if (g_stepperCount >= RMT_MAX_STEPPERS) {
+        Serial.println("StepperRmt: ERROR - No free RMT channel");
+        return nullptr;
+    }
+    Stepper& stepper = g_steppers[g_stepperCount];
+    if (!stepper.attach(stepPin)) {
+        Serial.printf("StepperRmt: ERROR - RMT channel setup failed on GPIO %d\n", stepPin);
+        return nullptr;
+    }
+    g_stepperCount++;  // Published after setup - the refill task only services ready steppers
+    return &stepper;
+}
+
+} // namespace StepperRmt
+
+#endif // STEPPER_BACKEND_RMT && !SKULLSTEPPER_SIMULATION
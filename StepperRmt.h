@@ -0,0 +1,143 @@
+// ============================================================================
+// File: StepperRmt.h
+// Project: SkullStepperV4 - ESP32-S3 Modular Stepper Control System
+// Version: 4.2.0
+// Date: 2026-10-15
+// Author: Tim Rosener
+// Description: RMT step pulse backend for StepperHal (STEPPER_BACKEND_RMT)
+// License: MIT
+//
+// Compiled only with STEPPER_BACKEND_RMT in ProjectConfig.h (and never in
+// the host simulation). Provides the ODStepper subset StepperController
+// uses, generating the pulses itself:
+// - StepPulseGen turns the ramp generator and raw stream commands into
+//   blocks of RMT symbols (one symbol per step, 25% duty)
+// - Each stepper owns one RMT TX channel and two blocks: one transmitting,
+//   one queued behind it. When a block finishes, the TX-done interrupt
+//   books its steps, sets DIR for the queued block and wakes the refill
+//   task, which fills the free block and queues it
+// - The position is the booked position plus the pulses of the running
+//   block that have started by now, from the block's symbol start times
+//
+// Pulses run up to two blocks (2 * RMT_BLOCK_MAX_US) ahead of the motor,
+// so a retarget or stop acts after the queued pulses; forceStop aborts the
+// channel at once. Up to RMT_MAX_STEPPERS steppers (the S3's TX channels).
+// ============================================================================
+
+#ifndef STEPPERRMT_H
+#define STEPPERRMT_H
+
+#include "ProjectConfig.h"
+
+#if defined(STEPPER_BACKEND_RMT) && !defined(SKULLSTEPPER_SIMULATION)
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <driver/rmt_tx.h>
+#include "StepPulseGen.h"
+
+#define RMT_MAX_STEPPERS          4      // ESP32-S3 RMT TX channels
+#define RMT_REFILL_TASK_STACK     3072
+#define RMT_REFILL_TASK_PRIORITY  3      // Above StepperCtrl - a late refill is a gap in the pulses
+#define RMT_REFILL_POLL_MS        10     // Refill check without a TX-done wake
+
+// ============================================================================
+// StepperRmt Namespace - RMT Step Engine
+// ============================================================================
+
+namespace StepperRmt {
+
+    class Stepper {
+    public:
+        Stepper();
+
+        /**
+         * Claim an RMT TX channel on the step pin
+         * @return true if the channel and encoder are ready
+         */
+        bool attach(uint8_t stepPin);
+
+        // Configuration
+        void setDirectionPin(uint8_t pin, bool dirHighCountsUp = true, uint16_t delayUs = 0);
+        void setEnablePin(uint8_t pin, bool lowActive = true);
+        void setAutoEnable(bool autoEnable) {}  // Outputs are switched explicitly
+        void enableOutputs();
+        void disableOutputs();
+
+        // Ramp generator
+        int8_t setSpeedInHz(uint32_t hz) { return setSpeedInMilliHz(hz * 1000); }
+        int8_t setSpeedInMilliHz(uint32_t milliHz);
+        int8_t setAcceleration(int32_t stepsPerSec2);
+        int8_t moveTo(int32_t position, bool blocking = false);
+        int8_t move(int32_t steps, bool blocking = false) { return moveTo(targetPos() + steps, blocking); }
+        void stopMove();
+        void forceStop();
+        void setCurrentPosition(int32_t position);
+
+        // Raw command queue (streams)
+        int8_t addQueueEntry(const struct stepper_command_s* cmd, bool start = true);
+        bool isQueueFull() const { return m_gen.queueCount >= StepPulseGen::RAW_QUEUE_LENGTH; }
+        int32_t getPositionAfterCommandsCompleted() const;
+
+        // State (motor, not generator, for position and speed)
+        int32_t getCurrentPosition() const;
+        int32_t getCurrentSpeedInMilliHz(bool realtime = true) const;
+        int32_t targetPos() const { return getPositionAfterCommandsCompleted(); }
+        bool isRunning() const;
+        bool isRampGeneratorActive() const { return m_gen.rampActive; }
+        uint8_t rampState() const { return m_gen.rampState; }
+
+        /**
+         * Fill and queue free blocks (refill task)
+         */
+        void service();
+
+        /**
+         * Book a finished block and start the next one's DIR (TX-done ISR)
+         * @return true if a higher-priority task was woken
+         */
+        bool blockDone();
+
+    private:
+        void writeDirection(int8_t direction);
+        void wakeRefill();
+
+        rmt_channel_handle_t m_channel;
+        rmt_encoder_handle_t m_encoder;
+        SemaphoreHandle_t m_mutex;       // Guards m_gen (API callers vs refill task)
+        mutable portMUX_TYPE m_lock;     // Guards the block bookkeeping below (ISR)
+
+        uint8_t m_dirPin;
+        bool m_dirHighCountsUp;
+        uint8_t m_enablePin;
+        bool m_enableLowActive;
+
+        StepPulseGen::Generator m_gen;
+        StepPulseGen::Block m_blocks[2];
+        volatile uint8_t m_active;       // Block transmitting (or next to)
+        volatile uint8_t m_inFlight;     // Blocks queued in the channel (0-2)
+        volatile uint32_t m_activeStartUs;
+        volatile int32_t m_donePosition; // Position after the finished blocks
+    };
+
+    class Engine {
+    public:
+        /**
+         * Start the refill task
+         * @param cpuCore Core for the refill task
+         */
+        void init(uint8_t cpuCore = 0);
+
+        /**
+         * Create a stepper on its own RMT channel
+         * @return nullptr if every channel is taken or setup failed
+         */
+        Stepper* stepperConnectToPin(uint8_t stepPin, uint8_t driverType = 0);
+    };
+
+} // namespace StepperRmt
+
+#endif // STEPPER_BACKEND_RMT && !SKULLSTEPPER_SIMULATION
+
+#endif // STEPPERRMT_H
@@ -0,0 +1,443 @@
+// ============================================================================
+// File: StepperSim.cpp
+// Project: SkullStepperV4 - ESP32-S3 Modular Stepper Control System
+// Version: 4.2.0
+// Date: 2026-10-15
+// Author: Tim Rosener
+// Description: Deterministic simulation backend for StepperHal (host builds)
+// License: MIT
+// ============================================================================
+
+#include "StepperSim.h"
+
+#ifdef SKULLSTEPPER_SIMULATION
+
+#include "HardwareConfig.h"
+#include <freertos/task.h>
+#include <atomic>
+#include <math.h>
+
+namespace StepperSim {
+
+// ----------------------------------------------------------------------------
+// Private Module Variables
+// ----------------------------------------------------------------------------
+
+// Pins of one axis - same layout as StepperController's AxisPins
+struct RigPins {
+    uint8_t step;
+    uint8_t dir;
+    uint8_t enable;
+    uint8_t alarm;
+    uint8_t leftLimit;
+    uint8_t rightLimit;
+};
+static const RigPins RIG_PINS[STEPPER_AXIS_COUNT] = STEPPER_AXIS_PINS;
+static_assert(STEPPER_AXIS_COUNT <= SIM_MAX_AXES, "StepperSim supports SIM_MAX_AXES axes");
+
+// One axis: motor, carriage and switches (switch positions in physical carriage steps)
+struct Rig {
+    Stepper stepper;
+    bool connected = false;
+    int32_t leftSwitch = 0;
+    int32_t rightSwitch = 10000;
+    int32_t hysteresis = 20;
+    bool leftActive = false;
+    bool rightActive = false;
+    bool alarmActive = false;
+
+    // Benchmark tracking
+    MoveStats moveStats = {};
+    bool wasRunning = false;
+    uint64_t moveStartUs = 0;
+    int32_t lastCarriage = 0;
+};
+
+struct PinHandler {
+    uint8_t pin;
+    void (*handler)(void*);
+    void* arg;
+};
+
+struct OneShotTimer {
+    void (*callback)(void*);
+    void* arg;
+    uint64_t deadlineUs;
+    bool armed;
+};
+
+static std::atomic<uint64_t> g_nowUs(0);
+static Rig g_rigs[STEPPER_AXIS_COUNT];
+
+static PinHandler g_handlers[3 * SIM_MAX_AXES];
+static uint8_t g_handlerCount = 0;
+
+static OneShotTimer g_timers[2];
+static uint8_t g_timerCount = 0;
+
+// ============================================================================
+// Step Engine Model
+// ============================================================================
+
+Stepper::Stepper()
+    : m_enabled(false), m_exact(0.0), m_position(0), m_offset(0), m_speed(0.0),
+      m_maxSpeed(1000.0), m_accel(1000.0), m_target(0), m_rampActive(false),
+      m_rampState(0), m_queueHead(0), m_queueCount(0), m_entryElapsedUs(0.0),
+      m_entryStart(0), m_queueEnd(0) {
+}
+
+int8_t Stepper::setSpeedInMilliHz(uint32_t milliHz) {
+    if (milliHz == 0) return -1;
+    m_maxSpeed = milliHz / 1000.0;
+    return 0;
+}
+
+int8_t Stepper::setAcceleration(int32_t stepsPerSec2) {
+    if (stepsPerSec2 <= 0) return -1;
+    m_accel = stepsPerSec2;
+    return 0;
+}
+
+int8_t Stepper::moveTo(int32_t position, bool blocking) {
+    // The ramp generator takes over from a stream at the current speed
+    m_queueCount = 0;
+    m_target = position;
+    m_rampActive = true;
+    return 0;
+}
+
+void Stepper::stopMove() {
+    if (m_queueCount > 0) {
+        // Model simplification: a stream stops where it is instead of ramping down
+        m_queueCount = 0;
+        m_speed = 0.0;
+        return;
+    }
+    if (!m_rampActive) return;
+    double stopDistance = m_speed * m_speed / (2.0 * m_accel);
+    m_target = m_position + (int32_t)ceil(stopDistance) * (m_speed >= 0 ? 1 : -1);
+}
+
+void Stepper::forceStop() {
+    m_speed = 0.0;
+    m_rampActive = false;
+    m_rampState = 0;
+    m_queueCount = 0;
+    m_target = m_position;
+}
+
+void Stepper::setCurrentPosition(int32_t position) {
+    int32_t delta = position - m_position;
+    m_offset -= delta;
+    m_exact += delta;
+    m_position = position;
+    m_target += delta;
+    m_queueEnd += delta;
+    m_entryStart += delta;
+}
+
+int8_t Stepper::addQueueEntry(const struct stepper_command_s* cmd, bool start) {
+    if (m_rampActive) return AQE_ERROR_RAMP_ACTIVE;
+    if (isQueueFull()) return AQE_QUEUE_FULL;
+    if (m_queueCount == 0) {
+        m_entryStart = m_position;
+        m_entryElapsedUs = 0.0;
+        m_queueEnd = m_position;
+    }
+    m_queue[(m_queueHead + m_queueCount) % SIM_QUEUE_LENGTH] = *cmd;
+    m_queueCount++;
+    m_queueEnd += cmd->count_up ? cmd->steps : -cmd->steps;
+    m_target = m_queueEnd;  // targetPos() follows the stream like FastAccelStepper
+    return AQE_OK;
+}
+
+int32_t Stepper::getPositionAfterCommandsCompleted() const {
+    if (m_rampActive) return m_target;
+    if (m_queueCount > 0) return m_queueEnd;
+    return m_position;
+}
+
+void Stepper::setPosition(double exact) {
+    m_exact = exact;
+    m_position = (int32_t)lround(exact);
+}
+
+/**
+ * Trapezoidal ramp: accelerate to the speed limit, decelerate when the
+ * stopping distance reaches the remaining distance
+ */
+void Stepper::updateRamp(double dt) {
+    double distance = m_target - m_exact;
+    double dv = m_accel * dt;
+    if (fabs(distance) < 0.5 && fabs(m_speed) <= dv) {
+        setPosition(m_target);
+        m_speed = 0.0;
+        m_rampActive = false;
+        m_rampState = 0;
+        return;
+    }
+
+    double direction = (distance > 0) ? 1.0 : -1.0;
+    double stopDistance = m_speed * m_speed / (2.0 * m_accel);
+    bool toward = (m_speed * direction >= 0);
+    double speed = fabs(m_speed);
+    double newSpeed = m_speed;
+
+    if (!toward || stopDistance >= fabs(distance) || speed > m_maxSpeed) {
+        // Wrong way, inside the stopping distance, or above a lowered limit
+        newSpeed = (speed <= dv) ? 0.0 : m_speed - dv * (m_speed > 0 ? 1.0 : -1.0);
+        if (!toward && newSpeed == 0.0) newSpeed = direction * min(dv, m_maxSpeed);
+        m_rampState = RAMP_STATE_DECELERATING_FLAG;
+    } else if (speed < m_maxSpeed) {
+        newSpeed = direction * min(speed + dv, m_maxSpeed);
+        m_rampState = RAMP_STATE_ACCELERATING_FLAG;
+    } else {
+        m_rampState = 0;  // Coasting
+    }
+
+    double next = m_exact + (m_speed + newSpeed) * 0.5 * dt;
+    if ((m_target - next) * direction < 0 && fabs(newSpeed) <= 2.0 * dv) {
+        next = m_target;  // Do not overshoot on the last step
+        newSpeed = 0.0;
+    }
+    m_speed = newSpeed;
+    setPosition(next);
+}
+
+/**
+ * Raw queue: each entry runs steps at a fixed period (or pauses for ticks)
+ */
+void Stepper::updateQueue(double dtUs) {
+    while (dtUs > 0.0 && m_queueCount > 0) {
+        const stepper_command_s& entry = m_queue[m_queueHead];
+        double periodUs = entry.ticks / (double)(TICKS_PER_S / 1000000);
+        double durationUs = entry.steps > 0 ? entry.steps * periodUs : periodUs;
+        double take = min(dtUs, durationUs - m_entryElapsedUs);
+        m_entryElapsedUs += take;
+        dtUs -= take;
+
+        int32_t sign = entry.count_up ? 1 : -1;
+        double fraction = (durationUs > 0.0) ? m_entryElapsedUs / durationUs : 1.0;
+        setPosition(m_entryStart + sign * entry.steps * fraction);
+        m_speed = (entry.steps > 0 && periodUs > 0.0) ? sign * 1e6 / periodUs : 0.0;
+
+        if (m_entryElapsedUs >= durationUs) {
+            m_entryStart += sign * entry.steps;
+            m_entryElapsedUs = 0.0;
+            m_queueHead = (m_queueHead + 1) % SIM_QUEUE_LENGTH;
+            m_queueCount--;
+        }
+    }
+    if (m_queueCount == 0) {
+        m_speed = 0.0;
+    }
+}
+
+void Stepper::update(uint32_t dtUs) {
+    if (!m_enabled) {
+        return;  // Driver disabled - the carriage does not move
+    }
+    if (m_rampActive) {
+        updateRamp(dtUs / 1e6);
+    } else if (m_queueCount > 0) {
+        updateQueue(dtUs);
+    }
+}
+
+Stepper* Engine::stepperConnectToPin(uint8_t stepPin, uint8_t driverType) {
+    for (uint8_t i = 0; i < STEPPER_AXIS_COUNT; i++) {
+        if (RIG_PINS[i].step == stepPin) {
+            if (g_rigs[i].connected) return nullptr;  // One motor per step pin
+            g_rigs[i].connected = true;
+            return &g_rigs[i].stepper;
+        }
+    }
+    return nullptr;  // Not a step pin of the rig
+}
+
+// ============================================================================
+// Rig
+// ============================================================================
+
+static void firePinChange(uint8_t pin) {
+    for (uint8_t i = 0; i < g_handlerCount; i++) {
+        if (g_handlers[i].pin == pin && g_handlers[i].handler) {
+            g_handlers[i].handler(g_handlers[i].arg);
+        }
+    }
+}
+
+/**
+ * Switch levels from the carriage position; a released switch needs the
+ * hysteresis travel before it opens again
+ */
+static void updateSwitches(uint8_t axis) {
+    Rig& rig = g_rigs[axis];
+    int32_t carriage = rig.stepper.carriagePosition();
+    bool left = rig.leftActive ? (carriage <= rig.leftSwitch + rig.hysteresis) : (carriage <= rig.leftSwitch);
+    bool right = rig.rightActive ? (carriage >= rig.rightSwitch - rig.hysteresis) : (carriage >= rig.rightSwitch);
+    if (left != rig.leftActive) {
+        rig.leftActive = left;
+        firePinChange(RIG_PINS[axis].leftLimit);
+    }
+    if (right != rig.rightActive) {
+        rig.rightActive = right;
+        firePinChange(RIG_PINS[axis].rightLimit);
+    }
+}
+
+static void updateMoveStats(Rig& rig) {
+    int32_t carriage = rig.stepper.carriagePosition();
+    rig.moveStats.travelSteps += abs(carriage - rig.lastCarriage);
+    rig.lastCarriage = carriage;
+
+    bool running = rig.stepper.isRunning();
+    if (running && !rig.wasRunning) {
+        rig.moveStartUs = g_nowUs.load();
+    } else if (!running && rig.wasRunning) {
+        uint32_t duration = (uint32_t)(g_nowUs.load() - rig.moveStartUs);
+        rig.moveStats.moves++;
+        rig.moveStats.lastDurationUs = duration;
+        rig.moveStats.totalDurationUs += duration;
+        if (duration > rig.moveStats.maxDurationUs) rig.moveStats.maxDurationUs = duration;
+    }
+    rig.wasRunning = running;
+}
+
+void configureRig(uint8_t axis, int32_t leftSwitch, int32_t rightSwitch, int32_t hysteresis,
+                  int32_t startPosition) {
+    if (axis >= STEPPER_AXIS_COUNT) return;
+    Rig& rig = g_rigs[axis];
+    rig.leftSwitch = leftSwitch;
+    rig.rightSwitch = rightSwitch;
+    rig.hysteresis = hysteresis;
+    rig.stepper.forceStop();
+    rig.stepper.placeCarriage(startPosition);
+    rig.leftActive = (startPosition <= leftSwitch);
+    rig.rightActive = (startPosition >= rightSwitch);
+    memset(&rig.moveStats, 0, sizeof(rig.moveStats));
+    rig.wasRunning = false;
+    rig.lastCarriage = startPosition;
+}
+
+void setAlarm(uint8_t axis, bool active) {
+    if (axis >= STEPPER_AXIS_COUNT) return;
+    if (active != g_rigs[axis].alarmActive) {
+        g_rigs[axis].alarmActive = active;
+        firePinChange(RIG_PINS[axis].alarm);
+    }
+}
+
+Stepper* getStepper(uint8_t axis) {
+    if (axis >= STEPPER_AXIS_COUNT || !g_rigs[axis].connected) return nullptr;
+    return &g_rigs[axis].stepper;
+}
+
+// ============================================================================
+// Virtual Time
+// ============================================================================
+
+uint32_t millis() {
+    return (uint32_t)(g_nowUs.load() / 1000);
+}
+
+uint32_t micros() {
+    return (uint32_t)g_nowUs.load();
+}
+
+uint64_t nowUs() {
+    return g_nowUs.load();
+}
+
+static void fireTimers() {
+    for (uint8_t i = 0; i < g_timerCount; i++) {
+        OneShotTimer& timer = g_timers[i];
+        if (timer.armed && g_nowUs.load() >= timer.deadlineUs) {
+            timer.armed = false;
+            timer.callback(timer.arg);
+        }
+    }
+}
+
+void advance(uint32_t us) {
+    while (us > 0) {
+        uint32_t step = min(us, (uint32_t)SIM_PHYSICS_STEP_US);
+        for (Rig& rig : g_rigs) {
+            rig.stepper.update(step);
+        }
+        g_nowUs += step;
+        us -= step;
+        for (uint8_t i = 0; i < STEPPER_AXIS_COUNT; i++) {
+            updateSwitches(i);
+            updateMoveStats(g_rigs[i]);
+        }
+        fireTimers();
+    }
+}
+
+void runFor(uint32_t us) {
+    uint64_t endUs = g_nowUs.load() + us;
+    vHostRunReadyTasks();
+    while (g_nowUs.load() < endUs) {
+        advance((uint32_t)min((uint64_t)SIM_PHYSICS_STEP_US, endUs - g_nowUs.load()));
+        vHostRunReadyTasks();
+    }
+}
+
+BaseType_t waitForWake(uint32_t& reasons, TickType_t timeout) {
+    if (xTaskNotifyWait(0, UINT32_MAX, &reasons, timeout) == pdTRUE) {
+        return pdTRUE;
+    }
+    reasons = 0;
+    return pdFALSE;
+}
+
+// ============================================================================
+// Simulated GPIO
+// ============================================================================
+
+int readPin(uint8_t pin) {
+    for (uint8_t i = 0; i < STEPPER_AXIS_COUNT; i++) {
+        const Rig& rig = g_rigs[i];
+        if (pin == RIG_PINS[i].leftLimit) return rig.leftActive ? LOW : HIGH;
+        if (pin == RIG_PINS[i].rightLimit) return rig.rightActive ? LOW : HIGH;
+        if (pin == RIG_PINS[i].alarm) return rig.alarmActive ? LOW : HIGH;
+    }
+    return HIGH;  // Pull-ups on everything else
+}
+
+void attachPinChange(uint8_t pin, void (*handler)(void*), void* arg) {
+    if (g_handlerCount < sizeof(g_handlers) / sizeof(g_handlers[0])) {
+        g_handlers[g_handlerCount].pin = pin;
+        g_handlers[g_handlerCount].handler = handler;
+        g_handlers[g_handlerCount].arg = arg;
+        g_handlerCount++;
+    }
+}
+
+// ============================================================================
+// Simulated One-Shot Timers
+// ============================================================================
+
+OneShot createOneShot(void (*callback)(void*), void* arg) {
+    if (g_timerCount >= sizeof(g_timers) / sizeof(g_timers[0])) return -1;
+    g_timers[g_timerCount].callback = callback;
+    g_timers[g_timerCount].arg = arg;
+    g_timers[g_timerCount].armed = false;
+    return (OneShot)g_timerCount++;
+}
+
+void startOneShot(OneShot timer, uint32_t us) {
+    if (timer < 0 || timer >= g_timerCount) return;
+    g_timers[timer].deadlineUs = g_nowUs.load() + us;
+    g_timers[timer].armed = true;
+}
+
+void getMoveStats(uint8_t axis, MoveStats& stats) {
+    if (axis >= STEPPER_AXIS_COUNT) return;
+    stats = g_rigs[axis].moveStats;
+}
+
+} // namespace StepperSim
+
+#endif // SKULLSTEPPER_SIMULATION
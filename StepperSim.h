@@ -0,0 +1,249 @@
+// ============================================================================
+// File: StepperSim.h
+// Project: SkullStepperV4 - ESP32-S3 Modular Stepper Control System
+// Version: 4.2.0
+// Date: 2026-10-15
+// Author: Tim Rosener
+// Description: Deterministic simulation backend for StepperHal (host builds)
+// License: MIT
+//
+// Compiled only with SKULLSTEPPER_SIMULATION (the sketch build sees an empty
+// file). Provides:
+// - A virtual clock: millis()/micros() only move when advance() is called,
+//   so a host run is deterministic and runs as fast as the CPU allows
+// - Stepper: the subset of the ODStepper/FastAccelStepper API that
+//   StepperController uses, with a trapezoidal ramp model (speed limit,
+//   acceleration, stopping distance) and the raw command queue for streams
+// - One rig per axis of STEPPER_AXIS_PINS (the table StepperController
+//   uses): a carriage with two limit switches and a driver ALARM input.
+//   Pin levels follow the physical carriage position (setCurrentPosition
+//   only moves the logical zero), with release hysteresis, and pin-change
+//   handlers fire like the ISRs
+// - Move statistics for benchmarks (move count, durations, travel)
+//
+// The FreeRTOS primitives StepperController uses (mutex, queue, task
+// notifications) come from the host FreeRTOS port in extras/host, which
+// schedules tasks on this virtual clock: runFor() advances time and resumes
+// every task that is notified or whose wait has timed out.
+// ============================================================================
+
+#ifndef STEPPERSIM_H
+#define STEPPERSIM_H
+
+#ifdef SKULLSTEPPER_SIMULATION
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+
+// FastAccelStepper names StepperController relies on
+#define RAMP_STATE_ACCELERATING_FLAG  4
+#define RAMP_STATE_DECELERATING_FLAG  8
+#define AQE_OK                        0
+#define AQE_QUEUE_FULL                1
+#define AQE_ERROR_RAMP_ACTIVE         (-1)
+#ifndef TICKS_PER_S
+#define TICKS_PER_S                   16000000L
+#endif
+
+struct stepper_command_s {
+    uint16_t ticks;
+    uint8_t steps;
+    bool count_up;
+};
+
+#define SIM_QUEUE_LENGTH      32     // Raw command queue entries (as on the ESP32)
+#define SIM_PHYSICS_STEP_US   50     // Integration step of advance()
+#define SIM_MAX_AXES          4      // Rigs (STEPPER_AXIS_COUNT must not exceed this)
+
+// ============================================================================
+// StepperSim Namespace - Virtual Rig
+// ============================================================================
+
+namespace StepperSim {
+
+    // ------------------------------------------------------------------------
+    // Step Engine Model
+    // ------------------------------------------------------------------------
+
+    class Stepper {
+    public:
+        Stepper();
+
+        // Configuration (pins are accepted and ignored)
+        void setDirectionPin(uint8_t pin, bool dirHighCountsUp = true, uint16_t delayUs = 0) {}
+        void setEnablePin(uint8_t pin, bool lowActive = true) {}
+        void setAutoEnable(bool autoEnable) {}
+        void enableOutputs() { m_enabled = true; }
+        void disableOutputs() { m_enabled = false; }
+
+        // Ramp generator
+        int8_t setSpeedInHz(uint32_t hz) { return setSpeedInMilliHz(hz * 1000); }
+        int8_t setSpeedInMilliHz(uint32_t milliHz);
+        int8_t setAcceleration(int32_t stepsPerSec2);
+        int8_t moveTo(int32_t position, bool blocking = false);
+        int8_t move(int32_t steps, bool blocking = false) {
+            return moveTo(getPositionAfterCommandsCompleted() + steps, blocking);
+        }
+        void stopMove();
+        void forceStop();
+        void setCurrentPosition(int32_t position);
+
+        // Raw command queue (streams)
+        int8_t addQueueEntry(const struct stepper_command_s* cmd, bool start = true);
+        bool isQueueFull() const { return m_queueCount >= SIM_QUEUE_LENGTH; }
+        int32_t getPositionAfterCommandsCompleted() const;
+
+        // State
+        int32_t getCurrentPosition() const { return m_position; }
+        int32_t getCurrentSpeedInMilliHz(bool realtime = true) const { return (int32_t)(m_speed * 1000.0); }
+        int32_t targetPos() const { return m_target; }
+        bool isRunning() const { return m_rampActive || m_queueCount > 0 || m_speed != 0.0; }
+        bool isRampGeneratorActive() const { return m_rampActive; }
+        uint8_t rampState() const { return m_rampState; }
+
+        /**
+         * Integrate the motion over dtUs of virtual time
+         */
+        void update(uint32_t dtUs);
+
+        /**
+         * Physical carriage position in steps (unaffected by setCurrentPosition)
+         */
+        int32_t carriagePosition() const { return m_position + m_offset; }
+        
+        /**
+         * Put the carriage somewhere without changing the logical position
+         */
+        void placeCarriage(int32_t carriage) { m_offset = carriage - m_position; }
+
+    private:
+        void updateRamp(double dt);
+        void updateQueue(double dtUs);
+        void setPosition(double exact);
+
+        bool m_enabled;
+        double m_exact;          // Logical position with fraction
+        int32_t m_position;      // Logical position (whole steps)
+        int32_t m_offset;        // Carriage position minus logical position
+        double m_speed;          // Signed steps/sec
+        double m_maxSpeed;       // steps/sec
+        double m_accel;          // steps/sec²
+        int32_t m_target;
+        bool m_rampActive;
+        uint8_t m_rampState;
+
+        stepper_command_s m_queue[SIM_QUEUE_LENGTH];
+        uint8_t m_queueHead;
+        uint8_t m_queueCount;
+        double m_entryElapsedUs; // Time spent in the front entry
+        int32_t m_entryStart;    // Logical position when the front entry began
+        int32_t m_queueEnd;      // Logical position after the queued entries
+    };
+
+    class Engine {
+    public:
+        void init(uint8_t cpuCore = 0) {}
+        Stepper* stepperConnectToPin(uint8_t stepPin, uint8_t driverType = 0);
+    };
+
+    // ------------------------------------------------------------------------
+    // Rig Configuration
+    // ------------------------------------------------------------------------
+
+    /**
+     * Place an axis' limit switches (physical steps) and its carriage
+     * @param axis Axis index (order of STEPPER_AXIS_PINS)
+     * @param leftSwitch Carriage position at and below which the left switch is active
+     * @param rightSwitch Carriage position at and above which the right switch is active
+     * @param hysteresis Steps a switch needs to travel back before it releases
+     * @param startPosition Carriage position at power-up
+     */
+    void configureRig(uint8_t axis, int32_t leftSwitch, int32_t rightSwitch, int32_t hysteresis,
+                      int32_t startPosition);
+
+    /**
+     * Assert or clear an axis' driver ALARM input
+     */
+    void setAlarm(uint8_t axis, bool active);
+
+    /**
+     * Stepper of an axis (nullptr until StepperController connected it)
+     */
+    Stepper* getStepper(uint8_t axis);
+
+    // ------------------------------------------------------------------------
+    // Virtual Time
+    // ------------------------------------------------------------------------
+
+    uint32_t millis();
+    uint32_t micros();
+
+    /**
+     * Virtual time without the 32-bit wrap
+     */
+    uint64_t nowUs();
+
+    /**
+     * Move virtual time forward, integrating the motors and switches
+     * Pin-change handlers and one-shot timers run inline, as the ISRs would;
+     * tasks do not run (a task calling this keeps the CPU, like a busy-wait)
+     */
+    void advance(uint32_t us);
+
+    /**
+     * Run the rig and its tasks for us of virtual time (harness side)
+     * Ready tasks run to their next wait before every physics step
+     */
+    void runFor(uint32_t us);
+
+    /**
+     * Task wait: block in the host FreeRTOS port until notified or the
+     * timeout passes in virtual time
+     */
+    BaseType_t waitForWake(uint32_t& reasons, TickType_t timeout);
+
+    // ------------------------------------------------------------------------
+    // Simulated GPIO
+    // ------------------------------------------------------------------------
+
+    int readPin(uint8_t pin);
+    void attachPinChange(uint8_t pin, void (*handler)(void*), void* arg);
+
+    // ------------------------------------------------------------------------
+    // Simulated One-Shot Timers
+    // ------------------------------------------------------------------------
+
+    typedef int8_t OneShot;  // Timer index, -1 if none was free
+
+    /**
+     * Create a one-shot timer; the callback runs from advance() at its deadline
+     */
+    OneShot createOneShot(void (*callback)(void*), void* arg);
+
+    /**
+     * (Re)start a one-shot timer us microseconds of virtual time from now
+     */
+    void startOneShot(OneShot timer, uint32_t us);
+
+    // ------------------------------------------------------------------------
+    // Benchmark Statistics
+    // ------------------------------------------------------------------------
+
+    /**
+     * Standstill-to-standstill motion segments of one axis since configureRig()
+     */
+    struct MoveStats {
+        uint32_t moves;          // Completed moves
+        uint32_t lastDurationUs; // Duration of the last move
+        uint32_t maxDurationUs;  // Longest move
+        uint64_t totalDurationUs;
+        uint64_t travelSteps;    // Total steps travelled
+    };
+
+    void getMoveStats(uint8_t axis, MoveStats& stats);
+
+} // namespace StepperSim
+
+#endif // SKULLSTEPPER_SIMULATION
+
+#endif // STEPPERSIM_H
@@ -45,26 +45,35 @@ namespace SystemConfigMgr {
     g_systemConfig.defaultProfile.jerk = 1000.0f;
     g_systemConfig.defaultProfile.targetPosition = 0;
     g_systemConfig.defaultProfile.enableLimits = true;
+    g_systemConfig.defaultProfile.shape = ProfileShape::TRAPEZOIDAL;
     
     // Position limits
     g_systemConfig.homePositionPercent = 50.0f;  // Default to center of range
     g_systemConfig.minPosition = MIN_POSITION_STEPS;
     g_systemConfig.maxPosition = MAX_POSITION_STEPS;
     g_systemConfig.homingSpeed = 940.0f;  // Default homing speed (steps/sec)
+    g_systemConfig.homingFastSpeed = 0.0f;  // Default: single-speed homing
     g_systemConfig.limitSafetyMargin = 400.0f;  // Default 400 steps from limit switches
     g_systemConfig.autoHomeOnBoot = false;  // Default: manual homing required
     g_systemConfig.autoHomeOnEstop = false;  // Default: manual homing after E-stop
+    g_systemConfig.verifyHoming = false;  // Default: full left-right sweep every time
     
     // DMX configuration
     g_systemConfig.dmxStartChannel = DMX_START_CHANNEL;
     g_systemConfig.dmxScale = 1.0f;
     g_systemConfig.dmxOffset = 0;
     g_systemConfig.dmxTimeout = 5000;
+    g_systemConfig.dmxInterpolation = true;
+    g_systemConfig.dmxInterpDelayMs = DMX_INTERP_DELAY_MS;
+    g_systemConfig.dmxPersonality = DMX_PERSONALITY;
+    g_systemConfig.dmxInput = DMX_INPUT;
+    g_systemConfig.dmxUniverse = DMX_NET_UNIVERSE;
     
     // Safety configuration
     g_systemConfig.enableLimitSwitches = true;
     g_systemConfig.enableStepperAlarm = true;
     g_systemConfig.emergencyDeceleration = EMERGENCY_STOP_DECEL;
+    g_systemConfig.limitFilterSamples = LIMIT_FILTER_SAMPLES;
     
     // System configuration
     g_systemConfig.statusUpdateInterval = STATUS_UPDATE_INTERVAL_MS;
@@ -99,26 +108,35 @@ namespace SystemConfigMgr {
     g_systemConfig.defaultProfile.jerk = g_preferences.getFloat("jerk", 1000.0f);
     g_systemConfig.defaultProfile.targetPosition = g_preferences.getInt("targetPos", 0);
     g_systemConfig.defaultProfile.enableLimits = g_preferences.getBool("enableLimits", true);
+    g_systemConfig.defaultProfile.shape = (ProfileShape)g_preferences.getUChar("profileShape", (uint8_t)ProfileShape::TRAPEZOIDAL);
     
     // Load position limits
     g_systemConfig.homePositionPercent = g_preferences.getFloat("homePosPercent", 50.0f);
     g_systemConfig.minPosition = g_preferences.getInt("minPos", MIN_POSITION_STEPS);
     g_systemConfig.maxPosition = g_preferences.getInt("maxPos", MAX_POSITION_STEPS);
     g_systemConfig.homingSpeed = g_preferences.getFloat("homingSpeed", 940.0f);
+    g_systemConfig.homingFastSpeed = g_preferences.getFloat("homingFast", 0.0f);
     g_systemConfig.limitSafetyMargin = g_preferences.getFloat("limitMargin", 400.0f);
     g_systemConfig.autoHomeOnBoot = g_preferences.getBool("autoHomeOnBoot", false);
     g_systemConfig.autoHomeOnEstop = g_preferences.getBool("autoHomeOnEstop", false);
+    g_systemConfig.verifyHoming = g_preferences.getBool("verifyHoming", false);
     
     // Load DMX configuration
     g_systemConfig.dmxStartChannel = g_preferences.getUShort("dmxChannel", DMX_START_CHANNEL);
     g_systemConfig.dmxScale = g_preferences.getFloat("dmxScale", 1.0f);
     g_systemConfig.dmxOffset = g_preferences.getInt("dmxOffset", 0);
     g_systemConfig.dmxTimeout = g_preferences.getUInt("dmxTimeout", 5000);
+    g_systemConfig.dmxInterpolation = g_preferences.getBool("dmxInterp", true);
+    g_systemConfig.dmxInterpDelayMs = g_preferences.getUChar("dmxInterpDelay", DMX_INTERP_DELAY_MS);
+    g_systemConfig.dmxPersonality = g_preferences.getUChar("dmxPersonality", DMX_PERSONALITY);
+    g_systemConfig.dmxInput = g_preferences.getUChar("dmxInput", DMX_INPUT);
+    g_systemConfig.dmxUniverse = g_preferences.getUShort("dmxUniverse", DMX_NET_UNIVERSE);
     
     // Load safety configuration
     g_systemConfig.enableLimitSwitches = g_preferences.getBool("limitSwitches", true);
     g_systemConfig.enableStepperAlarm = g_preferences.getBool("stepperAlarm", true);
     g_systemConfig.emergencyDeceleration = g_preferences.getFloat("emergencyDecel", EMERGENCY_STOP_DECEL);
+    g_systemConfig.limitFilterSamples = g_preferences.getUChar("limitFilter", LIMIT_FILTER_SAMPLES);
     
     // Load system configuration
     g_systemConfig.statusUpdateInterval = g_preferences.getUInt("statusInterval", STATUS_UPDATE_INTERVAL_MS);
@@ -135,6 +153,7 @@ namespace SystemConfigMgr {
     Serial.printf("    Acceleration: %.1f steps/sec²\n", g_systemConfig.defaultProfile.acceleration);
     Serial.printf("    Deceleration: %.1f steps/sec²\n", g_systemConfig.defaultProfile.deceleration);
     Serial.printf("    Jerk: %.1f steps/sec³\n", g_systemConfig.defaultProfile.jerk);
+    Serial.printf("    Profile Shape: %s\n", profileShapeToString(g_systemConfig.defaultProfile.shape));
     Serial.printf("    Target Position: %d steps\n", g_systemConfig.defaultProfile.targetPosition);
     Serial.printf("    Enable Limits: %s\n", g_systemConfig.defaultProfile.enableLimits ? "ON" : "OFF");
     
@@ -143,19 +162,32 @@ namespace SystemConfigMgr {
     Serial.printf("    Min Position: %d steps\n", g_systemConfig.minPosition);
     Serial.printf("    Max Position: %d steps\n", g_systemConfig.maxPosition);
     Serial.printf("    Homing Speed: %.1f steps/sec\n", g_systemConfig.homingSpeed);
+    if (g_systemConfig.homingFastSpeed > 0.0f) {
+      Serial.printf("    Homing Fast Approach: %.1f steps/sec\n", g_systemConfig.homingFastSpeed);
+    } else {
+      Serial.println("    Homing Fast Approach: OFF");
+    }
     Serial.printf("    Auto-Home on Boot: %s\n", g_systemConfig.autoHomeOnBoot ? "ON" : "OFF");
     Serial.printf("    Auto-Home on E-Stop: %s\n", g_systemConfig.autoHomeOnEstop ? "ON" : "OFF");
+    Serial.printf("    Verify Homing: %s\n", g_systemConfig.verifyHoming ? "ON" : "OFF");
     
     Serial.printf("  DMX Configuration:\n");
     Serial.printf("    Start Channel: %d\n", g_systemConfig.dmxStartChannel);
     Serial.printf("    Scale Factor: %.3f\n", g_systemConfig.dmxScale);
     Serial.printf("    Offset: %d steps\n", g_systemConfig.dmxOffset);
     Serial.printf("    Timeout: %d ms\n", g_systemConfig.dmxTimeout);
+    Serial.printf("    Interpolation: %s (delay %d ms)\n", g_systemConfig.dmxInterpolation ? "ON" : "OFF",
+                  g_systemConfig.dmxInterpDelayMs);
+    Serial.printf("    Personality: %d\n", g_systemConfig.dmxPersonality);
+    Serial.printf("    Input: %s (network universe %d)\n", g_systemConfig.dmxInput ? "network" : "RS-485",
+                  g_systemConfig.dmxUniverse);
     
     Serial.printf("  Safety Configuration:\n");
     Serial.printf("    Limit Switches: %s\n", g_systemConfig.enableLimitSwitches ? "ON" : "OFF");
     Serial.printf("    Stepper Alarm: %s\n", g_systemConfig.enableStepperAlarm ? "ON" : "OFF");
     Serial.printf("    Emergency Decel: %.1f steps/sec²\n", g_systemConfig.emergencyDeceleration);
+    Serial.printf("    Limit Filter: %d samples (%d us)\n", g_systemConfig.limitFilterSamples,
+                  (g_systemConfig.limitFilterSamples - 1) * LIMIT_FILTER_SAMPLE_US);
     
     Serial.printf("  System Configuration:\n");
     Serial.printf("    Status Update Interval: %d ms\n", g_systemConfig.statusUpdateInterval);
@@ -184,26 +216,35 @@ namespace SystemConfigMgr {
     g_preferences.putFloat("jerk", g_systemConfig.defaultProfile.jerk);
     g_preferences.putInt("targetPos", g_systemConfig.defaultProfile.targetPosition);
     g_preferences.putBool("enableLimits", g_systemConfig.defaultProfile.enableLimits);
+    g_preferences.putUChar("profileShape", (uint8_t)g_systemConfig.defaultProfile.shape);
     
     // Save position limits
     g_preferences.putFloat("homePosPercent", g_systemConfig.homePositionPercent);
     g_preferences.putInt("minPos", g_systemConfig.minPosition);
     g_preferences.putInt("maxPos", g_systemConfig.maxPosition);
     g_preferences.putFloat("homingSpeed", g_systemConfig.homingSpeed);
+    g_preferences.putFloat("homingFast", g_systemConfig.homingFastSpeed);
     g_preferences.putFloat("limitMargin", g_systemConfig.limitSafetyMargin);
     g_preferences.putBool("autoHomeOnBoot", g_systemConfig.autoHomeOnBoot);
     g_preferences.putBool("autoHomeOnEstop", g_systemConfig.autoHomeOnEstop);
+    g_preferences.putBool("verifyHoming", g_systemConfig.verifyHoming);
     
     // Save DMX configuration
     g_preferences.putUShort("dmxChannel", g_systemConfig.dmxStartChannel);
     g_preferences.putFloat("dmxScale", g_systemConfig.dmxScale);
     g_preferences.putInt("dmxOffset", g_systemConfig.dmxOffset);
     g_preferences.putUInt("dmxTimeout", g_systemConfig.dmxTimeout);
+    g_preferences.putBool("dmxInterp", g_systemConfig.dmxInterpolation);
+    g_preferences.putUChar("dmxInterpDelay", g_systemConfig.dmxInterpDelayMs);
+    g_preferences.putUChar("dmxPersonality", g_systemConfig.dmxPersonality);
+    g_preferences.putUChar("dmxInput", g_systemConfig.dmxInput);
+    g_preferences.putUShort("dmxUniverse", g_systemConfig.dmxUniverse);
     
     // Save safety configuration
     g_preferences.putBool("limitSwitches", g_systemConfig.enableLimitSwitches);
     g_preferences.putBool("stepperAlarm", g_systemConfig.enableStepperAlarm);
     g_preferences.putFloat("emergencyDecel", g_systemConfig.emergencyDeceleration);
+    g_preferences.putUChar("limitFilter", g_systemConfig.limitFilterSamples);
     
     // Save system configuration
     g_preferences.putUInt("statusInterval", g_systemConfig.statusUpdateInterval);
@@ -275,6 +316,25 @@ namespace SystemConfigMgr {
       Serial.println("SystemConfig: Invalid emergency deceleration");
       return false;
     }
+    if (g_systemConfig.limitFilterSamples < 1 || g_systemConfig.limitFilterSamples > LIMIT_FILTER_MAX_SAMPLES) {
+      Serial.println("SystemConfig: Invalid limit filter sample count");
+      return false;
+    }
+    
+    if (g_systemConfig.dmxInterpDelayMs > DMX_INTERP_MAX_DELAY_MS) {
+      Serial.println("SystemConfig: Invalid DMX interpolation delay");
+      return false;
+    }
+    
+    if (g_systemConfig.dmxPersonality >= DMX_PERSONALITY_SLOTS) {
+      Serial.println("SystemConfig: Invalid DMX personality");
+      return false;
+    }
+    
+    if (g_systemConfig.dmxInput > 1 || g_systemConfig.dmxUniverse > DMX_NET_MAX_UNIVERSE) {
+      Serial.println("SystemConfig: Invalid DMX input or network universe");
+      return false;
+    }
     
     // Validate timeouts
     if (g_systemConfig.dmxTimeout == 0 || g_systemConfig.statusUpdateInterval == 0) {
@@ -390,6 +450,13 @@ namespace SystemConfigMgr {
       return false;
     }
     
+    if (profile.shape != ProfileShape::CONFIGURED &&
+        profile.shape != ProfileShape::TRAPEZOIDAL &&
+        profile.shape != ProfileShape::SCURVE) {
+      Serial.printf("SystemConfig: Invalid profile shape: %d\n", (int)profile.shape);
+      return false;
+    }
+    
     return true;
   }
   
@@ -433,6 +500,34 @@ namespace SystemConfigMgr {
   // JSON Export/Import Functions
   // ============================================================================
   
+  // ============================================================================
+  // Profile Shape Helpers
+  // ============================================================================
+  
+  const char* profileShapeToString(ProfileShape shape) {
+    switch (shape) {
+      case ProfileShape::TRAPEZOIDAL: return "trapezoidal";
+      case ProfileShape::SCURVE: return "scurve";
+      default: return "default";
+    }
+  }
+  
+  bool parseProfileShape(const char* name, ProfileShape& shape) {
+    if (name == nullptr) {
+      return false;
+    }
+    if (strcasecmp(name, "trapezoidal") == 0 || strcasecmp(name, "trap") == 0) {
+      shape = ProfileShape::TRAPEZOIDAL;
+    } else if (strcasecmp(name, "scurve") == 0 || strcasecmp(name, "s-curve") == 0) {
+      shape = ProfileShape::SCURVE;
+    } else if (strcasecmp(name, "default") == 0) {
+      shape = ProfileShape::CONFIGURED;
+    } else {
+      return false;
+    }
+    return true;
+  }
+  
   size_t exportToJSON(char* buffer, size_t bufferSize) {
     StaticJsonDocument<1024> doc;
     
@@ -442,23 +537,31 @@ namespace SystemConfigMgr {
     doc["motion"]["deceleration"] = g_systemConfig.defaultProfile.deceleration;
     doc["motion"]["jerk"] = g_systemConfig.defaultProfile.jerk;
     doc["motion"]["enableLimits"] = g_systemConfig.defaultProfile.enableLimits;
+    doc["motion"]["profileShape"] = profileShapeToString(g_systemConfig.defaultProfile.shape);
     
     // Position limits
     doc["position"]["homePositionPercent"] = g_systemConfig.homePositionPercent;
     doc["position"]["minPosition"] = g_systemConfig.minPosition;
     doc["position"]["maxPosition"] = g_systemConfig.maxPosition;
     doc["position"]["homingSpeed"] = g_systemConfig.homingSpeed;
+    doc["position"]["homingFastSpeed"] = g_systemConfig.homingFastSpeed;
     
     // DMX configuration
     doc["dmx"]["startChannel"] = g_systemConfig.dmxStartChannel;
     doc["dmx"]["scale"] = g_systemConfig.dmxScale;
     doc["dmx"]["offset"] = g_systemConfig.dmxOffset;
     doc["dmx"]["timeout"] = g_systemConfig.dmxTimeout;
+    doc["dmx"]["interpolation"] = g_systemConfig.dmxInterpolation;
+    doc["dmx"]["interpDelayMs"] = g_systemConfig.dmxInterpDelayMs;
+    doc["dmx"]["personality"] = g_systemConfig.dmxPersonality;
+    doc["dmx"]["input"] = g_systemConfig.dmxInput ? "network" : "uart";
+    doc["dmx"]["universe"] = g_systemConfig.dmxUniverse;
     
     // Safety configuration
     doc["safety"]["enableLimitSwitches"] = g_systemConfig.enableLimitSwitches;
     doc["safety"]["enableStepperAlarm"] = g_systemConfig.enableStepperAlarm;
     doc["safety"]["emergencyDeceleration"] = g_systemConfig.emergencyDeceleration;
+    doc["safety"]["limitFilterSamples"] = g_systemConfig.limitFilterSamples;
     
     // System configuration
     doc["system"]["statusUpdateInterval"] = g_systemConfig.statusUpdateInterval;
@@ -488,6 +591,12 @@ namespace SystemConfigMgr {
       tempConfig.defaultProfile.deceleration = doc["motion"]["deceleration"] | tempConfig.defaultProfile.deceleration;
       tempConfig.defaultProfile.jerk = doc["motion"]["jerk"] | tempConfig.defaultProfile.jerk;
       tempConfig.defaultProfile.enableLimits = doc["motion"]["enableLimits"] | tempConfig.defaultProfile.enableLimits;
+      if (doc["motion"].containsKey("profileShape")) {
+        ProfileShape shape;
+        if (parseProfileShape(doc["motion"]["profileShape"], shape) && shape != ProfileShape::CONFIGURED) {
+          tempConfig.defaultProfile.shape = shape;
+        }
+      }
     }
     
     // Import position limits
@@ -496,6 +605,7 @@ namespace SystemConfigMgr {
       tempConfig.minPosition = doc["position"]["minPosition"] | tempConfig.minPosition;
       tempConfig.maxPosition = doc["position"]["maxPosition"] | tempConfig.maxPosition;
       tempConfig.homingSpeed = doc["position"]["homingSpeed"] | tempConfig.homingSpeed;
+      tempConfig.homingFastSpeed = doc["position"]["homingFastSpeed"] | tempConfig.homingFastSpeed;
     }
     
     // Import DMX configuration
@@ -504,6 +614,18 @@ namespace SystemConfigMgr {
       tempConfig.dmxScale = doc["dmx"]["scale"] | tempConfig.dmxScale;
       tempConfig.dmxOffset = doc["dmx"]["offset"] | tempConfig.dmxOffset;
       tempConfig.dmxTimeout = doc["dmx"]["timeout"] | tempConfig.dmxTimeout;
+      tempConfig.dmxInterpolation = doc["dmx"]["interpolation"] | tempConfig.dmxInterpolation;
+      tempConfig.dmxInterpDelayMs = doc["dmx"]["interpDelayMs"] | tempConfig.dmxInterpDelayMs;
+      tempConfig.dmxInterpDelayMs = constrain(tempConfig.dmxInterpDelayMs, 0, DMX_INTERP_MAX_DELAY_MS);
+      tempConfig.dmxPersonality = doc["dmx"]["personality"] | tempConfig.dmxPersonality;
+      if (tempConfig.dmxPersonality >= DMX_PERSONALITY_SLOTS) {
+        tempConfig.dmxPersonality = DMX_PERSONALITY;
+      }
+      if (doc["dmx"].containsKey("input")) {
+        tempConfig.dmxInput = (strcmp(doc["dmx"]["input"] | "uart", "network") == 0) ? 1 : 0;
+      }
+      tempConfig.dmxUniverse = doc["dmx"]["universe"] | tempConfig.dmxUniverse;
+      tempConfig.dmxUniverse = constrain(tempConfig.dmxUniverse, 0, DMX_NET_MAX_UNIVERSE);
     }
     
     // Import safety configuration
@@ -511,6 +633,8 @@ namespace SystemConfigMgr {
       tempConfig.enableLimitSwitches = doc["safety"]["enableLimitSwitches"] | tempConfig.enableLimitSwitches;
       tempConfig.enableStepperAlarm = doc["safety"]["enableStepperAlarm"] | tempConfig.enableStepperAlarm;
       tempConfig.emergencyDeceleration = doc["safety"]["emergencyDeceleration"] | tempConfig.emergencyDeceleration;
+      tempConfig.limitFilterSamples = doc["safety"]["limitFilterSamples"] | tempConfig.limitFilterSamples;
+      tempConfig.limitFilterSamples = constrain(tempConfig.limitFilterSamples, 1, LIMIT_FILTER_MAX_SAMPLES);
     }
     
     // Import system configuration
@@ -142,6 +142,26 @@ namespace SystemConfigMgr {
    */
   bool validateDMXConfig(uint16_t startChannel, float scale, int32_t offset);
   
+  // ----------------------------------------------------------------------------
+  // Profile Shape Helpers
+  // ----------------------------------------------------------------------------
+  
+  /**
+   * Get the name used for a profile shape in commands and JSON
+   * @param shape profile shape
+   * @return "trapezoidal", "scurve" or "default"
+   */
+  const char* profileShapeToString(ProfileShape shape);
+  
+  /**
+   * Parse a profile shape name (case-insensitive)
+   * Accepts trapezoidal/trap, scurve/s-curve, default
+   * @param name shape name
+   * @param shape returns parsed shape
+   * @return true if name recognized
+   */
+  bool parseProfileShape(const char* name, ProfileShape& shape);
+  
   // ----------------------------------------------------------------------------
   // Configuration Export/Import Functions
   // ----------------------------------------------------------------------------
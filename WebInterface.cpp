@@ -10,6 +10,14 @@
 #include "SerialInterface.h"    // For processCommand function
 #include "DMXReceiver.h"        // For DMX status information
 #include "InputValidation.h"    // For input bounds checking
+#include "SystemConfig.h"       // For profile shape helpers
+#include "CueEngine.h"          // For keyframe cue upload
+#include "DMXPersonality.h"     // For DMX personality upload
+#include "NetworkDMX.h"         // For Art-Net/sACN source statistics
+#include "FixedPoint.h"         // For decoded DMX values as percentages
+#include "LoopProfiler.h"       // For the control loop profile endpoint
+#include "CoreLog.h"            // For the Core 0 log endpoint
+#include "MotionTrace.h"        // For the motion trace endpoint
 #include <esp_random.h>         // For esp_random() function
 #include <esp_system.h>         // For esp_reset_reason()
 
@@ -71,6 +79,10 @@ String WebInterface::getIndexHTML() {
                         <label>Speed:</label>
                         <span id="currentSpeed" class="value">--</span>
                     </div>
+                    <div class="status-item">
+                        <label>ETA:</label>
+                        <span id="motionEta" class="value">--</span>
+                    </div>
                     <div class="status-item">
                         <label>Motor:</label>
                         <span id="motorEnabled" class="value">--</span>
@@ -89,32 +101,41 @@ String WebInterface::getIndexHTML() {
                         <label>DMX Active:</label>
                         <span id="dmxActive" class="value">--</span>
                     </div>
+                    <div class="status-item">
+                        <label>Input:</label>
+                        <span id="dmxInputStatus" class="value">--</span>
+                        <span id="dmxNetSources" class="calc-text">--</span>
+                    </div>
                     <div class="status-item">
                         <label>DMX Start Ch:</label>
                         <span id="dmxOffset" class="value">--</span>
                     </div>
                     <div class="status-item">
-                        <label>Ch1 (Position):</label>
-                        <span id="dmxCh1" class="value">--</span>
-                        <span id="dmxPos" class="calc-text">--</span>
+                        <label>Personality:</label>
+                        <span id="dmxPersonality" class="value">--</span>
                     </div>
                     <div class="status-item">
-                        <label>Ch2 (Fine):</label>
-                        <span id="dmxCh2" class="value">--</span>
+                        <label>Channels:</label>
+                        <span id="dmxChannels" class="value">--</span>
                     </div>
                     <div class="status-item">
-                        <label>Ch3 (Acceleration):</label>
-                        <span id="dmxCh3" class="value">--</span>
+                        <label>Position:</label>
+                        <span id="dmxPosValue" class="value">--</span>
+                        <span id="dmxPos" class="calc-text">--</span>
+                    </div>
+                    <div class="status-item">
+                        <label>Acceleration:</label>
+                        <span id="dmxAccelValue" class="value">--</span>
                         <span id="dmxAccel" class="calc-text">--</span>
                     </div>
                     <div class="status-item">
-                        <label>Ch4 (Speed):</label>
-                        <span id="dmxCh4" class="value">--</span>
+                        <label>Speed:</label>
+                        <span id="dmxSpeedValue" class="value">--</span>
                         <span id="dmxSpeed" class="calc-text">--</span>
                     </div>
                     <div class="status-item">
-                        <label>Ch5 (Mode):</label>
-                        <span id="dmxCh5" class="value">--</span>
+                        <label>Mode:</label>
+                        <span id="dmxModeValue" class="value">--</span>
                         <span id="dmxMode" class="mode-text">--</span>
                     </div>
                 </div>
@@ -291,6 +312,12 @@ String WebInterface::getIndexHTML() {
                         <input type="range" id="homingSpeed" min="100" max="10000" step="100">
                         <span id="homingSpeedValue">--</span> steps/sec
                     </div>
+                    <div class="config-item">
+                        <label for="homingFastSpeed">Homing Fast Approach:</label>
+                        <input type="range" id="homingFastSpeed" min="0" max="10000" step="100">
+                        <span id="homingFastSpeedValue">--</span> steps/sec
+                        <small class="param-info">0 = off. Above homing speed: approach switches fast, re-approach at homing speed</small>
+                    </div>
                     <div class="config-item">
                         <label for="limitSafetyMargin">Limit Safety Margin:</label>
                         <input type="range" id="limitSafetyMargin" min="0" max="1000" step="10">
@@ -334,6 +361,13 @@ String WebInterface::getIndexHTML() {
                     <span id="jerkValue">--</span> steps/sec³
                     <small class="param-info">Controls smoothness of acceleration changes (0-50000)</small>
                 </div>
+                <div class="config-item">
+                    <label style="display: flex; align-items: center; cursor: pointer;">
+                        <input type="checkbox" id="scurveProfile" style="margin-right: 10px; width: auto;">
+                        S-Curve Motion Profile
+                    </label>
+                    <small class="param-info">Jerk-limited ramps for moves started from rest (uses Jerk Limitation above)</small>
+                </div>
                 <div class="config-item">
                     <label for="emergencyDeceleration">Emergency Deceleration:</label>
                     <input type="range" id="emergencyDeceleration" min="100" max="50000" step="100">
@@ -356,6 +390,13 @@ String WebInterface::getIndexHTML() {
                     </label>
                     <small class="param-info">Automatically re-home after emergency stop or unexpected limit switch activation</small>
                 </div>
+                <div class="config-item">
+                    <label style="display: flex; align-items: center; cursor: pointer;">
+                        <input type="checkbox" id="verifyHoming" style="margin-right: 10px; width: auto;">
+                        Quick Verify Homing
+                    </label>
+                    <small class="param-info">Home on the left switch only and check it against the stored range (full sweep on mismatch)</small>
+                </div>
             </div>
             
             <!-- DMX Configuration Tab -->
@@ -370,6 +411,35 @@ String WebInterface::getIndexHTML() {
                     <input type="number" id="dmxTimeout" min="100" max="60000" step="100" placeholder="Milliseconds">
                     <small class="param-info">Time before DMX signal loss is detected (100-60000 ms)</small>
                 </div>
+                <div class="config-item">
+                    <label style="display: flex; align-items: center; cursor: pointer;">
+                        <input type="checkbox" id="dmxInterpolation" style="margin-right: 10px; width: auto;">
+                        Interpolate Between Frames
+                    </label>
+                    <small class="param-info">Upsample the DMX position between frames for smoother fades</small>
+                </div>
+                <div class="config-item">
+                    <label for="dmxInterpDelayMs">Interpolation Delay:</label>
+                    <input type="number" id="dmxInterpDelayMs" min="0" max="100" step="1" placeholder="Milliseconds">
+                    <small class="param-info">0 predicts a frame ahead (least lag); one frame interval (23-44 ms) or more never overshoots</small>
+                </div>
+                <div class="config-item">
+                    <label for="dmxPersonality">Personality:</label>
+                    <input type="number" id="dmxPersonality" min="0" max="7" step="1">
+                    <small class="param-info">Channel layout: 0 = standard 8-bit, 1 = standard 16-bit, 2 = compact 16-bit, 3-7 = uploaded</small>
+                </div>
+                <div class="config-item">
+                    <label style="display: flex; align-items: center; cursor: pointer;">
+                        <input type="checkbox" id="dmxNetworkInput" style="margin-right: 10px; width: auto;">
+                        Network Input (Art-Net / sACN)
+                    </label>
+                    <small class="param-info">Take DMX from Art-Net or sACN sent to this access point instead of the RS-485 input</small>
+                </div>
+                <div class="config-item">
+                    <label for="dmxUniverse">Network Universe:</label>
+                    <input type="number" id="dmxUniverse" min="0" max="63999" step="1">
+                    <small class="param-info">Art-Net port address (0-32767) or sACN universe (1-63999)</small>
+                </div>
             </div>
 
             
@@ -859,6 +929,8 @@ let motorEnabled = false;
 let isAdjustingSliders = false;  // Track if user is adjusting sliders
 let detectedLimits = null;  // Store detected position limits from homing
 let livePreviewEnabled = false;  // Track if live preview mode is active
+let motionTarget = null;  // Target of the move in progress
+let motionEta = 0;  // Its time to arrival (ms, 0 = at rest)
 
 // WebSocket connection management
 function connectWebSocket() {
@@ -974,6 +1046,12 @@ function updateUI(data) {
     if (data.position) {
         document.getElementById('currentPosition').textContent = data.position.current;
         document.getElementById('targetPosition').textContent = data.position.target;
+        motionTarget = data.position.target;
+    }
+    
+    if (data.eta !== undefined) {
+        motionEta = data.eta;
+        document.getElementById('motionEta').textContent = data.eta > 0 ? (data.eta / 1000).toFixed(1) + ' s' : '--';
     }
     
     if (data.speed !== undefined) {
@@ -1000,19 +1078,31 @@ function updateUI(data) {
         dmxActiveEl.style.color = data.dmx.active ? 'var(--success-color)' : 'var(--text-dim)';
         
         document.getElementById('dmxOffset').textContent = data.dmx.offset || '0';
-        
-        // Update channel values
+        document.getElementById('dmxInputStatus').textContent = data.dmx.input === 'network' ? 'Network' : 'RS-485';
+        if (data.dmx.network) {
+            const active = data.dmx.network.sources.find(source => source.active);
+            document.getElementById('dmxNetSources').textContent = active ?
+                `${active.protocol} ${active.address} (${data.dmx.network.sources.length} sources)` :
+                `${data.dmx.network.sources.length} sources`;
+        } else {
+            document.getElementById('dmxNetSources').textContent = '';
+        }
+        document.getElementById('dmxPersonality').textContent = data.dmx.personality || '--';
         if (data.dmx.channels) {
-            // Channel 1 & 2: Position (with calculations if we have position limits)
-            const ch1Value = data.dmx.channels[0] || 0;
-            const ch2Value = data.dmx.channels[1] || 0;
-            document.getElementById('dmxCh1').textContent = ch1Value;
-            document.getElementById('dmxCh2').textContent = ch2Value;
+            document.getElementById('dmxChannels').textContent = data.dmx.channels.join(', ');
+        }
+        
+        // Update decoded values (the personality maps channels to roles)
+        if (data.dmx.values) {
+            const values = data.dmx.values;
+            
+            // Position (with calculations if we have position limits)
+            document.getElementById('dmxPosValue').textContent = values.position.toFixed(1) + '%';
             
             // Calculate position in steps
             if (data.positionLimits && data.positionLimits.valid && data.config) {
                 // DMX position is always percentage-based in this system
-                const positionPercent = (ch1Value / 255.0) * 100.0;
+                const positionPercent = values.position;
                 
                 // Use configured position limits
                 const minPos = data.config.minPosition || data.positionLimits.min;
@@ -1025,42 +1115,43 @@ function updateUI(data) {
                 document.getElementById('dmxPos').textContent = '';
             }
             
-            // Channel 3: Acceleration
-            const ch3Value = data.dmx.channels[2] || 0;
-            document.getElementById('dmxCh3').textContent = ch3Value;
+            // Acceleration
+            document.getElementById('dmxAccelValue').textContent = values.acceleration.toFixed(0) + '%';
             if (data.config && data.config.acceleration) {
-                const accelPercent = (ch3Value / 255.0) * 100.0;
+                const accelPercent = values.acceleration;
                 const accelValue = Math.round((data.config.acceleration * accelPercent) / 100.0);
                 document.getElementById('dmxAccel').textContent = `(${accelValue} steps/s²)`;
             } else {
                 document.getElementById('dmxAccel').textContent = '';
             }
             
-            // Channel 4: Speed
-            const ch4Value = data.dmx.channels[3] || 0;
-            document.getElementById('dmxCh4').textContent = ch4Value;
+            // Speed
+            document.getElementById('dmxSpeedValue').textContent = values.speed.toFixed(0) + '%';
             if (data.config && data.config.maxSpeed) {
-                const speedPercent = (ch4Value / 255.0) * 100.0;
+                const speedPercent = values.speed;
                 const speedValue = Math.round((data.config.maxSpeed * speedPercent) / 100.0);
                 document.getElementById('dmxSpeed').textContent = `(${speedValue} steps/s)`;
             } else {
                 document.getElementById('dmxSpeed').textContent = '';
             }
             
-            // Channel 5 with mode translation
-            const ch5Value = data.dmx.channels[4] || 0;
-            document.getElementById('dmxCh5').textContent = ch5Value;
+            // Mode channel with mode translation
+            const ch5Value = values.mode || 0;
+            document.getElementById('dmxModeValue').textContent = ch5Value;
             
             // Decode mode based on DMXReceiver.h thresholds:
-            // 0-84: STOP, 85-170: CONTROL, 171-255: HOME
+            // 0-100: STOP, 101-200: CONTROL, 201-254: CUE (6 values per cue), 255: HOME
             let modeText = '';
             let modeColor = '';
-            if (ch5Value <= 84) {
+            if (ch5Value <= 100) {
                 modeText = '(STOP)';
                 modeColor = 'var(--danger-color)';
-            } else if (ch5Value <= 170) {
+            } else if (ch5Value <= 200) {
                 modeText = '(CONTROL)';
                 modeColor = 'var(--success-color)';
+            } else if (ch5Value <= 254) {
+                modeText = '(CUE ' + Math.min(Math.floor((ch5Value - 201) / 6), 7) + ')';
+                modeColor = 'var(--primary-color)';
             } else {
                 modeText = '(HOME)';
                 modeColor = 'var(--warning-color)';
@@ -1202,6 +1293,10 @@ function updateUI(data) {
             document.getElementById('acceleration').value = data.config.acceleration;
             document.getElementById('accelerationValue').textContent = data.config.acceleration;
         }
+        if (data.config.homingFastSpeed !== undefined) {
+            document.getElementById('homingFastSpeed').value = data.config.homingFastSpeed;
+            document.getElementById('homingFastSpeedValue').textContent = data.config.homingFastSpeed;
+        }
         if (data.config.homingSpeed !== undefined) {
             document.getElementById('homingSpeed').value = data.config.homingSpeed;
             document.getElementById('homingSpeedValue').textContent = data.config.homingSpeed;
@@ -1220,6 +1315,9 @@ function updateUI(data) {
             document.getElementById('jerk').value = data.config.jerk;
             document.getElementById('jerkValue').textContent = data.config.jerk;
         }
+        if (data.config.profileShape !== undefined) {
+            document.getElementById('scurveProfile').checked = (data.config.profileShape === 'scurve');
+        }
         if (data.config.emergencyDeceleration !== undefined) {
             document.getElementById('emergencyDeceleration').value = data.config.emergencyDeceleration;
             document.getElementById('emergencyDecelerationValue').textContent = data.config.emergencyDeceleration;
@@ -1232,6 +1330,21 @@ function updateUI(data) {
         if (data.config.dmxTimeout !== undefined) {
             document.getElementById('dmxTimeout').value = data.config.dmxTimeout;
         }
+        if (data.config.dmxInterpolation !== undefined) {
+            document.getElementById('dmxInterpolation').checked = data.config.dmxInterpolation;
+        }
+        if (data.config.dmxInterpDelayMs !== undefined) {
+            document.getElementById('dmxInterpDelayMs').value = data.config.dmxInterpDelayMs;
+        }
+        if (data.config.dmxPersonality !== undefined) {
+            document.getElementById('dmxPersonality').value = data.config.dmxPersonality;
+        }
+        if (data.config.dmxInput !== undefined) {
+            document.getElementById('dmxNetworkInput').checked = data.config.dmxInput === 'network';
+        }
+        if (data.config.dmxUniverse !== undefined) {
+            document.getElementById('dmxUniverse').value = data.config.dmxUniverse;
+        }
         
         // Position limits - convert from steps to percentages if we have detected limits
         if (detectedLimits && data.config.minPosition !== undefined && data.config.maxPosition !== undefined) {
@@ -1255,6 +1368,9 @@ function updateUI(data) {
         if (data.config.autoHomeOnEstop !== undefined) {
             document.getElementById('autoHomeOnEstop').checked = data.config.autoHomeOnEstop;
         }
+        if (data.config.verifyHoming !== undefined) {
+            document.getElementById('verifyHoming').checked = data.config.verifyHoming;
+        }
     }
 }
 
@@ -1288,12 +1404,19 @@ function toggleMotor() {
     sendCommand(motorEnabled ? 'disable' : 'enable');
 }
 
+// A move to this target is already under way - resending it would only restart the ramp
+function alreadyEnRoute(position) {
+    return motionEta > 0 && position === motionTarget;
+}
+
 function moveToPosition() {
     const input = document.getElementById('positionInput');
     const position = parseInt(input.value);
     
     if (!isNaN(position)) {
-        sendCommand('move', { position: position });
+        if (!alreadyEnRoute(position)) {
+            sendCommand('move', { position: position });
+        }
         input.value = '';
     }
 }
@@ -1312,7 +1435,10 @@ function moveToHome() {
     const range = detectedLimits.max - detectedLimits.min;
     const homePosition = detectedLimits.min + Math.floor((range * homePercent) / 100);
     
-    // Send move command to calculated home position
+    // Send move command to calculated home position (unless already heading there)
+    if (alreadyEnRoute(homePosition)) {
+        return;
+    }
     sendCommand('move', { position: homePosition });
     
     // Optional: Show feedback
@@ -1362,6 +1488,7 @@ function applyConfig() {
         } else {
             config.homingSpeed = parseInt(document.getElementById('homingSpeed').value);
         }
+        config.homingFastSpeed = parseInt(document.getElementById('homingFastSpeed').value);
         
         // Limit safety margin
         config.limitSafetyMargin = parseInt(document.getElementById('limitSafetyMargin').value);
@@ -1386,14 +1513,21 @@ function applyConfig() {
         // Include auto-home settings
         config.autoHomeOnBoot = document.getElementById('autoHomeOnBoot').checked;
         config.autoHomeOnEstop = document.getElementById('autoHomeOnEstop').checked;
+        config.verifyHoming = document.getElementById('verifyHoming').checked;
         
         // Include advanced motion settings (now part of Motion & Limits tab)
         config.jerk = parseInt(document.getElementById('jerk').value);
+        config.profileShape = document.getElementById('scurveProfile').checked ? 'scurve' : 'trapezoidal';
         config.emergencyDeceleration = parseInt(document.getElementById('emergencyDeceleration').value);
     } else if (activeTab === 'dmx-tab') {
-        // DMX tab - only channel and timeout now
+        // DMX tab - channel, timeout, setpoint interpolation, personality and input
         config.dmxChannel = parseInt(document.getElementById('dmxChannel').value);
         config.dmxTimeout = parseInt(document.getElementById('dmxTimeout').value);
+        config.dmxInterpolation = document.getElementById('dmxInterpolation').checked;
+        config.dmxInterpDelayMs = parseInt(document.getElementById('dmxInterpDelayMs').value);
+        config.dmxPersonality = parseInt(document.getElementById('dmxPersonality').value);
+        config.dmxInput = document.getElementById('dmxNetworkInput').checked ? 1 : 0;
+        config.dmxUniverse = parseInt(document.getElementById('dmxUniverse').value);
     }
     
     // Remove any NaN values
@@ -1539,6 +1673,11 @@ document.getElementById('homingSpeed').addEventListener('input', (e) => {
     }
 });
 
+document.getElementById('homingFastSpeed').addEventListener('input', (e) => {
+    isAdjustingSliders = true;
+    document.getElementById('homingFastSpeedValue').textContent = e.target.value;
+});
+
 document.getElementById('limitSafetyMargin').addEventListener('input', (e) => {
     isAdjustingSliders = true;
     document.getElementById('limitSafetyMarginValue').textContent = e.target.value;
@@ -1579,6 +1718,10 @@ document.getElementById('homingSpeed').addEventListener('mousedown', () => {
     isAdjustingSliders = true;
 });
 
+document.getElementById('homingFastSpeed').addEventListener('mousedown', () => {
+    isAdjustingSliders = true;
+});
+
 if (document.getElementById('homingSpeedAlso')) {
     document.getElementById('homingSpeedAlso').addEventListener('mousedown', () => {
         isAdjustingSliders = true;
@@ -1606,6 +1749,10 @@ document.getElementById('homingSpeed').addEventListener('touchstart', () => {
     isAdjustingSliders = true;
 });
 
+document.getElementById('homingFastSpeed').addEventListener('touchstart', () => {
+    isAdjustingSliders = true;
+});
+
 // Removed duplicate slider touch listener
 
 document.getElementById('jerk').addEventListener('touchstart', () => {
@@ -1791,6 +1938,23 @@ static int32_t g_randomPositions[10];
 static uint8_t g_randomTestIndex = 0;
 static uint32_t g_randomTestMoveCount = 0;
 
+/**
+ * Read the optional "axis" field of a motion command (axis 0 without it)
+ * @return false if the field is not an existing axis
+ */
+static bool readAxis(const JsonDocument& cmd, uint8_t& axis) {
+    axis = 0;
+    if (!cmd.containsKey("axis")) {
+        return true;
+    }
+    int value = cmd["axis"] | -1;
+    if (!cmd["axis"].is<int>() || value < 0 || value >= StepperController::getAxisCount()) {
+        return false;
+    }
+    axis = (uint8_t)value;
+    return true;
+}
+
 // ============================================================================
 // Singleton Implementation
 // ============================================================================
@@ -2135,6 +2299,9 @@ void WebInterface::setupWebServer() {
     httpServer->on("/api/config", HTTP_GET, [this]() { this->handleConfig(); });
     httpServer->on("/api/config", HTTP_POST, [this]() { this->handleConfigUpdate(); });
     httpServer->on("/api/info", HTTP_GET, [this]() { this->handleInfo(); });
+    httpServer->on("/api/profile", HTTP_GET, [this]() { this->handleProfile(); });
+    httpServer->on("/api/log", HTTP_GET, [this]() { this->handleLog(); });
+    httpServer->on("/api/trace", HTTP_GET, [this]() { this->handleTrace(); });
     
     // 404 handler - also redirect to main page for captive portal
     httpServer->onNotFound([this]() { this->handleCaptivePortal(); });
@@ -2167,7 +2334,7 @@ void WebInterface::handleCommand() {
     }
     
     String body = httpServer->arg("plain");
-    StaticJsonDocument<512> cmd;
+    StaticJsonDocument<1536> cmd;  // Sized for path waypoint arrays
     DeserializationError error = deserializeJson(cmd, body);
     
     if (error) {
@@ -2184,48 +2351,225 @@ void WebInterface::handleCommand() {
     
     // Process commands
     if (command == "move") {
-        if (!cmd.containsKey("position")) {
+        // {"command":"move","positions":[1000,2500]} moves the axes together (null = axis stays)
+        if (!cmd.containsKey("position") && !cmd.containsKey("positions")) {
             sendJsonResponse(400, "error", "Missing position field");
             return;
         }
+        ProfileShape shape = ProfileShape::CONFIGURED;
+        if (cmd.containsKey("profile") &&
+            !SystemConfigMgr::parseProfileShape(cmd["profile"], shape)) {
+            sendJsonResponse(400, "error", "Invalid profile (use scurve or trapezoidal)");
+            return;
+        }
+        if (cmd.containsKey("positions")) {
+            JsonArrayConst positions = cmd["positions"].as<JsonArrayConst>();
+            if (positions.size() == 0 || positions.size() > StepperController::getAxisCount()) {
+                sendJsonResponse(400, "error", "One position per axis required");
+            } else if (sendCoordinatedMove(positions, shape)) {
+                sendJsonResponse(200, "ok", "Coordinated move queued");
+            } else {
+                sendJsonResponse(503, "error", "Command queue full");
+            }
+            return;
+        }
+        uint8_t axis;
+        if (!readAxis(cmd, axis)) {
+            sendJsonResponse(400, "error", "Axis out of range");
+            return;
+        }
         int32_t position = cmd["position"];
-        if (sendMotionCommand(CommandType::MOVE_ABSOLUTE, position)) {
+        if (sendMotionCommand(CommandType::MOVE_ABSOLUTE, position, shape, axis)) {
             sendJsonResponse(200, "ok", "Move command queued");
         } else {
             sendJsonResponse(503, "error", "Command queue full");
         }
     }
+    else if (command == "path") {
+        // {"command":"path","waypoints":[{"position":1000,"speed":2000}],"run":true}
+        // {"command":"path","action":"clear"}
+        if (cmd["action"] == "clear") {
+            if (sendMotionCommand(CommandType::PATH_CLEAR)) {
+                sendJsonResponse(200, "ok", "Path clear queued");
+            } else {
+                sendJsonResponse(503, "error", "Command queue full");
+            }
+            return;
+        }
+        
+        JsonArray waypoints = cmd["waypoints"].as<JsonArray>();
+        for (JsonObject waypoint : waypoints) {
+            if (!waypoint.containsKey("position")) {
+                sendJsonResponse(400, "error", "Waypoint missing position");
+                return;
+            }
+            if (!sendPathWaypoint(waypoint["position"], waypoint["speed"] | 0.0f)) {
+                sendJsonResponse(503, "error", "Command queue full");
+                return;
+            }
+        }
+        if ((cmd["run"] | false) && !sendMotionCommand(CommandType::PATH_START)) {
+            sendJsonResponse(503, "error", "Command queue full");
+            return;
+        }
+        sendJsonResponse(200, "ok", "Path command queued");
+    }
+    else if (command == "cue") {
+        // {"command":"cue","action":"upload","id":0,"loop":false,"keyframes":[[0,1000,0],...]}
+        // "append" adds keyframes, "play"/"delete" take an id, "list" reports stored cues
+        String action = cmd["action"] | "list";
+        if (action == "upload" || action == "append") {
+            const char* error = nullptr;
+            if (CueEngine::uploadTrackJson(cmd.as<JsonObjectConst>(), action == "append", error)) {
+                sendJsonResponse(200, "ok", "Cue stored");
+            } else {
+                sendJsonResponse(400, "error", error);
+            }
+            return;
+        }
+        if (action == "list") {
+            StaticJsonDocument<512> response;
+            response["status"] = "ok";
+            CueEngine::listTracks(response);
+            response["playing"] = StepperController::getActiveCue();
+            sendJsonResponse(200, response);
+            return;
+        }
+        int id = cmd["id"] | -1;
+        if (id < 0 || id >= CueEngine::MAX_CUES) {
+            sendJsonResponse(400, "error", "Cue id out of range (0-7)");
+        } else if (action == "play") {
+            if (sendCuePlay(id)) {
+                sendJsonResponse(200, "ok", "Cue play queued");
+            } else {
+                sendJsonResponse(503, "error", "Command queue full");
+            }
+        } else if (action == "delete") {
+            if (CueEngine::deleteTrack(id)) {
+                sendJsonResponse(200, "ok", "Cue deleted");
+            } else {
+                sendJsonResponse(503, "error", "Cue store busy");
+            }
+        } else {
+            sendJsonResponse(400, "error", "Unknown cue action");
+        }
+    }
+    else if (command == "personality") {
+        // {"command":"personality","action":"upload","id":3,"name":"venue","channels":[{"role":"position","coarse":0,"fine":1},...]}
+        // "select"/"delete" take an id, "list" reports the personalities
+        String action = cmd["action"] | "list";
+        if (action == "upload") {
+            const char* error = nullptr;
+            if (DMXPersonality::uploadJson(cmd.as<JsonObjectConst>(), error)) {
+                if (cmd["id"] == DMXReceiver::getPersonalitySlot()) {
+                    DMXReceiver::selectPersonality(DMXReceiver::getPersonalitySlot(), false);  // Recompile the active layout
+                }
+                sendJsonResponse(200, "ok", "Personality stored");
+            } else {
+                sendJsonResponse(400, "error", error);
+            }
+            return;
+        }
+        if (action == "list") {
+            StaticJsonDocument<768> response;
+            response["status"] = "ok";
+            DMXPersonality::listPersonalities(response);
+            response["active"] = DMXReceiver::getPersonalitySlot();
+            sendJsonResponse(200, response);
+            return;
+        }
+        int id = cmd["id"] | -1;
+        if (id < 0 || id >= DMXPersonality::MAX_PERSONALITIES) {
+            sendJsonResponse(400, "error", "Personality id out of range (0-7)");
+        } else if (action == "select") {
+            if (DMXReceiver::selectPersonality(id) && SystemConfigMgr::commitChanges()) {
+                sendJsonResponse(200, "ok", "Personality selected");
+            } else {
+                sendJsonResponse(400, "error", "Personality slot is empty or does not fit after the base channel");
+            }
+        } else if (action == "delete") {
+            if (id == DMXReceiver::getPersonalitySlot()) {
+                sendJsonResponse(409, "error", "Personality is in use");
+            } else if (DMXPersonality::deletePersonality(id)) {
+                sendJsonResponse(200, "ok", "Personality deleted");
+            } else {
+                sendJsonResponse(400, "error", "Only uploaded personalities (3-7) can be deleted");
+            }
+        } else {
+            sendJsonResponse(400, "error", "Unknown personality action");
+        }
+    }
     else if (command == "jog") {
         if (!cmd.containsKey("steps")) {
             sendJsonResponse(400, "error", "Missing steps field");
             return;
         }
+        uint8_t axis;
+        if (!readAxis(cmd, axis)) {
+            sendJsonResponse(400, "error", "Axis out of range");
+            return;
+        }
         int32_t steps = cmd["steps"];
-        if (sendMotionCommand(CommandType::MOVE_RELATIVE, steps)) {
+        if (sendMotionCommand(CommandType::MOVE_RELATIVE, steps, ProfileShape::CONFIGURED, axis)) {
             sendJsonResponse(200, "ok", "Jog command queued");
         } else {
             sendJsonResponse(503, "error", "Command queue full");
         }
     }
     else if (command == "home") {
-        if (sendMotionCommand(CommandType::HOME)) {
+        uint8_t axis;
+        if (!readAxis(cmd, axis)) {
+            sendJsonResponse(400, "error", "Axis out of range");
+            return;
+        }
+        bool queued = (cmd["full"] | false) ? StepperController::startHoming(true, axis)
+                                            : sendMotionCommand(CommandType::HOME, 0, ProfileShape::CONFIGURED, axis);
+        if (queued) {
             sendJsonResponse(200, "ok", "Home command queued");
         } else {
             sendJsonResponse(503, "error", "Command queue full");
         }
     }
     else if (command == "stop") {
+        uint8_t axis;
+        if (!readAxis(cmd, axis)) {
+            sendJsonResponse(400, "error", "Axis out of range");
+            return;
+        }
         // Stop any active tests
         if (g_stressTestActive || g_randomTestActive) {
             g_stressTestActive = false;
             g_randomTestActive = false;
         }
-        if (sendMotionCommand(CommandType::STOP)) {
+        if (sendMotionCommand(CommandType::STOP, 0, ProfileShape::CONFIGURED, axis)) {
             sendJsonResponse(200, "ok", "Stop command queued");
         } else {
             sendJsonResponse(503, "error", "Command queue full");
         }
     }
+    else if (command == "speed" || command == "accel") {
+        // {"command":"speed","value":2000,"axis":1} - live change as serial SPEED/ACCEL, not saved
+        uint8_t axis;
+        if (!readAxis(cmd, axis)) {
+            sendJsonResponse(400, "error", "Axis out of range");
+            return;
+        }
+        bool isSpeed = (command == "speed");
+        float value = cmd["value"] | 0.0f;
+        if (!InputValidation::validateFloat(value,
+                                            isSpeed ? ParamLimits::MIN_SPEED : ParamLimits::MIN_ACCELERATION,
+                                            isSpeed ? ParamLimits::MAX_SPEED : ParamLimits::MAX_ACCELERATION)) {
+            sendJsonResponse(400, "error", "Value missing or out of range");
+            return;
+        }
+        bool queued = isSpeed ? StepperController::setMaxSpeed(value, axis)
+                              : StepperController::setAcceleration(value, axis);
+        if (queued) {
+            sendJsonResponse(200, "ok", "Live change queued");
+        } else {
+            sendJsonResponse(503, "error", "Command queue full");
+        }
+    }
     else if (command == "estop") {
         // Stop any active tests
         if (g_stressTestActive || g_randomTestActive) {
@@ -2373,6 +2717,39 @@ void WebInterface::handleInfo() {
     sendJsonResponse(200, doc);
 }
 
+void WebInterface::handleProfile() {
+    // GET /api/profile?reset=1 clears the histograms after reporting them
+    StaticJsonDocument<1536> doc;
+    LoopProfiler::exportJson(doc.to<JsonObject>());
+    sendJsonResponse(200, doc);
+    if (httpServer->hasArg("reset")) {
+        LoopProfiler::reset();
+    }
+}
+
+void WebInterface::handleLog() {
+    // Recent Core 0 log lines - too large for the web task stack, so heap allocated
+    DynamicJsonDocument doc(CORE_LOG_HISTORY_LINES * (CORE_LOG_LINE_LENGTH + 64) + 256);
+    CoreLog::exportJson(doc.to<JsonObject>());
+    sendJsonResponse(200, doc);
+}
+
+void WebInterface::handleTrace() {
+    // GET /api/trace?clear=1 clears the trace after sending it
+    uint8_t* blob = (uint8_t*)malloc(MotionTrace::maxDumpSize());
+    if (blob == nullptr) {
+        sendJsonResponse(503, "error", "Not enough memory for the trace");
+        return;
+    }
+    size_t length = MotionTrace::dump(blob, MotionTrace::maxDumpSize());
+    httpServer->sendHeader("Content-Disposition", "attachment; filename=\"skullstepper.trace\"");
+    httpServer->send_P(200, "application/octet-stream", (const char*)blob, length);
+    free(blob);
+    if (httpServer->hasArg("clear")) {
+        MotionTrace::clear();
+    }
+}
+
 void WebInterface::handleNotFound() {
     sendJsonResponse(404, "error", "Not found");
 }
@@ -2447,16 +2824,24 @@ void WebInterface::processWebSocketMessage(uint8_t num, uint8_t* payload, size_t
     if (type == "command") {
         String command = cmd["command"] | "";
         
+        uint8_t axis;
+        if (!readAxis(cmd, axis)) {
+            wsServer->sendTXT(num, "{\"status\":\"error\",\"message\":\"Axis out of range\"}");
+            return;
+        }
+        
         if (command == "move") {
             int32_t position = cmd["position"];
-            sendMotionCommand(CommandType::MOVE_ABSOLUTE, position);
+            ProfileShape shape = ProfileShape::CONFIGURED;
+            SystemConfigMgr::parseProfileShape(cmd["profile"] | "default", shape);
+            sendMotionCommand(CommandType::MOVE_ABSOLUTE, position, shape, axis);
         }
         else if (command == "jog") {
             int32_t steps = cmd["steps"];
-            sendMotionCommand(CommandType::MOVE_RELATIVE, steps);
+            sendMotionCommand(CommandType::MOVE_RELATIVE, steps, ProfileShape::CONFIGURED, axis);
         }
         else if (command == "home") {
-            sendMotionCommand(CommandType::HOME);
+            sendMotionCommand(CommandType::HOME, 0, ProfileShape::CONFIGURED, axis);
         }
         else if (command == "stop") {
             // Stop any active tests
@@ -2466,7 +2851,7 @@ void WebInterface::processWebSocketMessage(uint8_t num, uint8_t* payload, size_t
                 String statusMsg = "{\"status\":\"info\",\"message\":\"Test stopped by user\"}";
                 wsServer->sendTXT(num, statusMsg);
             }
-            sendMotionCommand(CommandType::STOP);
+            sendMotionCommand(CommandType::STOP, 0, ProfileShape::CONFIGURED, axis);
         }
         else if (command == "estop") {
             // Stop any active tests
@@ -2585,27 +2970,23 @@ void WebInterface::processWebSocketMessage(uint8_t num, uint8_t* payload, size_t
 // ============================================================================
 
 void WebInterface::getSystemStatus(JsonDocument& doc) {
-    // Read system status using thread-safe macros
-    int32_t currentPos, targetPos;
-    float currentSpeed;
-    bool stepperEnabled;
-    SystemState state;
-    bool leftLimit, rightLimit;
-    
-    SAFE_READ_STATUS(currentPosition, currentPos);
-    SAFE_READ_STATUS(targetPosition, targetPos);
-    SAFE_READ_STATUS(currentSpeed, currentSpeed);
-    SAFE_READ_STATUS(stepperEnabled, stepperEnabled);
-    SAFE_READ_STATUS(systemState, state);
-    
-    // Get limit states from StepperController
-    StepperController::getLimitStates(leftLimit, rightLimit);
+    // Read one consistent status snapshot (lock-free, never stalls Core 0)
+    SystemStatus status;
+    readSystemStatus(status);
+    int32_t currentPos = status.currentPosition;
+    int32_t targetPos = status.targetPosition;
+    float currentSpeed = status.currentSpeed;
+    bool stepperEnabled = status.stepperEnabled;
+    SystemState state = status.systemState;
+    bool leftLimit = status.limitsActive[0];
+    bool rightLimit = status.limitsActive[1];
     
     // Build status object
     doc["systemState"] = static_cast<int>(state);
     doc["position"]["current"] = currentPos;
     doc["position"]["target"] = targetPos;
     doc["speed"] = currentSpeed;
+    doc["eta"] = status.timeToArrival;
     doc["stepperEnabled"] = stepperEnabled;
     doc["limits"]["left"] = leftLimit;
     doc["limits"]["right"] = rightLimit;
@@ -2614,6 +2995,27 @@ void WebInterface::getSystemStatus(JsonDocument& doc) {
     doc["isHomed"] = StepperController::isHomed();
     doc["limitFaultActive"] = StepperController::isLimitFaultActive();
     
+    // Every axis, on boards driving more than one
+    if (StepperController::getAxisCount() > 1) {
+        JsonArray axes = doc.createNestedArray("axes");
+        for (uint8_t i = 0; i < StepperController::getAxisCount(); i++) {
+            StepperController::AxisStatus axisStatus;
+            StepperController::getAxisStatus(i, axisStatus);
+            JsonObject axis = axes.createNestedObject();
+            axis["position"] = axisStatus.currentPosition;
+            axis["target"] = axisStatus.targetPosition;
+            axis["speed"] = axisStatus.currentSpeed;
+            axis["eta"] = axisStatus.timeToArrival;
+            axis["motionState"] = static_cast<int>(axisStatus.motionState);
+            axis["limitLeft"] = axisStatus.limitsActive[0];
+            axis["limitRight"] = axisStatus.limitsActive[1];
+            axis["alarm"] = axisStatus.stepperAlarm;
+            axis["isHoming"] = axisStatus.homing;
+            axis["isHomed"] = axisStatus.homed;
+            axis["limitFault"] = axisStatus.limitFault;
+        }
+    }
+    
     // Add detected physical limits (actual switch positions)
     int32_t detectedLeft, detectedRight;
     if (StepperController::getDetectedLimits(detectedLeft, detectedRight)) {
@@ -2641,30 +3043,99 @@ void WebInterface::getSystemStatus(JsonDocument& doc) {
     doc["config"]["maxSpeed"] = config->defaultProfile.maxSpeed;
     doc["config"]["acceleration"] = config->defaultProfile.acceleration;
     doc["config"]["homingSpeed"] = config->homingSpeed;
+    doc["config"]["homingFastSpeed"] = config->homingFastSpeed;
     doc["config"]["limitSafetyMargin"] = config->limitSafetyMargin;
     doc["config"]["jerk"] = config->defaultProfile.jerk;
+    doc["config"]["profileShape"] = SystemConfigMgr::profileShapeToString(config->defaultProfile.shape);
     doc["config"]["emergencyDeceleration"] = config->emergencyDeceleration;
     doc["config"]["dmxChannel"] = config->dmxStartChannel;
     doc["config"]["dmxTimeout"] = config->dmxTimeout;
+    doc["config"]["dmxInterpolation"] = config->dmxInterpolation;
+    doc["config"]["dmxInterpDelayMs"] = config->dmxInterpDelayMs;
+    doc["config"]["dmxPersonality"] = config->dmxPersonality;
+    doc["config"]["dmxInput"] = config->dmxInput ? "network" : "uart";
+    doc["config"]["dmxUniverse"] = config->dmxUniverse;
     doc["config"]["minPosition"] = config->minPosition;
     doc["config"]["maxPosition"] = config->maxPosition;
     doc["config"]["homePositionPercent"] = config->homePositionPercent;
     doc["config"]["autoHomeOnBoot"] = config->autoHomeOnBoot;
     doc["config"]["autoHomeOnEstop"] = config->autoHomeOnEstop;
+    doc["config"]["verifyHoming"] = config->verifyHoming;
+    doc["config"]["limitFilterSamples"] = config->limitFilterSamples;
     
     // Add DMX information
-    uint8_t dmxChannels[5] = {0};
+    uint8_t dmxChannels[DMXReceiver::MAX_CHANNELS] = {0};
+    uint8_t dmxChannelCount = DMXReceiver::getFootprint();
+    DMXPersonality::Values dmxValues = {};
     bool dmxActive = DMXReceiver::isSignalPresent();
     if (dmxActive) {
-        DMXReceiver::getChannelCache(dmxChannels);
+        dmxChannelCount = DMXReceiver::getChannelCache(dmxChannels, DMXReceiver::MAX_CHANNELS);
+        DMXReceiver::getDecodedValues(dmxValues);
     }
     
     doc["dmx"]["active"] = dmxActive;
     doc["dmx"]["offset"] = DMXReceiver::getBaseChannel();  // Show the actual base channel
+    doc["dmx"]["input"] = (DMXReceiver::getInput() == DMXReceiver::DMXInput::NETWORK) ? "network" : "uart";
+    DMXPersonality::Personality dmxPersonality;
+    if (DMXPersonality::getPersonality(DMXReceiver::getPersonalitySlot(), dmxPersonality)) {
+        doc["dmx"]["personality"] = (char*)dmxPersonality.name;  // Copied into the document
+    }
     JsonArray channels = doc["dmx"].createNestedArray("channels");
-    for (int i = 0; i < 5; i++) {
+    for (int i = 0; i < dmxChannelCount; i++) {
         channels.add(dmxChannels[i]);
     }
+    JsonObject values = doc["dmx"].createNestedObject("values");
+    values["position"] = FixedPoint::fractionToPercent(dmxValues.value[(uint8_t)DMXPersonality::Role::POSITION]);
+    values["speed"] = FixedPoint::fractionToPercent(dmxValues.value[(uint8_t)DMXPersonality::Role::SPEED]);
+    values["acceleration"] = FixedPoint::fractionToPercent(dmxValues.value[(uint8_t)DMXPersonality::Role::ACCELERATION]);
+    values["mode"] = dmxValues.mode;
+    
+    // DMX frame timing (frame rate, jitter, frame-to-command latency)
+    DMXReceiver::FrameStats frameStats;
+    if (DMXReceiver::getFrameStats(frameStats)) {
+        JsonObject frames = doc["dmx"].createNestedObject("frames");
+        frames["count"] = frameStats.frames;
+        frames["skipped"] = frameStats.skippedFrames;
+        frames["rateHz"] = frameStats.rateHz;
+        frames["intervalUs"] = frameStats.intervalAvgUs;
+        frames["jitterUs"] = frameStats.jitterAvgUs;
+        frames["jitterMaxUs"] = frameStats.jitterMaxUs;
+        frames["latencyUs"] = frameStats.latencyAvgUs;
+        frames["latencyMaxUs"] = frameStats.latencyMaxUs;
+        JsonArray latency = frames.createNestedArray("latencyHist");
+        for (uint8_t i = 0; i < DMXReceiver::LATENCY_BUCKETS; i++) {
+            latency.add(frameStats.latencyBuckets[i]);
+        }
+    }
+    
+#ifdef ENABLE_NETWORK_DMX
+    // Art-Net/sACN receiver totals and senders
+    NetworkDMX::Stats netStats;
+    NetworkDMX::getStats(netStats);
+    JsonObject network = doc["dmx"].createNestedObject("network");
+    network["packets"] = netStats.packets;
+    network["malformed"] = netStats.malformed;
+    network["otherUniverse"] = netStats.otherUniverse;
+    network["outOfOrder"] = netStats.outOfOrder;
+    network["frames"] = netStats.frames;
+    network["switches"] = netStats.sourceSwitches;
+    JsonArray sources = network.createNestedArray("sources");
+    for (uint8_t i = 0; i < NetworkDMX::MAX_SOURCES; i++) {
+        NetworkDMX::SourceStats source;
+        if (!NetworkDMX::getSourceStats(i, source)) continue;
+        const uint8_t* ip = (const uint8_t*)&source.address;  // Network byte order
+        char address[16];
+        snprintf(address, sizeof(address), "%d.%d.%d.%d", ip[0], ip[1], ip[2], ip[3]);
+        JsonObject entry = sources.createNestedObject();
+        entry["protocol"] = NetworkDMX::protocolName(source.protocol);
+        entry["address"] = (char*)address;  // Copied into the document
+        entry["priority"] = source.priority;
+        entry["active"] = source.active;
+        entry["packets"] = source.packets;
+        entry["outOfOrder"] = source.outOfOrder;
+        entry["ageMs"] = source.ageMs;
+    }
+#endif
     
     // Add system information
     doc["systemInfo"]["version"] = "4.1.13";
@@ -2720,6 +3191,57 @@ void WebInterface::getSystemStatus(JsonDocument& doc) {
         tasks["broadcastExists"] = false;
     }
     
+    // Motion command queue statistics
+    StepperController::CommandQueueStats cmdStats;
+    StepperController::getCommandQueueStats(cmdStats);
+    JsonObject commands = diag.createNestedObject("commands");
+    commands["received"] = cmdStats.received;
+    commands["processed"] = cmdStats.processed;
+    commands["coalesced"] = cmdStats.coalesced;
+    commands["dropped"] = cmdStats.dropped;
+    commands["queueFull"] = cmdStats.queueFull;
+    
+    // Waypoint path
+    JsonObject path = diag.createNestedObject("path");
+    path["queued"] = StepperController::getPathQueueDepth();
+    path["running"] = StepperController::isPathRunning();
+    diag["cue"] = StepperController::getActiveCue();
+    
+    // Last homing sequence, per phase (ms)
+    StepperController::HomingTimes homingTimes;
+    StepperController::getHomingTimes(homingTimes);
+    JsonObject homing = diag.createNestedObject("homing");
+    homing["total"] = homingTimes.total;
+    homing["twoSpeed"] = homingTimes.fastApproach;
+    homing["verified"] = homingTimes.verified;
+    homing["storedRange"] = StepperController::getCalibratedRange();
+    homing["findLeft"] = homingTimes.findLeft;
+    homing["releaseLeft"] = homingTimes.releaseLeft;
+    homing["findRight"] = homingTimes.findRight;
+    homing["releaseRight"] = homingTimes.releaseRight;
+    homing["moveHome"] = homingTimes.moveHome;
+    
+    // Limit switch stop path
+    StepperController::LimitStopStats limitStats;
+    StepperController::getLimitStopStats(limitStats);
+    JsonObject limitStop = diag.createNestedObject("limitStop");
+    limitStop["stops"] = limitStats.stops;
+    limitStop["latencyUs"] = limitStats.lastLatencyUs;
+    limitStop["maxLatencyUs"] = limitStats.maxLatencyUs;
+    limitStop["overrun"] = limitStats.lastOverrun;
+    limitStop["maxOverrun"] = limitStats.maxOverrun;
+    limitStop["glitches"] = limitStats.glitches;
+    limitStop["latchDelta"] = limitStats.lastLatchDelta;
+    limitStop["maxLatchDelta"] = limitStats.maxLatchDelta;
+    
+    // Core 0 deferred log ring
+    CoreLog::Stats logStats;
+    CoreLog::getStats(logStats);
+    JsonObject coreLog = diag.createNestedObject("coreLog");
+    coreLog["written"] = logStats.written;
+    coreLog["dropped"] = logStats.dropped;
+    coreLog["highWater"] = logStats.highWater;
+    
     // System info
     JsonObject sysInfo = diag.createNestedObject("system");
     sysInfo["cpuFreq"] = ESP.getCpuFreqMHz();
@@ -2734,7 +3256,9 @@ void WebInterface::getSystemConfig(JsonDocument& doc) {
     doc["motion"]["maxSpeed"] = config->defaultProfile.maxSpeed;
     doc["motion"]["acceleration"] = config->defaultProfile.acceleration;
     doc["motion"]["homingSpeed"] = config->homingSpeed;
+    doc["motion"]["homingFastSpeed"] = config->homingFastSpeed;
     doc["motion"]["jerk"] = config->defaultProfile.jerk;
+    doc["motion"]["profileShape"] = SystemConfigMgr::profileShapeToString(config->defaultProfile.shape);
     
     // Position limits
     doc["limits"]["min"] = config->minPosition;
@@ -2744,6 +3268,11 @@ void WebInterface::getSystemConfig(JsonDocument& doc) {
     // DMX config
     doc["dmx"]["channel"] = config->dmxStartChannel;
     doc["dmx"]["timeout"] = config->dmxTimeout;
+    doc["dmx"]["interpolation"] = config->dmxInterpolation;
+    doc["dmx"]["interpDelayMs"] = config->dmxInterpDelayMs;
+    doc["dmx"]["personality"] = config->dmxPersonality;
+    doc["dmx"]["input"] = config->dmxInput ? "network" : "uart";
+    doc["dmx"]["universe"] = config->dmxUniverse;
     
     // Safety config
     doc["safety"]["emergencyDeceleration"] = config->emergencyDeceleration;
@@ -2772,9 +3301,10 @@ void WebInterface::getSystemInfo(JsonDocument& doc) {
     doc["apStations"] = WiFi.softAPgetStationNum();
 }
 
-bool WebInterface::sendMotionCommand(CommandType type, int32_t position) {
+bool WebInterface::sendMotionCommand(CommandType type, int32_t position, ProfileShape shape, uint8_t axis) {
     MotionCommand cmd = {};  // Zero-initialize to avoid random values
     cmd.type = type;
+    cmd.axis = axis;
     cmd.timestamp = millis();
     cmd.commandId = nextCommandId++;
     
@@ -2787,10 +3317,60 @@ bool WebInterface::sendMotionCommand(CommandType type, int32_t position) {
     // Override target position for movement commands
     if (type == CommandType::MOVE_ABSOLUTE || type == CommandType::MOVE_RELATIVE) {
         cmd.profile.targetPosition = position;
+        if (shape != ProfileShape::CONFIGURED) {
+            cmd.profile.shape = shape;  // Per-move override of the configured shape
+        }
+    }
+    
+    // Non-blocking send; wakes the stepper task immediately
+    return StepperController::queueMotionCommand(cmd);
+}
+
+bool WebInterface::sendPathWaypoint(int32_t position, float speed) {
+    MotionCommand cmd = {};
+    cmd.type = CommandType::PATH_APPEND;
+    cmd.timestamp = millis();
+    cmd.commandId = nextCommandId++;
+    
+    SystemConfig* config = SystemConfigMgr::getConfig();
+    if (config) {
+        cmd.profile = config->defaultProfile;
+    }
+    cmd.profile.targetPosition = position;
+    if (speed > 0) {
+        cmd.profile.maxSpeed = speed;
     }
     
-    // Non-blocking send with no timeout
-    return (xQueueSend(g_motionCommandQueue, &cmd, 0) == pdTRUE);
+    // Short wait so a long batch does not overrun the command queue
+    return StepperController::queueMotionCommand(cmd, pdMS_TO_TICKS(10));
+}
+
+bool WebInterface::sendCoordinatedMove(JsonArrayConst positions, ProfileShape shape) {
+    int32_t targets[STEPPER_AXIS_COUNT] = {};
+    uint8_t axisMask = 0;
+    uint8_t axis = 0;
+    for (JsonVariantConst position : positions) {
+        if (!position.isNull()) {
+            axisMask |= (1 << axis);
+            targets[axis] = position.as<int32_t>();
+        }
+        axis++;
+    }
+    return StepperController::moveCoordinated(targets, axisMask, shape);
+}
+
+bool WebInterface::sendCuePlay(uint8_t id) {
+    MotionCommand cmd = {};
+    cmd.type = CommandType::CUE_PLAY;
+    cmd.timestamp = millis();
+    cmd.commandId = nextCommandId++;
+    cmd.cueId = id;
+    
+    SystemConfig* config = SystemConfigMgr::getConfig();
+    if (config) {
+        cmd.profile = config->defaultProfile;
+    }
+    return StepperController::queueMotionCommand(cmd);
 }
 
 bool WebInterface::updateConfiguration(const JsonDocument& params) {
@@ -2847,6 +3427,13 @@ bool WebInterface::updateConfiguration(const JsonDocument& params) {
         Serial.printf("[WebInterface] Setting homingSpeed to: %.1f\n", speed);
     }
     
+    if (params.containsKey("homingFastSpeed")) {
+        float speed = params["homingFastSpeed"];
+        InputValidation::validateFloat(speed, 0.0f, ParamLimits::MAX_HOMING_SPEED, "homingFastSpeed");
+        config->homingFastSpeed = speed;
+        Serial.printf("[WebInterface] Setting homingFastSpeed to: %.1f\n", speed);
+    }
+    
     if (params.containsKey("limitSafetyMargin")) {
         float margin = params["limitSafetyMargin"];
         InputValidation::validateFloat(margin, ParamLimits::MIN_LIMIT_MARGIN,
@@ -2861,6 +3448,18 @@ bool WebInterface::updateConfiguration(const JsonDocument& params) {
         Serial.printf("[WebInterface] Setting jerk to: %.1f\n", jerk);
     }
     
+    if (params.containsKey("profileShape")) {
+        ProfileShape shape;
+        if (SystemConfigMgr::parseProfileShape(params["profileShape"], shape) &&
+            shape != ProfileShape::CONFIGURED) {
+            config->defaultProfile.shape = shape;
+            Serial.printf("[WebInterface] Setting profile shape to: %s\n",
+                          SystemConfigMgr::profileShapeToString(shape));
+        } else {
+            success = false;
+        }
+    }
+    
     if (params.containsKey("emergencyDeceleration")) {
         float emergDecel = params["emergencyDeceleration"];
         config->emergencyDeceleration = emergDecel;
@@ -2883,6 +3482,45 @@ bool WebInterface::updateConfiguration(const JsonDocument& params) {
         Serial.printf("[WebInterface] Setting dmxTimeout to: %u\n", timeout);
     }
     
+    if (params.containsKey("dmxInterpolation")) {
+        config->dmxInterpolation = params["dmxInterpolation"];
+        Serial.printf("[WebInterface] Setting dmxInterpolation to: %s\n", config->dmxInterpolation ? "ON" : "OFF");
+    }
+    
+    if (params.containsKey("dmxInterpDelayMs")) {
+        int32_t delayMs = params["dmxInterpDelayMs"];
+        InputValidation::validateInt32(delayMs, 0, DMX_INTERP_MAX_DELAY_MS, "dmxInterpDelayMs");
+        config->dmxInterpDelayMs = (uint8_t)delayMs;
+        Serial.printf("[WebInterface] Setting dmxInterpDelayMs to: %d\n", delayMs);
+    }
+    
+    if (params.containsKey("dmxPersonality")) {
+        int32_t slot = params["dmxPersonality"];
+        InputValidation::validateInt32(slot, 0, DMX_PERSONALITY_SLOTS - 1, "dmxPersonality");
+        if (DMXReceiver::selectPersonality((uint8_t)slot)) {
+            Serial.printf("[WebInterface] Setting dmxPersonality to: %d\n", slot);
+        } else {
+            Serial.printf("[WebInterface] dmxPersonality %d is empty or does not fit - unchanged\n", slot);
+        }
+    }
+    
+    if (params.containsKey("dmxUniverse")) {
+        int32_t universe = params["dmxUniverse"];
+        InputValidation::validateInt32(universe, 0, DMX_NET_MAX_UNIVERSE, "dmxUniverse");
+        config->dmxUniverse = (uint16_t)universe;
+        Serial.printf("[WebInterface] Setting dmxUniverse to: %d\n", universe);
+    }
+    
+    if (params.containsKey("dmxInput")) {
+        // 0/1 from the config tab, "uart"/"network" from the API
+        bool network = params["dmxInput"].is<const char*>() ?
+                       strcmp(params["dmxInput"].as<const char*>(), "network") == 0 :
+                       params["dmxInput"].as<int>() == 1;
+        DMXReceiver::setInput(network ? DMXReceiver::DMXInput::NETWORK : DMXReceiver::DMXInput::UART, false);
+        config->dmxInput = network ? 1 : 0;
+        Serial.printf("[WebInterface] Setting dmxInput to: %s\n", network ? "network" : "uart");
+    }
+    
     // Update position limits (these are usually set by homing, but allow manual override)
     if (params.containsKey("minPosition")) {
         config->minPosition = params["minPosition"];
@@ -2916,6 +3554,18 @@ bool WebInterface::updateConfiguration(const JsonDocument& params) {
         Serial.printf("[WebInterface] Setting autoHomeOnEstop to: %s\n", config->autoHomeOnEstop ? "ON" : "OFF");
     }
     
+    if (params.containsKey("verifyHoming")) {
+        config->verifyHoming = params["verifyHoming"];
+        Serial.printf("[WebInterface] Setting verifyHoming to: %s\n", config->verifyHoming ? "ON" : "OFF");
+    }
+    
+    if (params.containsKey("limitFilterSamples")) {
+        int32_t samples = params["limitFilterSamples"];
+        InputValidation::validateInt32(samples, 1, LIMIT_FILTER_MAX_SAMPLES, "limitFilterSamples");
+        config->limitFilterSamples = (uint8_t)samples;
+        Serial.printf("[WebInterface] Setting limitFilterSamples to: %d\n", samples);
+    }
+    
     // For live updates, skip saving to flash
     if (liveUpdate) {
         // Just update StepperController with motion changes
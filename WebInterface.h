@@ -42,7 +42,7 @@
 #define WS_SERVER_PORT 81
 #define WS_MAX_CLIENTS 2
 #define STATUS_BROADCAST_INTERVAL_MS 100  // 10Hz updates
-#define JSON_BUFFER_SIZE 2048
+#define JSON_BUFFER_SIZE 4608  // Full status with diagnostics (homing, limit stop, path, DMX frames, channels and network sources)
 
 // WiFi Access Point defaults
 #define DEFAULT_AP_SSID "SkullStepper"
@@ -128,6 +128,9 @@ private:
     void handleConfig();
     void handleConfigUpdate();
     void handleInfo();
+    void handleProfile();
+    void handleLog();
+    void handleTrace();
     void handleNotFound();
     void handleCaptivePortal();
     void handleFavicon();
@@ -140,7 +143,11 @@ private:
     void getSystemStatus(JsonDocument& doc);
     void getSystemConfig(JsonDocument& doc);
     void getSystemInfo(JsonDocument& doc);
-    bool sendMotionCommand(CommandType type, int32_t position = 0);
+    bool sendMotionCommand(CommandType type, int32_t position = 0,
+                           ProfileShape shape = ProfileShape::CONFIGURED, uint8_t axis = 0);
+    bool sendPathWaypoint(int32_t position, float speed);
+    bool sendCoordinatedMove(JsonArrayConst positions, ProfileShape shape);
+    bool sendCuePlay(uint8_t id);
     bool updateConfiguration(const JsonDocument& params);
     void broadcastStatus();
     void sendStatusToClient(uint8_t num);
@@ -1,134 +1,138 @@
-// DMX Diagnostic Enhancement for DMXReceiver.cpp
-// Add this function to help debug channel mapping issues
+// DMX Diagnostic Enhancement
+// Helpers for debugging channel mapping issues, written against the public
+// DMXReceiver / DMXPersonality interface so they can live in any module
+// (e.g. behind a serial command) without touching DMXReceiver internals.
+//
+// The channel layout comes from the selected personality; there are no
+// fixed channel offsets any more.
+
+#include "DMXReceiver.h"
+#include "DMXPersonality.h"
 
 /**
  * Debug function to show raw DMX values for troubleshooting
- * Shows the first 20 channels to help identify channel mapping
+ * Shows the first 20 channels of the universe, then the personality footprint
  */
 static void debugRawDMXChannels() {
     Serial.print("[DMX DEBUG] Raw channels 1-20: ");
     for (int i = 1; i <= 20; i++) {
-        uint8_t value = dmx.read(i);
-        Serial.printf("[%d:%d] ", i, value);
+        Serial.printf("[%d:%d] ", i, DMXReceiver::getChannelValue(i));
     }
     Serial.println();
-    
+
     // Also show what we think we're reading
-    Serial.printf("[DMX DEBUG] Our 5 channels (base=%d): ", baseChannel);
-    for (int i = 0; i < NUM_CHANNELS; i++) {
-        Serial.printf("[%d:%d] ", baseChannel + i, channelCache[i]);
+    uint8_t cache[DMXReceiver::MAX_CHANNELS];
+    uint8_t count = DMXReceiver::getChannelCache(cache, sizeof(cache));
+    uint16_t baseChannel = DMXReceiver::getBaseChannel();
+    Serial.printf("[DMX DEBUG] Our %d channels (base=%d): ", count, baseChannel);
+    for (int i = 0; i < count; i++) {
+        Serial.printf("[%d:%d] ", baseChannel + i, cache[i]);
     }
     Serial.println();
 }
 
-// Modified processDMXChannels function with better diagnostics
-static void processDMXChannels() {
-    if (!dmxEnabled) {
+/**
+ * Show each channel of the selected personality with its current value
+ * Flags the classic miswiring: position moving while speed/accel read zero
+ */
+static void debugChannelMapping() {
+    DMXPersonality::Personality personality;
+    uint8_t slot = DMXReceiver::getPersonalitySlot();
+    if (!DMXPersonality::getPersonality(slot, personality)) {
+        Serial.printf("[DMX DEBUG] Personality %d unavailable\n", slot);
+        return;
+    }
+
+    uint8_t cache[DMXReceiver::MAX_CHANNELS];
+    uint8_t count = DMXReceiver::getChannelCache(cache, sizeof(cache));
+    uint16_t baseChannel = DMXReceiver::getBaseChannel();
+
+    Serial.println("[DMX DEBUG] Channel Mapping Check:");
+    Serial.printf("  Personality: %d (%s), %d channels\n",
+                  slot, personality.name, DMXReceiver::getFootprint());
+    Serial.printf("  Base Channel: %d\n", baseChannel);
+    for (uint8_t i = 0; i < personality.count; i++) {
+        const DMXPersonality::ChannelDef& def = personality.channels[i];
+        uint8_t coarse = def.coarse < count ? cache[def.coarse] : 0;
+        if (def.fine == DMXPersonality::NO_FINE) {
+            Serial.printf("  %-13s Channel %d = %d\n", DMXPersonality::roleName(def.role),
+                          baseChannel + def.coarse, coarse);
+        } else {
+            uint8_t fine = def.fine < count ? cache[def.fine] : 0;
+            Serial.printf("  %-13s Channels %d/%d = %d/%d\n", DMXPersonality::roleName(def.role),
+                          baseChannel + def.coarse, baseChannel + def.fine, coarse, fine);
+        }
+    }
+
+    // Check if speed/accel are stuck at 0 while position changes
+    DMXPersonality::Values values;
+    if (!DMXReceiver::getDecodedValues(values)) {
         return;
     }
-    
-    // Add periodic raw channel debug
+    static uint16_t lastPosition = 0;
+    uint16_t position = values.raw[(uint8_t)DMXPersonality::Role::POSITION];
+    if (position != lastPosition &&
+        values.raw[(uint8_t)DMXPersonality::Role::SPEED] == 0 &&
+        values.raw[(uint8_t)DMXPersonality::Role::ACCELERATION] == 0) {
+        Serial.println("[DMX DEBUG] WARNING: Position changing but speed/accel stuck at 0!");
+        Serial.println("[DMX DEBUG] This suggests the wrong personality or base channel!");
+    }
+    lastPosition = position;
+}
+
+/**
+ * Periodic diagnostics - call from a loop while chasing a mapping problem
+ */
+void serviceDMXDiagnostics() {
     static uint32_t lastRawDebugTime = 0;
     if (millis() - lastRawDebugTime > 2000) {  // Every 2 seconds
         lastRawDebugTime = millis();
         debugRawDMXChannels();  // Show raw DMX values
     }
-    
-    // ... rest of the function continues as before ...
-    
-    // When in CONTROL mode, add more detailed debug
-    if (currentMode == DMXMode::CONTROL && !homingRequired) {
-        
-        // Add channel mapping verification
-        static uint32_t lastMappingCheckTime = 0;
-        if (millis() - lastMappingCheckTime > 5000) {  // Every 5 seconds
-            lastMappingCheckTime = millis();
-            
-            Serial.println("[DMX DEBUG] Channel Mapping Check:");
-            Serial.printf("  Base Channel: %d\n", baseChannel);
-            Serial.printf("  Position MSB: Channel %d = %d\n", baseChannel + CH_POSITION_MSB, channels[CH_POSITION_MSB]);
-            Serial.printf("  Position LSB: Channel %d = %d\n", baseChannel + CH_POSITION_LSB, channels[CH_POSITION_LSB]);
-            Serial.printf("  Speed:        Channel %d = %d\n", baseChannel + CH_SPEED, channels[CH_SPEED]);
-            Serial.printf("  Acceleration: Channel %d = %d\n", baseChannel + CH_ACCELERATION, channels[CH_ACCELERATION]);
-            Serial.printf("  Mode:         Channel %d = %d\n", baseChannel + CH_MODE, channels[CH_MODE]);
-            
-            // Check if speed/accel are stuck at 0 while position changes
-            static uint8_t lastPosMSB = 0;
-            if (channels[CH_POSITION_MSB] != lastPosMSB && 
-                channels[CH_SPEED] == 0 && 
-                channels[CH_ACCELERATION] == 0) {
-                Serial.println("[DMX DEBUG] WARNING: Position changing but speed/accel stuck at 0!");
-                Serial.println("[DMX DEBUG] This suggests wrong channel mapping!");
-            }
-            lastPosMSB = channels[CH_POSITION_MSB];
-        }
-        
-        // ... rest of position processing ...
+
+    static uint32_t lastMappingCheckTime = 0;
+    if (millis() - lastMappingCheckTime > 5000) {  // Every 5 seconds
+        lastMappingCheckTime = millis();
+        debugChannelMapping();
     }
 }
 
-// Add a public function to trigger immediate debug output
+/**
+ * Trigger immediate debug output
+ * @return false if no DMX frame has been decoded yet
+ */
 bool debugDMXChannels() {
-    if (!moduleInitialized) {
-        Serial.println("[DMX] Module not initialized");
-        return false;
-    }
-    
     Serial.println("\n==== DMX CHANNEL DEBUG ====");
-    
+
     // Show connection status
-    Serial.printf("DMX Connected: %s\n", dmxConnected ? "YES" : "NO");
-    Serial.printf("Signal State: %s\n", 
-        currentState == DMXState::NO_SIGNAL ? "NO_SIGNAL" :
-        currentState == DMXState::SIGNAL_PRESENT ? "SIGNAL_PRESENT" :
-        currentState == DMXState::TIMEOUT ? "TIMEOUT" : "ERROR");
-    
-    // Show raw channels
+    DMXState state = DMXReceiver::getState();
+    Serial.printf("DMX Connected: %s\n", DMXReceiver::isSignalPresent() ? "YES" : "NO");
+    Serial.printf("Signal State: %s\n",
+        state == DMXState::NO_SIGNAL ? "NO_SIGNAL" :
+        state == DMXState::SIGNAL_PRESENT ? "SIGNAL_PRESENT" :
+        state == DMXState::TIMEOUT ? "TIMEOUT" : "ERROR");
+
+    // Show raw channels and the personality layout
     debugRawDMXChannels();
-    
-    // Show configuration
-    Serial.printf("\nConfiguration:\n");
-    Serial.printf("  Base Channel: %d\n", baseChannel);
-    Serial.printf("  16-bit Mode: %s\n", use16BitPosition ? "YES" : "NO");
-    Serial.printf("  DMX Enabled: %s\n", dmxEnabled ? "YES" : "NO");
-    Serial.printf("  Current Mode: %s\n", 
-        currentMode == DMXMode::STOP ? "STOP" :
-        currentMode == DMXMode::CONTROL ? "CONTROL" : "HOME");
-    
-    // Show what channels we're expecting
-    Serial.printf("\nExpected Channel Layout (base + offset):\n");
-    Serial.printf("  Ch %d: Position MSB (current: %d)\n", baseChannel + 0, channelCache[0]);
-    Serial.printf("  Ch %d: Position LSB (current: %d)\n", baseChannel + 1, channelCache[1]);
-    Serial.printf("  Ch %d: Acceleration (current: %d)\n", baseChannel + 2, channelCache[2]);
-    Serial.printf("  Ch %d: Speed (current: %d)\n", baseChannel + 3, channelCache[3]);
-    Serial.printf("  Ch %d: Mode (current: %d)\n", baseChannel + 4, channelCache[4]);
-    
-    Serial.println("==========================\n");
-    
-    return true;
-}
+    debugChannelMapping();
 
-// Temporary fix: Add channel remapping capability
-static struct {
-    bool useRemapping = false;
-    uint8_t speedChannelOffset = 3;      // Default: base + 3
-    uint8_t accelChannelOffset = 2;      // Default: base + 2
-} g_channelRemap;
-
-// Function to set custom channel mapping
-bool setChannelMapping(uint8_t speedOffset, uint8_t accelOffset) {
-    if (speedOffset > 10 || accelOffset > 10) {
-        Serial.println("[DMX] Invalid channel offsets");
-        return false;
+    // Show the decoded values the control path sees
+    DMXPersonality::Values values;
+    bool decoded = DMXReceiver::getDecodedValues(values);
+    if (decoded) {
+        Serial.printf("\nDecoded (Q0.16 after curve and range):\n");
+        Serial.printf("  Position: %u  Speed: %u  Acceleration: %u  Mode: %d\n",
+                      values.value[(uint8_t)DMXPersonality::Role::POSITION],
+                      values.value[(uint8_t)DMXPersonality::Role::SPEED],
+                      values.value[(uint8_t)DMXPersonality::Role::ACCELERATION],
+                      values.mode);
     }
-    
-    g_channelRemap.speedChannelOffset = speedOffset;
-    g_channelRemap.accelChannelOffset = accelOffset;
-    g_channelRemap.useRemapping = true;
-    
-    Serial.printf("[DMX] Channel remapping enabled:\n");
-    Serial.printf("  Speed: base + %d (channel %d)\n", speedOffset, baseChannel + speedOffset);
-    Serial.printf("  Acceleration: base + %d (channel %d)\n", accelOffset, baseChannel + accelOffset);
-    
-    return true;
+
+    Serial.println("==========================\n");
+
+    return decoded;
 }
+
+// Channel remapping is now done by selecting or uploading a personality
+// (DMXReceiver::selectPersonality / DMXPersonality::uploadJson) instead
+// of patching offsets here.
@@ -0,0 +1,90 @@
+// ============================================================================
+// File: SimHarness.cpp
+// Project: SkullStepperV4 - ESP32-S3 Modular Stepper Control System
+// Version: 4.2.0
+// Date: 2026-10-15
+// Author: Tim Rosener
+// Description: Host harness - boots the Core 0 modules on the StepperSim rig
+// License: MIT
+// ============================================================================
+
+#include "SimHarness.h"
+#include "GlobalInterface.h"
+#include "SystemConfig.h"
+#include "StepperController.h"
+#include "CueEngine.h"
+#include "CoreLog.h"
+#include <stdarg.h>
+
+bool initializeGlobalInfrastructure();
+
+namespace SimHarness {
+
+static int g_failures = 0;
+
+bool boot(bool verbose) {
+    setvbuf(stdout, nullptr, _IOLBF, 0);
+    Serial.mute(!verbose);
+    bool ok = initializeGlobalInfrastructure() &&
+              CoreLog::initialize() &&
+              SystemConfigMgr::initialize() &&
+              StepperController::initialize() &&
+              CueEngine::initialize();
+    StepperSim::runFor(1000);  // Let the tasks start
+    if (!ok) {
+        Serial.mute(false);
+        fail("boot: module initialization failed");
+    }
+    return ok;
+}
+
+uint32_t runUntil(const std::function<bool()>& done, uint32_t timeoutUs) {
+    uint64_t startUs = StepperSim::nowUs();
+    uint64_t nextLoopUs = startUs;
+    while (!done()) {
+        uint64_t elapsedUs = StepperSim::nowUs() - startUs;
+        if (elapsedUs >= timeoutUs) {
+            return UINT32_MAX;
+        }
+        if (StepperSim::nowUs() >= nextLoopUs) {
+            StepperController::flushPendingSaves();  // loop() duty on Core 1
+            nextLoopUs += 1000;
+        }
+        StepperSim::runFor(SIM_PHYSICS_STEP_US);
+    }
+    return (uint32_t)(StepperSim::nowUs() - startUs);
+}
+
+uint32_t home(bool fullSweep) {
+    uint64_t startUs = StepperSim::nowUs();
+    if (!StepperController::startHoming(fullSweep)) {
+        return UINT32_MAX;
+    }
+    // The command is taken at the next wake; then wait for the sequence to end
+    if (runUntil([] { return StepperController::isHoming(); }, 10000) == UINT32_MAX ||
+        runUntil([] { return !StepperController::isHoming(); }, 120000000UL) == UINT32_MAX ||
+        !StepperController::isHomed()) {
+        return UINT32_MAX;
+    }
+    return (uint32_t)(StepperSim::nowUs() - startUs);
+}
+
+void report(const char* name, double value, const char* unit) {
+    printf("%-40s %12.3f %s\n", name, value, unit);
+}
+
+void fail(const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    printf("FAIL: ");
+    vprintf(format, args);
+    printf("\n");
+    va_end(args);
+    g_failures++;
+}
+
+int exitCode() {
+    return g_failures == 0 ? 0 : 1;
+}
+
+} // namespace SimHarness
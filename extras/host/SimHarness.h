@@ -0,0 +1,66 @@
+// ============================================================================
+// File: SimHarness.h
+// Project: SkullStepperV4 - ESP32-S3 Modular Stepper Control System
+// Version: 4.2.0
+// Date: 2026-10-15
+// Author: Tim Rosener
+// Description: Host harness - boots the Core 0 modules on the StepperSim rig
+// License: MIT
+//
+// The harness thread plays the Arduino loop on Core 1: it queues commands
+// through the public StepperController API and runs the virtual clock,
+// during which the real stepperControllerTask runs on the host FreeRTOS
+// port (extras/host/shims). Every run is deterministic.
+// ============================================================================
+
+#ifndef SIMHARNESS_H
+#define SIMHARNESS_H
+
+#include <Arduino.h>
+#include <functional>
+#include "StepperSim.h"
+
+namespace SimHarness {
+
+    /**
+     * Bring up the modules in setup() order: GlobalInfrastructure, CoreLog,
+     * SystemConfig, StepperController, CueEngine
+     * @param verbose Keep the modules' serial output (muted otherwise)
+     * @return true if every module initialized
+     */
+    bool boot(bool verbose);
+
+    /**
+     * Run the virtual clock until a condition holds, servicing the Core 1
+     * loop duties (StepperController::flushPendingSaves) every millisecond
+     * @param done Checked after every physics step
+     * @param timeoutUs Give up after this much virtual time
+     * @return virtual microseconds until done held, or UINT32_MAX on timeout
+     */
+    uint32_t runUntil(const std::function<bool()>& done, uint32_t timeoutUs);
+
+    /**
+     * Home axis 0 and wait for the sequence to finish
+     * @param fullSweep Force the left-right sweep
+     * @return homing time in virtual microseconds, or UINT32_MAX on failure
+     */
+    uint32_t home(bool fullSweep);
+
+    /**
+     * Print one benchmark result line: name, value and unit
+     */
+    void report(const char* name, double value, const char* unit);
+
+    /**
+     * Record a failed check (printed now, reflected in exitCode())
+     */
+    void fail(const char* format, ...) __attribute__((format(printf, 1, 2)));
+
+    /**
+     * Process exit code: 0 when no check failed
+     */
+    int exitCode();
+
+} // namespace SimHarness
+
+#endif // SIMHARNESS_H
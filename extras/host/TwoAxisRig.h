@@ -0,0 +1,25 @@
+// ============================================================================
+// File: TwoAxisRig.h
+// Project: SkullStepperV4 - ESP32-S3 Modular Stepper Control System
+// Version: 4.2.0
+// Date: 2026-10-15
+// Author: Tim Rosener
+// Description: Axis table of the 2-axis host build (force-included)
+// License: MIT
+//
+// HardwareConfig.h keeps these when they are predefined. Axis 0 is the
+// sketch's own axis; axis 1 takes free GPIOs, which the rig only uses to
+// tell the axes apart.
+// Row: step, dir, enable, alarm, left limit, right limit
+// ============================================================================
+
+#ifndef TWOAXISRIG_H
+#define TWOAXISRIG_H
+
+#define STEPPER_AXIS_COUNT      2
+#define STEPPER_AXIS_PINS { \
+    { STEPPER_STEP_PIN, STEPPER_DIR_PIN, STEPPER_ENABLE_PIN, STEPPER_ALARM_PIN, LEFT_LIMIT_PIN, RIGHT_LIMIT_PIN }, \
+    { 9, 10, 11, 12, 13, 14 } \
+}
+
+#endif // TWOAXISRIG_H
@@ -0,0 +1,220 @@
+// ============================================================================
+// File: bench_coordinated.cpp
+// Project: SkullStepperV4 - ESP32-S3 Modular Stepper Control System
+// Version: 4.2.0
+// Date: 2026-10-15
+// Author: Tim Rosener
+// Description: Host benchmark - arrival skew of coordinated 2-axis moves
+// License: MIT
+//
+// Runs on the 2-axis build (TwoAxisRig.h). Both axes are homed with
+// startHoming(false, axis), the HOME command that HOME AXIS <n> and
+// {"command":"home","axis":n} queue. Each target pair is driven twice from
+// the same start, trapezoid and S-curve:
+// - Independent: one MOVE_ABSOLUTE per axis, sent together
+// - Coordinated: moveCoordinated(), which the JSON "positions" move calls
+//   with the parsed array (the host ArduinoJson shim parses nothing)
+// and reports the start and arrival skew between the axes plus the largest
+// deviation from the straight line through axis space, in steps of the
+// shorter axis. Coordinated moves must arrive together and stay on the line.
+// Usage: bench_coordinated [-v]
+// ============================================================================
+
+#include "SimHarness.h"
+#include "StepperController.h"
+#include "SystemConfig.h"
+
+static_assert(STEPPER_AXIS_COUNT == 2, "bench_coordinated runs on the 2-axis library");
+
+// Rig geometry per axis (physical carriage steps): left, right, start
+static const int32_t RIGS[STEPPER_AXIS_COUNT][3] = {{0, 6000, 2500}, {0, 4000, 1500}};
+static const int32_t SWITCH_HYSTERESIS = 20;
+
+// Target offsets from the start point (axis 0, axis 1) - all inside the homed
+// ranges, which keep limitSafetyMargin clear of the switches
+static const int32_t OFFSETS[][2] = {{2000, 1500}, {2500, 300}, {-2400, 1200}, {100, -1500}, {1500, 40}};
+
+// Coordinated moves may be a couple of physics steps apart at either end.
+// On the ramp generator each axis may also snap onto its target up to one
+// last half step early, which at the end of the ramp takes sqrt(1 / a)
+static const uint32_t SKEW_LIMIT_US = 4 * SIM_PHYSICS_STEP_US;
+static const float LINE_LIMIT_STEPS = 2.0f;
+
+struct Result {
+    uint32_t startSkewUs;
+    uint32_t arrivalSkewUs;
+    float lineDeviation;  // Steps of the shorter axis
+    bool arrived;
+};
+
+/**
+ * Run until both axes are at rest on their targets, timing each axis
+ */
+static Result measure(const int32_t start[], const int32_t target[]) {
+    Result result = {};
+    StepperSim::Stepper* steppers[STEPPER_AXIS_COUNT] = {StepperSim::getStepper(0), StepperSim::getStepper(1)};
+    uint64_t startUs[STEPPER_AXIS_COUNT] = {0, 0};
+    uint64_t arrivalUs[STEPPER_AXIS_COUNT] = {0, 0};
+    int32_t minorSpan = min(abs(target[0] - start[0]), abs(target[1] - start[1]));
+
+    uint32_t elapsed = SimHarness::runUntil([&] {
+        bool done = true;
+        float progress[STEPPER_AXIS_COUNT];
+        for (uint8_t i = 0; i < STEPPER_AXIS_COUNT; i++) {
+            int32_t position = steppers[i]->getCurrentPosition();
+            if (startUs[i] == 0 && steppers[i]->isRunning()) {
+                startUs[i] = StepperSim::nowUs();
+            }
+            bool atRest = !steppers[i]->isRunning() && position == target[i];
+            if (atRest && arrivalUs[i] == 0) {
+                arrivalUs[i] = StepperSim::nowUs();
+            } else if (!atRest) {
+                arrivalUs[i] = 0;
+                done = false;
+            }
+            progress[i] = (target[i] != start[i]) ? (float)(position - start[i]) / (target[i] - start[i]) : 1.0f;
+        }
+        result.lineDeviation = max(result.lineDeviation, fabsf(progress[0] - progress[1]) * minorSpan);
+        return done;
+    }, 10000000UL);
+
+    result.arrived = (elapsed != UINT32_MAX);
+    result.startSkewUs = (uint32_t)(startUs[0] > startUs[1] ? startUs[0] - startUs[1] : startUs[1] - startUs[0]);
+    result.arrivalSkewUs = (uint32_t)(arrivalUs[0] > arrivalUs[1] ? arrivalUs[0] - arrivalUs[1] : arrivalUs[1] - arrivalUs[0]);
+    return result;
+}
+
+static MotionCommand moveCommand(CommandType type, ProfileShape shape) {
+    MotionCommand cmd = {};
+    cmd.type = type;
+    cmd.profile = SystemConfigMgr::getConfig()->defaultProfile;
+    cmd.profile.shape = shape;
+    cmd.profile.enableLimits = true;
+    cmd.timestamp = millis();
+    return cmd;
+}
+
+static bool moveIndependent(const int32_t target[], ProfileShape shape) {
+    for (uint8_t i = 0; i < STEPPER_AXIS_COUNT; i++) {
+        MotionCommand cmd = moveCommand(CommandType::MOVE_ABSOLUTE, shape);
+        cmd.axis = i;
+        cmd.profile.targetPosition = target[i];
+        if (!StepperController::queueMotionCommand(cmd, pdMS_TO_TICKS(10))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool moveCoordinated(const int32_t target[], ProfileShape shape) {
+    return StepperController::moveCoordinated(target, (1 << STEPPER_AXIS_COUNT) - 1, shape);
+}
+
+/**
+ * Return both axes to the start point (independent moves, not measured)
+ */
+static bool returnTo(const int32_t start[]) {
+    moveIndependent(start, ProfileShape::TRAPEZOIDAL);
+    return SimHarness::runUntil([start] {
+        for (uint8_t i = 0; i < STEPPER_AXIS_COUNT; i++) {
+            StepperSim::Stepper* stepper = StepperSim::getStepper(i);
+            if (stepper->isRunning() || stepper->getCurrentPosition() != start[i]) return false;
+        }
+        return true;
+    }, 10000000UL) != UINT32_MAX;
+}
+
+static void report(const char* shape, const char* mode, int n, const Result& result) {
+    char name[64];
+    snprintf(name, sizeof(name), "%s.%s.pair%d.start_skew", shape, mode, n);
+    SimHarness::report(name, result.startSkewUs / 1000.0, "ms");
+    snprintf(name, sizeof(name), "%s.%s.pair%d.arrival_skew", shape, mode, n);
+    SimHarness::report(name, result.arrivalSkewUs / 1000.0, "ms");
+    snprintf(name, sizeof(name), "%s.%s.pair%d.line_deviation", shape, mode, n);
+    SimHarness::report(name, result.lineDeviation, "steps");
+}
+
+static void benchShape(ProfileShape shape, const char* shapeName, const int32_t start[]) {
+    float accel = SystemConfigMgr::getConfig()->defaultProfile.acceleration;
+    int n = 0;
+    for (const auto& offset : OFFSETS) {
+        int32_t target[STEPPER_AXIS_COUNT] = {start[0] + offset[0], start[1] + offset[1]};
+        float minorAccel = accel * min(abs(offset[0]), abs(offset[1])) / max(abs(offset[0]), abs(offset[1]));
+        uint32_t arrivalLimitUs = SKEW_LIMIT_US + (uint32_t)(1e6f / sqrtf(minorAccel) + 1e6f / sqrtf(accel));
+
+        if (!returnTo(start) || !moveIndependent(target, shape)) {
+            SimHarness::fail("%s pair %d: independent move not accepted", shapeName, n);
+            return;
+        }
+        Result independent = measure(start, target);
+        report(shapeName, "independent", n, independent);
+
+        if (!returnTo(start) || !moveCoordinated(target, shape)) {
+            SimHarness::fail("%s pair %d: coordinated move not accepted", shapeName, n);
+            return;
+        }
+        Result coordinated = measure(start, target);
+        report(shapeName, "coordinated", n, coordinated);
+
+        if (!independent.arrived || !coordinated.arrived) {
+            SimHarness::fail("%s pair %d: did not arrive", shapeName, n);
+        } else if (coordinated.startSkewUs > SKEW_LIMIT_US || coordinated.arrivalSkewUs > arrivalLimitUs) {
+            SimHarness::fail("%s pair %d: coordinated skew %u us start, %u us arrival",
+                             shapeName, n, coordinated.startSkewUs, coordinated.arrivalSkewUs);
+        } else if (coordinated.lineDeviation > LINE_LIMIT_STEPS) {
+            SimHarness::fail("%s pair %d: coordinated move %.1f steps off the line",
+                             shapeName, n, coordinated.lineDeviation);
+        }
+        n++;
+    }
+}
+
+/**
+ * Home one axis through the public homing call the interfaces use
+ */
+static bool homeAxis(uint8_t axis) {
+    if (!StepperController::startHoming(false, axis)) {
+        return false;
+    }
+    return SimHarness::runUntil([axis] {
+        StepperController::AxisStatus status;
+        return StepperController::getAxisStatus(axis, status) && status.homed && !status.homing;
+    }, 120000000UL) != UINT32_MAX;
+}
+
+int main(int argc, char** argv) {
+    bool verbose = (argc > 1 && strcmp(argv[1], "-v") == 0);
+    for (uint8_t i = 0; i < STEPPER_AXIS_COUNT; i++) {
+        StepperSim::configureRig(i, RIGS[i][0], RIGS[i][1], SWITCH_HYSTERESIS, RIGS[i][2]);
+    }
+    if (!SimHarness::boot(verbose)) {
+        return SimHarness::exitCode();
+    }
+    int32_t userLimits0[2] = {0, 0};
+    for (uint8_t i = 0; i < STEPPER_AXIS_COUNT; i++) {
+        if (!homeAxis(i)) {
+            SimHarness::fail("axis %d did not home", i);
+            return SimHarness::exitCode();
+        }
+        if (i == 0) {
+            StepperController::getUserLimits(userLimits0[0], userLimits0[1], 0);
+        }
+    }
+    // Homing the shorter axis 1 leaves axis 0's user limits alone
+    int32_t minPos = 0, maxPos = 0;
+    StepperController::getUserLimits(minPos, maxPos, 0);
+    if (minPos != userLimits0[0] || maxPos != userLimits0[1]) {
+        SimHarness::fail("homing axis 1 moved axis 0 user limits to %d..%d", minPos, maxPos);
+    }
+    // Open each axis' user limits to its homed range
+    for (uint8_t i = 0; i < STEPPER_AXIS_COUNT; i++) {
+        StepperController::getPositionLimits(minPos, maxPos, i);
+        StepperController::setUserLimits(minPos, maxPos, i);
+    }
+
+    // Start in the middle of both ranges so every offset fits
+    const int32_t start[STEPPER_AXIS_COUNT] = {3000, 2000};
+    benchShape(ProfileShape::TRAPEZOIDAL, "trapezoid", start);
+    benchShape(ProfileShape::SCURVE, "scurve", start);
+    return SimHarness::exitCode();
+}
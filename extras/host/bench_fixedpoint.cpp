@@ -0,0 +1,157 @@
+// ============================================================================
+// File: bench_fixedpoint.cpp
+// Project: SkullStepperV4 - ESP32-S3 Modular Stepper Control System
+// Version: 4.2.0
+// Date: 2026-10-15
+// Author: Tim Rosener
+// Description: Host benchmark - FixedPoint control math vs the former floats
+// License: MIT
+//
+// Error, against the exact result rounded to the nearest step:
+// - DMX 16-bit position to target, for every DMX value over several ranges
+// - DMX 8-bit speed scaling (milliHz)
+// - Stream bookkeeping: 1 ms chunks summed in float seconds vs microseconds
+// Cost: ns per conversion on the host CPU for both versions. These do not
+// carry over to the Xtensa core (software float divide, 64-bit multiply);
+// the LoopProfiler zones (PROFILE) give the cycle times on the target.
+// Usage: bench_fixedpoint
+// ============================================================================
+
+#include "SimHarness.h"
+#include "FixedPoint.h"
+#include "HardwareConfig.h"
+#include <chrono>
+
+static const int32_t RANGES[][2] = {{400, 5558}, {0, 6400}, {-100000, 100000}, {0, 2000000}};
+
+// ----------------------------------------------------------------------------
+// Former float conversions (DMXReceiver before the fixed-point refactor)
+// ----------------------------------------------------------------------------
+
+static int32_t floatPosition(int32_t minPos, int32_t maxPos, uint16_t pos16) {
+    float positionPercent = (pos16 / 65535.0f) * 100.0f;
+    int32_t range = maxPos - minPos;
+    return minPos + (int32_t)((range * positionPercent) / 100.0f);
+}
+
+static float floatSpeed(float maxSpeed, uint8_t value) {
+    float speedPercent = (value / 255.0f) * 100.0f;
+    return 10.0f + ((maxSpeed - 10.0f) * speedPercent) / 100.0f;
+}
+
+/**
+ * Exact position for a 16-bit value, rounded to the nearest step
+ */
+static int32_t exactPosition(int32_t minPos, int32_t maxPos, uint16_t pos16) {
+    return minPos + (int32_t)llround((double)((int64_t)maxPos - minPos) * pos16 / 65535.0);
+}
+
+static void benchPositionError() {
+    for (const auto& range : RANGES) {
+        int32_t floatWorst = 0, fixedWorst = 0;
+        uint32_t floatWrong = 0;
+        for (uint32_t value = 0; value <= 0xFFFF; value++) {
+            int32_t exact = exactPosition(range[0], range[1], (uint16_t)value);
+            int32_t floatError = abs(floatPosition(range[0], range[1], (uint16_t)value) - exact);
+            int32_t fixedError = abs(FixedPoint::lerp(range[0], range[1], (uint16_t)value) - exact);
+            floatWorst = max(floatWorst, floatError);
+            fixedWorst = max(fixedWorst, fixedError);
+            floatWrong += (floatError != 0);
+        }
+        char name[64];
+        snprintf(name, sizeof(name), "position.%d_%d.float.max_error", range[0], range[1]);
+        SimHarness::report(name, floatWorst, "steps");
+        snprintf(name, sizeof(name), "position.%d_%d.float.off_target", range[0], range[1]);
+        SimHarness::report(name, floatWrong * 100.0 / 65536, "%");
+        snprintf(name, sizeof(name), "position.%d_%d.fixed.max_error", range[0], range[1]);
+        SimHarness::report(name, fixedWorst, "steps");
+        if (fixedWorst != 0) {
+            SimHarness::fail("lerp over %d..%d is %d steps off", range[0], range[1], fixedWorst);
+        }
+    }
+}
+
+static void benchSpeedError() {
+    const float maxSpeed = DEFAULT_MAX_SPEED;
+    const int32_t floorMilli = 10 * FixedPoint::MILLI_PER_UNIT;
+    double floatWorst = 0.0, fixedWorst = 0.0;
+    for (uint32_t value = 0; value <= 255; value++) {
+        double exact = 10.0 + (maxSpeed - 10.0) * value / 255.0;
+        int32_t fixedMilli = FixedPoint::lerp(floorMilli, FixedPoint::toMilli(maxSpeed),
+                                              FixedPoint::fractionFrom8((uint8_t)value));
+        floatWorst = max(floatWorst, fabs(floatSpeed(maxSpeed, (uint8_t)value) - exact));
+        fixedWorst = max(fixedWorst, fabs(fixedMilli / 1000.0 - exact));
+    }
+    SimHarness::report("speed.float.max_error", floatWorst * 1000.0, "milliHz");
+    SimHarness::report("speed.fixed.max_error", fixedWorst * 1000.0, "milliHz");
+    if (fixedWorst * 1000.0 > 0.5) {
+        SimHarness::fail("speed scaling %.3f milliHz off", fixedWorst * 1000.0);
+    }
+}
+
+static void benchStreamTime() {
+    // One minute of 1 ms chunks (a long cue or follow stream)
+    const uint32_t chunks = 60000;
+    float queuedSeconds = 0.0f;
+    uint32_t queuedMicros = 0;
+    for (uint32_t i = 0; i < chunks; i++) {
+        queuedSeconds += 0.001f;
+        queuedMicros += 1000;
+    }
+    double floatDrift = fabs(queuedSeconds * 1e6 - chunks * 1000.0);
+    SimHarness::report("stream_time.float.drift_60s", floatDrift, "us");
+    SimHarness::report("stream_time.fixed.drift_60s", fabs((double)queuedMicros - chunks * 1000.0), "us");
+    if (queuedMicros != chunks * 1000) {
+        SimHarness::fail("integer stream time drifted");
+    }
+}
+
+/**
+ * Host nanoseconds per call of fn over every 16-bit value, repeated
+ */
+template <class Fn>
+static double nsPerCall(Fn fn) {
+    const int repeats = 200;
+    volatile int64_t sink = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeats; r++) {
+        int64_t sum = 0;
+        for (uint32_t value = 0; value <= 0xFFFF; value++) {
+            sum += fn((uint16_t)(value ^ r));
+        }
+        sink = sink + sum;
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / (repeats * 65536.0);
+}
+
+static void benchCost() {
+    // Range from a volatile so the compiler cannot fold it
+    volatile int32_t minPos = 400, maxPos = 5558;
+    volatile float maxSpeed = DEFAULT_MAX_SPEED;
+    int32_t lo = minPos, hi = maxPos;
+    float speed = maxSpeed;
+    int32_t speedMilli = FixedPoint::toMilli(speed);
+
+    SimHarness::report("cost.position.float", nsPerCall([=](uint16_t v) {
+        return (int64_t)floatPosition(lo, hi, v);
+    }), "ns");
+    SimHarness::report("cost.position.fixed", nsPerCall([=](uint16_t v) {
+        return (int64_t)FixedPoint::lerp(lo, hi, v);
+    }), "ns");
+    SimHarness::report("cost.speed.float", nsPerCall([=](uint16_t v) {
+        return (int64_t)floatSpeed(speed, (uint8_t)v);
+    }), "ns");
+    SimHarness::report("cost.speed.fixed", nsPerCall([=](uint16_t v) {
+        return (int64_t)FixedPoint::lerp(10 * FixedPoint::MILLI_PER_UNIT, speedMilli,
+                                         FixedPoint::fractionFrom8((uint8_t)v));
+    }), "ns");
+}
+
+int main(int argc, char** argv) {
+    benchPositionError();
+    benchSpeedError();
+    benchStreamTime();
+    benchCost();
+    return SimHarness::exitCode();
+}
@@ -0,0 +1,217 @@
+// ============================================================================
+// File: bench_interp.cpp
+// Project: SkullStepperV4 - ESP32-S3 Modular Stepper Control System
+// Version: 4.2.0
+// Date: 2026-10-15
+// Author: Tim Rosener
+// Description: Host benchmark - DMX follow on recorded fades, with and
+//              without the SetpointInterpolator
+// License: MIT
+//
+// Replays console fade curves as DMX follow setpoints through the real follow
+// path (FOLLOW_TARGET, as DMXReceiver sends them) with the frame timing of
+// a real universe: 23-44 ms between frames, a setpoint only when it moved
+// plus one hold frame. Each fade runs with interpolation off and on at
+// several delays; per run:
+// - Tracking error: carriage against the fade itself (no quantization, no
+//   frame timing), RMS and worst, once the motor has caught up with the
+//   start of the fade
+// - Jerk: change of the 10 ms mean acceleration, RMS and worst. The ramp
+//   generator switches between +a, 0 and -a, so the worst case is bounded
+//   by 2a per window in every mode; the RMS shows how often it switches
+// Usage: bench_interp [-v]
+// ============================================================================
+
+#include "SimHarness.h"
+#include "StepperController.h"
+#include "SystemConfig.h"
+
+static const int32_t LEFT_SWITCH = 0;
+static const int32_t RIGHT_SWITCH = 6000;
+static const int32_t SWITCH_HYSTERESIS = 20;
+static const int32_t START_POSITION = 2500;
+
+static const uint32_t FRAME_MIN_MS = 23;
+static const uint32_t FRAME_MAX_MS = 44;
+static const uint32_t TAIL_MS = 600;       // Settling after the fade ends
+static const uint32_t CATCH_UP_MS = 300;   // Spin-up from rest, not counted as error
+static const uint32_t ACCEL_WINDOW_MS = 10;
+
+/**
+ * Console fade: position (steps) over t (s)
+ */
+struct Fade {
+    const char* name;
+    float durationS;
+    bool coarseOnly;  // 8-bit console channel - setpoint moves in DMX steps
+    float (*position)(float t);
+};
+
+static float linearFade(float t) { return 1500.0f + 3000.0f * t / 2.0f; }
+static float easeFade(float t) { return 4500.0f - 3300.0f * (1.0f - cosf((float)M_PI * t / 3.0f)) / 2.0f; }
+static float slowFade(float t) { return 2000.0f + 400.0f * t / 4.0f; }
+static float sineFade(float t) { return 3000.0f + 1200.0f * cosf(2.0f * (float)M_PI * t / 2.5f); }  // Ends at rest
+
+static const Fade FADES[] = {
+    {"linear_2s", 2.0f, false, linearFade},
+    {"ease_3s",   3.0f, false, easeFade},
+    {"slow_8bit", 4.0f, true,  slowFade},
+    {"sine_5s",   5.0f, false, sineFade},
+};
+
+struct Mode {
+    const char* name;
+    bool interpolation;
+    uint32_t delayMs;
+};
+
+static const Mode MODES[] = {
+    {"off",      false, 0},
+    {"delay_0",  true,  0},
+    {"delay_10", true,  DMX_INTERP_DELAY_MS},
+    {"delay_40", true,  40},
+};
+
+struct Result {
+    double rmsError;
+    double maxError;
+    double rmsJerk;
+    double maxJerk;
+};
+
+static uint32_t g_seed;
+
+/**
+ * Next frame gap - deterministic, so every mode sees the same frames
+ */
+static uint32_t frameGapMs() {
+    g_seed = g_seed * 1664525UL + 1013904223UL;
+    return FRAME_MIN_MS + (g_seed >> 16) % (FRAME_MAX_MS - FRAME_MIN_MS + 1);
+}
+
+/**
+ * Setpoint a console sends for the fade at t
+ */
+static int32_t dmxSetpoint(const Fade& fade, float t, int32_t minPos, int32_t maxPos) {
+    float position = fade.position(min(t, fade.durationS));
+    if (fade.coarseOnly) {
+        float step = (maxPos - minPos) / 255.0f;
+        return minPos + (int32_t)lroundf(floorf((position - minPos) / step) * step);
+    }
+    return (int32_t)lroundf(position);
+}
+
+static void sendFollow(int32_t setpoint) {
+    MotionCommand cmd = {};
+    cmd.type = CommandType::FOLLOW_TARGET;
+    cmd.profile = SystemConfigMgr::getConfig()->defaultProfile;
+    cmd.profile.targetPosition = setpoint;
+    cmd.profile.enableLimits = true;
+    cmd.timestamp = millis();
+    StepperController::queueMotionCommand(cmd, pdMS_TO_TICKS(10));
+}
+
+static Result replay(const Fade& fade, const Mode& mode, int32_t minPos, int32_t maxPos) {
+    SystemConfig* config = SystemConfigMgr::getConfig();
+    config->dmxInterpolation = mode.interpolation;
+    config->dmxInterpDelayMs = mode.delayMs;
+
+    // Park on the first setpoint, then let the follow state go stale
+    int32_t first = (int32_t)lroundf(fade.position(0.0f));
+    StepperController::moveTo(first);
+    SimHarness::runUntil([first] {
+        return !StepperController::isMoving() && StepperController::getCurrentPosition() == first;
+    }, 10000000UL);
+    StepperSim::runFor(300000);
+
+    StepperSim::Stepper* stepper = StepperSim::getStepper(0);
+    g_seed = 12345;
+    uint32_t totalMs = (uint32_t)(fade.durationS * 1000.0f) + TAIL_MS;
+    uint32_t nextFrame = 0;
+    int32_t lastSent = INT32_MIN;
+    bool holdSent = false;
+    double errorSum = 0.0, jerkSum = 0.0;
+    Result result = {};
+    uint32_t jerkCount = 0;
+    double windowStartSpeed = stepper->getCurrentSpeedInMilliHz() / 1000.0;
+    double lastAccel = 0.0;
+    bool haveAccel = false;
+
+    for (uint32_t ms = 0; ms < totalMs; ms++) {
+        float t = ms / 1000.0f;
+        if (ms >= nextFrame) {
+            int32_t setpoint = dmxSetpoint(fade, t, minPos, maxPos);
+            if (setpoint != lastSent || !holdSent) {
+                holdSent = (setpoint == lastSent);
+                sendFollow(setpoint);
+                lastSent = setpoint;
+            }
+            nextFrame += frameGapMs();
+        }
+        StepperSim::runFor(1000);
+
+        if (ms >= CATCH_UP_MS) {
+            double error = fabs(stepper->carriagePosition() - fade.position(min(t + 0.001f, fade.durationS)));
+            errorSum += error * error;
+            result.maxError = max(result.maxError, error);
+        }
+
+        if ((ms + 1) % ACCEL_WINDOW_MS == 0) {
+            double speed = stepper->getCurrentSpeedInMilliHz() / 1000.0;
+            double accel = (speed - windowStartSpeed) * 1000.0 / ACCEL_WINDOW_MS;
+            if (haveAccel) {
+                double jerk = fabs(accel - lastAccel) * 1000.0 / ACCEL_WINDOW_MS;
+                jerkSum += jerk * jerk;
+                result.maxJerk = max(result.maxJerk, jerk);
+                jerkCount++;
+            }
+            windowStartSpeed = speed;
+            lastAccel = accel;
+            haveAccel = true;
+        }
+    }
+    result.rmsError = sqrt(errorSum / (totalMs - CATCH_UP_MS));
+    result.rmsJerk = jerkCount ? sqrt(jerkSum / jerkCount) : 0.0;
+    return result;
+}
+
+int main(int argc, char** argv) {
+    bool verbose = (argc > 1 && strcmp(argv[1], "-v") == 0);
+    StepperSim::configureRig(0, LEFT_SWITCH, RIGHT_SWITCH, SWITCH_HYSTERESIS, START_POSITION);
+    if (!SimHarness::boot(verbose)) {
+        return SimHarness::exitCode();
+    }
+    if (SimHarness::home(true) == UINT32_MAX) {
+        SimHarness::fail("homing did not complete");
+        return SimHarness::exitCode();
+    }
+    SystemConfig* config = SystemConfigMgr::getConfig();
+    int32_t minPos = 0, maxPos = 0;
+    StepperController::getPositionLimits(minPos, maxPos);
+    config->minPosition = minPos;
+    config->maxPosition = maxPos;
+
+    for (const Fade& fade : FADES) {
+        Result results[sizeof(MODES) / sizeof(MODES[0])];
+        for (size_t m = 0; m < sizeof(MODES) / sizeof(MODES[0]); m++) {
+            results[m] = replay(fade, MODES[m], minPos, maxPos);
+            char name[64];
+            snprintf(name, sizeof(name), "%s.%s.error_rms", fade.name, MODES[m].name);
+            SimHarness::report(name, results[m].rmsError, "steps");
+            snprintf(name, sizeof(name), "%s.%s.error_max", fade.name, MODES[m].name);
+            SimHarness::report(name, results[m].maxError, "steps");
+            snprintf(name, sizeof(name), "%s.%s.jerk_rms", fade.name, MODES[m].name);
+            SimHarness::report(name, results[m].rmsJerk / 1e6, "Msteps/s3");
+            snprintf(name, sizeof(name), "%s.%s.jerk_max", fade.name, MODES[m].name);
+            SimHarness::report(name, results[m].maxJerk / 1e6, "Msteps/s3");
+
+            // Smooth fades must run smoother between frames; an 8-bit fade is
+            // a staircase of holds, which stop the prediction in both modes
+            if (MODES[m].interpolation && !fade.coarseOnly && results[m].rmsJerk > results[0].rmsJerk) {
+                SimHarness::fail("%s: %s RMS jerk %.0f above %.0f without interpolation",
+                                 fade.name, MODES[m].name, results[m].rmsJerk, results[0].rmsJerk);
+            }
+        }
+    }
+    return SimHarness::exitCode();
+}
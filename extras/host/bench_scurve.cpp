@@ -0,0 +1,136 @@
+// ============================================================================
+// File: bench_scurve.cpp
+// Project: SkullStepperV4 - ESP32-S3 Modular Stepper Control System
+// Version: 4.2.0
+// Date: 2026-10-15
+// Author: Tim Rosener
+// Description: Host benchmark - trapezoid vs jerk-limited S-curve move times
+// License: MIT
+//
+// Moves of several lengths through the real command path, once per profile:
+// - Trapezoid at half the validated acceleration (today's setting on the rig)
+// - Trapezoid at the full acceleration (what the prop cannot take)
+// - S-curve at the full acceleration, for a range of jerk limits
+// Each executed time (standstill to standstill on the rig) is reported next
+// to the planned one and must agree with it.
+// Usage: bench_scurve [-v]
+// ============================================================================
+
+#include "SimHarness.h"
+#include "StepperController.h"
+#include "SystemConfig.h"
+#include "MotionPlanner.h"
+#include "InputValidation.h"
+
+static const int32_t LEFT_SWITCH = 0;
+static const int32_t RIGHT_SWITCH = 6000;
+static const int32_t SWITCH_HYSTERESIS = 20;
+static const int32_t START_POSITION = 2500;
+
+static const int32_t DISTANCES[] = {200, 1000, 3000, 5000};
+
+struct Profile {
+    const char* name;
+    ProfileShape shape;
+    float accel;
+    float jerk;
+};
+
+static const Profile PROFILES[] = {
+    {"trapezoid.half_accel", ProfileShape::TRAPEZOIDAL, ParamLimits::MAX_ACCELERATION / 2, 0.0f},
+    {"trapezoid.full_accel", ProfileShape::TRAPEZOIDAL, ParamLimits::MAX_ACCELERATION, 0.0f},
+    {"scurve.jerk_12500",    ProfileShape::SCURVE,      ParamLimits::MAX_ACCELERATION, 12500.0f},
+    {"scurve.jerk_25000",    ProfileShape::SCURVE,      ParamLimits::MAX_ACCELERATION, 25000.0f},
+    {"scurve.jerk_50000",    ProfileShape::SCURVE,      ParamLimits::MAX_ACCELERATION, ParamLimits::MAX_JERK},
+};
+
+/**
+ * Planned standstill-to-standstill time of a move (us)
+ */
+static double plannedUs(const Profile& profile, int32_t distance, float speed) {
+    if (profile.shape == ProfileShape::SCURVE) {
+        MotionPlanner::SCurveProfile scurve;
+        if (MotionPlanner::planSCurve(0, distance, speed, profile.accel, profile.jerk, scurve)) {
+            return scurve.totalTime * 1e6;
+        }
+    }
+    return MotionPlanner::trapezoidDuration(distance, speed, profile.accel) * 1e6;
+}
+
+/**
+ * Run one move with the profile, as SerialInterface sends MOVE <pos> <shape>
+ * @return executed duration (us), UINT32_MAX if it did not arrive
+ */
+static uint32_t runMove(const Profile& profile, int32_t target) {
+    MotionCommand cmd = {};
+    cmd.type = CommandType::MOVE_ABSOLUTE;
+    cmd.profile = SystemConfigMgr::getConfig()->defaultProfile;
+    cmd.profile.acceleration = profile.accel;
+    cmd.profile.deceleration = profile.accel;
+    cmd.profile.jerk = profile.jerk;
+    cmd.profile.shape = profile.shape;
+    cmd.profile.targetPosition = target;
+    cmd.profile.enableLimits = true;
+    cmd.timestamp = millis();
+    if (!StepperController::queueMotionCommand(cmd, pdMS_TO_TICKS(10))) {
+        return UINT32_MAX;
+    }
+    uint32_t elapsed = SimHarness::runUntil([target] {
+        return !StepperController::isMoving() && StepperController::getCurrentPosition() == target;
+    }, 10000000UL);
+    if (elapsed == UINT32_MAX) {
+        return UINT32_MAX;
+    }
+    StepperSim::MoveStats stats;
+    StepperSim::getMoveStats(0, stats);
+    return stats.lastDurationUs;
+}
+
+static void benchProfile(const Profile& profile, float speed, int32_t minPos, int32_t maxPos) {
+    for (int32_t distance : DISTANCES) {
+        // Start each move from the end of the range it leaves from
+        int32_t start = StepperController::getCurrentPosition();
+        int32_t target = (start + distance <= maxPos) ? start + distance : start - distance;
+        if (target < minPos) {
+            runMove(profile, minPos);
+            target = minPos + distance;
+        }
+        uint32_t executed = runMove(profile, target);
+        if (executed == UINT32_MAX) {
+            SimHarness::fail("%s: move of %d steps did not arrive", profile.name, distance);
+            continue;
+        }
+        double planned = plannedUs(profile, distance, speed);
+        char name[64];
+        snprintf(name, sizeof(name), "%s.%d_steps", profile.name, distance);
+        SimHarness::report(name, executed / 1000.0, "ms");
+        if (fabs(executed - planned) > 0.05 * planned + 4 * SIM_PHYSICS_STEP_US) {
+            SimHarness::fail("%s: %d steps took %u us, planned %.0f us",
+                             profile.name, distance, executed, planned);
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    bool verbose = (argc > 1 && strcmp(argv[1], "-v") == 0);
+    StepperSim::configureRig(0, LEFT_SWITCH, RIGHT_SWITCH, SWITCH_HYSTERESIS, START_POSITION);
+    if (!SimHarness::boot(verbose)) {
+        return SimHarness::exitCode();
+    }
+    if (SimHarness::home(true) == UINT32_MAX) {
+        SimHarness::fail("homing did not complete");
+        return SimHarness::exitCode();
+    }
+    SystemConfig* config = SystemConfigMgr::getConfig();
+    int32_t minPos = 0, maxPos = 0;
+    StepperController::getPositionLimits(minPos, maxPos);
+    config->minPosition = minPos;
+    config->maxPosition = maxPos;
+
+    float speed = config->defaultProfile.maxSpeed;
+    SimHarness::report("profile.max_speed", speed, "steps/s");
+    for (const Profile& profile : PROFILES) {
+        benchProfile(profile, speed, minPos, maxPos);
+    }
+    return SimHarness::exitCode();
+}
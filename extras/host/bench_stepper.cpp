@@ -0,0 +1,199 @@
+// ============================================================================
+// File: bench_stepper.cpp
+// Project: SkullStepperV4 - ESP32-S3 Modular Stepper Control System
+// Version: 4.2.0
+// Date: 2026-10-15
+// Author: Tim Rosener
+// Description: Host benchmark - homing time, move durations, command latency
+// License: MIT
+//
+// Runs the real stepperControllerTask against the StepperSim rig:
+// - Full-sweep homing, then verify homing from the stored calibration
+//   (written by the Core 1 side, flushPendingSaves)
+// - Absolute moves of several lengths, measured standstill to standstill
+//   and checked against the trapezoid time for the configured profile,
+//   also for a move that ends a slow follow
+// - Command latency: moveTo() on the harness side until the motor runs,
+//   issued at varying phases of the idle housekeeping period
+// Usage: bench_stepper [-v]   (-v keeps the modules' serial log)
+// ============================================================================
+
+#include "SimHarness.h"
+#include "StepperController.h"
+#include "SystemConfig.h"
+#include <Preferences.h>
+
+// Rig geometry (physical carriage steps)
+static const int32_t LEFT_SWITCH = 0;
+static const int32_t RIGHT_SWITCH = 6000;
+static const int32_t SWITCH_HYSTERESIS = 20;
+static const int32_t START_POSITION = 2500;
+
+static const int LATENCY_TRIALS = 50;
+
+/**
+ * Standstill-to-standstill time of a trapezoid move (us)
+ */
+static double trapezoidUs(double distance, double speed, double accel) {
+    if (distance >= speed * speed / accel) {
+        return (distance / speed + speed / accel) * 1e6;
+    }
+    return 2.0 * sqrt(distance / accel) * 1e6;
+}
+
+static bool waitForStandstill(int32_t target) {
+    return SimHarness::runUntil([target] {
+        return !StepperController::isMoving() && StepperController::getCurrentPosition() == target;
+    }, 10000000UL) != UINT32_MAX;
+}
+
+static void benchHoming() {
+    uint32_t writesBefore = Preferences::writeCount();
+    uint32_t fullUs = SimHarness::home(true);
+    if (fullUs == UINT32_MAX) {
+        SimHarness::fail("full-sweep homing did not complete");
+        return;
+    }
+    StepperController::HomingTimes times;
+    StepperController::getHomingTimes(times);
+    SimHarness::report("homing.full_sweep", fullUs / 1000.0, "ms");
+    SimHarness::report("homing.full_sweep.find_left", times.findLeft, "ms");
+    SimHarness::report("homing.full_sweep.find_right", times.findRight, "ms");
+    SimHarness::report("homing.full_sweep.move_home", times.moveHome, "ms");
+
+    int32_t leftLimit = 0, rightLimit = 0;
+    StepperController::getDetectedLimits(leftLimit, rightLimit);
+    SimHarness::report("homing.detected_range", rightLimit - leftLimit, "steps");
+    if (abs((rightLimit - leftLimit) - (RIGHT_SWITCH - LEFT_SWITCH)) > 4 * SWITCH_HYSTERESIS) {
+        SimHarness::fail("detected range %d steps, rig switches are %d apart",
+                         rightLimit - leftLimit, RIGHT_SWITCH - LEFT_SWITCH);
+    }
+
+    // The calibration reaches flash from the Core 1 side only
+    if (Preferences::writeCount() == writesBefore) {
+        SimHarness::fail("homing calibration was not stored");
+    }
+
+    // Verify homing: left switch only, range from the stored calibration
+    SystemConfigMgr::getConfig()->verifyHoming = true;
+    uint32_t verifyUs = SimHarness::home(false);
+    SystemConfigMgr::getConfig()->verifyHoming = false;
+    StepperController::getHomingTimes(times);
+    if (verifyUs == UINT32_MAX || !times.verified) {
+        SimHarness::fail("verify homing did not use the stored calibration");
+        return;
+    }
+    SimHarness::report("homing.verify", verifyUs / 1000.0, "ms");
+}
+
+static void benchMoves() {
+    SystemConfig* config = SystemConfigMgr::getConfig();
+    double speed = config->defaultProfile.maxSpeed;
+    double accel = config->defaultProfile.acceleration;
+    static const int32_t DISTANCES[] = {50, 200, 1000, 3000};
+
+    // Open the user limits (default 0 to 2 revolutions) to the homed range
+    int32_t minPos = 0, maxPos = 0;
+    StepperController::getPositionLimits(minPos, maxPos);
+    config->minPosition = minPos;
+    config->maxPosition = maxPos;
+
+    for (int32_t distance : DISTANCES) {
+        int32_t start = StepperController::getCurrentPosition();
+        int32_t target = (start + distance <= maxPos) ? start + distance : start - distance;
+        StepperController::moveTo(target);
+        if (!waitForStandstill(target)) {
+            SimHarness::fail("move of %d steps did not arrive", distance);
+            continue;
+        }
+        StepperSim::MoveStats stats;
+        StepperSim::getMoveStats(0, stats);
+        double expectedUs = trapezoidUs(distance, speed, accel);
+        char name[48];
+        snprintf(name, sizeof(name), "move.%d_steps", distance);
+        SimHarness::report(name, stats.lastDurationUs / 1000.0, "ms");
+        // Ramp model integrates in SIM_PHYSICS_STEP_US steps
+        if (fabs(stats.lastDurationUs - expectedUs) > 0.05 * expectedUs + 2 * SIM_PHYSICS_STEP_US) {
+            SimHarness::fail("move of %d steps took %u us, trapezoid time %.0f us",
+                             distance, stats.lastDurationUs, expectedUs);
+        }
+    }
+
+    // Relative move after an absolute one starts from where the last one ended
+    int32_t start = StepperController::getCurrentPosition();
+    int32_t offset = (start > 1000) ? -300 : 300;
+    StepperController::move(offset);
+    if (!waitForStandstill(start + offset)) {
+        SimHarness::fail("relative move ended at %d, expected %d",
+                         StepperController::getCurrentPosition(), start + offset);
+    }
+
+    // A move that ends a slow follow runs at the profile speed again - follow
+    // steers the ramp speed down to the setpoint rate
+    start = StepperController::getCurrentPosition();
+    int32_t direction = (start + 2000 <= maxPos) ? 1 : -1;
+    for (int32_t frame = 0; frame < 25; frame++) {
+        MotionCommand follow = {};
+        follow.type = CommandType::FOLLOW_TARGET;
+        follow.profile = config->defaultProfile;
+        follow.profile.targetPosition = start + direction * frame;
+        follow.profile.enableLimits = true;
+        follow.timestamp = millis();
+        StepperController::queueMotionCommand(follow, pdMS_TO_TICKS(10));
+        StepperSim::runFor(20000);
+    }
+    int32_t target = start + direction * 2000;
+    double expectedUs = trapezoidUs(abs(target - StepperController::getCurrentPosition()), speed, accel);
+    StepperController::moveTo(target);
+    uint32_t elapsed = SimHarness::runUntil([target] {
+        return !StepperController::isMoving() && StepperController::getCurrentPosition() == target;
+    }, 10000000UL);
+    SimHarness::report("move.after_follow", elapsed / 1000.0, "ms");
+    if (elapsed == UINT32_MAX || elapsed > 1.1 * expectedUs) {
+        SimHarness::fail("move after follow took %u us, trapezoid time %.0f us", elapsed, expectedUs);
+    }
+}
+
+static void benchCommandLatency() {
+    StepperSim::Stepper* stepper = StepperSim::getStepper(0);
+    uint32_t total = 0, worst = 0;
+    int32_t minPos = 0, maxPos = 0;
+    StepperController::getPositionLimits(minPos, maxPos);
+
+    for (int trial = 0; trial < LATENCY_TRIALS; trial++) {
+        // Land the command at a different phase of the 20 ms idle period each time
+        StepperSim::runFor(STEPPER_TASK_IDLE_MS * 1000 + (trial * 1370) % (STEPPER_TASK_IDLE_MS * 1000));
+        int32_t start = StepperController::getCurrentPosition();
+        int32_t target = (start + 500 <= maxPos) ? start + 500 : start - 500;
+        StepperController::moveTo(target);
+        uint32_t latency = SimHarness::runUntil([stepper] { return stepper->isRunning(); }, 100000);
+        if (latency == UINT32_MAX) {
+            SimHarness::fail("move %d never started", trial);
+            return;
+        }
+        total += latency;
+        worst = max(worst, latency);
+        waitForStandstill(target);
+    }
+    SimHarness::report("command_latency.mean", total / (double)LATENCY_TRIALS, "us");
+    SimHarness::report("command_latency.max", worst, "us");
+    // Commands wake the task - they must not wait for the housekeeping period
+    if (worst >= STEPPER_TASK_IDLE_MS * 1000 / 4) {
+        SimHarness::fail("command latency %u us - the task is polling, not woken", worst);
+    }
+}
+
+int main(int argc, char** argv) {
+    bool verbose = (argc > 1 && strcmp(argv[1], "-v") == 0);
+    StepperSim::configureRig(0, LEFT_SWITCH, RIGHT_SWITCH, SWITCH_HYSTERESIS, START_POSITION);
+    if (!SimHarness::boot(verbose)) {
+        return SimHarness::exitCode();
+    }
+
+    benchHoming();
+    if (StepperController::isHomed()) {
+        benchMoves();
+        benchCommandLatency();
+    }
+    return SimHarness::exitCode();
+}
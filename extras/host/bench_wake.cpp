@@ -0,0 +1,176 @@
+// ============================================================================
+// File: bench_wake.cpp
+// Project: SkullStepperV4 - ESP32-S3 Modular Stepper Control System
+// Version: 4.2.0
+// Date: 2026-10-15
+// Author: Tim Rosener
+// Description: Host benchmark - event-driven wakeups of stepperControllerTask
+// License: MIT
+//
+// Compares the notification wake model with the former fixed 2 ms poll:
+// - Task passes per second idle and while moving (LoopProfiler cycle count)
+// - Command latency: moveTo() until the motor runs, over many phases
+// - ALARM latency: driver ALARM edge until isAlarmActive()
+// - Limit latency: switch edge until forceStop() (includes the glitch filter)
+// Latencies resolve to one SIM_PHYSICS_STEP_US; the polling figures are the
+// analytic ones for a 2 ms period (mean = period / 2, worst = period).
+// Usage: bench_wake [-v]
+// ============================================================================
+
+#include "SimHarness.h"
+#include "StepperController.h"
+#include "SystemConfig.h"
+#include "LoopProfiler.h"
+#include "HardwareConfig.h"
+
+static const int32_t LEFT_SWITCH = 0;
+static const int32_t RIGHT_SWITCH = 6000;
+static const int32_t SWITCH_HYSTERESIS = 20;
+static const int32_t START_POSITION = 2500;
+
+static const uint32_t POLL_PERIOD_US = 2000;  // Former vTaskDelayUntil period
+static const int LATENCY_TRIALS = 200;
+
+/**
+ * Task passes per second over us of virtual time
+ */
+static double passRate(uint32_t us) {
+    LoopProfiler::reset();
+    StepperSim::runFor(STEPPER_TASK_IDLE_MS * 1000);  // Reset is applied on the next wake
+    LoopProfiler::reset();
+    StepperSim::runFor(STEPPER_TASK_IDLE_MS * 1000);
+    LoopProfiler::Stats before;
+    if (!LoopProfiler::getZoneStats(LoopProfiler::Zone::CYCLE, before)) {
+        before.count = 0;
+    }
+    StepperSim::runFor(us);
+    LoopProfiler::Stats after;
+    if (!LoopProfiler::getZoneStats(LoopProfiler::Zone::CYCLE, after)) {
+        return 0.0;
+    }
+    return (after.count - before.count) * 1e6 / us;
+}
+
+static void benchPassRate() {
+    double idle = passRate(2000000);
+    SimHarness::report("passes_per_s.idle", idle, "1/s");
+    SimHarness::report("passes_per_s.idle.polling", 1e6 / POLL_PERIOD_US, "1/s");
+    // Idle housekeeping only - nothing else may wake the task
+    if (idle > 1.1 * 1000.0 / STEPPER_TASK_IDLE_MS) {
+        SimHarness::fail("idle task runs %.1f passes/s, housekeeping is %d/s",
+                         idle, 1000 / STEPPER_TASK_IDLE_MS);
+    }
+
+    int32_t minPos = 0, maxPos = 0;
+    StepperController::getPositionLimits(minPos, maxPos);
+    int32_t target = (StepperController::getCurrentPosition() > (minPos + maxPos) / 2) ? minPos : maxPos;
+    StepperController::moveTo(target);
+    SimHarness::runUntil([] { return StepperController::isMoving(); }, 100000);
+    double moving = passRate(200000);
+    SimHarness::report("passes_per_s.moving", moving, "1/s");
+    SimHarness::runUntil([target] {
+        return !StepperController::isMoving() && StepperController::getCurrentPosition() == target;
+    }, 10000000UL);
+}
+
+static void benchCommandLatency() {
+    StepperSim::Stepper* stepper = StepperSim::getStepper(0);
+    int32_t minPos = 0, maxPos = 0;
+    StepperController::getPositionLimits(minPos, maxPos);
+    uint32_t total = 0, worst = 0;
+
+    for (int trial = 0; trial < LATENCY_TRIALS; trial++) {
+        // Spread the commands over the whole idle housekeeping period
+        StepperSim::runFor(STEPPER_TASK_IDLE_MS * 1000 + (trial * 730) % (STEPPER_TASK_IDLE_MS * 1000));
+        int32_t start = StepperController::getCurrentPosition();
+        int32_t target = (start + 100 <= maxPos) ? start + 100 : start - 100;
+        StepperController::moveTo(target);
+        uint32_t latency = SimHarness::runUntil([stepper] { return stepper->isRunning(); }, 100000);
+        if (latency == UINT32_MAX) {
+            SimHarness::fail("command %d never started", trial);
+            return;
+        }
+        total += latency;
+        worst = max(worst, latency);
+        SimHarness::runUntil([stepper] { return !stepper->isRunning(); }, 1000000);
+    }
+    SimHarness::report("command_latency.mean", total / (double)LATENCY_TRIALS, "us");
+    SimHarness::report("command_latency.max", worst, "us");
+    SimHarness::report("command_latency.polling.mean", POLL_PERIOD_US / 2, "us");
+    SimHarness::report("command_latency.polling.max", POLL_PERIOD_US, "us");
+    if (worst >= POLL_PERIOD_US / 4) {
+        SimHarness::fail("command latency %u us - not woken by the queue send", worst);
+    }
+}
+
+static void benchAlarmLatency() {
+    uint32_t total = 0, worst = 0;
+    for (int trial = 0; trial < 20; trial++) {
+        StepperSim::runFor(STEPPER_TASK_IDLE_MS * 1000 + (trial * 1730) % (STEPPER_TASK_IDLE_MS * 1000));
+        StepperSim::setAlarm(0, true);
+        uint32_t latency = SimHarness::runUntil([] { return StepperController::isAlarmActive(); }, 100000);
+        StepperSim::setAlarm(0, false);
+        SimHarness::runUntil([] { return !StepperController::isAlarmActive(); }, 100000);
+        if (latency == UINT32_MAX) {
+            SimHarness::fail("ALARM edge %d never seen", trial);
+            return;
+        }
+        total += latency;
+        worst = max(worst, latency);
+    }
+    SimHarness::report("alarm_latency.mean", total / 20.0, "us");
+    SimHarness::report("alarm_latency.max", worst, "us");
+    if (worst >= POLL_PERIOD_US / 4) {
+        SimHarness::fail("ALARM latency %u us - not woken by the edge", worst);
+    }
+}
+
+static void benchLimitLatency() {
+    // Pull the switch ahead into the operating range and drive into it
+    StepperSim::Stepper* stepper = StepperSim::getStepper(0);
+    int32_t carriage = stepper->carriagePosition();
+    int32_t minPos = 0, maxPos = 0;
+    StepperController::getPositionLimits(minPos, maxPos);
+    int32_t position = StepperController::getCurrentPosition();
+    if (maxPos - position > position - minPos) {
+        StepperSim::configureRig(0, LEFT_SWITCH, carriage + 300, SWITCH_HYSTERESIS, carriage);
+        StepperController::moveTo(maxPos);
+    } else {
+        StepperSim::configureRig(0, carriage - 300, RIGHT_SWITCH, SWITCH_HYSTERESIS, carriage);
+        StepperController::moveTo(minPos);
+    }
+    if (SimHarness::runUntil([] { return StepperController::isLimitFaultActive(); }, 2000000) == UINT32_MAX) {
+        SimHarness::fail("limit stop never happened");
+        return;
+    }
+    StepperController::LimitStopStats stats;
+    StepperController::getLimitStopStats(stats);
+    uint32_t filterUs = (stats.filterSamples - 1) * LIMIT_FILTER_SAMPLE_US;
+    SimHarness::report("limit_latency.edge_to_stop", stats.lastLatencyUs, "us");
+    SimHarness::report("limit_latency.glitch_filter", filterUs, "us");
+    SimHarness::report("limit_latency.overrun", stats.lastOverrun, "steps");
+    if (stats.lastLatencyUs >= filterUs + POLL_PERIOD_US / 4) {
+        SimHarness::fail("limit stop %u us after the edge, filter window is %u us",
+                         stats.lastLatencyUs, filterUs);
+    }
+}
+
+int main(int argc, char** argv) {
+    bool verbose = (argc > 1 && strcmp(argv[1], "-v") == 0);
+    StepperSim::configureRig(0, LEFT_SWITCH, RIGHT_SWITCH, SWITCH_HYSTERESIS, START_POSITION);
+    if (!SimHarness::boot(verbose)) {
+        return SimHarness::exitCode();
+    }
+    if (SimHarness::home(true) == UINT32_MAX) {
+        SimHarness::fail("homing did not complete");
+        return SimHarness::exitCode();
+    }
+    SystemConfig* config = SystemConfigMgr::getConfig();
+    StepperController::getPositionLimits(config->minPosition, config->maxPosition);
+
+    benchPassRate();
+    benchCommandLatency();
+    benchAlarmLatency();
+    benchLimitLatency();  // Last - leaves a latched limit fault
+    return SimHarness::exitCode();
+}
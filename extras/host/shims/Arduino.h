@@ -0,0 +1,162 @@
+// ============================================================================
+// File: Arduino.h (host shim)
+// Project: SkullStepperV4 - ESP32-S3 Modular Stepper Control System
+// Version: 4.2.0
+// Date: 2026-10-15
+// Author: Tim Rosener
+// Description: The subset of the Arduino-ESP32 core the Core 0 modules use
+// License: MIT
+//
+// millis()/micros() read the StepperSim virtual clock, Serial writes to
+// stdout (Serial.mute() silences it for benchmark output) and
+// ESP.getCycleCount() counts 240 MHz cycles of the host's steady clock, so
+// LoopProfiler histograms show host CPU time.
+// ============================================================================
+
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <string>
+#include "freertos/FreeRTOS.h"
+#include "esp_attr.h"
+
+#define HIGH            1
+#define LOW             0
+#define INPUT           0x01
+#define OUTPUT          0x03
+#define INPUT_PULLUP    0x05
+#define CHANGE          0x03
+#define RISING          0x01
+#define FALLING         0x02
+#define DEC             10
+#define HEX             16
+#define PI              3.1415926535897932384626433832795
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+using std::min;
+using std::max;
+
+template <class T, class L, class H>
+inline T constrain(T value, L low, H high) {
+    return value < (T)low ? (T)low : (value > (T)high ? (T)high : value);
+}
+
+// ----------------------------------------------------------------------------
+// String
+// ----------------------------------------------------------------------------
+
+class String {
+public:
+    String() {}
+    String(const char* text) : m_text(text ? text : "") {}
+    String(const std::string& text) : m_text(text) {}
+    String(char c) : m_text(1, c) {}
+    String(int value) : m_text(std::to_string(value)) {}
+    String(unsigned value) : m_text(std::to_string(value)) {}
+    String(long value) : m_text(std::to_string(value)) {}
+    String(unsigned long value) : m_text(std::to_string(value)) {}
+    String(double value, int decimals = 2) {
+        char buffer[32];
+        snprintf(buffer, sizeof(buffer), "%.*f", decimals, value);
+        m_text = buffer;
+    }
+
+    const char* c_str() const { return m_text.c_str(); }
+    size_t length() const { return m_text.length(); }
+    bool isEmpty() const { return m_text.empty(); }
+    String& operator+=(const String& other) { m_text += other.m_text; return *this; }
+    String operator+(const String& other) const { return String(m_text + other.m_text); }
+    friend String operator+(const char* left, const String& right) { return String(left) + right; }
+    bool operator==(const String& other) const { return m_text == other.m_text; }
+    bool operator!=(const String& other) const { return m_text != other.m_text; }
+
+private:
+    std::string m_text;
+};
+
+// ----------------------------------------------------------------------------
+// Serial
+// ----------------------------------------------------------------------------
+
+class HardwareSerial {
+public:
+    void begin(unsigned long baud) {}
+    operator bool() const { return true; }
+    int available() { return 0; }
+    int read() { return -1; }
+    void flush() { fflush(stdout); }
+
+    size_t print(const char* text) { return emit("%s", text); }
+    size_t print(const String& text) { return emit("%s", text.c_str()); }
+    size_t print(char c) { return emit("%c", c); }
+    size_t print(int value, int base = DEC) { return emit(base == HEX ? "%x" : "%d", value); }
+    size_t print(unsigned value, int base = DEC) { return emit(base == HEX ? "%x" : "%u", value); }
+    size_t print(long value, int base = DEC) { return emit(base == HEX ? "%lx" : "%ld", value); }
+    size_t print(unsigned long value, int base = DEC) { return emit(base == HEX ? "%lx" : "%lu", value); }
+    size_t print(double value, int decimals = 2) { return emit("%.*f", decimals, value); }
+
+    size_t println() { return emit("\n"); }
+    template <class T>
+    size_t println(T value) { return print(value) + println(); }
+    template <class T>
+    size_t println(T value, int format) { return print(value, format) + println(); }
+
+    size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+
+    /**
+     * Host only: drop all output (benchmarks print their own report)
+     */
+    void mute(bool muted) { m_muted = muted; }
+
+private:
+    size_t emit(const char* format, ...) __attribute__((format(printf, 2, 3)));
+    bool m_muted = false;
+};
+
+extern HardwareSerial Serial;
+
+// ----------------------------------------------------------------------------
+// Time and GPIO
+// ----------------------------------------------------------------------------
+
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+
+void pinMode(uint8_t pin, uint8_t mode);
+int digitalRead(uint8_t pin);
+void digitalWrite(uint8_t pin, uint8_t value);
+
+long random(long max);
+long random(long min, long max);
+
+// ----------------------------------------------------------------------------
+// ESP
+// ----------------------------------------------------------------------------
+
+class EspClass {
+public:
+    uint32_t getCpuFreqMHz() { return 240; }
+    uint32_t getCycleCount();
+    uint32_t getFreeHeap() { return 256 * 1024; }
+    uint32_t getHeapSize() { return 320 * 1024; }
+    uint32_t getMinFreeHeap() { return 200 * 1024; }
+    void restart() { exit(0); }
+};
+
+extern EspClass ESP;
+
+uint32_t esp_get_free_heap_size();
+uint32_t esp_get_minimum_free_heap_size();
+
+#endif // HOST_ARDUINO_H
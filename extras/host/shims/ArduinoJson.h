@@ -0,0 +1,122 @@
+// ============================================================================
+// File: ArduinoJson.h (host shim)
+// Project: SkullStepperV4 - ESP32-S3 Modular Stepper Control System
+// Version: 4.2.0
+// Date: 2026-10-15
+// Author: Tim Rosener
+// Description: Inert stand-in for ArduinoJson v6 (host harness)
+// License: MIT
+//
+// The Core 0 modules only build JSON for the serial/web reports, which the
+// harness never calls. This keeps those functions compiling without the
+// library: every document is empty, every read returns the default and
+// every write is dropped.
+// ============================================================================
+
+#ifndef HOST_ARDUINOJSON_H
+#define HOST_ARDUINOJSON_H
+
+#include <Arduino.h>
+
+namespace ArduinoJson {
+
+class JsonArray;
+class JsonObject;
+
+struct DeserializationError {
+    enum Code { Ok, InvalidInput };
+    explicit operator bool() const { return true; }  // Nothing parses on the host
+    bool operator==(Code code) const { return code == InvalidInput; }
+    bool operator!=(Code code) const { return code != InvalidInput; }
+    const char* c_str() const { return "InvalidInput"; }
+};
+
+class JsonVariant {
+public:
+    template <class K> JsonVariant operator[](K) const { return JsonVariant(); }
+    template <class T> T as() const { return T(); }
+    template <class T> bool is() const { return false; }
+    template <class T> operator T() const { return T(); }
+    template <class T> JsonVariant& operator=(const T&) { return *this; }
+    template <class T> bool set(const T&) { return false; }
+    template <class T> bool add(const T&) { return false; }
+    JsonVariant add() { return JsonVariant(); }
+    template <class K> bool containsKey(K) const { return false; }
+    template <class K> JsonObject createNestedObject(K) const;
+    JsonObject createNestedObject() const;
+    template <class K> JsonArray createNestedArray(K) const;
+    JsonArray createNestedArray() const;
+    template <class T> JsonArray to();
+    template <class K> void remove(K) {}
+    bool isNull() const { return true; }
+    size_t size() const { return 0; }
+    template <class T> bool operator==(const T&) const { return false; }
+    template <class T> bool operator!=(const T&) const { return true; }
+    template <class T> T operator|(const T& fallback) const { return fallback; }
+    const char* operator|(const char* fallback) const { return fallback; }
+    JsonVariant* begin() const { return nullptr; }
+    JsonVariant* end() const { return nullptr; }
+    JsonVariant key() const { return *this; }
+    JsonVariant value() const { return *this; }
+    const char* c_str() const { return ""; }
+};
+
+class JsonObject : public JsonVariant {
+public:
+    using JsonVariant::operator=;
+};
+
+class JsonArray : public JsonVariant {
+public:
+    using JsonVariant::operator=;
+};
+
+template <class K> JsonObject JsonVariant::createNestedObject(K) const { return JsonObject(); }
+inline JsonObject JsonVariant::createNestedObject() const { return JsonObject(); }
+template <class K> JsonArray JsonVariant::createNestedArray(K) const { return JsonArray(); }
+inline JsonArray JsonVariant::createNestedArray() const { return JsonArray(); }
+template <class T> JsonArray JsonVariant::to() { return JsonArray(); }
+
+typedef JsonVariant JsonVariantConst;
+typedef JsonObject JsonObjectConst;
+typedef JsonArray JsonArrayConst;
+typedef JsonVariant JsonPair;
+
+class JsonDocument : public JsonVariant {
+public:
+    using JsonVariant::operator=;
+    void clear() {}
+    size_t memoryUsage() const { return 0; }
+    size_t capacity() const { return 0; }
+    bool overflowed() const { return false; }
+    template <class T> T as() const { return T(); }
+    template <class T> T to() { return T(); }
+};
+
+template <size_t N>
+class StaticJsonDocument : public JsonDocument {
+public:
+    using JsonVariant::operator=;
+};
+
+class DynamicJsonDocument : public JsonDocument {
+public:
+    explicit DynamicJsonDocument(size_t capacity) {}
+    using JsonVariant::operator=;
+};
+
+template <class S> DeserializationError deserializeJson(JsonDocument&, const S&) { return DeserializationError(); }
+template <class S> DeserializationError deserializeJson(JsonDocument&, S*, size_t) { return DeserializationError(); }
+template <class S> size_t serializeJson(const JsonVariant&, S&) { return 0; }
+inline size_t serializeJson(const JsonVariant&, char* buffer, size_t size) {
+    if (size > 0) buffer[0] = '\0';
+    return 0;
+}
+template <class S> size_t serializeJsonPretty(const JsonVariant&, S&) { return 0; }
+inline size_t measureJson(const JsonVariant&) { return 0; }
+
+} // namespace ArduinoJson
+
+using namespace ArduinoJson;
+
+#endif // HOST_ARDUINOJSON_H
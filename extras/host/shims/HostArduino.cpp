@@ -0,0 +1,178 @@
+// ============================================================================
+// File: HostArduino.cpp (host shim)
+// Project: SkullStepperV4 - ESP32-S3 Modular Stepper Control System
+// Version: 4.2.0
+// Date: 2026-10-15
+// Author: Tim Rosener
+// Description: Arduino core, ESP-IDF and Preferences functions for the host
+// License: MIT
+// ============================================================================
+
+#include <Arduino.h>
+#include <Preferences.h>
+#include <esp_timer.h>
+#include <freertos/task.h>
+#include "StepperSim.h"
+#include <chrono>
+#include <stdarg.h>
+
+// ----------------------------------------------------------------------------
+// Serial
+// ----------------------------------------------------------------------------
+
+HardwareSerial Serial;
+
+size_t HardwareSerial::emit(const char* format, ...) {
+    if (m_muted) return 0;
+    va_list args;
+    va_start(args, format);
+    int written = vprintf(format, args);
+    va_end(args);
+    return written > 0 ? (size_t)written : 0;
+}
+
+size_t HardwareSerial::printf(const char* format, ...) {
+    if (m_muted) return 0;
+    va_list args;
+    va_start(args, format);
+    int written = vprintf(format, args);
+    va_end(args);
+    return written > 0 ? (size_t)written : 0;
+}
+
+// ----------------------------------------------------------------------------
+// Time and GPIO
+// ----------------------------------------------------------------------------
+
+uint32_t millis() {
+    return StepperSim::millis();
+}
+
+uint32_t micros() {
+    return StepperSim::micros();
+}
+
+void delay(uint32_t ms) {
+    vTaskDelay(pdMS_TO_TICKS(ms));
+}
+
+void delayMicroseconds(uint32_t us) {
+    StepperSim::advance(us);  // Busy-wait: time passes, nothing else runs
+}
+
+int64_t esp_timer_get_time() {
+    return (int64_t)StepperSim::nowUs();
+}
+
+void pinMode(uint8_t pin, uint8_t mode) {}
+
+int digitalRead(uint8_t pin) {
+    return StepperSim::readPin(pin);
+}
+
+void digitalWrite(uint8_t pin, uint8_t value) {}
+
+long random(long max) {
+    return max > 0 ? ::random() % max : 0;
+}
+
+long random(long min, long max) {
+    return max > min ? min + ::random() % (max - min) : min;
+}
+
+// ----------------------------------------------------------------------------
+// ESP
+// ----------------------------------------------------------------------------
+
+EspClass ESP;
+
+uint32_t EspClass::getCycleCount() {
+    // Host CPU time in 240 MHz cycles - profiles show real work, not virtual time
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+    int64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+    return (uint32_t)(ns * 240 / 1000);
+}
+
+uint32_t esp_get_free_heap_size() {
+    return ESP.getFreeHeap();
+}
+
+uint32_t esp_get_minimum_free_heap_size() {
+    return ESP.getMinFreeHeap();
+}
+
+// ----------------------------------------------------------------------------
+// Preferences
+// ----------------------------------------------------------------------------
+
+static uint32_t g_preferenceWrites = 0;
+
+std::map<std::string, std::vector<uint8_t>>* Preferences::entries() {
+    static auto* store = new std::map<std::string, std::map<std::string, std::vector<uint8_t>>>();
+    return m_name.empty() ? nullptr : &(*store)[m_name];
+}
+
+bool Preferences::begin(const char* name, bool readOnly) {
+    if (!name || !name[0] || strlen(name) > 15) return false;  // NVS namespace limit
+    m_name = name;
+    m_readOnly = readOnly;
+    return true;
+}
+
+bool Preferences::clear() {
+    auto* store = entries();
+    if (!store || m_readOnly) return false;
+    store->clear();
+    g_preferenceWrites++;
+    return true;
+}
+
+bool Preferences::remove(const char* key) {
+    auto* store = entries();
+    if (!store || m_readOnly) return false;
+    g_preferenceWrites++;
+    return store->erase(key) > 0;
+}
+
+bool Preferences::isKey(const char* key) {
+    auto* store = entries();
+    return store && store->count(key) > 0;
+}
+
+size_t Preferences::putBytes(const char* key, const void* value, size_t length) {
+    auto* store = entries();
+    if (!store || m_readOnly) return 0;
+    const uint8_t* bytes = (const uint8_t*)value;
+    (*store)[key].assign(bytes, bytes + length);
+    g_preferenceWrites++;
+    return length;
+}
+
+size_t Preferences::getBytes(const char* key, void* buffer, size_t maxLength) {
+    auto* store = entries();
+    if (!store) return 0;
+    auto entry = store->find(key);
+    if (entry == store->end() || entry->second.size() > maxLength) return 0;
+    memcpy(buffer, entry->second.data(), entry->second.size());
+    return entry->second.size();
+}
+
+size_t Preferences::getBytesLength(const char* key) {
+    auto* store = entries();
+    if (!store) return 0;
+    auto entry = store->find(key);
+    return entry == store->end() ? 0 : entry->second.size();
+}
+
+String Preferences::getString(const char* key, const String& defaultValue) {
+    size_t length = getBytesLength(key);
+    if (length == 0) return defaultValue;
+    std::vector<char> text(length);
+    getBytes(key, text.data(), length);
+    text.back() = '\0';
+    return String(text.data());
+}
+
+uint32_t Preferences::writeCount() {
+    return g_preferenceWrites;
+}
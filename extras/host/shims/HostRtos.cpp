@@ -0,0 +1,357 @@
+// ============================================================================
+// File: HostRtos.cpp (host shim)
+// Project: SkullStepperV4 - ESP32-S3 Modular Stepper Control System
+// Version: 4.2.0
+// Date: 2026-10-15
+// Author: Tim Rosener
+// Description: Host FreeRTOS port - lockstep scheduler on the virtual clock
+// License: MIT
+//
+// Each task is a std::thread that only runs while it holds the turn. The
+// harness thread hands the turn to a task in vHostRunReadyTasks() and gets
+// it back when the task blocks (xTaskNotifyWait, vTaskDelay). Everything
+// else - queues, mutexes, notifications - is plain data, because no two
+// threads ever run at once. Timeouts are in virtual time (StepperSim).
+// ============================================================================
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include "StepperSim.h"
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <string.h>
+
+// ----------------------------------------------------------------------------
+// Scheduler
+// ----------------------------------------------------------------------------
+
+struct HostTask {
+    TaskFunction_t function;
+    void* parameter;
+    const char* name;
+    BaseType_t core;
+    std::condition_variable resume;
+    bool started = false;
+    bool finished = false;
+    bool waitingNotify = false;    // Blocked in xTaskNotifyWait (a notification wakes it)
+    uint64_t wakeUs = UINT64_MAX;  // End of the current wait
+    uint64_t lastPass = 0;         // Scheduler pass that last resumed it on a timeout
+    uint32_t notifyValue = 0;
+    bool notifyPending = false;
+};
+
+struct Scheduler {
+    std::mutex lock;
+    std::condition_variable harness;  // Signalled when the turn returns to the harness
+    HostTask* running = nullptr;      // Task holding the turn, nullptr = harness
+    std::vector<HostTask*> tasks;
+    uint64_t pass = 0;
+};
+
+// Leaked on purpose - task threads are still blocked in it at exit
+static Scheduler& scheduler() {
+    static Scheduler* instance = new Scheduler();
+    return *instance;
+}
+
+static thread_local HostTask* t_self = nullptr;
+
+/**
+ * Task side: give the turn back to the harness and sleep until resumed
+ */
+static void blockTask(Scheduler& s, std::unique_lock<std::mutex>& guard, HostTask* task) {
+    s.running = nullptr;
+    s.harness.notify_one();
+    task->resume.wait(guard, [&] { return s.running == task; });
+}
+
+static void taskEntry(HostTask* task) {
+    Scheduler& s = scheduler();
+    {
+        std::unique_lock<std::mutex> guard(s.lock);
+        task->resume.wait(guard, [&] { return s.running == task; });
+    }
+    t_self = task;
+    task->function(task->parameter);
+
+    // A FreeRTOS task must not return - treat it like vTaskDelete(NULL)
+    vTaskDelete(nullptr);
+}
+
+static bool isReady(const Scheduler& s, const HostTask* task, uint64_t nowUs) {
+    if (task->finished) return false;
+    if (!task->started) return true;
+    if (task->waitingNotify && task->notifyPending) return true;
+    return task->wakeUs <= nowUs && task->lastPass != s.pass;
+}
+
+void vHostRunReadyTasks() {
+    Scheduler& s = scheduler();
+    std::unique_lock<std::mutex> guard(s.lock);
+    uint64_t nowUs = StepperSim::nowUs();
+    s.pass++;
+
+    // Notifications can chain (a task waking another), timeouts run once per pass
+    bool ran = true;
+    while (ran) {
+        ran = false;
+        for (HostTask* task : s.tasks) {
+            if (!isReady(s, task, nowUs)) continue;
+            if (task->started && task->wakeUs <= nowUs) {
+                task->lastPass = s.pass;
+            }
+            task->started = true;
+            s.running = task;
+            task->resume.notify_one();
+            s.harness.wait(guard, [&] { return s.running == nullptr; });
+            ran = true;
+        }
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Tasks
+// ----------------------------------------------------------------------------
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char* name, uint32_t stackDepth,
+                                   void* parameter, UBaseType_t priority, TaskHandle_t* handle,
+                                   BaseType_t core) {
+    HostTask* task = new HostTask();
+    task->function = function;
+    task->parameter = parameter;
+    task->name = name;
+    task->core = core;
+    {
+        std::lock_guard<std::mutex> guard(scheduler().lock);
+        scheduler().tasks.push_back(task);
+    }
+    std::thread(taskEntry, task).detach();
+    if (handle) *handle = task;
+    return pdPASS;  // Starts at the next vHostRunReadyTasks()
+}
+
+BaseType_t xTaskCreate(TaskFunction_t function, const char* name, uint32_t stackDepth,
+                       void* parameter, UBaseType_t priority, TaskHandle_t* handle) {
+    return xTaskCreatePinnedToCore(function, name, stackDepth, parameter, priority, handle, 1);
+}
+
+void vTaskDelete(TaskHandle_t handle) {
+    HostTask* task = handle ? (HostTask*)handle : t_self;
+    if (!task) return;
+    Scheduler& s = scheduler();
+    std::unique_lock<std::mutex> guard(s.lock);
+    task->finished = true;
+    if (task == t_self) {
+        blockTask(s, guard, task);  // Never resumed
+    }
+}
+
+void vTaskDelay(TickType_t ticks) {
+    HostTask* self = t_self;
+    if (!self) {
+        StepperSim::runFor(ticks * 1000UL);  // Harness: let the rig and the tasks run
+        return;
+    }
+    Scheduler& s = scheduler();
+    std::unique_lock<std::mutex> guard(s.lock);
+    self->waitingNotify = false;
+    self->wakeUs = StepperSim::nowUs() + (uint64_t)ticks * 1000;
+    blockTask(s, guard, self);
+    self->wakeUs = UINT64_MAX;
+}
+
+TickType_t xTaskGetTickCount() {
+    return (TickType_t)(StepperSim::nowUs() / 1000);
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle() {
+    return t_self;
+}
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task) {
+    return 1024;  // Host threads have no FreeRTOS stack to measure
+}
+
+BaseType_t xPortGetCoreID() {
+    return t_self ? t_self->core : 1;  // The harness stands in for the Arduino loop on Core 1
+}
+
+// ----------------------------------------------------------------------------
+// Task Notifications
+// ----------------------------------------------------------------------------
+
+BaseType_t xTaskNotify(TaskHandle_t handle, uint32_t value, eNotifyAction action) {
+    HostTask* task = (HostTask*)handle;
+    if (!task) return pdFAIL;
+    std::lock_guard<std::mutex> guard(scheduler().lock);
+    switch (action) {
+        case eSetBits:
+            task->notifyValue |= value;
+            break;
+        case eIncrement:
+            task->notifyValue++;
+            break;
+        case eSetValueWithOverwrite:
+            task->notifyValue = value;
+            break;
+        case eSetValueWithoutOverwrite:
+            if (task->notifyPending) return pdFAIL;
+            task->notifyValue = value;
+            break;
+        case eNoAction:
+            break;
+    }
+    task->notifyPending = true;
+    return pdPASS;
+}
+
+BaseType_t xTaskNotifyFromISR(TaskHandle_t handle, uint32_t value, eNotifyAction action,
+                              BaseType_t* higherPriorityTaskWoken) {
+    if (higherPriorityTaskWoken) *higherPriorityTaskWoken = pdFALSE;
+    return xTaskNotify(handle, value, action);
+}
+
+BaseType_t xTaskNotifyWait(uint32_t clearOnEntry, uint32_t clearOnExit, uint32_t* value,
+                           TickType_t timeout) {
+    HostTask* self = t_self;
+    if (!self) return pdFALSE;  // The harness has no notification slot
+    Scheduler& s = scheduler();
+    std::unique_lock<std::mutex> guard(s.lock);
+    if (!self->notifyPending) {
+        self->notifyValue &= ~clearOnEntry;
+        if (timeout > 0) {
+            self->waitingNotify = true;
+            self->wakeUs = (timeout == portMAX_DELAY) ? UINT64_MAX
+                                                      : StepperSim::nowUs() + (uint64_t)timeout * 1000;
+            blockTask(s, guard, self);
+            self->waitingNotify = false;
+            self->wakeUs = UINT64_MAX;
+        }
+    }
+    if (value) *value = self->notifyValue;
+    if (!self->notifyPending) return pdFALSE;
+    self->notifyValue &= ~clearOnExit;
+    self->notifyPending = false;
+    return pdTRUE;
+}
+
+// ----------------------------------------------------------------------------
+// Queues
+// ----------------------------------------------------------------------------
+
+struct HostQueue {
+    UBaseType_t length;
+    UBaseType_t itemSize;
+    std::deque<std::vector<uint8_t>> items;
+};
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize) {
+    HostQueue* queue = new HostQueue();
+    queue->length = length;
+    queue->itemSize = itemSize;
+    return queue;
+}
+
+void vQueueDelete(QueueHandle_t handle) {
+    delete (HostQueue*)handle;
+}
+
+BaseType_t xQueueSend(QueueHandle_t handle, const void* item, TickType_t timeout) {
+    HostQueue* queue = (HostQueue*)handle;
+    if (!queue || queue->items.size() >= queue->length) return errQUEUE_FULL;
+    const uint8_t* bytes = (const uint8_t*)item;
+    queue->items.emplace_back(bytes, bytes + queue->itemSize);
+    return pdTRUE;
+}
+
+BaseType_t xQueueSendToBack(QueueHandle_t handle, const void* item, TickType_t timeout) {
+    return xQueueSend(handle, item, timeout);
+}
+
+BaseType_t xQueueSendFromISR(QueueHandle_t handle, const void* item, BaseType_t* woken) {
+    if (woken) *woken = pdFALSE;
+    return xQueueSend(handle, item, 0);
+}
+
+BaseType_t xQueueOverwrite(QueueHandle_t handle, const void* item) {
+    HostQueue* queue = (HostQueue*)handle;
+    if (!queue) return pdFAIL;
+    queue->items.clear();
+    return xQueueSend(handle, item, 0);
+}
+
+BaseType_t xQueueReceive(QueueHandle_t handle, void* item, TickType_t timeout) {
+    HostQueue* queue = (HostQueue*)handle;
+    if (!queue || queue->items.empty()) return pdFALSE;
+    memcpy(item, queue->items.front().data(), queue->itemSize);
+    queue->items.pop_front();
+    return pdTRUE;
+}
+
+BaseType_t xQueuePeek(QueueHandle_t handle, void* item, TickType_t timeout) {
+    HostQueue* queue = (HostQueue*)handle;
+    if (!queue || queue->items.empty()) return pdFALSE;
+    memcpy(item, queue->items.front().data(), queue->itemSize);
+    return pdTRUE;
+}
+
+BaseType_t xQueueReset(QueueHandle_t handle) {
+    HostQueue* queue = (HostQueue*)handle;
+    if (queue) queue->items.clear();
+    return pdPASS;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t handle) {
+    HostQueue* queue = (HostQueue*)handle;
+    return queue ? (UBaseType_t)queue->items.size() : 0;
+}
+
+UBaseType_t uxQueueSpacesAvailable(QueueHandle_t handle) {
+    HostQueue* queue = (HostQueue*)handle;
+    return queue ? queue->length - (UBaseType_t)queue->items.size() : 0;
+}
+
+// ----------------------------------------------------------------------------
+// Mutexes and Semaphores
+// ----------------------------------------------------------------------------
+
+struct HostSemaphore {
+    UBaseType_t count;
+    UBaseType_t max;
+};
+
+SemaphoreHandle_t xSemaphoreCreateMutex() {
+    return new HostSemaphore{1, 1};
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary() {
+    return new HostSemaphore{0, 1};
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t handle) {
+    delete (HostSemaphore*)handle;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t handle, TickType_t timeout) {
+    HostSemaphore* semaphore = (HostSemaphore*)handle;
+    if (!semaphore || semaphore->count == 0) return pdFALSE;
+    semaphore->count--;
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t handle) {
+    HostSemaphore* semaphore = (HostSemaphore*)handle;
+    if (!semaphore || semaphore->count >= semaphore->max) return pdFALSE;
+    semaphore->count++;
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t handle, BaseType_t* woken) {
+    if (woken) *woken = pdFALSE;
+    return xSemaphoreGive(handle);
+}
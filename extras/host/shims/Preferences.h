@@ -0,0 +1,68 @@
+// ============================================================================
+// File: Preferences.h (host shim)
+// Project: SkullStepperV4 - ESP32-S3 Modular Stepper Control System
+// Version: 4.2.0
+// Date: 2026-10-15
+// Author: Tim Rosener
+// Description: In-memory NVS for the host harness
+// License: MIT
+//
+// Namespaces and keys behave like NVS for the life of the process, so a
+// second homing run sees the calibration the first one stored. writeCount()
+// counts committed puts (what would have been flash writes).
+// ============================================================================
+
+#ifndef HOST_PREFERENCES_H
+#define HOST_PREFERENCES_H
+
+#include <Arduino.h>
+#include <map>
+#include <string>
+#include <vector>
+
+class Preferences {
+public:
+    bool begin(const char* name, bool readOnly = false);
+    void end() { m_name.clear(); }
+    bool clear();
+    bool remove(const char* key);
+    bool isKey(const char* key);
+
+    size_t putBytes(const char* key, const void* value, size_t length);
+    size_t getBytes(const char* key, void* buffer, size_t maxLength);
+    size_t getBytesLength(const char* key);
+
+    size_t putString(const char* key, const char* value) { return putBytes(key, value, strlen(value) + 1); }
+    String getString(const char* key, const String& defaultValue = String());
+
+#define HOST_PREFERENCES_TYPE(T, Name) \
+    size_t put##Name(const char* key, T value) { return putBytes(key, &value, sizeof(value)); } \
+    T get##Name(const char* key, T defaultValue = T()) { \
+        T value; \
+        return getBytes(key, &value, sizeof(value)) == sizeof(value) ? value : defaultValue; \
+    }
+    HOST_PREFERENCES_TYPE(int8_t, Char)
+    HOST_PREFERENCES_TYPE(uint8_t, UChar)
+    HOST_PREFERENCES_TYPE(int16_t, Short)
+    HOST_PREFERENCES_TYPE(uint16_t, UShort)
+    HOST_PREFERENCES_TYPE(int32_t, Int)
+    HOST_PREFERENCES_TYPE(uint32_t, UInt)
+    HOST_PREFERENCES_TYPE(int64_t, Long64)
+    HOST_PREFERENCES_TYPE(uint64_t, ULong64)
+    HOST_PREFERENCES_TYPE(float, Float)
+    HOST_PREFERENCES_TYPE(double, Double)
+    HOST_PREFERENCES_TYPE(bool, Bool)
+#undef HOST_PREFERENCES_TYPE
+
+    /**
+     * Host only: puts committed since the process started (all namespaces)
+     */
+    static uint32_t writeCount();
+
+private:
+    std::map<std::string, std::vector<uint8_t>>* entries();
+    std::string m_name;
+    bool m_readOnly = false;
+};
+
+#endif // HOST_PREFERENCES_H
@@ -0,0 +1,18 @@
+// ============================================================================
+// File: esp_attr.h (host shim)
+// Project: SkullStepperV4 - ESP32-S3 Modular Stepper Control System
+// Version: 4.2.0
+// Date: 2026-10-15
+// Author: Tim Rosener
+// Description: ESP-IDF placement attributes (no-ops on the host)
+// License: MIT
+// ============================================================================
+
+#ifndef HOST_ESP_ATTR_H
+#define HOST_ESP_ATTR_H
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define FORCE_INLINE_ATTR static inline __attribute__((always_inline))
+
+#endif // HOST_ESP_ATTR_H
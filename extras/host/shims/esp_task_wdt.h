@@ -0,0 +1,23 @@
+// ============================================================================
+// File: esp_task_wdt.h (host shim)
+// Project: SkullStepperV4 - ESP32-S3 Modular Stepper Control System
+// Version: 4.2.0
+// Date: 2026-10-15
+// Author: Tim Rosener
+// Description: Task watchdog (no-ops on the host)
+// License: MIT
+// ============================================================================
+
+#ifndef HOST_ESP_TASK_WDT_H
+#define HOST_ESP_TASK_WDT_H
+
+typedef int esp_err_t;
+#ifndef ESP_OK
+#define ESP_OK 0
+#endif
+
+inline esp_err_t esp_task_wdt_add(void* task) { return ESP_OK; }
+inline esp_err_t esp_task_wdt_delete(void* task) { return ESP_OK; }
+inline esp_err_t esp_task_wdt_reset() { return ESP_OK; }
+
+#endif // HOST_ESP_TASK_WDT_H
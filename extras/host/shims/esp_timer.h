@@ -0,0 +1,21 @@
+// ============================================================================
+// File: esp_timer.h (host shim)
+// Project: SkullStepperV4 - ESP32-S3 Modular Stepper Control System
+// Version: 4.2.0
+// Date: 2026-10-15
+// Author: Tim Rosener
+// Description: High-resolution timer clock (StepperSim virtual time)
+// License: MIT
+//
+// Only the clock - the one-shot timers of the target StepperHal backend are
+// StepperSim timers on the host.
+// ============================================================================
+
+#ifndef HOST_ESP_TIMER_H
+#define HOST_ESP_TIMER_H
+
+#include <stdint.h>
+
+int64_t esp_timer_get_time();
+
+#endif // HOST_ESP_TIMER_H
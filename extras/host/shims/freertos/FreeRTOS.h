@@ -0,0 +1,53 @@
+// ============================================================================
+// File: freertos/FreeRTOS.h (host shim)
+// Project: SkullStepperV4 - ESP32-S3 Modular Stepper Control System
+// Version: 4.2.0
+// Date: 2026-10-15
+// Author: Tim Rosener
+// Description: Host FreeRTOS port - types and macros
+// License: MIT
+//
+// The host port is a lockstep scheduler on the StepperSim virtual clock:
+// every task is a thread, but only one thread (a task or the harness) runs
+// at a time and tasks switch only where they block (task notification wait,
+// vTaskDelay). Critical sections, mutexes and queues therefore never
+// contend; a take or send that would have to block fails instead.
+// One tick is one millisecond, as in the sketch build.
+// ============================================================================
+
+#ifndef HOST_FREERTOS_H
+#define HOST_FREERTOS_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef void* TaskHandle_t;
+typedef void* QueueHandle_t;
+typedef void* SemaphoreHandle_t;
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned UBaseType_t;
+
+#define pdTRUE                 1
+#define pdFALSE                0
+#define pdPASS                 1
+#define pdFAIL                 0
+#define errQUEUE_FULL          0
+#define portMAX_DELAY          0xFFFFFFFFu
+#define configTICK_RATE_HZ     1000
+#define portTICK_PERIOD_MS     1
+#define pdMS_TO_TICKS(ms)      ((TickType_t)(ms))
+#define tskIDLE_PRIORITY       0
+#define configMAX_PRIORITIES   25
+
+// Only one thread runs at a time - nothing to lock or yield
+typedef struct { int unused; } portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED  {0}
+#define portENTER_CRITICAL(mux)       do { (void)(mux); } while (0)
+#define portEXIT_CRITICAL(mux)        do { (void)(mux); } while (0)
+#define portENTER_CRITICAL_ISR(mux)   do { (void)(mux); } while (0)
+#define portEXIT_CRITICAL_ISR(mux)    do { (void)(mux); } while (0)
+#define portYIELD_FROM_ISR(woken)     do { (void)(woken); } while (0)
+#define taskYIELD()                   do { } while (0)
+
+#endif // HOST_FREERTOS_H
@@ -0,0 +1,466 @@
+// ============================================================================
+// File: test_network_dmx.cpp
+// Project: SkullStepperV4 - ESP32-S3 Modular Stepper Control System
+// Version: 4.2.0
+// Date: 2026-10-15
+// Author: Tim Rosener
+// Description: Host test - Art-Net / sACN parsing and source arbitration
+// License: MIT
+//
+// Sends ArtDmx and E1.31 datagrams over UDP loopback (senders bound to
+// separate 127.0.0.x addresses) and runs what arrives through the module:
+// - Full-size packets: 530-byte ArtDmx and 638-byte E1.31 parse with all
+//   512 slots; every shorter length of either is MALFORMED
+// - ArtPoll, sACN preview and sync packets are OTHER
+// - sequenceAccepted() over all sequence pairs, SEQUENCE_WINDOW (-20) edge
+// - Arbitration by sender address: highest priority wins, equal priority
+//   keeps the active source, timeout and stream termination hand over,
+//   out-of-order drops, table full and reuse of a silent entry
+// Built without the rig or the receive task: the parsers and the source
+// table are pure computation, the time is passed in.
+// Usage: test_network_dmx
+// ============================================================================
+
+#include "NetworkDMX.h"
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <vector>
+
+using namespace NetworkDMX;
+
+static const uint16_t UNIVERSE = 7;
+
+static int g_failures = 0;
+
+static void fail(const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    printf("FAIL: ");
+    vprintf(format, args);
+    printf("\n");
+    va_end(args);
+    g_failures++;
+}
+
+// ----------------------------------------------------------------------------
+// Packet builders
+// ----------------------------------------------------------------------------
+
+/**
+ * ArtDmx (Art-Net 4) with slot i = (i + seed) & 0xFF
+ */
+static std::vector<uint8_t> artDmx(uint16_t universe, uint8_t sequence, uint16_t slots, uint8_t seed = 0) {
+    std::vector<uint8_t> p(18 + slots, 0);
+    memcpy(p.data(), "Art-Net", 8);
+    p[8] = 0x00;                   // OpDmx 0x5000, little-endian
+    p[9] = 0x50;
+    p[11] = 14;                    // ProtVer
+    p[12] = sequence;
+    p[14] = universe & 0xFF;       // SubUni
+    p[15] = (universe >> 8) & 0x7F;  // Net
+    p[16] = slots >> 8;
+    p[17] = slots & 0xFF;
+    for (uint16_t i = 0; i < slots; i++) {
+        p[18 + i] = (uint8_t)(i + seed);
+    }
+    return p;
+}
+
+static std::vector<uint8_t> artPoll() {
+    std::vector<uint8_t> p(14, 0);
+    memcpy(p.data(), "Art-Net", 8);
+    p[9] = 0x20;                   // OpPoll 0x2000
+    p[11] = 14;
+    return p;
+}
+
+static void put16(std::vector<uint8_t>& p, size_t at, uint16_t v) {
+    p[at] = v >> 8;
+    p[at + 1] = v & 0xFF;
+}
+
+static void put32(std::vector<uint8_t>& p, size_t at, uint32_t v) {
+    put16(p, at, v >> 16);
+    put16(p, at + 2, v & 0xFFFF);
+}
+
+/**
+ * E1.31 data packet from the component cidByte (all 16 CID bytes)
+ */
+static std::vector<uint8_t> e131(uint8_t cidByte, uint16_t universe, uint8_t sequence, uint8_t priority,
+                                 uint16_t slots, uint8_t options = 0, uint8_t seed = 0) {
+    std::vector<uint8_t> p(126 + slots, 0);
+    // Root layer
+    put16(p, 0, 0x0010);
+    memcpy(p.data() + 4, "ASC-E1.17\0\0\0", 12);
+    put16(p, 16, 0x7000 | (uint16_t)(p.size() - 16));
+    put32(p, 18, 0x00000004);
+    memset(p.data() + 22, cidByte, 16);
+    // Framing layer
+    put16(p, 38, 0x7000 | (uint16_t)(p.size() - 38));
+    put32(p, 40, 0x00000002);
+    memcpy(p.data() + 44, "test console", 12);
+    p[108] = priority;
+    p[111] = sequence;
+    p[112] = options;
+    put16(p, 113, universe);
+    // DMP layer
+    put16(p, 115, 0x7000 | (uint16_t)(p.size() - 115));
+    p[117] = 0x02;
+    p[118] = 0xa1;
+    put16(p, 119, 0);
+    put16(p, 121, 1);
+    put16(p, 123, slots + 1);
+    p[125] = 0;                    // Start code
+    for (uint16_t i = 0; i < slots; i++) {
+        p[126 + i] = (uint8_t)(i + seed);
+    }
+    return p;
+}
+
+static std::vector<uint8_t> e131Sync(uint8_t cidByte) {
+    std::vector<uint8_t> p(49, 0);
+    put16(p, 0, 0x0010);
+    memcpy(p.data() + 4, "ASC-E1.17\0\0\0", 12);
+    put32(p, 18, 0x00000008);
+    memset(p.data() + 22, cidByte, 16);
+    return p;
+}
+
+// ----------------------------------------------------------------------------
+// Loopback sockets
+// ----------------------------------------------------------------------------
+
+static int openUdp(const char* address, uint16_t port) {
+    int sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (sock < 0) return -1;
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    inet_pton(AF_INET, address, &addr.sin_addr);
+    if (bind(sock, (struct sockaddr*)&addr, sizeof(addr)) < 0) {
+        close(sock);
+        return -1;
+    }
+    return sock;
+}
+
+struct Loopback {
+    int receiver;
+    struct sockaddr_in to;
+    int senders[4];                // 127.0.0.2 .. 127.0.0.5
+    uint8_t buffer[MAX_PACKET_SIZE];
+};
+
+static bool openLoopback(Loopback& lo) {
+    lo.receiver = openUdp("127.0.0.1", 0);
+    socklen_t length = sizeof(lo.to);
+    if (lo.receiver < 0 || getsockname(lo.receiver, (struct sockaddr*)&lo.to, &length) < 0) {
+        return false;
+    }
+    for (int i = 0; i < 4; i++) {
+        char address[16];
+        snprintf(address, sizeof(address), "127.0.0.%d", i + 2);
+        lo.senders[i] = openUdp(address, 0);
+        if (lo.senders[i] < 0) return false;
+    }
+    return true;
+}
+
+/**
+ * Send from one sender and receive it as the task does
+ * @return received length (-1 on timeout), from = sender address
+ */
+static int transfer(Loopback& lo, int sender, const std::vector<uint8_t>& packet, uint32_t& from) {
+    if (sendto(lo.senders[sender], packet.data(), packet.size(), 0, (struct sockaddr*)&lo.to, sizeof(lo.to)) < 0) {
+        return -1;
+    }
+    struct pollfd fd = { lo.receiver, POLLIN, 0 };
+    if (poll(&fd, 1, 1000) != 1) return -1;
+    struct sockaddr_in source;
+    socklen_t length = sizeof(source);
+    int received = recvfrom(lo.receiver, lo.buffer, sizeof(lo.buffer), 0, (struct sockaddr*)&source, &length);
+    from = source.sin_addr.s_addr;
+    return received;
+}
+
+// ----------------------------------------------------------------------------
+// Tests
+// ----------------------------------------------------------------------------
+
+static void checkSlots(const Packet& packet, uint8_t seed, const char* name) {
+    for (uint16_t i = 0; i < packet.slots; i++) {
+        if (packet.data[i] != (uint8_t)(i + seed)) {
+            fail("%s: slot %u is %u", name, i + 1, packet.data[i]);
+            return;
+        }
+    }
+}
+
+static void testFullPackets(Loopback& lo) {
+    uint32_t from = 0;
+    Packet packet;
+
+    std::vector<uint8_t> art = artDmx(UNIVERSE, 42, DMX_UNIVERSE_SIZE, 3);
+    int length = transfer(lo, 0, art, from);
+    if (length != 530) {
+        fail("ArtDmx: %d bytes received, expected 530", length);
+    } else if (parseArtDmx(lo.buffer, length, packet) != ParseResult::UNIVERSE_DATA) {
+        fail("ArtDmx: 530 bytes not parsed");
+    } else {
+        if (packet.protocol != Protocol::ARTNET || packet.universe != UNIVERSE || packet.sequence != 42 ||
+            packet.slots != DMX_UNIVERSE_SIZE || packet.priority != ARTNET_PRIORITY || packet.cid != nullptr) {
+            fail("ArtDmx: fields universe %u sequence %u slots %u", packet.universe, packet.sequence, packet.slots);
+        }
+        checkSlots(packet, 3, "ArtDmx");
+        if (from != inet_addr("127.0.0.2")) fail("ArtDmx: sender address %08x", from);
+    }
+
+    std::vector<uint8_t> sacn = e131(0xA5, UNIVERSE, 9, 150, DMX_UNIVERSE_SIZE, 0, 7);
+    length = transfer(lo, 1, sacn, from);
+    if (length != 638) {
+        fail("E1.31: %d bytes received, expected 638", length);
+    } else if (parseE131(lo.buffer, length, packet) != ParseResult::UNIVERSE_DATA) {
+        fail("E1.31: 638 bytes not parsed");
+    } else {
+        if (packet.protocol != Protocol::SACN || packet.universe != UNIVERSE || packet.sequence != 9 ||
+            packet.slots != DMX_UNIVERSE_SIZE || packet.priority != 150 || packet.terminated ||
+            packet.cid != lo.buffer + 22 || packet.cid[15] != 0xA5) {
+            fail("E1.31: fields universe %u sequence %u slots %u", packet.universe, packet.sequence, packet.slots);
+        }
+        checkSlots(packet, 7, "E1.31");
+    }
+}
+
+static void testShortPackets(Loopback& lo) {
+    std::vector<uint8_t> art = artDmx(UNIVERSE, 1, DMX_UNIVERSE_SIZE);
+    std::vector<uint8_t> sacn = e131(1, UNIVERSE, 1, 100, DMX_UNIVERSE_SIZE);
+    Packet packet;
+
+    // Every truncation, parsed in place
+    for (size_t length = 0; length < art.size(); length++) {
+        if (parseArtDmx(art.data(), length, packet) != ParseResult::MALFORMED) {
+            fail("ArtDmx: %zu of %zu bytes not MALFORMED", length, art.size());
+            break;
+        }
+    }
+    for (size_t length = 0; length < sacn.size(); length++) {
+        if (parseE131(sacn.data(), length, packet) != ParseResult::MALFORMED) {
+            fail("E1.31: %zu of %zu bytes not MALFORMED", length, sacn.size());
+            break;
+        }
+    }
+
+    // A few through the socket (the header, the header plus a slot short)
+    uint32_t from;
+    for (size_t length : {(size_t)17, (size_t)529}) {
+        std::vector<uint8_t> cut(art.begin(), art.begin() + length);
+        int received = transfer(lo, 0, cut, from);
+        if (received != (int)length || parseArtDmx(lo.buffer, received, packet) != ParseResult::MALFORMED) {
+            fail("ArtDmx: %zu-byte datagram not MALFORMED", length);
+        }
+    }
+    for (size_t length : {(size_t)125, (size_t)637}) {
+        std::vector<uint8_t> cut(sacn.begin(), sacn.begin() + length);
+        int received = transfer(lo, 1, cut, from);
+        if (received != (int)length || parseE131(lo.buffer, received, packet) != ParseResult::MALFORMED) {
+            fail("E1.31: %zu-byte datagram not MALFORMED", length);
+        }
+    }
+
+    // Short universes are fine when the length field agrees
+    std::vector<uint8_t> shortArt = artDmx(UNIVERSE, 1, 24);
+    if (parseArtDmx(shortArt.data(), shortArt.size(), packet) != ParseResult::UNIVERSE_DATA || packet.slots != 24) {
+        fail("ArtDmx: 24-slot packet not parsed");
+    }
+    std::vector<uint8_t> shortSacn = e131(1, UNIVERSE, 1, 100, 24);
+    if (parseE131(shortSacn.data(), shortSacn.size(), packet) != ParseResult::UNIVERSE_DATA || packet.slots != 24) {
+        fail("E1.31: 24-slot packet not parsed");
+    }
+}
+
+static void testOtherPackets() {
+    Packet packet;
+    std::vector<uint8_t> poll = artPoll();
+    if (parseArtDmx(poll.data(), poll.size(), packet) != ParseResult::OTHER) fail("ArtPoll not OTHER");
+    std::vector<uint8_t> preview = e131(1, UNIVERSE, 1, 100, 512, 0x80);
+    if (parseE131(preview.data(), preview.size(), packet) != ParseResult::OTHER) fail("E1.31 preview not OTHER");
+    std::vector<uint8_t> sync = e131Sync(1);
+    if (parseE131(sync.data(), sync.size(), packet) != ParseResult::OTHER) fail("E1.31 sync not OTHER");
+    std::vector<uint8_t> art = artDmx(UNIVERSE, 1, 512);
+    if (parseE131(art.data(), art.size(), packet) != ParseResult::MALFORMED) fail("ArtDmx parsed as E1.31");
+    std::vector<uint8_t> sacn = e131(1, UNIVERSE, 1, 100, 512);
+    if (parseArtDmx(sacn.data(), sacn.size(), packet) != ParseResult::MALFORMED) fail("E1.31 parsed as ArtDmx");
+    std::vector<uint8_t> badPriority = e131(1, UNIVERSE, 1, 201, 512);
+    if (parseE131(badPriority.data(), badPriority.size(), packet) != ParseResult::MALFORMED) {
+        fail("E1.31 priority 201 not MALFORMED");
+    }
+}
+
+static void testSequenceWindow() {
+    for (int last = 0; last < 256; last++) {
+        for (int step = -128; step < 128; step++) {
+            bool expected = step > 0 || step <= -SEQUENCE_WINDOW;
+            if (sequenceAccepted((uint8_t)last, (uint8_t)(last + step)) != expected) {
+                fail("sequence %d after %d: %s", (uint8_t)(last + step), last, expected ? "dropped" : "accepted");
+                return;
+            }
+        }
+    }
+    // The edges spelled out
+    if (sequenceAccepted(100, 100)) fail("repeated sequence accepted");
+    if (!sequenceAccepted(100, 101)) fail("next sequence dropped");
+    if (sequenceAccepted(100, 81)) fail("19 behind accepted");
+    if (!sequenceAccepted(100, 80)) fail("20 behind (restart) dropped");
+    if (!sequenceAccepted(255, 0)) fail("wrap 255 -> 0 dropped");
+    if (sequenceAccepted(5, 250)) fail("11 behind across the wrap accepted");
+}
+
+/**
+ * Receive a packet over loopback and arbitrate it at nowMs
+ */
+static Arbitration deliver(Loopback& lo, SourceTable& table, Stats& stats, int sender,
+                           const std::vector<uint8_t>& datagram, uint32_t nowMs) {
+    uint32_t from = 0;
+    int length = transfer(lo, sender, datagram, from);
+    Packet packet;
+    ParseResult result = (length > 0 && datagram[0] == 'A') ? parseArtDmx(lo.buffer, length, packet)
+                                                              : parseE131(lo.buffer, length, packet);
+    if (length <= 0 || result != ParseResult::UNIVERSE_DATA) {
+        fail("sender %d: packet lost or not parsed", sender);
+        return Arbitration::TABLE_FULL;
+    }
+    return arbitrate(table, packet, from, nowMs, stats);
+}
+
+static const char* arbitrationName(Arbitration a) {
+    switch (a) {
+        case Arbitration::FORWARD:      return "FORWARD";
+        case Arbitration::STANDBY:      return "STANDBY";
+        case Arbitration::OUT_OF_ORDER: return "OUT_OF_ORDER";
+        case Arbitration::TERMINATED:   return "TERMINATED";
+        default:                        return "TABLE_FULL";
+    }
+}
+
+static void expect(Arbitration got, Arbitration expected, const char* step) {
+    if (got != expected) {
+        fail("%s: %s, expected %s", step, arbitrationName(got), arbitrationName(expected));
+    }
+}
+
+static void testArbitration(Loopback& lo) {
+    SourceTable table;
+    Stats stats = {};
+    clearSources(table);
+    uint32_t t = 1000;
+
+    // Art-Net A takes the idle output; B at the same priority waits
+    expect(deliver(lo, table, stats, 0, artDmx(UNIVERSE, 1, 512), t), Arbitration::FORWARD, "Art-Net A first");
+    expect(deliver(lo, table, stats, 1, artDmx(UNIVERSE, 1, 512), t += 25), Arbitration::STANDBY, "Art-Net B equal");
+    expect(deliver(lo, table, stats, 0, artDmx(UNIVERSE, 2, 512), t += 25), Arbitration::FORWARD, "Art-Net A keeps");
+
+    // sACN C at 150 takes over from both; D at 50 and A stay behind it
+    expect(deliver(lo, table, stats, 2, e131(0xC, UNIVERSE, 10, 150, 512), t += 25), Arbitration::FORWARD,
+           "sACN 150 over Art-Net");
+    expect(deliver(lo, table, stats, 3, e131(0xD, UNIVERSE, 1, 50, 512), t += 25), Arbitration::STANDBY, "sACN 50");
+    expect(deliver(lo, table, stats, 0, artDmx(UNIVERSE, 3, 512), t += 25), Arbitration::STANDBY, "Art-Net behind sACN");
+    if (stats.sourceSwitches != 2) fail("%u source switches, expected 2", stats.sourceSwitches);
+
+    // Late packets of C are dropped; 20 behind is a restart
+    expect(deliver(lo, table, stats, 2, e131(0xC, UNIVERSE, 11, 150, 512), t += 25), Arbitration::FORWARD, "sACN next");
+    expect(deliver(lo, table, stats, 2, e131(0xC, UNIVERSE, 11, 150, 512), t += 1), Arbitration::OUT_OF_ORDER,
+           "sACN repeat");
+    expect(deliver(lo, table, stats, 2, e131(0xC, UNIVERSE, 11 - 19, 150, 512), t += 1), Arbitration::OUT_OF_ORDER,
+           "sACN 19 behind");
+    expect(deliver(lo, table, stats, 2, e131(0xC, UNIVERSE, 11 - 20, 150, 512), t += 1), Arbitration::FORWARD,
+           "sACN 20 behind");
+    if (stats.outOfOrder != 2) fail("%u out of order, expected 2", stats.outOfOrder);
+
+    // Art-Net sequence 0 = sequencing off, repeats pass
+    expect(deliver(lo, table, stats, 1, artDmx(UNIVERSE, 0, 512), t += 1), Arbitration::STANDBY, "Art-Net B seq 0");
+    expect(deliver(lo, table, stats, 1, artDmx(UNIVERSE, 0, 512), t += 1), Arbitration::STANDBY, "Art-Net B seq 0 again");
+
+    // C terminates: the next packet from anyone takes the output at once
+    expect(deliver(lo, table, stats, 2, e131(0xC, UNIVERSE, 250, 150, 512, 0x40), t += 25), Arbitration::TERMINATED,
+           "sACN terminated");
+    if (table.active != -1) fail("output still held after termination");
+    expect(deliver(lo, table, stats, 3, e131(0xD, UNIVERSE, 2, 50, 512), t += 25), Arbitration::FORWARD,
+           "sACN 50 after termination");
+
+    // C returns and wins, then goes silent: D waits until SOURCE_TIMEOUT_MS
+    expect(deliver(lo, table, stats, 2, e131(0xC, UNIVERSE, 1, 150, 512), t += 25), Arbitration::FORWARD, "sACN 150 back");
+    uint32_t lastC = t;
+    expect(deliver(lo, table, stats, 3, e131(0xD, UNIVERSE, 3, 50, 512), lastC + SOURCE_TIMEOUT_MS), Arbitration::STANDBY,
+           "sACN 50 at the timeout");
+    expect(deliver(lo, table, stats, 3, e131(0xD, UNIVERSE, 4, 50, 512), lastC + SOURCE_TIMEOUT_MS + 1),
+           Arbitration::FORWARD, "sACN 50 past the timeout");
+}
+
+static int usedSources(const SourceTable& table) {
+    int used = 0;
+    for (uint8_t i = 0; i < MAX_SOURCES; i++) {
+        used += table.sources[i].used;
+    }
+    return used;
+}
+
+static void testSourceTable(Loopback& lo) {
+    SourceTable table;
+    Stats stats = {};
+    clearSources(table);
+    uint32_t t = 5000;
+
+    // Four senders fill the table; the first keeps the output
+    expect(deliver(lo, table, stats, 0, artDmx(UNIVERSE, 1, 512), t), Arbitration::FORWARD, "table: Art-Net A");
+    expect(deliver(lo, table, stats, 1, artDmx(UNIVERSE, 1, 512), t + 1), Arbitration::STANDBY, "table: Art-Net B");
+    expect(deliver(lo, table, stats, 2, e131(0xC, UNIVERSE, 1, 100, 512), t + 2), Arbitration::STANDBY, "table: sACN C");
+    expect(deliver(lo, table, stats, 3, e131(0xD, UNIVERSE, 1, 100, 512), t + 3), Arbitration::STANDBY, "table: sACN D");
+    if (usedSources(table) != MAX_SOURCES) fail("%d sources in the table", usedSources(table));
+
+    // A fifth (new CID from A's address) is ignored while all are live
+    expect(deliver(lo, table, stats, 0, e131(0xE, UNIVERSE, 1, 200, 512), t + 10), Arbitration::TABLE_FULL,
+           "table: fifth sender");
+    if (stats.sourcesDropped != 1) fail("%u sources dropped, expected 1", stats.sourcesDropped);
+
+    // Only D keeps sending; once A has been silent past the timeout the fifth
+    // takes its entry and, at priority 200, the output
+    expect(deliver(lo, table, stats, 3, e131(0xD, UNIVERSE, 2, 100, 512), t + 2000), Arbitration::STANDBY,
+           "table: sACN D again");
+    uint32_t later = t + SOURCE_TIMEOUT_MS + 1;
+    expect(deliver(lo, table, stats, 0, e131(0xE, UNIVERSE, 2, 200, 512), later), Arbitration::FORWARD,
+           "table: fifth sender after A went silent");
+
+    // B and C expire as well; D and the newcomer remain
+    expireSources(table, later + 2);
+    if (usedSources(table) != 2) fail("%d sources after expiry, expected 2", usedSources(table));
+    if (table.active < 0 || table.sources[table.active].cid[0] != 0xE) fail("newcomer lost the output on expiry");
+    expireSources(table, later + SOURCE_TIMEOUT_MS + 1);
+    if (usedSources(table) != 0 || table.active != -1) fail("silent sources not released");
+}
+
+int main(int argc, char** argv) {
+    Loopback lo;
+    if (!openLoopback(lo)) {
+        fail("cannot open UDP loopback sockets");
+        return 1;
+    }
+    testFullPackets(lo);
+    testShortPackets(lo);
+    testOtherPackets();
+    testSequenceWindow();
+    testArbitration(lo);
+    testSourceTable(lo);
+    close(lo.receiver);
+    for (int sock : lo.senders) close(sock);
+    if (g_failures == 0) {
+        printf("test_network_dmx: all checks passed\n");
+    }
+    return g_failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,356 @@
+// ============================================================================
+// File: test_step_pulse_gen.cpp
+// Project: SkullStepperV4 - ESP32-S3 Modular Stepper Control System
+// Version: 4.2.0
+// Date: 2026-10-15
+// Author: Tim Rosener
+// Description: Host test - StepPulseGen pulse blocks (RMT step backend)
+// License: MIT
+//
+// Fills blocks the way StepperRmt does and inspects the symbol arrays:
+// - Every step is one pulse, high for 25% of its period (MIN_STEP_PULSE_WIDTH
+//   floor, one symbol half at most), and the next pulse starts one period later
+// - No symbol has a zero half (it would end the RMT transmission)
+// - Blocks hold one direction, at most RMT_BLOCK_SYMBOLS symbols and end
+//   once RMT_BLOCK_MAX_US is reached; reversals start with the DIR setup
+// - Ramps reach the target at the planned speed; raw pauses keep their length
+// Built with STEPPER_BACKEND_RMT (40 kHz ceiling) and without the rig: the
+// generator is pure computation.
+// Usage: test_step_pulse_gen
+// ============================================================================
+
+#include "StepPulseGen.h"
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <vector>
+
+using namespace StepPulseGen;
+
+static const uint32_t MAX_BLOCK_TICKS = RMT_BLOCK_MAX_US * TICKS_PER_US;
+static const uint32_t SETUP_TICKS = RMT_DIR_SETUP_US * TICKS_PER_US;
+
+static int g_failures = 0;
+
+static void fail(const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    printf("FAIL: ");
+    vprintf(format, args);
+    printf("\n");
+    va_end(args);
+    g_failures++;
+}
+
+/**
+ * One pulse as transmitted: start on the global tick line
+ */
+struct Pulse {
+    uint64_t startTicks;
+    uint32_t highTicks;
+    uint32_t periodTicks;
+    int8_t direction;
+    bool firstOfBlock;
+};
+
+struct Run {
+    std::vector<Pulse> pulses;
+    uint32_t blocks;
+    uint64_t durationTicks;
+};
+
+/**
+ * Expected high time for a step period
+ */
+static uint32_t expectedHigh(uint32_t period) {
+    uint32_t high = RMT_PULSE_WIDTH_FROM_PERIOD(period);
+    high = std::max(high, (uint32_t)(MIN_STEP_PULSE_WIDTH * TICKS_PER_US));
+    return std::min(high, (uint32_t)MAX_DURATION);  // One symbol half at most
+}
+
+/**
+ * Check the structure of one block and append its pulses to the run
+ */
+static void collectBlock(const Block& block, Run& run, const char* name) {
+    if (block.count == 0 || block.count > RMT_BLOCK_SYMBOLS) {
+        fail("%s: block with %u symbols", name, block.count);
+    }
+    // A symbol only starts below the block limit; it may run past it
+    if (block.durationTicks > MAX_BLOCK_TICKS + 2UL * MAX_DURATION) {
+        fail("%s: block of %u ticks", name, block.durationTicks);
+    }
+
+    uint32_t at = 0;
+    uint16_t steps = 0;
+    for (uint16_t i = 0; i < block.count; i++) {
+        uint32_t symbol = block.symbols[i];
+        uint32_t d0 = symbol & MAX_DURATION;
+        uint32_t d1 = (symbol >> 16) & MAX_DURATION;
+        bool l0 = (symbol >> 15) & 1;
+        bool l1 = (symbol >> 31) & 1;
+        if (d0 == 0 || d1 == 0) {
+            fail("%s: symbol %u has a zero half", name, i);
+        }
+        if (l1 || (l0 && !isPulse(symbol))) {
+            fail("%s: symbol %u is not high-low or low-low", name, i);
+        }
+        if (block.startTicks[i] != at) {
+            fail("%s: symbol %u starts at %u, durations sum to %u", name, i, block.startTicks[i], at);
+        }
+        if (l0) {
+            if (block.direction == 0) {
+                fail("%s: pulses without a direction", name);
+            }
+            Pulse pulse = {run.durationTicks + at, d0, block.periodTicks[i], block.direction, steps == 0};
+            run.pulses.push_back(pulse);
+            steps++;
+        }
+        at += d0 + d1;
+    }
+    if (at != block.durationTicks || steps != block.steps) {
+        fail("%s: block says %u ticks / %u steps, symbols hold %u / %u",
+             name, block.durationTicks, block.steps, at, steps);
+    }
+    if (stepsStarted(block, block.durationTicks) != block.steps) {
+        fail("%s: stepsStarted() at the block end is %u of %u", name,
+             stepsStarted(block, block.durationTicks), block.steps);
+    }
+    run.durationTicks += block.durationTicks;
+    run.blocks++;
+}
+
+/**
+ * Fill blocks until the generator is idle
+ */
+static Run drain(Generator& gen, const char* name) {
+    Run run = {};
+    static Block block;
+    while (hasWork(gen) && run.blocks < 100000) {
+        if (!fillBlock(gen, block)) {
+            break;
+        }
+        collectBlock(block, run, name);
+    }
+    return run;
+}
+
+/**
+ * Pulse widths and spacing: each pulse is high for 25% of its period and
+ * the next one starts a period later (or later, where gaps are allowed)
+ */
+static void checkPulses(const Run& run, const char* name, bool allowGaps) {
+    for (size_t i = 0; i < run.pulses.size(); i++) {
+        const Pulse& pulse = run.pulses[i];
+        if (pulse.highTicks != expectedHigh(pulse.periodTicks)) {
+            fail("%s: pulse %zu high %u ticks, period %u", name, i, pulse.highTicks, pulse.periodTicks);
+            return;
+        }
+        if (pulse.periodTicks < MIN_STEP_PERIOD * TICKS_PER_US) {
+            fail("%s: pulse %zu period %u below MIN_STEP_PERIOD", name, i, pulse.periodTicks);
+            return;
+        }
+        if (i + 1 < run.pulses.size()) {
+            uint64_t spacing = run.pulses[i + 1].startTicks - pulse.startTicks;
+            if (spacing != pulse.periodTicks && !(allowGaps && spacing > pulse.periodTicks)) {
+                fail("%s: pulse %zu spacing %llu, period %u", name, i,
+                     (unsigned long long)spacing, pulse.periodTicks);
+                return;
+            }
+        }
+    }
+}
+
+static void newGenerator(Generator& gen, float maxSpeed, float accel) {
+    reset(gen, 0);
+    gen.maxSpeed = maxSpeed;
+    gen.accel = accel;
+}
+
+static stepper_command_s rawCommand(uint32_t hz, uint8_t steps, bool up) {
+    stepper_command_s cmd = {(uint16_t)(TICKS_PER_S / hz), steps, up};
+    return cmd;
+}
+
+static void testRawStream() {
+    // 200 steps at 10 kHz, then 200 at the 40 kHz ceiling
+    static const uint32_t RATES[] = {10000, MAX_STEP_FREQUENCY};
+    for (uint32_t hz : RATES) {
+        Generator gen;
+        newGenerator(gen, 1000.0f, 1000.0f);
+        stepper_command_s cmd = rawCommand(hz, 100, true);
+        addQueueEntry(gen, cmd);
+        addQueueEntry(gen, cmd);
+        Run run = drain(gen, "raw stream");
+        uint32_t period = TICKS_PER_SECOND / hz;
+        if (run.pulses.size() != 200 || gen.position != 200) {
+            fail("raw %u Hz: %zu pulses, position %d", hz, run.pulses.size(), gen.position);
+        }
+        checkPulses(run, "raw stream", false);
+        if (!run.pulses.empty() && run.pulses[0].periodTicks != period) {
+            fail("raw %u Hz: period %u ticks, expected %u", hz, run.pulses[0].periodTicks, period);
+        }
+        printf("raw %5u Hz: %zu pulses in %u blocks, high %u of %u ticks (%.1f%% duty)\n",
+               hz, run.pulses.size(), run.blocks, run.pulses[0].highTicks, period,
+               100.0 * run.pulses[0].highTicks / period);
+    }
+}
+
+static void testRamp() {
+    const float maxSpeed = MAX_STEP_FREQUENCY;
+    const float accel = 400000.0f;
+    const int32_t distance = 5000;  // Cruises for 1000 steps
+    Generator gen;
+    newGenerator(gen, maxSpeed, accel);
+    moveTo(gen, distance);
+    Run run = drain(gen, "ramp");
+    if ((int32_t)run.pulses.size() != distance || gen.position != distance || gen.rampActive) {
+        fail("ramp: %zu pulses, ended at %d", run.pulses.size(), gen.position);
+    }
+    checkPulses(run, "ramp", false);
+
+    uint32_t shortest = UINT32_MAX;
+    for (const Pulse& pulse : run.pulses) {
+        shortest = std::min(shortest, pulse.periodTicks);
+        if (pulse.direction != 1) {
+            fail("ramp: pulse in the wrong direction");
+            break;
+        }
+    }
+    if (shortest != MIN_STEP_PERIOD * TICKS_PER_US) {
+        fail("ramp: shortest period %u ticks, cruise is %u", shortest, MIN_STEP_PERIOD * TICKS_PER_US);
+    }
+    double expectedTicks = (distance / maxSpeed + maxSpeed / accel) * TICKS_PER_SECOND;
+    double endTicks = (double)(run.pulses.back().startTicks + run.pulses.back().periodTicks);
+    if (fabs(endTicks - expectedTicks) > 0.005 * expectedTicks) {
+        fail("ramp: last step ends at %.0f ticks, trapezoid %.0f", endTicks, expectedTicks);
+    }
+    printf("ramp %d steps: %u blocks, last step ends at %.3f ms (trapezoid %.3f ms)\n",
+           distance, run.blocks, endTicks / (TICKS_PER_US * 1000.0), expectedTicks / (TICKS_PER_US * 1000.0));
+}
+
+static void testReversal() {
+    Generator gen;
+    newGenerator(gen, 10000.0f, 50000.0f);
+    moveTo(gen, 2000);
+    Run run = {};
+    static Block block;
+    for (int i = 0; i < 5 && fillBlock(gen, block); i++) {
+        collectBlock(block, run, "reversal");
+    }
+    int32_t turnedAt = gen.position;
+    moveTo(gen, -500);
+    Run rest = drain(gen, "reversal");
+    for (Pulse pulse : rest.pulses) {
+        pulse.startTicks += run.durationTicks;
+        run.pulses.push_back(pulse);
+    }
+    if (gen.position != -500) {
+        fail("reversal: ended at %d", gen.position);
+    }
+    checkPulses(run, "reversal", true);
+
+    // The first pulse after the turn waits out the DIR setup in its block
+    int32_t forward = 0, backward = 0;
+    bool setupSeen = false;
+    for (size_t i = 0; i < run.pulses.size(); i++) {
+        (run.pulses[i].direction > 0 ? forward : backward)++;
+        if (i > 0 && run.pulses[i].direction != run.pulses[i - 1].direction) {
+            if (!run.pulses[i].firstOfBlock) {
+                fail("reversal: direction changes inside a block");
+            }
+            setupSeen = true;
+        }
+    }
+    if (!setupSeen || forward - backward != -500) {
+        fail("reversal: %d forward, %d back (turned at %d)", forward, backward, turnedAt);
+    }
+    // Re-fill the turn to see its lead-in
+    Generator turn;
+    newGenerator(turn, 1000.0f, 1000.0f);
+    stepper_command_s up = rawCommand(10000, 10, true);
+    stepper_command_s down = rawCommand(10000, 10, false);
+    addQueueEntry(turn, up);
+    addQueueEntry(turn, down);
+    fillBlock(turn, block);
+    fillBlock(turn, block);
+    if (block.direction != -1 || block.count < 2 || isPulse(block.symbols[0]) ||
+        block.startTicks[1] < SETUP_TICKS) {
+        fail("reversal: block after the turn does not start with %u ticks low", SETUP_TICKS);
+    }
+}
+
+static void testSlowSteps() {
+    // Periods beyond one symbol half (MAX_DURATION) continue as pauses
+    Generator gen;
+    newGenerator(gen, 20.0f, 20.0f);
+    moveTo(gen, 5);
+    Run run = drain(gen, "slow");
+    if (run.pulses.size() != 5 || gen.position != 5) {
+        fail("slow: %zu pulses, ended at %d", run.pulses.size(), gen.position);
+    }
+    checkPulses(run, "slow", false);
+    uint32_t longest = 0;
+    for (const Pulse& pulse : run.pulses) {
+        longest = std::max(longest, pulse.periodTicks);
+    }
+    if (longest <= MAX_DURATION) {
+        fail("slow: longest period %u ticks does not exercise the pauses", longest);
+    }
+}
+
+static void testRawPause() {
+    // 10 steps, a 2.5 ms pause entry, 10 steps
+    Generator gen;
+    newGenerator(gen, 1000.0f, 1000.0f);
+    stepper_command_s steps = rawCommand(10000, 10, true);
+    stepper_command_s pause = {(uint16_t)(TICKS_PER_S / 400), 0, true};
+    addQueueEntry(gen, steps);
+    addQueueEntry(gen, pause);
+    addQueueEntry(gen, steps);
+    Run run = drain(gen, "raw pause");
+    if (run.pulses.size() != 20) {
+        fail("raw pause: %zu pulses", run.pulses.size());
+        return;
+    }
+    checkPulses(run, "raw pause", true);
+    uint64_t gap = run.pulses[10].startTicks - run.pulses[9].startTicks;
+    uint64_t expected = run.pulses[9].periodTicks + TICKS_PER_SECOND / 400;
+    if (gap != expected) {
+        fail("raw pause: gap %llu ticks, expected %llu", (unsigned long long)gap, (unsigned long long)expected);
+    }
+}
+
+static void testPlayback() {
+    Generator gen;
+    newGenerator(gen, 1000.0f, 1000.0f);
+    stepper_command_s cmd = rawCommand(10000, 8, true);
+    addQueueEntry(gen, cmd);
+    Block block;
+    fillBlock(gen, block);
+    uint32_t period = TICKS_PER_SECOND / 10000;
+    uint32_t first = block.startTicks[1];  // After the DIR setup of the first move
+    if (isPulse(block.symbols[0]) || stepsStarted(block, first - 1) != 0 ||
+        stepsStarted(block, first) != 1 || stepsStarted(block, first + period - 1) != 1 ||
+        stepsStarted(block, first + period) != 2 || stepsStarted(block, first + 7 * period) != 8) {
+        fail("playback: stepsStarted() does not follow the pulse starts");
+    }
+    if (periodAt(block, 1) != 0 || periodAt(block, first + 3 * period + 1) != period ||
+        periodAt(block, block.durationTicks) != 0) {
+        fail("playback: periodAt() wrong");
+    }
+}
+
+int main(int argc, char** argv) {
+    testRawStream();
+    testRamp();
+    testReversal();
+    testSlowSteps();
+    testRawPause();
+    testPlayback();
+    if (g_failures == 0) {
+        printf("test_step_pulse_gen: all checks passed\n");
+    }
+    return g_failures == 0 ? 0 : 1;
+}
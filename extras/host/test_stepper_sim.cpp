@@ -0,0 +1,123 @@
+// ============================================================================
+// File: test_stepper_sim.cpp
+// Project: SkullStepperV4 - ESP32-S3 Modular Stepper Control System
+// Version: 4.2.0
+// Date: 2026-10-15
+// Author: Tim Rosener
+// Description: Host test - StepperSim rig on the 2-axis build
+// License: MIT
+//
+// Checks the rig itself, without the controller task:
+// - Every axis' step pin connects its own stepper, once
+// - Limit and ALARM inputs follow the axis' row of STEPPER_AXIS_PINS
+// - Relative moves queued behind raw commands start from the queue end
+// ============================================================================
+
+#include "SimHarness.h"
+#include "HardwareConfig.h"
+
+// Same table StepperController and StepperSim build from HardwareConfig.h
+struct AxisPins {
+    uint8_t step;
+    uint8_t dir;
+    uint8_t enable;
+    uint8_t alarm;
+    uint8_t leftLimit;
+    uint8_t rightLimit;
+};
+static const AxisPins AXIS_PINS[STEPPER_AXIS_COUNT] = STEPPER_AXIS_PINS;
+
+static_assert(STEPPER_AXIS_COUNT == 2, "test_stepper_sim runs on the 2-axis library");
+
+static uint32_t g_rightEdges = 0;
+
+static void countEdge(void* arg) {
+    g_rightEdges++;
+}
+
+static void testConnect(StepperSim::Engine& engine) {
+    StepperSim::Stepper* first = engine.stepperConnectToPin(AXIS_PINS[0].step);
+    StepperSim::Stepper* second = engine.stepperConnectToPin(AXIS_PINS[1].step);
+    if (!first || !second || first == second) {
+        SimHarness::fail("each step pin must connect its own stepper");
+        return;
+    }
+    if (StepperSim::getStepper(0) != first || StepperSim::getStepper(1) != second) {
+        SimHarness::fail("getStepper() does not return the connected steppers");
+    }
+    if (engine.stepperConnectToPin(AXIS_PINS[1].step) != nullptr) {
+        SimHarness::fail("a step pin connected twice");
+    }
+    if (engine.stepperConnectToPin(AXIS_PINS[0].dir) != nullptr) {
+        SimHarness::fail("a non-step pin connected a stepper");
+    }
+}
+
+static void testPins() {
+    StepperSim::configureRig(0, 0, 1000, 10, 500);
+    StepperSim::configureRig(1, 0, 1000, 10, -5);
+    if (StepperSim::readPin(AXIS_PINS[1].leftLimit) != LOW ||
+        StepperSim::readPin(AXIS_PINS[0].leftLimit) != HIGH) {
+        SimHarness::fail("left switch of axis 1 not on its own pin");
+    }
+
+    StepperSim::setAlarm(1, true);
+    if (StepperSim::readPin(AXIS_PINS[1].alarm) != LOW ||
+        StepperSim::readPin(AXIS_PINS[0].alarm) != HIGH) {
+        SimHarness::fail("ALARM of axis 1 not on its own pin");
+    }
+    StepperSim::setAlarm(1, false);
+
+    // Drive axis 1 into its right switch - only its handler fires
+    StepperSim::attachPinChange(AXIS_PINS[1].rightLimit, countEdge, nullptr);
+    StepperSim::Stepper* stepper = StepperSim::getStepper(1);
+    stepper->enableOutputs();
+    stepper->setSpeedInHz(5000);
+    stepper->setAcceleration(50000);
+    stepper->moveTo(1100);
+    StepperSim::advance(1000000);
+    if (StepperSim::readPin(AXIS_PINS[1].rightLimit) != LOW ||
+        StepperSim::readPin(AXIS_PINS[0].rightLimit) != HIGH || g_rightEdges != 1) {
+        SimHarness::fail("right switch of axis 1: pin %d, axis 0 pin %d, %u edges",
+                         StepperSim::readPin(AXIS_PINS[1].rightLimit),
+                         StepperSim::readPin(AXIS_PINS[0].rightLimit), g_rightEdges);
+    }
+}
+
+static void testMoveAfterQueue() {
+    StepperSim::configureRig(0, -100000, 100000, 10, 0);
+    StepperSim::Stepper* stepper = StepperSim::getStepper(0);
+    stepper->enableOutputs();
+    stepper->setSpeedInHz(5000);
+    stepper->setAcceleration(50000);
+    stepper->setCurrentPosition(0);
+
+    // 100 steps at 1 kHz, then a relative move of 10
+    stepper_command_s cmd = { (uint16_t)(TICKS_PER_S / 1000), 100, true };
+    if (stepper->addQueueEntry(&cmd) != AQE_OK) {
+        SimHarness::fail("raw command rejected");
+        return;
+    }
+    stepper->move(10);
+    if (stepper->targetPos() != 110) {
+        SimHarness::fail("move(10) after 100 queued steps targets %d, expected 110", stepper->targetPos());
+    }
+    StepperSim::advance(1000000);
+    if (stepper->isRunning() || stepper->getCurrentPosition() != 110) {
+        SimHarness::fail("ended at %d, expected 110", stepper->getCurrentPosition());
+    }
+}
+
+int main(int argc, char** argv) {
+    StepperSim::Engine engine;
+    testConnect(engine);
+    if (SimHarness::exitCode() != 0) {
+        return SimHarness::exitCode();
+    }
+    testPins();
+    testMoveAfterQueue();
+    if (SimHarness::exitCode() == 0) {
+        printf("test_stepper_sim: all checks passed\n");
+    }
+    return SimHarness::exitCode();
+}
@@ -0,0 +1,87 @@
+// ============================================================================
+// File: trace_dump.cpp
+// Project: SkullStepperV4 - ESP32-S3 Modular Stepper Control System
+// Version: 4.2.0
+// Date: 2026-10-15
+// Author: Tim Rosener
+// Description: Host tool - record a motion trace on the rig and dump it
+// License: MIT
+//
+// Homes, runs a few moves and drives into a switch, then writes the
+// MotionTrace dump (the GET /api/trace bytes) to a file. ctest feeds the
+// file to scripts/utils/trace_to_chrome.py so the decoder follows the
+// dump layout in MotionTrace.h.
+// Usage: trace_dump <file> [-v]
+// ============================================================================
+
+#include "SimHarness.h"
+#include "StepperController.h"
+#include "SystemConfig.h"
+#include "MotionTrace.h"
+
+static const int32_t LEFT_SWITCH = 0;
+static const int32_t RIGHT_SWITCH = 6000;
+static const int32_t SWITCH_HYSTERESIS = 20;
+static const int32_t START_POSITION = 2500;
+
+static bool moveAndWait(int32_t target) {
+    StepperController::moveTo(target);
+    return SimHarness::runUntil([target] {
+        return !StepperController::isMoving() && StepperController::getCurrentPosition() == target;
+    }, 10000000UL) != UINT32_MAX;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: trace_dump <file> [-v]\n");
+        return 2;
+    }
+    bool verbose = (argc > 2 && strcmp(argv[2], "-v") == 0);
+    StepperSim::configureRig(0, LEFT_SWITCH, RIGHT_SWITCH, SWITCH_HYSTERESIS, START_POSITION);
+    if (!SimHarness::boot(verbose)) {
+        return SimHarness::exitCode();
+    }
+    MotionTrace::clear();
+    if (SimHarness::home(true) == UINT32_MAX) {
+        SimHarness::fail("homing did not complete");
+        return SimHarness::exitCode();
+    }
+    SystemConfig* config = SystemConfigMgr::getConfig();
+    int32_t minPos = 0, maxPos = 0;
+    StepperController::getPositionLimits(minPos, maxPos);
+    config->minPosition = minPos;
+    config->maxPosition = maxPos;
+
+    if (!moveAndWait(minPos + 500) || !moveAndWait(maxPos - 500) || !moveAndWait((minPos + maxPos) / 2)) {
+        SimHarness::fail("move did not arrive");
+    }
+
+    // Pull the right switch into range for a limit stop
+    int32_t carriage = StepperSim::getStepper(0)->carriagePosition();
+    StepperSim::configureRig(0, LEFT_SWITCH, carriage + 300, SWITCH_HYSTERESIS, carriage);
+    StepperController::moveTo(maxPos);
+    if (SimHarness::runUntil([] { return StepperController::isLimitFaultActive(); }, 2000000) == UINT32_MAX) {
+        SimHarness::fail("limit stop never happened");
+    }
+    StepperSim::runFor(100000);
+
+    MotionTrace::Summary summary;
+    MotionTrace::getSummary(summary);
+    uint8_t* blob = (uint8_t*)malloc(MotionTrace::maxDumpSize());
+    size_t length = MotionTrace::dump(blob, MotionTrace::maxDumpSize());
+    FILE* file = fopen(argv[1], "wb");
+    if (file == nullptr || fwrite(blob, 1, length, file) != length) {
+        SimHarness::fail("cannot write %s", argv[1]);
+    }
+    if (file != nullptr) {
+        fclose(file);
+    }
+    free(blob);
+
+    SimHarness::report("trace.events", summary.held, "");
+    SimHarness::report("trace.bytes", length, "B");
+    if (summary.held == 0 || length != TRACE_HEADER_SIZE + summary.held * sizeof(MotionTrace::Record)) {
+        SimHarness::fail("dump of %u bytes for %u events", (unsigned)length, summary.held);
+    }
+    return SimHarness::exitCode();
+}
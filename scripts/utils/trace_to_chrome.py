@@ -0,0 +1,190 @@
+#!/usr/bin/env python3
+
+# ============================================================================
+# File: trace_to_chrome.py
+# Project: SkullStepperV4 - ESP32-S3 Modular Stepper Control System
+# Description: Convert a motion trace dump to Chrome trace-event JSON
+# Author: Tim Rosener
+# Version: 4.2.0
+# ============================================================================
+#
+# Reads the dump written by TRACE DUMP (serial hex, with or without the
+# TRACE BEGIN/END lines, or the JSON {"trace": "..."} reply) or GET
+# /api/trace (raw bytes) and writes a trace for chrome://tracing or
+# https://ui.perfetto.dev. Layout as documented in MotionTrace.h:
+#   Header 16 bytes: "SKTR", version, event size, count, dump micros(), overwritten
+#   Events 12 bytes: micros(), event, arg, command id, value
+#
+# Tracks: ramp phases, homing phases and DMX modes as slices; commands,
+# move starts, limit edges, force stops and queue overflows as instants;
+# the positions carried by the events as a counter.
+#
+# Usage: trace_to_chrome.py <dump> [-o trace.json]
+#        curl http://<device>/api/trace | trace_to_chrome.py - > trace.json
+# ============================================================================
+
+import argparse
+import json
+import re
+import struct
+import sys
+
+MAGIC = b"SKTR"
+FORMAT_VERSION = 1
+HEADER = struct.Struct("<4sBBHII")
+RECORD = struct.Struct("<IBBHi")
+
+# Enum names, in declaration order (GlobalInterface.h, StepperController.cpp,
+# DMXReceiver.h, MotionTrace.h)
+EVENTS = ["command", "moveStart", "rampPhase", "limitEdge",
+          "forceStop", "homingPhase", "dmxMode", "queueOverflow"]
+COMMAND_TYPES = ["MOVE_ABSOLUTE", "MOVE_RELATIVE", "SET_SPEED", "SET_ACCELERATION",
+                 "HOME", "STOP", "EMERGENCY_STOP", "ENABLE", "DISABLE",
+                 "FOLLOW_TARGET", "PATH_APPEND", "PATH_START", "PATH_CLEAR",
+                 "CUE_PLAY", "MOVE_COORDINATED"]
+MOTION_STATES = ["IDLE", "ACCELERATING", "CONSTANT_VELOCITY", "DECELERATING",
+                 "HOMING", "POSITION_HOLD"]
+HOMING_STATES = ["IDLE", "FINDING_LEFT", "BACKING_OFF_LEFT", "REAPPROACH_LEFT",
+                 "FINDING_RIGHT", "BACKING_OFF_RIGHT", "REAPPROACH_RIGHT",
+                 "MOVING_TO_CENTER", "COMPLETE", "ERROR"]
+DMX_MODES = ["STOP", "CONTROL", "CUE", "HOME"]
+
+# Track (thread) per kind of event
+TRACKS = {"Commands": 1, "Motion": 2, "Homing": 3, "Limits": 4, "DMX": 5}
+PID = 1
+
+
+def name_of(table, index):
+    return table[index] if index < len(table) else "#%d" % index
+
+
+def load_blob(data):
+    """Raw dump, or any text with the dump as one run of hex digits"""
+    if data[:4] == MAGIC:
+        return data
+    text = data.decode("ascii", errors="replace")
+    text = re.sub(r"TRACE (BEGIN \d+|END)", "", text)
+    digits = "".join(re.findall(r"[0-9a-fA-F]+", text))
+    start = digits.find(MAGIC.hex())
+    if start < 0:
+        raise ValueError("no SKTR dump found")
+    digits = digits[start:]
+    return bytes.fromhex(digits[:len(digits) & ~1])
+
+
+def parse(blob):
+    """Header fields and the event records, oldest first"""
+    if len(blob) < HEADER.size:
+        raise ValueError("dump shorter than the %d-byte header" % HEADER.size)
+    magic, version, size, count, dump_us, overwritten = HEADER.unpack_from(blob)
+    if magic != MAGIC:
+        raise ValueError("bad magic %r" % magic)
+    if version != FORMAT_VERSION or size != RECORD.size:
+        raise ValueError("format version %d, event size %d not supported" % (version, size))
+    if len(blob) < HEADER.size + count * size:
+        raise ValueError("dump holds %d of %d events" % ((len(blob) - HEADER.size) // size, count))
+    records = [RECORD.unpack_from(blob, HEADER.size + i * size) for i in range(count)]
+    return dump_us, overwritten, records
+
+
+def convert(dump_us, overwritten, records):
+    """Chrome trace-event JSON object"""
+    # micros() wraps - place every event by its age at dump time, oldest at 0
+    ages = [(dump_us - r[0]) & 0xFFFFFFFF for r in records]
+    origin = max(ages) if ages else 0
+    end_ts = origin
+
+    events = [{"ph": "M", "pid": PID, "name": "process_name", "args": {"name": "SkullStepperV4"}}]
+    for track, tid in TRACKS.items():
+        events.append({"ph": "M", "pid": PID, "tid": tid, "name": "thread_name", "args": {"name": track}})
+        events.append({"ph": "M", "pid": PID, "tid": tid, "name": "thread_sort_index", "args": {"sort_index": tid}})
+
+    open_slices = {}  # track -> (name, ts, args)
+
+    def instant(track, ts, name, args):
+        events.append({"ph": "i", "s": "t", "pid": PID, "tid": TRACKS[track],
+                       "ts": ts, "name": name, "args": args})
+
+    def slice_to(track, ts, name, args):
+        """Close the open slice on the track at ts and open the next one (name None = none)"""
+        previous = open_slices.pop(track, None)
+        if previous is not None:
+            events.append({"ph": "X", "pid": PID, "tid": TRACKS[track], "ts": previous[1],
+                           "dur": max(ts - previous[1], 0), "name": previous[0], "args": previous[2]})
+        if name is not None:
+            open_slices[track] = (name, ts, args)
+
+    def position(ts, value):
+        events.append({"ph": "C", "pid": PID, "ts": ts, "name": "position", "args": {"steps": value}})
+
+    for (time_us, event, arg, cmd_id, value), age in zip(records, ages):
+        ts = origin - age
+        kind = name_of(EVENTS, event)
+        if kind in ("command", "moveStart", "queueOverflow"):
+            command = name_of(COMMAND_TYPES, arg)
+            instant("Motion" if kind == "moveStart" else "Commands", ts, "%s %s" % (kind, command),
+                    {"id": cmd_id, "target": value})
+        elif kind == "rampPhase":
+            state = name_of(MOTION_STATES, arg)
+            slice_to("Motion", ts, None if state == "IDLE" else state, {"position": value})
+            position(ts, value)
+        elif kind == "homingPhase":
+            state = name_of(HOMING_STATES, arg)
+            done = state in ("IDLE", "COMPLETE", "ERROR")
+            slice_to("Homing", ts, None if done else state, {"position": value})
+            if done:
+                instant("Homing", ts, "homing %s" % state, {"position": value})
+            position(ts, value)
+        elif kind == "limitEdge":
+            side = "right" if arg & 1 else "left"
+            edge = "active" if arg & 2 else "released"
+            instant("Limits", ts, "%s %s" % (side, edge), {"position": value})
+        elif kind == "forceStop":
+            instant("Limits", ts, "forceStop", {"position": value})
+            position(ts, value)
+        elif kind == "dmxMode":
+            slice_to("DMX", ts, name_of(DMX_MODES, arg), {"previous": name_of(DMX_MODES, value)})
+        else:
+            instant("Commands", ts, kind, {"arg": arg, "id": cmd_id, "value": value})
+
+    # Whatever is still running ends at the dump
+    for track in list(open_slices):
+        slice_to(track, end_ts, None, None)
+
+    return {
+        "traceEvents": events,
+        "displayTimeUnit": "ms",
+        "otherData": {"events": len(records), "overwritten": overwritten, "dumpMicros": dump_us},
+    }
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert a SkullStepperV4 motion trace dump to Chrome trace JSON")
+    parser.add_argument("dump", help="TRACE DUMP output or /api/trace bytes ('-' = stdin)")
+    parser.add_argument("-o", "--output", help="JSON file (default stdout)")
+    args = parser.parse_args()
+
+    if args.dump == "-":
+        data = sys.stdin.buffer.read()
+    else:
+        with open(args.dump, "rb") as f:
+            data = f.read()
+    try:
+        trace = convert(*parse(load_blob(data)))
+    except ValueError as e:
+        sys.stderr.write("trace_to_chrome: %s\n" % e)
+        return 1
+
+    text = json.dumps(trace, indent=1)
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text + "\n")
+    sys.stderr.write("trace_to_chrome: %d events (%d overwritten)\n"
+                     % (trace["otherData"]["events"], trace["otherData"]["overwritten"]))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -15,6 +15,8 @@
 #include "StepperController.h"
 #include "SerialInterface.h"
 #include "SystemConfig.h"
+#include "CueEngine.h"      // Keyframe cue storage
+#include "CoreLog.h"        // Lock-free logging for the Core 0 tasks
 #include "ProjectConfig.h"  // Global project configuration
 #include <esp_task_wdt.h>   // ESP32 Task Watchdog Timer
 
@@ -25,6 +27,8 @@
 #endif
 
 #include "DMXReceiver.h"  // DMX512 input module
+#include "DMXPersonality.h"  // DMX channel layouts
+#include "NetworkDMX.h"  // Art-Net / sACN input
 
 // Forward declaration of global infrastructure function
 bool initializeGlobalInfrastructure();
@@ -76,6 +80,11 @@ void setup() {
     }
   }
   
+  // Deferred logging for the Core 0 tasks - start before any of them run
+  if (!CoreLog::initialize()) {
+    Serial.println("WARNING: Core log initialization failed - Core 0 messages will be dropped");
+  }
+  
   Serial.println("✓ Thread-safe infrastructure ready");
   Serial.println("✓ FreeRTOS mutexes and queues created");
   Serial.println("✓ Memory-safe data structures initialized");
@@ -134,10 +143,20 @@ void setup() {
   Serial.println("✓ CL57Y ALARM monitoring active");
   Serial.println("✓ Thread-safe motion command queue ready");
   
+  if (!CueEngine::initialize()) {
+    Serial.println("WARNING: Cue engine initialization failed");
+    Serial.println("Keyframe cues will not be available");
+  } else {
+    Serial.println("✓ Keyframe cue store ready");
+  }
+  
   // ========================================================================
   // STEP 5: Initialize DMXReceiver (Phase 6 Development)
   // ========================================================================
   Serial.println("\nSTEP 5: Initializing DMX receiver...");
+  if (!DMXPersonality::initialize()) {
+    Serial.println("WARNING: DMX personality store initialization failed");
+  }
   if (!DMXReceiver::initialize()) {
     Serial.println("WARNING: DMX receiver initialization failed");
     Serial.println("DMX control will not be available");
@@ -145,7 +164,8 @@ void setup() {
     Serial.println("✓ ESP32S3DMX library initialized");
     Serial.println("✓ Core 0 DMX task running");
     Serial.println("✓ DMX signal monitoring active");
-    Serial.println("✓ 5-channel configuration ready");
+    Serial.printf("✓ DMX personality %d ready (%d channels)\n",
+                  DMXReceiver::getPersonalitySlot(), DMXReceiver::getFootprint());
   }
   
   // ========================================================================
@@ -160,6 +180,14 @@ void setup() {
   Serial.println("✓ Connect to WiFi: SkullStepper (open network)");
   #endif
   
+  #ifdef ENABLE_NETWORK_DMX
+  if (NetworkDMX::initialize()) {
+    Serial.printf("✓ Art-Net/sACN receiver started (UDP %d/%d)\n", NetworkDMX::ARTNET_PORT, NetworkDMX::SACN_PORT);
+  } else {
+    Serial.println("WARNING: Network DMX receiver failed to start");
+  }
+  #endif
+  
   // ========================================================================
   // STEP 7: Validate System Integrity
   // ========================================================================
@@ -288,6 +316,9 @@ void loop() {
   // This handles ALL commands: human-readable, JSON API, skull> prompt, etc.
   SerialInterface::update();
   
+  // Flash writes requested by the Core 0 task (homing calibration, limits)
+  StepperController::flushPendingSaves();
+  
   // Update web interface if enabled
   #ifdef ENABLE_WEB_INTERFACE
   WebInterface::getInstance().update();